@@ -41,6 +41,20 @@ ifneq ($(FORCE_LAYOUT),)
     TARGET := $(TARGET)_$(FORCE_LAYOUT)
 endif
 
+# Per-role split builds: compile the firmware for one fixed half role so the
+# other role's code paths constant-fold away and get discarded by the linker.
+ifneq ($(strip $(SPLIT_ROLE)),)
+    ifeq ($(filter $(strip $(SPLIT_ROLE)),master slave),)
+        $(call CATASTROPHIC_ERROR,Invalid SPLIT_ROLE,SPLIT_ROLE="$(SPLIT_ROLE)" must be either "master" or "slave")
+    endif
+    TARGET := $(TARGET)_$(strip $(SPLIT_ROLE))
+    ifeq ($(strip $(SPLIT_ROLE)),master)
+        OPT_DEFS += -DSPLIT_ROLE_MASTER
+    else
+        OPT_DEFS += -DSPLIT_ROLE_SLAVE
+    endif
+endif
+
 # Object files and generated keymap directory
 #     To put object files in current directory, use a dot (.), do NOT make
 #     this an empty or blank macro!
@@ -419,6 +433,21 @@ VPATH += $(KEYMAP_OUTPUT)/src
 
 include $(BUILDDEFS_PATH)/common_features.mk
 include $(BUILDDEFS_PATH)/generic_features.mk
+
+# Compile the per-event dispatch chain as a single translation unit, so the
+# process_* handlers inline into process_record_quantum() without LTO.
+ifeq ($(strip $(DISPATCH_UNITY_ENABLE)), yes)
+    OPT_DEFS += -DDISPATCH_UNITY
+    DISPATCH_UNITY_SRC := $(QUANTUM_DIR)/quantum.c $(filter $(QUANTUM_DIR)/process_keycode/%,$(SRC))
+    SRC := $(filter-out $(DISPATCH_UNITY_SRC),$(SRC)) $(KEYMAP_OUTPUT)/src/process_dispatch.c
+
+$(KEYMAP_OUTPUT)/src/process_dispatch.c: $(DISPATCH_UNITY_SRC)
+	@$(SILENT) || printf "$(MSG_GENERATING) $@" | $(AWK_CMD)
+	$(eval CMD=mkdir -p $(KEYMAP_OUTPUT)/src && printf '\#include "%s"\n' $(abspath $(DISPATCH_UNITY_SRC)) > $@)
+	@$(BUILD_CMD)
+
+generated-files: $(KEYMAP_OUTPUT)/src/process_dispatch.c
+endif
 include $(TMK_PATH)/protocol.mk
 include $(PLATFORM_PATH)/common.mk
 
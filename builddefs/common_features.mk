@@ -25,6 +25,7 @@ QUANTUM_SRC += \
     $(QUANTUM_DIR)/keyboard.c \
     $(QUANTUM_DIR)/keymap_common.c \
     $(QUANTUM_DIR)/keycode_config.c \
+    $(QUANTUM_DIR)/keycode_class.c \
     $(QUANTUM_DIR)/sync_timer.c \
     $(QUANTUM_DIR)/logging/debug.c \
     $(QUANTUM_DIR)/logging/sendchar.c \
@@ -37,6 +38,45 @@ else
     include $(PLATFORM_PATH)/$(PLATFORM_KEY)/printf.mk
 endif
 
+ifeq ($(strip $(TASK_ACCOUNTING_ENABLE)), yes)
+    OPT_DEFS += -DTASK_ACCOUNTING_ENABLE
+    SRC += $(QUANTUM_DIR)/task_accounting.c
+    # Uses the benchmark module's calibrated cycle counter.
+    BENCHMARK_ENABLE := yes
+endif
+
+ifeq ($(strip $(TELEMETRY_COUNTERS_ENABLE)), yes)
+    OPT_DEFS += -DTELEMETRY_COUNTERS_ENABLE
+    SRC += $(QUANTUM_DIR)/telemetry_counters.c
+    # Checkpoint slots are validated with the shared CRC8.
+    CRC_ENABLE := yes
+endif
+
+ifeq ($(strip $(POWER_TELEMETRY_ENABLE)), yes)
+    OPT_DEFS += -DPOWER_TELEMETRY_ENABLE
+    SRC += $(QUANTUM_DIR)/power_telemetry.c
+    # VBAT/current-sense sampling goes through the platform ADC driver.
+    OPT_DEFS += -DSTM32_ADC -DHAL_USE_ADC=TRUE
+    QUANTUM_LIB_SRC += analog.c
+endif
+
+ifeq ($(strip $(DEFERRED_LOGGING_ENABLE)), yes)
+    OPT_DEFS += -DDEFERRED_LOGGING_ENABLE
+    SRC += $(QUANTUM_DIR)/logging/deferred_logging.c
+    CONSOLE_ENABLE = yes
+endif
+
+ifeq ($(strip $(MATRIX_SCAN_THREAD_ENABLE)), yes)
+    OPT_DEFS += -DMATRIX_SCAN_THREAD_ENABLE
+    # The scan thread hands events to the main thread over the key event queue.
+    KEY_EVENT_QUEUE_ENABLE := yes
+endif
+
+ifeq ($(strip $(VELOCIKEY_ENABLE)), yes)
+    # Velocikey samples the shared keystroke-rate estimator.
+    QUANTUM_SRC += $(QUANTUM_DIR)/keystroke_rate.c
+endif
+
 ifeq ($(strip $(DEBUG_MATRIX_SCAN_RATE_ENABLE)), yes)
     OPT_DEFS += -DDEBUG_MATRIX_SCAN_RATE
     CONSOLE_ENABLE = yes
@@ -126,6 +166,7 @@ endif
 
 ifeq ($(strip $(VIRTSER_ENABLE)), yes)
     OPT_DEFS += -DVIRTSER_ENABLE
+    SRC += $(QUANTUM_DIR)/virtser.c
 endif
 
 ifeq ($(strip $(MOUSEKEY_ENABLE)), yes)
@@ -145,6 +186,7 @@ ifeq ($(strip $(POINTING_DEVICE_ENABLE)), yes)
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device.c
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_drivers.c
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_auto_mouse.c
+        SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_transform.c
         ifneq ($(strip $(POINTING_DEVICE_DRIVER)), custom)
             SRC += drivers/sensors/$(strip $(POINTING_DEVICE_DRIVER)).c
             OPT_DEFS += -DPOINTING_DEVICE_DRIVER_$(strip $(shell echo $(POINTING_DEVICE_DRIVER) | tr '[:lower:]' '[:upper:]'))
@@ -370,6 +412,7 @@ endif
     SRC += $(QUANTUM_DIR)/process_keycode/process_backlight.c
     SRC += $(QUANTUM_DIR)/led_matrix/led_matrix.c
     SRC += $(QUANTUM_DIR)/led_matrix/led_matrix_drivers.c
+    SRC += $(QUANTUM_DIR)/fixed_point.c
     SRC += $(LIB_PATH)/lib8tion/lib8tion.c
     CIE1931_CURVE := yes
 
@@ -435,10 +478,18 @@ endif
     SRC += $(QUANTUM_DIR)/color.c
     SRC += $(QUANTUM_DIR)/rgb_matrix/rgb_matrix.c
     SRC += $(QUANTUM_DIR)/rgb_matrix/rgb_matrix_drivers.c
+    SRC += $(QUANTUM_DIR)/fixed_point.c
     SRC += $(LIB_PATH)/lib8tion/lib8tion.c
     CIE1931_CURVE := yes
     RGB_KEYCODES_ENABLE := yes
 
+    ifeq ($(strip $(RGB_MATRIX_CURRENT_LIMIT_ENABLE)), yes)
+        OPT_DEFS += -DRGB_MATRIX_CURRENT_LIMIT_ENABLE
+        # VBUS droop sampling goes through the platform ADC driver.
+        OPT_DEFS += -DSTM32_ADC -DHAL_USE_ADC=TRUE
+        QUANTUM_LIB_SRC += analog.c
+    endif
+
     ifeq ($(strip $(RGB_MATRIX_DRIVER)), AW20216)
         OPT_DEFS += -DAW20216 -DSTM32_SPI -DHAL_USE_SPI=TRUE
         COMMON_VPATH += $(DRIVER_PATH)/led
@@ -612,10 +663,20 @@ ifeq ($(strip $(CIE1931_CURVE)), yes)
     LED_TABLES := yes
 endif
 
+ifeq ($(strip $(CIE1931_CURVE_COMPRESSED)), yes)
+    OPT_DEFS += -DCIE1931_CURVE_COMPRESSED
+    TABLE_COMPRESSION_ENABLE := yes
+endif
+
 ifeq ($(strip $(LED_TABLES)), yes)
     SRC += $(QUANTUM_DIR)/led_tables.c
 endif
 
+ifeq ($(strip $(TABLE_COMPRESSION_ENABLE)), yes)
+    OPT_DEFS += -DTABLE_COMPRESSION_ENABLE
+    SRC += $(QUANTUM_DIR)/table_compression.c
+endif
+
 ifeq ($(strip $(VIA_ENABLE)), yes)
     DYNAMIC_KEYMAP_ENABLE := yes
     RAW_ENABLE := yes
@@ -639,6 +700,36 @@ endif
 COMMON_VPATH += $(QUANTUM_DIR)/bootmagic
 QUANTUM_SRC += $(QUANTUM_DIR)/bootmagic/magic.c
 
+VALID_MATRIX_DRIVER_TYPES := generic vendor
+
+MATRIX_DRIVER ?= generic
+ifeq ($(filter $(MATRIX_DRIVER),$(VALID_MATRIX_DRIVER_TYPES)),)
+    $(call CATASTROPHIC_ERROR,Invalid MATRIX_DRIVER,MATRIX_DRIVER="$(MATRIX_DRIVER)" is not a valid matrix driver)
+endif
+
+ifeq ($(strip $(MATRIX_DRIVER)), vendor)
+    # MCU-specific scan engine (e.g. the RP2040 PIO/DMA scanner); provides the
+    # custom matrix entry points, so only the common matrix code is built.
+    CUSTOM_MATRIX := lite
+    SRC += matrix_vendor.c
+endif
+
+ifeq ($(strip $(MATRIX_EXPANDER_ENABLE)), yes)
+    # MCP23018-hosted sub-matrix support in the common matrix code
+    OPT_DEFS += -DMATRIX_EXPANDER
+    COMMON_VPATH += $(DRIVER_PATH)/gpio
+    SRC += mcp23018.c
+    QUANTUM_LIB_SRC += i2c_master.c
+endif
+
+ifeq ($(strip $(ANALOG_MATRIX_ENABLE)), yes)
+    # Analog matrix engine provides the custom matrix entry points; the
+    # sampling driver is added per keyboard (see analog_matrix_adc.h).
+    CUSTOM_MATRIX := lite
+    OPT_DEFS += -DANALOG_MATRIX_ENABLE
+    QUANTUM_SRC += $(QUANTUM_DIR)/analog_matrix.c
+endif
+
 VALID_CUSTOM_MATRIX_TYPES:= yes lite no
 
 CUSTOM_MATRIX ?= no
@@ -672,6 +763,12 @@ ifeq ($(filter $(SERIAL_DRIVER),$(VALID_SERIAL_DRIVER_TYPES)),)
     $(call CATASTROPHIC_ERROR,Invalid SERIAL_DRIVER,SERIAL_DRIVER="$(SERIAL_DRIVER)" is not a valid SERIAL driver)
 endif
 
+ifneq ($(strip $(SPLIT_ROLE)),)
+    ifneq ($(strip $(SPLIT_KEYBOARD)), yes)
+        $(call CATASTROPHIC_ERROR,Invalid SPLIT_ROLE,SPLIT_ROLE is only valid with SPLIT_KEYBOARD=yes)
+    endif
+endif
+
 ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
     POST_CONFIG_H += $(QUANTUM_DIR)/split_common/post_config.h
     OPT_DEFS += -DSPLIT_KEYBOARD
@@ -687,21 +784,33 @@ ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
 
         OPT_DEFS += -DSPLIT_COMMON_TRANSACTIONS
 
-        # Functions added via QUANTUM_LIB_SRC are only included in the final binary if they're called.
-        # Unused functions are pruned away, which is why we can add multiple drivers here without bloat.
-        ifeq ($(PLATFORM),AVR)
-            ifneq ($(NO_I2C),yes)
-                QUANTUM_LIB_SRC += i2c_master.c \
-                                   i2c_slave.c
-            endif
+        ifeq ($(strip $(SPLIT_TRANSACTION_STATS_ENABLE)), yes)
+            OPT_DEFS += -DSPLIT_TRANSACTION_STATS_ENABLE
+            QUANTUM_SRC += $(QUANTUM_DIR)/split_common/transaction_stats.c
+            BENCHMARK_ENABLE := yes
         endif
 
-        OPT_DEFS += -DSERIAL_DRIVER_$(strip $(shell echo $(SERIAL_DRIVER) | tr '[:lower:]' '[:upper:]'))
-        ifeq ($(strip $(SERIAL_DRIVER)), bitbang)
-            QUANTUM_LIB_SRC += serial.c
+        ifeq ($(strip $(SPLIT_TRANSPORT)), driver)
+            # Board supplies the physical link (split_link_driver); shared
+            # memory sync and the transaction table stay in common code.
+            OPT_DEFS += -DSPLIT_LINK_DRIVER
         else
-            QUANTUM_LIB_SRC += serial_protocol.c
-            QUANTUM_LIB_SRC += serial_$(strip $(SERIAL_DRIVER)).c
+            # Functions added via QUANTUM_LIB_SRC are only included in the final binary if they're called.
+            # Unused functions are pruned away, which is why we can add multiple drivers here without bloat.
+            ifeq ($(PLATFORM),AVR)
+                ifneq ($(NO_I2C),yes)
+                    QUANTUM_LIB_SRC += i2c_master.c \
+                                       i2c_slave.c
+                endif
+            endif
+
+            OPT_DEFS += -DSERIAL_DRIVER_$(strip $(shell echo $(SERIAL_DRIVER) | tr '[:lower:]' '[:upper:]'))
+            ifeq ($(strip $(SERIAL_DRIVER)), bitbang)
+                QUANTUM_LIB_SRC += serial.c
+            else
+                QUANTUM_LIB_SRC += serial_protocol.c
+                QUANTUM_LIB_SRC += serial_$(strip $(SERIAL_DRIVER)).c
+            endif
         endif
     endif
     COMMON_VPATH += $(QUANTUM_PATH)/split_common
@@ -753,6 +862,11 @@ ifeq ($(strip $(OLED_ENABLE)), yes)
             SRC += ssd1306_sh1106.c
             QUANTUM_LIB_SRC += i2c_master.c
         endif
+
+        ifeq ($(strip $(OLED_WIDGET_ENABLE)), yes)
+            OPT_DEFS += -DOLED_WIDGET_ENABLE
+            SRC += oled_widget.c
+        endif
     endif
 endif
 
@@ -853,6 +967,13 @@ ifeq ($(strip $(JOYSTICK_ENABLE)), yes)
     ifeq ($(strip $(JOYSTICK_DRIVER)), analog)
         OPT_DEFS += -DANALOG_JOYSTICK_ENABLE
         SRC += analog.c
+        ifeq ($(strip $(JOYSTICK_ASYNC_ADC)), yes)
+            ifneq ($(PLATFORM),CHIBIOS)
+                $(call CATASTROPHIC_ERROR,JOYSTICK_ASYNC_ADC is only available on ChibiOS)
+            endif
+            OPT_DEFS += -DJOYSTICK_ASYNC_ADC
+            SRC += joystick_adc.c
+        endif
     endif
     ifeq ($(strip $(JOYSTICK_DRIVER)), digital)
         OPT_DEFS += -DDIGITAL_JOYSTICK_ENABLE
@@ -908,6 +1029,26 @@ ifeq ($(strip $(BLUETOOTH_ENABLE)), yes)
     endif
 endif
 
+RADIO_ENABLE ?= no
+RADIO_DRIVER ?= UART
+VALID_RADIO_DRIVER_TYPES := UART custom
+ifeq ($(strip $(RADIO_ENABLE)), yes)
+    ifeq ($(filter $(strip $(RADIO_DRIVER)),$(VALID_RADIO_DRIVER_TYPES)),)
+        $(call CATASTROPHIC_ERROR,Invalid RADIO_DRIVER,RADIO_DRIVER="$(RADIO_DRIVER)" is not a valid radio driver type)
+    endif
+    OPT_DEFS += -DRADIO_ENABLE
+    NO_USB_STARTUP_CHECK := yes
+    COMMON_VPATH += $(DRIVER_PATH)/bluetooth
+    COMMON_VPATH += $(DRIVER_PATH)/wireless
+    SRC += outputselect.c $(DRIVER_PATH)/wireless/radio.c
+
+    ifeq ($(strip $(RADIO_DRIVER)), UART)
+        OPT_DEFS += -DHAL_USE_SERIAL=TRUE
+        SRC += $(DRIVER_PATH)/wireless/radio_uart.c
+        QUANTUM_LIB_SRC += uart.c
+    endif
+endif
+
 ifeq ($(strip $(ENCODER_ENABLE)), yes)
     SRC += $(QUANTUM_DIR)/encoder.c
     OPT_DEFS += -DENCODER_ENABLE
@@ -18,6 +18,7 @@ GRAVE_ESC_ENABLE ?= yes
 
 GENERIC_FEATURES = \
     AUTOCORRECT \
+    BENCHMARK \
     CAPS_WORD \
     COMBO \
     COMMAND \
@@ -26,16 +27,26 @@ GENERIC_FEATURES = \
     DIP_SWITCH \
     DYNAMIC_KEYMAP \
     DYNAMIC_MACRO \
+    EVENT_TRACE \
+    GAME_MODE \
     GRAVE_ESC \
     HAPTIC \
+    HOUSEKEEPING_BUDGET \
+    KEY_EVENT_QUEUE \
     KEY_LOCK \
     KEY_OVERRIDE \
+    LATENCY_HISTOGRAM \
     LEADER \
+    MATRIX_IDLE \
     PROGRAMMABLE_BUTTON \
+    RAW_HID_STREAM \
+    REPEAT_KEY \
     SECURE \
+    SOCD_CLEANER \
     SPACE_CADET \
     SWAP_HANDS \
     TAP_DANCE \
+    TUNABLES \
     VELOCIKEY \
     WPM \
     DYNAMIC_TAPPING_TERM \
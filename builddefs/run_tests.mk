@@ -0,0 +1,50 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Runs already-built test executables as individual make targets, so that
+# `make -j<n> test:all` executes suites in parallel instead of serially;
+# invoked from the main Makefile once all test binaries are linked.
+#
+# TEST_SHARDS=<n> additionally splits every suite into <n> googletest
+# shards (GTEST_TOTAL_SHARDS/GTEST_SHARD_INDEX), each run as its own
+# target, so a single long suite can also spread across cores.
+
+.DEFAULT_GOAL := all
+
+# Keep each test's output contiguous when running in parallel.
+MAKEFLAGS += --output-sync=target
+
+include paths.mk
+include $(BUILDDEFS_PATH)/message.mk
+
+TEST_OUTPUT_DIR := $(BUILD_DIR)/test
+TEST_SHARDS ?= 1
+
+# Unset/empty/0/1 all mean "one run per suite".
+ifeq ($(filter-out 0 1,$(TEST_SHARDS)),)
+
+.PHONY: all $(TESTS)
+all: $(TESTS)
+
+$(TESTS):
+	@printf "Testing $(BOLD)$@$(NO_COLOR)\n"
+	@$(TEST_OUTPUT_DIR)/$@.elf
+
+else
+
+SHARD_INDICES := $(shell seq 0 $(shell expr $(TEST_SHARDS) - 1))
+TEST_TARGETS  := $(foreach TEST,$(TESTS),$(foreach SHARD,$(SHARD_INDICES),$(TEST).shard$(SHARD)))
+
+.PHONY: all $(TEST_TARGETS)
+all: $(TEST_TARGETS)
+
+define SHARDED_TEST_RULE
+$1.shard$2:
+	@printf "Testing $(BOLD)$1$(NO_COLOR) (shard $2/$(TEST_SHARDS))\n"
+	@GTEST_TOTAL_SHARDS=$(TEST_SHARDS) GTEST_SHARD_INDEX=$2 $(TEST_OUTPUT_DIR)/$1.elf
+
+endef
+
+$(foreach TEST,$(TESTS),$(foreach SHARD,$(SHARD_INDICES),$(eval $(call SHARDED_TEST_RULE,$(TEST),$(SHARD)))))
+
+endif
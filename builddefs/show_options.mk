@@ -85,7 +85,34 @@ OTHER_OPTION_NAMES = \
   SECURE_ENABLE \
   CAPS_WORD_ENABLE \
   AUTOCORRECT_ENABLE \
-  TRI_LAYER_ENABLE
+  TRI_LAYER_ENABLE \
+  MATRIX_IDLE_ENABLE
+
+# Features that contribute a periodic hook to keyboard_task(), as
+# OPTION:hook pairs. Used for the feature_manifest target below and kept in
+# step with the call sites in quantum/keyboard.c and quantum/feature_audit.h.
+FEATURE_TASK_MAP = \
+  BACKLIGHT_ENABLE:backlight_task \
+  BLUETOOTH_ENABLE:bluetooth_task \
+  DIGITIZER_ENABLE:digitizer_task \
+  ENCODER_ENABLE:encoder_task \
+  JOYSTICK_ENABLE:joystick_task \
+  LED_MATRIX_ENABLE:led_matrix_task \
+  MIDI_ENABLE:midi_task \
+  MOUSEKEY_ENABLE:mousekey_task \
+  OLED_ENABLE:oled_task \
+  POINTING_DEVICE_ENABLE:pointing_device_task \
+  PROGRAMMABLE_BUTTON_ENABLE:programmable_button_task \
+  PS2_MOUSE_ENABLE:ps2_mouse_task \
+  RGBLIGHT_ENABLE:rgblight_task \
+  RGB_MATRIX_ENABLE:rgb_matrix_task \
+  ST7565_ENABLE:st7565_task \
+  SPLIT_WATCHDOG_ENABLE:split_watchdog_task \
+  TASK_ACCOUNTING_ENABLE:task_accounting_task \
+  DEFERRED_LOGGING_ENABLE:deferred_logging_task \
+  BENCHMARK_ENABLE:benchmark_task
+
+COMPILED_TASK_HOOKS = $(strip $(foreach PAIR,$(FEATURE_TASK_MAP),$(if $(filter yes,$(strip $($(word 1,$(subst :, ,$(PAIR)))))),$(PAIR))))
 
 define NAME_ECHO
        @printf "  %-30s = %-16s # %s\\n" "$1" "$($1)" "$(origin $1)"
@@ -138,6 +165,40 @@ show_full_features: show_build_options0
 	$(foreach A_OPTION_NAME,$(sort $(OTHER_OPTION_NAMES)),\
 		$(call NAME_ECHO,$(A_OPTION_NAME)))
 
+JSON_COMMA := ,
+JSON_EMPTY :=
+JSON_SPACE := $(JSON_EMPTY) $(JSON_EMPTY)
+
+# Enabled options as "name":"value" pairs, and compiled task hooks as
+# {"feature":...,"hook":...} objects; elements contain no spaces so the
+# list can be comma-joined by make.
+MANIFEST_OPTION_NAMES = $(sort $(foreach A_OPTION_NAME,$(BUILD_OPTION_NAMES) $(HARDWARE_OPTION_NAMES) $(OTHER_OPTION_NAMES),$(if $(strip $($(A_OPTION_NAME))),$(A_OPTION_NAME))))
+MANIFEST_FEATURE_LIST = $(subst $(JSON_SPACE),$(JSON_COMMA)$(JSON_SPACE),$(strip $(foreach A_OPTION_NAME,$(MANIFEST_OPTION_NAMES),"$(A_OPTION_NAME)":"$(strip $($(A_OPTION_NAME)))")))
+MANIFEST_TASK_LIST = $(subst $(JSON_SPACE),$(JSON_COMMA)$(JSON_SPACE),$(strip $(foreach PAIR,$(COMPILED_TASK_HOOKS),{"feature":"$(word 1,$(subst :, ,$(PAIR)))"$(JSON_COMMA)"hook":"$(word 2,$(subst :, ,$(PAIR)))"})))
+
+FEATURE_MANIFEST = $(BUILD_DIR)/$(TARGET)_features.json
+
+# Emits a JSON inventory of what this build pays for: every enabled option,
+# the periodic hooks compiled into keyboard_task(), and - when the .elf has
+# been built - the image's static RAM totals. Per-symbol attribution is
+# available via TOP_SYMBOLS=yes.
+.PHONY: feature_manifest
+feature_manifest:
+	@mkdir -p $(BUILD_DIR)
+	@echo '{' > $(FEATURE_MANIFEST)
+	@echo '  "keyboard": "$(KEYBOARD)",' >> $(FEATURE_MANIFEST)
+	@echo '  "keymap": "$(KEYMAP)",' >> $(FEATURE_MANIFEST)
+	@echo '  "mcu": "$(MCU)",' >> $(FEATURE_MANIFEST)
+	@echo '  "platform": "$(PLATFORM)",' >> $(FEATURE_MANIFEST)
+	@echo '  "features": { $(MANIFEST_FEATURE_LIST) },' >> $(FEATURE_MANIFEST)
+	@echo '  "tasks": [ $(MANIFEST_TASK_LIST) ],' >> $(FEATURE_MANIFEST)
+	@if [ -f $(BUILD_DIR)/$(TARGET).elf ]; then \
+		$(SIZE) $(BUILD_DIR)/$(TARGET).elf | $(AWK) 'NR==2 { printf "  \"static_ram\": { \"data\": %s, \"bss\": %s },\n", $$2, $$3 }' >> $(FEATURE_MANIFEST); \
+	fi
+	@echo '  "manifest_version": 1' >> $(FEATURE_MANIFEST)
+	@echo '}' >> $(FEATURE_MANIFEST)
+	@echo "Wrote $(FEATURE_MANIFEST)"
+
 .PHONY: yaml_build_options
 yaml_build_options:
 	@echo '- KEYBOARD : "$(KEYBOARD)"'
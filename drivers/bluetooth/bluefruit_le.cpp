@@ -35,6 +35,13 @@
 #define SAMPLE_BATTERY
 #define ConnectionUpdateInterval 1000 /* milliseconds */
 
+// Minimum spacing between queued report sends. The central only polls us
+// once per connection interval (AT+GAPINTERVALS below negotiates 10-30ms),
+// so pushing commands faster than that just piles them up in the module.
+#ifndef BLUEFRUIT_LE_CONNECTION_INTERVAL_MS
+#    define BLUEFRUIT_LE_CONNECTION_INTERVAL_MS 10
+#endif
+
 #ifndef BATTERY_LEVEL_PIN
 #    define BATTERY_LEVEL_PIN B5
 #endif
@@ -255,6 +262,8 @@ static void resp_buf_read_one(bool greedy) {
     }
 }
 
+static uint16_t last_send_time = 0;
+
 static void send_buf_send_one(uint16_t timeout = SdepTimeout) {
     struct queue_item item;
 
@@ -266,13 +275,22 @@ static void send_buf_send_one(uint16_t timeout = SdepTimeout) {
     if (!send_buf.peek(item)) {
         return;
     }
+
+    // Pace sends to the connection interval; the item stays queued and goes
+    // out on a later pass.
+    if (timer_elapsed(last_send_time) < BLUEFRUIT_LE_CONNECTION_INTERVAL_MS) {
+        return;
+    }
+
+    last_send_time = timer_read();
     if (process_queue_item(&item, timeout)) {
         // commit that peek
         send_buf.get(item);
         dprintf("send_buf_send_one: have %d remaining\n", (int)send_buf.size());
     } else {
+        // Leave the item queued; the pacing above acts as the retry backoff
+        // instead of stalling the scan loop with a blocking wait here.
         dprint("failed to send, will retry\n");
-        wait_ms(SdepTimeout);
         resp_buf_read_one(true);
     }
 }
@@ -505,8 +523,18 @@ void bluefruit_le_task(void) {
     if (!state.configured && !bluefruit_le_enable_keyboard()) {
         return;
     }
-    resp_buf_read_one(true);
-    send_buf_send_one(SdepShortTimeout);
+    // Drain as much of the send queue as the module will take this pass; each
+    // send needs its response consumed before the next one can go out, so
+    // alternate reads and sends until no further progress is made (queue
+    // empty, response outstanding, or paced to the connection interval).
+    for (uint8_t budget = 4; budget != 0; budget--) {
+        resp_buf_read_one(true);
+        uint8_t before = send_buf.size();
+        send_buf_send_one(SdepShortTimeout);
+        if (send_buf.size() == before) {
+            break;
+        }
+    }
 
     if (resp_buf.empty() && (state.event_flags & UsingEvents) && readPin(BLUEFRUIT_LE_IRQ_PIN)) {
         // Must be an event update
@@ -640,9 +668,34 @@ void bluefruit_le_send_consumer(uint16_t usage) {
     }
 }
 
+static int8_t add_clamped(int8_t a, int8_t b) {
+    int16_t sum = (int16_t)a + b;
+    if (sum > INT8_MAX) {
+        return INT8_MAX;
+    }
+    if (sum < INT8_MIN) {
+        return INT8_MIN;
+    }
+    return (int8_t)sum;
+}
+
 void bluefruit_le_send_mouse(report_mouse_t *report) {
     struct queue_item item;
 
+    // Coalesce with a move that is still queued when the buttons match, so a
+    // burst of motion collapses into a single AT exchange instead of one per
+    // delta.
+    if (!send_buf.empty()) {
+        struct queue_item &last = send_buf.back();
+        if (last.queue_type == QTMouseMove && last.mousemove.buttons == report->buttons) {
+            last.mousemove.x      = add_clamped(last.mousemove.x, report->x);
+            last.mousemove.y      = add_clamped(last.mousemove.y, report->y);
+            last.mousemove.scroll = add_clamped(last.mousemove.scroll, report->v);
+            last.mousemove.pan    = add_clamped(last.mousemove.pan, report->h);
+            return;
+        }
+    }
+
     item.queue_type        = QTMouseMove;
     item.mousemove.x       = report->x;
     item.mousemove.y       = report->y;
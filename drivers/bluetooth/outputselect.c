@@ -19,6 +19,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "bluefruit_le.h"
 #endif
 
+#ifdef RADIO_ENABLE
+#    include "radio.h"
+#endif
+
 uint8_t desired_output = OUTPUT_DEFAULT;
 
 /** \brief Set Output
@@ -45,6 +49,12 @@ uint8_t auto_detect_output(void) {
         return OUTPUT_USB;
     }
 
+#ifdef RADIO_ENABLE
+    if (radio_is_connected()) {
+        return OUTPUT_RF;
+    }
+#endif
+
 #ifdef BLUETOOTH_BLUEFRUIT_LE
     if (bluefruit_le_is_connected()) {
         return OUTPUT_BLUETOOTH;
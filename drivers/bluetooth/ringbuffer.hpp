@@ -60,6 +60,11 @@ class RingBuffer {
     return buf_[tail_];
   }
 
+  // Most recently enqueued item; only valid when !empty()
+  inline T& back() {
+    return buf_[prevPosition(head_)];
+  }
+
   inline bool peek(T &item) {
     return get(item, false);
   }
@@ -14,11 +14,177 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 
 #include "eeprom_driver.h"
 
+#ifdef EEPROM_WRITE_CACHE
+
+#    include "timer.h"
+
+/*
+    Write-behind cache. Writes are coalesced into page-sized RAM buffers and
+    flushed from housekeeping_task() once the burst of writes has died down,
+    so that configuration bursts (e.g. VIA dragging keycodes around) don't
+    stall the main loop on one blocking page write per byte.
+
+    The cache only ever holds dirty pages -- reads go to the backing driver
+    and are then overlaid with any not-yet-flushed data.
+*/
+
+#    ifndef EEPROM_WRITE_CACHE_PAGE_SIZE
+#        define EEPROM_WRITE_CACHE_PAGE_SIZE 32
+#    endif
+
+#    ifndef EEPROM_WRITE_CACHE_PAGES
+#        define EEPROM_WRITE_CACHE_PAGES 8
+#    endif
+
+#    ifndef EEPROM_WRITE_CACHE_FLUSH_DELAY_MS
+#        define EEPROM_WRITE_CACHE_FLUSH_DELAY_MS 50
+#    endif
+
+typedef struct eeprom_cache_page_t {
+    uint32_t addr; /* page-aligned backing address */
+    bool     dirty;
+    uint8_t  data[EEPROM_WRITE_CACHE_PAGE_SIZE];
+} eeprom_cache_page_t;
+
+static eeprom_cache_page_t cache_pages[EEPROM_WRITE_CACHE_PAGES];
+static uint8_t             cache_dirty_count = 0;
+static uint16_t            cache_last_write  = 0;
+
+__attribute__((weak)) bool eeprom_driver_busy_raw(void) {
+    return false;
+}
+
+static void eeprom_cache_flush_page(eeprom_cache_page_t *page) {
+    eeprom_driver_write_raw(page->data, (void *)(uintptr_t)page->addr, EEPROM_WRITE_CACHE_PAGE_SIZE);
+    page->dirty = false;
+    cache_dirty_count--;
+}
+
+static eeprom_cache_page_t *eeprom_cache_get_page(uint32_t page_addr, bool whole_page) {
+    eeprom_cache_page_t *victim = NULL;
+
+    for (uint8_t i = 0; i < EEPROM_WRITE_CACHE_PAGES; i++) {
+        eeprom_cache_page_t *page = &cache_pages[i];
+        if (page->dirty && page->addr == page_addr) {
+            return page;
+        }
+        if (!page->dirty) {
+            victim = page;
+        }
+    }
+
+    if (!victim) {
+        /* All pages dirty -- write one out and reuse it. The scan below keeps flush order stable so a long burst
+         * degrades to sequential page writes rather than thrashing a single slot. */
+        static uint8_t next_victim = 0;
+        victim                     = &cache_pages[next_victim];
+        next_victim                = (next_victim + 1) % EEPROM_WRITE_CACHE_PAGES;
+        eeprom_cache_flush_page(victim);
+    }
+
+    victim->addr = page_addr;
+    if (!whole_page) {
+        /* Partial page write -- seed the buffer with current backing content so the eventual flush is exact */
+        eeprom_driver_read_raw(victim->data, (const void *)(uintptr_t)page_addr, EEPROM_WRITE_CACHE_PAGE_SIZE);
+    }
+    victim->dirty = true;
+    cache_dirty_count++;
+    return victim;
+}
+
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    uint32_t target_addr = (uint32_t)(uintptr_t)addr;
+
+    eeprom_driver_read_raw(buf, addr, len);
+
+    if (cache_dirty_count == 0) {
+        return;
+    }
+
+    /* Overlay any dirty cached data on top of the backing content */
+    for (uint8_t i = 0; i < EEPROM_WRITE_CACHE_PAGES; i++) {
+        eeprom_cache_page_t *page = &cache_pages[i];
+        if (!page->dirty || page->addr >= target_addr + len || page->addr + EEPROM_WRITE_CACHE_PAGE_SIZE <= target_addr) {
+            continue;
+        }
+        uint32_t overlap_start = page->addr > target_addr ? page->addr : target_addr;
+        uint32_t overlap_end   = page->addr + EEPROM_WRITE_CACHE_PAGE_SIZE < target_addr + len ? page->addr + EEPROM_WRITE_CACHE_PAGE_SIZE : target_addr + len;
+        memcpy((uint8_t *)buf + (overlap_start - target_addr), &page->data[overlap_start - page->addr], overlap_end - overlap_start);
+    }
+}
+
+void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    const uint8_t *src         = (const uint8_t *)buf;
+    uint32_t       target_addr = (uint32_t)(uintptr_t)addr;
+
+    while (len > 0) {
+        uint32_t page_offset  = target_addr % EEPROM_WRITE_CACHE_PAGE_SIZE;
+        uint32_t write_length = EEPROM_WRITE_CACHE_PAGE_SIZE - page_offset;
+        if (write_length > len) {
+            write_length = len;
+        }
+
+        eeprom_cache_page_t *page = eeprom_cache_get_page(target_addr - page_offset, write_length == EEPROM_WRITE_CACHE_PAGE_SIZE);
+        memcpy(&page->data[page_offset], src, write_length);
+
+        src += write_length;
+        target_addr += write_length;
+        len -= write_length;
+    }
+
+    cache_last_write = timer_read();
+}
+
+void eeprom_driver_erase(void) {
+    /* Drop any pending writes -- they'd otherwise flush stale data on top of the erased area */
+    for (uint8_t i = 0; i < EEPROM_WRITE_CACHE_PAGES; i++) {
+        cache_pages[i].dirty = false;
+    }
+    cache_dirty_count = 0;
+
+    eeprom_driver_erase_raw();
+}
+
+void eeprom_driver_flush(void) {
+    for (uint8_t i = 0; i < EEPROM_WRITE_CACHE_PAGES; i++) {
+        if (cache_pages[i].dirty) {
+            eeprom_cache_flush_page(&cache_pages[i]);
+        }
+    }
+}
+
+void eeprom_driver_task(void) {
+    if (cache_dirty_count == 0 || timer_elapsed(cache_last_write) < EEPROM_WRITE_CACHE_FLUSH_DELAY_MS) {
+        /* Either nothing to do, or a write burst is still in progress -- keep coalescing */
+        return;
+    }
+
+    if (eeprom_driver_busy_raw()) {
+        /* The previous page is still committing (e.g. the SPI driver's write cycle) -- retry on a later pass
+         * instead of having the raw driver spin on its status bit for the remainder of the cycle */
+        return;
+    }
+
+    /* Flush one page per main loop iteration to bound the added latency */
+    for (uint8_t i = 0; i < EEPROM_WRITE_CACHE_PAGES; i++) {
+        if (cache_pages[i].dirty) {
+            eeprom_cache_flush_page(&cache_pages[i]);
+            break;
+        }
+    }
+}
+
+#endif // EEPROM_WRITE_CACHE
+
+#ifndef EEPROM_WEAR_LEVELING
+/* The wear-leveling driver provides its own read helpers, serving them straight from its RAM mirror */
+
 uint8_t eeprom_read_byte(const uint8_t *addr) {
     uint8_t ret = 0;
     eeprom_read_block(&ret, addr, 1);
@@ -36,6 +202,7 @@ uint32_t eeprom_read_dword(const uint32_t *addr) {
     eeprom_read_block(&ret, addr, 4);
     return ret;
 }
+#endif // EEPROM_WEAR_LEVELING
 
 void eeprom_write_byte(uint8_t *addr, uint8_t value) {
     eeprom_write_block(&value, addr, 1);
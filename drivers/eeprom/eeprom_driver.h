@@ -16,7 +16,28 @@
 
 #pragma once
 
+#include <stdbool.h>
+
 #include "eeprom.h"
 
 void eeprom_driver_init(void);
 void eeprom_driver_erase(void);
+
+#ifdef EEPROM_WRITE_CACHE
+/* Raw driver entry points, bypassing the write-behind cache. Provided by drivers which support caching -- see the
+ * renames at the top of eeprom_i2c.c/eeprom_spi.c. */
+void eeprom_driver_erase_raw(void);
+void eeprom_driver_read_raw(void *buf, const void *addr, size_t len);
+void eeprom_driver_write_raw(const void *buf, void *addr, size_t len);
+
+/* True while the backing device is still committing a previous write. Weakly defined to false; drivers whose write
+ * cycle outlives the bus transfer (e.g. the SPI driver's write-in-progress status bit) override this with a single
+ * non-spinning status probe, so the cache defers the next page flush rather than the driver blocking on the bit. */
+bool eeprom_driver_busy_raw(void);
+
+/* Flush barrier: writes out every dirty cached page. Must be invoked before resetting or powering down. */
+void eeprom_driver_flush(void);
+
+/* Background flushing of dirty pages, invoked from housekeeping_task(). */
+void eeprom_driver_task(void);
+#endif // EEPROM_WRITE_CACHE
@@ -38,6 +38,17 @@
 #include "eeprom.h"
 #include "eeprom_i2c.h"
 
+/*
+    When the write-behind cache is enabled, the public eeprom symbols are owned by the cache front-end in
+    eeprom_driver.c, and this driver only provides the raw entry points underneath it.
+*/
+#ifdef EEPROM_WRITE_CACHE
+#    include "eeprom_driver.h"
+#    define eeprom_driver_erase eeprom_driver_erase_raw
+#    define eeprom_read_block eeprom_driver_read_raw
+#    define eeprom_write_block eeprom_driver_write_raw
+#endif
+
 // #define DEBUG_EEPROM_OUTPUT
 
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
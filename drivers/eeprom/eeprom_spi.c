@@ -37,6 +37,17 @@
 #include "eeprom.h"
 #include "eeprom_spi.h"
 
+/*
+    When the write-behind cache is enabled, the public eeprom symbols are owned by the cache front-end in
+    eeprom_driver.c, and this driver only provides the raw entry points underneath it.
+*/
+#ifdef EEPROM_WRITE_CACHE
+#    include "eeprom_driver.h"
+#    define eeprom_driver_erase eeprom_driver_erase_raw
+#    define eeprom_read_block eeprom_driver_read_raw
+#    define eeprom_write_block eeprom_driver_write_raw
+#endif
+
 #define CMD_WREN 6
 #define CMD_WRDI 4
 #define CMD_RDSR 5
@@ -75,6 +86,24 @@ static spi_status_t spi_eeprom_wait_while_busy(int timeout) {
     return SPI_STATUS_SUCCESS;
 }
 
+#ifdef EEPROM_WRITE_CACHE
+/* Single non-spinning WIP probe for the cache front-end: one RDSR transaction, no retry loop. The cache checks this
+ * before flushing a page so a flush that lands mid write cycle gets deferred to a later housekeeping pass, rather
+ * than the pre-write wait above stalling the main loop for the rest of the cycle (up to ~5ms). */
+bool eeprom_driver_busy_raw(void) {
+    if (!spi_eeprom_start()) {
+        /* Can't tell -- report idle and let the write path surface the bus error */
+        return false;
+    }
+
+    spi_write(CMD_RDSR);
+    spi_status_t response = spi_read();
+    spi_stop();
+
+    return (response & SR_WIP) != 0;
+}
+#endif // EEPROM_WRITE_CACHE
+
 static void spi_eeprom_transmit_address(uintptr_t addr) {
     uint8_t buffer[EXTERNAL_EEPROM_ADDRESS_SIZE];
 
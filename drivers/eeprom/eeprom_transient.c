@@ -22,6 +22,17 @@
 
 __attribute__((aligned(4))) static uint8_t transientBuffer[TRANSIENT_EEPROM_SIZE] = {0};
 
+#ifdef EEPROM_TRANSIENT_SNAPSHOT
+static uint8_t dirty_pages[TRANSIENT_EEPROM_BITMAP_BYTES] = {0};
+static uint8_t snapshot_status                            = 0;
+
+static void mark_pages_dirty(intptr_t offset, size_t len) {
+    for (size_t page = offset / TRANSIENT_EEPROM_PAGE_SIZE; page <= (offset + len - 1) / TRANSIENT_EEPROM_PAGE_SIZE; page++) {
+        dirty_pages[page / 8] |= 1 << (page % 8);
+    }
+}
+#endif
+
 size_t clamp_length(intptr_t offset, size_t len) {
     if (offset + len > TRANSIENT_EEPROM_SIZE) {
         len = TRANSIENT_EEPROM_SIZE - offset;
@@ -36,6 +47,11 @@ void eeprom_driver_init(void) {
 
 void eeprom_driver_erase(void) {
     memset(transientBuffer, 0x00, TRANSIENT_EEPROM_SIZE);
+#ifdef EEPROM_TRANSIENT_SNAPSHOT
+    // Nothing worth persisting until the host restores its snapshot.
+    memset(dirty_pages, 0x00, sizeof(dirty_pages));
+    snapshot_status = TRANSIENT_EEPROM_STATUS_AWAITING_RESTORE;
+#endif
 }
 
 void eeprom_read_block(void *buf, const void *addr, size_t len) {
@@ -52,5 +68,46 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
     len             = clamp_length(offset, len);
     if (len > 0) {
         memcpy(&transientBuffer[offset], buf, len);
+#ifdef EEPROM_TRANSIENT_SNAPSHOT
+        mark_pages_dirty(offset, len);
+#endif
+    }
+}
+
+#ifdef EEPROM_TRANSIENT_SNAPSHOT
+__attribute__((weak)) void eeprom_transient_snapshot_restored(void) {}
+
+void eeprom_transient_read_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    for (uint16_t i = 0; i < size; i++) {
+        uint16_t pos = offset + i;
+        if (pos < TRANSIENT_EEPROM_SNAPSHOT_BITMAP_OFFSET) {
+            data[i] = transientBuffer[pos];
+        } else if (pos < TRANSIENT_EEPROM_SNAPSHOT_STATUS_OFFSET) {
+            data[i] = dirty_pages[pos - TRANSIENT_EEPROM_SNAPSHOT_BITMAP_OFFSET];
+        } else if (pos == TRANSIENT_EEPROM_SNAPSHOT_STATUS_OFFSET) {
+            data[i] = snapshot_status;
+        } else {
+            data[i] = 0x00;
+        }
+    }
+}
+
+void eeprom_transient_write_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    for (uint16_t i = 0; i < size; i++) {
+        uint16_t pos = offset + i;
+        if (pos < TRANSIENT_EEPROM_SNAPSHOT_BITMAP_OFFSET) {
+            // Restored snapshot data; not dirty, the host already has it.
+            transientBuffer[pos] = data[i];
+        } else if (pos < TRANSIENT_EEPROM_SNAPSHOT_STATUS_OFFSET) {
+            // Set bits acknowledge synced pages; pages dirtied since the
+            // host read the bitmap keep their flag.
+            dirty_pages[pos - TRANSIENT_EEPROM_SNAPSHOT_BITMAP_OFFSET] &= ~data[i];
+        } else if (pos == TRANSIENT_EEPROM_SNAPSHOT_STATUS_OFFSET && data[i] == 0x00) {
+            if (snapshot_status & TRANSIENT_EEPROM_STATUS_AWAITING_RESTORE) {
+                snapshot_status = 0x00;
+                eeprom_transient_snapshot_restored();
+            }
+        }
     }
 }
+#endif // EEPROM_TRANSIENT_SNAPSHOT
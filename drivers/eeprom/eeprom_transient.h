@@ -23,3 +23,42 @@
 #    include "eeconfig.h"
 #    define TRANSIENT_EEPROM_SIZE (((EECONFIG_SIZE + 3) / 4) * 4) // based off eeconfig's current usage, aligned to 4-byte sizes, to deal with LTO
 #endif
+
+#ifdef EEPROM_TRANSIENT_SNAPSHOT
+/*
+    Host-side persistence for the transient driver: a host daemon restores a
+    snapshot of the buffer over the raw HID stream after enumeration, and
+    periodically reads back the pages dirtied since its last sync. Requires
+    RAW_HID_STREAM_ENABLE for the transport.
+
+    The stream channel exposes, in order: the buffer itself, a dirty-page
+    bitmap (one bit per TRANSIENT_EEPROM_PAGE_SIZE bytes, LSB first), and a
+    status byte. Writing bits to the bitmap clears the matching dirty flags,
+    so a daemon writing back exactly the bitmap it read never loses a page
+    dirtied during the sync. Writing 0x00 to the status byte marks the
+    restore complete and invokes eeprom_transient_snapshot_restored().
+*/
+#    include <stdint.h>
+
+#    ifndef TRANSIENT_EEPROM_PAGE_SIZE
+#        define TRANSIENT_EEPROM_PAGE_SIZE 32
+#    endif
+
+#    define TRANSIENT_EEPROM_PAGE_COUNT ((TRANSIENT_EEPROM_SIZE + TRANSIENT_EEPROM_PAGE_SIZE - 1) / TRANSIENT_EEPROM_PAGE_SIZE)
+#    define TRANSIENT_EEPROM_BITMAP_BYTES ((TRANSIENT_EEPROM_PAGE_COUNT + 7) / 8)
+
+// Stream channel layout
+#    define TRANSIENT_EEPROM_SNAPSHOT_BITMAP_OFFSET TRANSIENT_EEPROM_SIZE
+#    define TRANSIENT_EEPROM_SNAPSHOT_STATUS_OFFSET (TRANSIENT_EEPROM_SIZE + TRANSIENT_EEPROM_BITMAP_BYTES)
+
+// Status byte: set from erase until the host completes a restore.
+#    define TRANSIENT_EEPROM_STATUS_AWAITING_RESTORE (1 << 0)
+
+/* Stream channel accessors for the buffer + bitmap + status layout. */
+void eeprom_transient_read_buffer(uint16_t offset, uint16_t size, uint8_t *data);
+void eeprom_transient_write_buffer(uint16_t offset, uint16_t size, uint8_t *data);
+
+/* Called once the host marks its snapshot restore complete, so cached
+   eeconfig state (debug flags, default layer, ...) can be re-applied. */
+void eeprom_transient_snapshot_restored(void);
+#endif // EEPROM_TRANSIENT_SNAPSHOT
@@ -14,10 +14,40 @@ void eeprom_driver_erase(void) {
     wear_leveling_erase();
 }
 
+/*
+    The wear-leveling layer keeps an always-consistent RAM mirror of the logical data -- writes update it before
+    touching the backing store -- so reads are served directly from the mirror instead of going through the
+    wear-leveling API. Subsystems with per-keystroke reads (e.g. dynamic keymaps) thereby pay a plain memory load,
+    with only writes incurring the write-log cost. The read helpers below also override the generic ones from
+    eeprom_driver.c, removing a level of call indirection for the common fixed-width accesses.
+*/
+
 void eeprom_read_block(void *buf, const void *addr, size_t len) {
-    wear_leveling_read((uint32_t)addr, buf, len);
+    uint32_t offset = (uint32_t)(uintptr_t)addr;
+    if (offset + len > (WEAR_LEVELING_LOGICAL_SIZE)) {
+        return;
+    }
+    memcpy(buf, wear_leveling_cache() + offset, len);
 }
 
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
-    wear_leveling_write((uint32_t)addr, buf, len);
+    wear_leveling_write((uint32_t)(uintptr_t)addr, buf, len);
+}
+
+uint8_t eeprom_read_byte(const uint8_t *addr) {
+    uint8_t ret = 0;
+    eeprom_read_block(&ret, addr, 1);
+    return ret;
+}
+
+uint16_t eeprom_read_word(const uint16_t *addr) {
+    uint16_t ret = 0;
+    eeprom_read_block(&ret, addr, 2);
+    return ret;
+}
+
+uint32_t eeprom_read_dword(const uint32_t *addr) {
+    uint32_t ret = 0;
+    eeprom_read_block(&ret, addr, 4);
+    return ret;
 }
@@ -23,6 +23,10 @@
 uint8_t DRV2605L_transfer_buffer[2];
 uint8_t DRV2605L_read_register;
 
+/* The last waveform staged in the sequencer; re-triggering the same effect
+ * only needs the GO register poked again. */
+static uint8_t DRV2605L_last_sequence = 0;
+
 void DRV_write(uint8_t drv_register, uint8_t settings) {
     DRV2605L_transfer_buffer[0] = drv_register;
     DRV2605L_transfer_buffer[1] = settings;
@@ -101,6 +105,7 @@ void DRV_init(void) {
     // Play greeting sequence
     DRV_write(DRV_GO, 0x00);
     DRV_write(DRV_WAVEFORM_SEQ_1, DRV_GREETING);
+    DRV2605L_last_sequence = DRV_GREETING;
     DRV_write(DRV_GO, 0x01);
 }
 
@@ -117,6 +122,9 @@ void DRV_amplitude(uint8_t amplitude) {
 
 void DRV_pulse(uint8_t sequence) {
     DRV_write(DRV_GO, 0x00);
-    DRV_write(DRV_WAVEFORM_SEQ_1, sequence);
+    if (sequence != DRV2605L_last_sequence) {
+        DRV_write(DRV_WAVEFORM_SEQ_1, sequence);
+        DRV2605L_last_sequence = sequence;
+    }
     DRV_write(DRV_GO, 0x01);
 }
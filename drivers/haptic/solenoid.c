@@ -26,9 +26,11 @@
 uint8_t      solenoid_dwell  = SOLENOID_DEFAULT_DWELL;
 static pin_t solenoid_pads[] = SOLENOID_PINS;
 #define NUMBER_OF_SOLENOIDS ARRAY_SIZE(solenoid_pads)
-bool     solenoid_on[NUMBER_OF_SOLENOIDS]      = {false};
-bool     solenoid_buzzing[NUMBER_OF_SOLENOIDS] = {false};
-uint16_t solenoid_start[NUMBER_OF_SOLENOIDS]   = {0};
+bool solenoid_on[NUMBER_OF_SOLENOIDS]      = {false};
+bool solenoid_buzzing[NUMBER_OF_SOLENOIDS] = {false};
+#ifndef SOLENOID_TIMER_SCHEDULED
+uint16_t solenoid_start[NUMBER_OF_SOLENOIDS] = {0};
+#endif
 #ifdef SOLENOID_PIN_ACTIVE_LOW
 #    define low true
 #    define high false
@@ -40,6 +42,73 @@ static bool solenoid_active_state[NUMBER_OF_SOLENOIDS];
 
 extern haptic_config_t haptic_config;
 
+#ifdef SOLENOID_TIMER_SCHEDULED
+#    ifndef PROTOCOL_CHIBIOS
+#        error "SOLENOID_TIMER_SCHEDULED needs the ChibiOS virtual timers for one-shot on/off callbacks."
+#    endif
+#    include <ch.h>
+
+// One virtual timer per solenoid drives the whole actuation from timer
+// callbacks: fire energizes the pin and schedules the release, buzz mode and
+// pulse trains chain on/off phases from the callback itself. Dwell no longer
+// depends on how often haptic_task() gets around to polling.
+static virtual_timer_t solenoid_vts[NUMBER_OF_SOLENOIDS];
+
+// Pattern playback and buzz bookkeeping, only touched with the system locked.
+static const solenoid_pulse_t *solenoid_pattern_step[NUMBER_OF_SOLENOIDS];
+static uint8_t                 solenoid_pattern_remaining[NUMBER_OF_SOLENOIDS];
+static uint16_t                solenoid_buzz_remaining[NUMBER_OF_SOLENOIDS];
+
+static void solenoid_vt_cb(virtual_timer_t *vtp, void *arg) {
+    const uint8_t index = (uint8_t)(uintptr_t)arg;
+
+    chSysLockFromISR();
+    if (solenoid_buzzing[index]) {
+        // Energized phase complete - release the plunger.
+        writePin(solenoid_pads[index], !solenoid_active_state[index]);
+        solenoid_buzzing[index] = false;
+
+        sysinterval_t gap = 0;
+        if (solenoid_pattern_remaining[index]) {
+            uint8_t off_ms = solenoid_pattern_step[index]->off_ms;
+            solenoid_pattern_remaining[index]--;
+            if (solenoid_pattern_remaining[index]) {
+                solenoid_pattern_step[index]++;
+                // a zero gap between pulses is stretched to the 1ms minimum
+                gap = TIME_MS2I(off_ms ? off_ms : 1);
+            }
+            // the trailing gap of the last pulse is irrelevant
+        } else if (haptic_config.buzz && solenoid_buzz_remaining[index]) {
+            gap = TIME_MS2I(SOLENOID_BUZZ_NONACTUATED);
+        }
+
+        if (gap) {
+            chVTSetI(vtp, gap, solenoid_vt_cb, arg);
+        } else {
+            solenoid_on[index] = false;
+        }
+    } else {
+        // Gap complete - energize for the next pulse.
+        writePin(solenoid_pads[index], solenoid_active_state[index]);
+        solenoid_buzzing[index] = true;
+
+        uint8_t on_ms;
+        if (solenoid_pattern_remaining[index]) {
+            on_ms = solenoid_pattern_step[index]->on_ms;
+        } else {
+            on_ms = SOLENOID_BUZZ_ACTUATED;
+            if (solenoid_buzz_remaining[index] > on_ms) {
+                solenoid_buzz_remaining[index] -= on_ms;
+            } else {
+                solenoid_buzz_remaining[index] = 0;
+            }
+        }
+        chVTSetI(vtp, TIME_MS2I(on_ms ? on_ms : 1), solenoid_vt_cb, arg);
+    }
+    chSysUnlockFromISR();
+}
+#endif // SOLENOID_TIMER_SCHEDULED
+
 void solenoid_buzz_on(void) {
     haptic_set_buzz(1);
 }
@@ -62,6 +131,11 @@ void solenoid_set_dwell(uint8_t dwell) {
  * @param index select which solenoid to check/stop
  */
 void solenoid_stop(uint8_t index) {
+#ifdef SOLENOID_TIMER_SCHEDULED
+    chVTReset(&solenoid_vts[index]);
+    solenoid_pattern_remaining[index] = 0;
+    solenoid_buzz_remaining[index]    = 0;
+#endif
     writePin(solenoid_pads[index], !solenoid_active_state[index]);
     solenoid_on[index]      = false;
     solenoid_buzzing[index] = false;
@@ -76,12 +150,57 @@ void solenoid_fire(uint8_t index) {
     if (!haptic_config.buzz && solenoid_on[index]) return;
     if (haptic_config.buzz && solenoid_buzzing[index]) return;
 
+#ifdef SOLENOID_TIMER_SCHEDULED
+    chSysLock();
+    solenoid_pattern_remaining[index] = 0;
+    solenoid_on[index]                = true;
+    solenoid_buzzing[index]           = true;
+    writePin(solenoid_pads[index], solenoid_active_state[index]);
+    if (haptic_config.buzz) {
+        solenoid_buzz_remaining[index] = solenoid_dwell > SOLENOID_BUZZ_ACTUATED ? solenoid_dwell - SOLENOID_BUZZ_ACTUATED : 0;
+        chVTSetI(&solenoid_vts[index], TIME_MS2I(SOLENOID_BUZZ_ACTUATED), solenoid_vt_cb, (void *)(uintptr_t)index);
+    } else {
+        chVTSetI(&solenoid_vts[index], TIME_MS2I(solenoid_dwell), solenoid_vt_cb, (void *)(uintptr_t)index);
+    }
+    chSysUnlock();
+#else
     solenoid_on[index]      = true;
     solenoid_buzzing[index] = true;
     solenoid_start[index]   = timer_read();
     writePin(solenoid_pads[index], solenoid_active_state[index]);
+#endif
 }
 
+#ifdef SOLENOID_TIMER_SCHEDULED
+/**
+ * @brief Plays a pulse train on a specific solenoid
+ *
+ * Each element energizes the solenoid for on_ms, then releases it for off_ms
+ * before the next pulse; the trailing gap of the last pulse is skipped. The
+ * pattern is read during playback from timer callbacks, so it must outlive
+ * the train - pass a static const array. Replaces whatever the solenoid was
+ * doing.
+ *
+ * @param index   Selects which solenoid to play on
+ * @param pattern Pulse train, length elements
+ * @param length  Number of pulses
+ */
+void solenoid_play_pattern(uint8_t index, const solenoid_pulse_t *pattern, uint8_t length) {
+    if (length == 0) return;
+
+    chSysLock();
+    chVTResetI(&solenoid_vts[index]);
+    solenoid_pattern_step[index]      = pattern;
+    solenoid_pattern_remaining[index] = length;
+    solenoid_buzz_remaining[index]    = 0;
+    solenoid_on[index]                = true;
+    solenoid_buzzing[index]           = true;
+    writePin(solenoid_pads[index], solenoid_active_state[index]);
+    chVTSetI(&solenoid_vts[index], TIME_MS2I(pattern->on_ms ? pattern->on_ms : 1), solenoid_vt_cb, (void *)(uintptr_t)index);
+    chSysUnlock();
+}
+#endif
+
 /**
  * @brief Handles selecting a non-active solenoid, and firing it.
  *
@@ -106,6 +225,7 @@ void solenoid_fire_handler(void) {
 #endif
 }
 
+#ifndef SOLENOID_TIMER_SCHEDULED
 /**
  * @brief Checks active solenoid to stop them, and to handle buzz mode
  *
@@ -140,6 +260,7 @@ void solenoid_check(void) {
         }
     }
 }
+#endif // !SOLENOID_TIMER_SCHEDULED
 
 /**
  * @brief Initial configuration for solenoids
@@ -171,6 +292,10 @@ void solenoid_setup(void) {
  */
 void solenoid_shutdown(void) {
     for (uint8_t i = 0; i < NUMBER_OF_SOLENOIDS; i++) {
+#ifdef SOLENOID_TIMER_SCHEDULED
+        // a pending callback could re-energize the pin after this loop
+        chVTReset(&solenoid_vts[i]);
+#endif
         writePin(solenoid_pads[i], !solenoid_active_state[i]);
     }
 }
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <stdint.h>
+
 #ifndef SOLENOID_DEFAULT_DWELL
 #    define SOLENOID_DEFAULT_DWELL 12
 #endif
@@ -64,7 +66,17 @@ void solenoid_stop(uint8_t index);
 void solenoid_fire(uint8_t index);
 void solenoid_fire_handler(void);
 
+#ifdef SOLENOID_TIMER_SCHEDULED
+// One element of a pulse train: energize for on_ms, release for off_ms.
+typedef struct {
+    uint8_t on_ms;
+    uint8_t off_ms;
+} solenoid_pulse_t;
+
+void solenoid_play_pattern(uint8_t index, const solenoid_pulse_t *pattern, uint8_t length);
+#else
 void solenoid_check(void);
+#endif
 
 void solenoid_setup(void);
 void solenoid_shutdown(void);
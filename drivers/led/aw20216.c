@@ -64,6 +64,42 @@
 uint8_t g_pwm_buffer[DRIVER_COUNT][AW_PWM_REGISTER_COUNT];
 bool    g_pwm_buffer_update_required[DRIVER_COUNT] = {false};
 
+#ifdef AW_FRAME_STREAMING
+#    include <string.h>
+// (ChibiOS only.) The whole PWM frame goes out as one background DMA chain: a
+// two-byte command/register header descriptor followed by a snapshot of the
+// PWM page. Chip select stays asserted by the SPI session for the duration of
+// the chain, so the flush call returns after transaction setup and the frame
+// streams out while scanning continues. The previous frame's chain is drained
+// before the shared buffers are reused.
+static uint8_t             s_frame_header[2];
+static uint8_t             s_frame_snapshot[AW_PWM_REGISTER_COUNT];
+static spi_sg_descriptor_t s_frame_chain[2];
+static bool                s_frame_in_flight = false;
+
+static void AW20216_stream_frame(pin_t cs_pin, uint8_t index) {
+    if (s_frame_in_flight) {
+        // Waits for the chain to drain, then releases chip select.
+        spi_stop();
+        s_frame_in_flight = false;
+    }
+
+    memcpy(s_frame_snapshot, g_pwm_buffer[index], AW_PWM_REGISTER_COUNT);
+
+    if (!spi_start(cs_pin, false, AW_SPI_MODE, AW_SPI_DIVISOR)) {
+        spi_stop();
+        return;
+    }
+
+    s_frame_header[0] = (AWINIC_ID | AW_PAGE_PWM | AW_WRITE);
+    s_frame_header[1] = 0;
+    s_frame_chain[0]  = (spi_sg_descriptor_t){.data = s_frame_header, .length = 2};
+    s_frame_chain[1]  = (spi_sg_descriptor_t){.data = s_frame_snapshot, .length = AW_PWM_REGISTER_COUNT};
+    spi_transmit_async_sg(s_frame_chain, 2);
+    s_frame_in_flight = true;
+}
+#endif
+
 bool AW20216_write(pin_t cs_pin, uint8_t page, uint8_t reg, uint8_t* data, uint8_t len) {
     static uint8_t s_spi_transfer_buffer[2] = {0};
 
@@ -140,7 +176,11 @@ void AW20216_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 
 void AW20216_update_pwm_buffers(pin_t cs_pin, uint8_t index) {
     if (g_pwm_buffer_update_required[index]) {
+#ifdef AW_FRAME_STREAMING
+        AW20216_stream_frame(cs_pin, index);
+#else
         AW20216_write(cs_pin, AW_PAGE_PWM, 0, g_pwm_buffer[index], AW_PWM_REGISTER_COUNT);
+#endif
     }
     g_pwm_buffer_update_required[index] = false;
 }
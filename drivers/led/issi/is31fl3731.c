@@ -68,6 +68,12 @@ uint8_t g_twi_transfer_buffer[20];
 uint8_t g_pwm_buffer[DRIVER_COUNT][144];
 bool    g_pwm_buffer_update_required[DRIVER_COUNT] = {false};
 
+// Dirty window over g_pwm_buffer, tracked per driver so flushes only cover
+// the 16-byte transfer chunks that actually changed since the last write.
+// first > last means the buffer is clean.
+static uint8_t g_pwm_buffer_dirty_first[DRIVER_COUNT] = {[0 ... DRIVER_COUNT - 1] = 143};
+static uint8_t g_pwm_buffer_dirty_last[DRIVER_COUNT]  = {0};
+
 uint8_t g_led_control_registers[DRIVER_COUNT][18]             = {{0}};
 bool    g_led_control_registers_update_required[DRIVER_COUNT] = {false};
 
@@ -98,14 +104,15 @@ void IS31FL3731_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
 #endif
 }
 
-void IS31FL3731_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+// Transmit the 16-byte chunks of pwm_buffer covering [first, last].
+static void IS31FL3731_write_pwm_window(uint8_t addr, uint8_t *pwm_buffer, uint8_t first, uint8_t last) {
     // assumes bank is already selected
 
-    // transmit PWM registers in 9 transfers of 16 bytes
+    // transmit PWM registers in up to 9 transfers of 16 bytes
     // g_twi_transfer_buffer[] is 20 bytes
 
     // iterate over the pwm_buffer contents at 16 byte intervals
-    for (int i = 0; i < 144; i += 16) {
+    for (int i = first & ~15; i <= last && i < 144; i += 16) {
         // set the first register, e.g. 0x24, 0x34, 0x44, etc.
         g_twi_transfer_buffer[0] = 0x24 + i;
         // copy the data from i to i+15
@@ -125,6 +132,10 @@ void IS31FL3731_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
     }
 }
 
+void IS31FL3731_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+    IS31FL3731_write_pwm_window(addr, pwm_buffer, 0, 143);
+}
+
 void IS31FL3731_init(uint8_t addr) {
     // In order to avoid the LEDs being driven with garbage data
     // in the LED driver's PWM registers, first enable software shutdown,
@@ -180,16 +191,27 @@ void IS31FL3731_init(uint8_t addr) {
     IS31FL3731_write_register(addr, ISSI_COMMANDREGISTER, 0);
 }
 
+// Update one PWM buffer byte, extending the dirty window on change.
+static void IS31FL3731_write_pwm_channel(uint8_t driver, uint8_t offset, uint8_t value) {
+    if (g_pwm_buffer[driver][offset] == value) {
+        return;
+    }
+    g_pwm_buffer[driver][offset] = value;
+    if (offset < g_pwm_buffer_dirty_first[driver]) g_pwm_buffer_dirty_first[driver] = offset;
+    if (offset > g_pwm_buffer_dirty_last[driver]) g_pwm_buffer_dirty_last[driver] = offset;
+    g_pwm_buffer_update_required[driver] = true;
+}
+
 void IS31FL3731_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
     is31_led led;
     if (index >= 0 && index < RGB_MATRIX_LED_COUNT) {
         memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
 
-        // Subtract 0x24 to get the second index of g_pwm_buffer
-        g_pwm_buffer[led.driver][led.r - 0x24]   = red;
-        g_pwm_buffer[led.driver][led.g - 0x24]   = green;
-        g_pwm_buffer[led.driver][led.b - 0x24]   = blue;
-        g_pwm_buffer_update_required[led.driver] = true;
+        // Subtract 0x24 to get the second index of g_pwm_buffer;
+        // only mark what actually changed so unchanged frames flush nothing
+        IS31FL3731_write_pwm_channel(led.driver, led.r - 0x24, red);
+        IS31FL3731_write_pwm_channel(led.driver, led.g - 0x24, green);
+        IS31FL3731_write_pwm_channel(led.driver, led.b - 0x24, blue);
     }
 }
 
@@ -231,7 +253,9 @@ void IS31FL3731_set_led_control_register(uint8_t index, bool red, bool green, bo
 
 void IS31FL3731_update_pwm_buffers(uint8_t addr, uint8_t index) {
     if (g_pwm_buffer_update_required[index]) {
-        IS31FL3731_write_pwm_buffer(addr, g_pwm_buffer[index]);
+        IS31FL3731_write_pwm_window(addr, g_pwm_buffer[index], g_pwm_buffer_dirty_first[index], g_pwm_buffer_dirty_last[index]);
+        g_pwm_buffer_dirty_first[index] = 143;
+        g_pwm_buffer_dirty_last[index]  = 0;
     }
     g_pwm_buffer_update_required[index] = false;
 }
@@ -21,6 +21,10 @@
 #include "i2c_master.h"
 #include "wait.h"
 
+#ifdef I2C_ASYNC_ENABLE
+#    include <string.h>
+#endif
+
 // This is a 7-bit address, that gets left-shifted and bit 0
 // set to 0 for write, 1 for read (as per I2C protocol)
 // The address will vary depending on your wiring:
@@ -85,6 +89,12 @@ uint8_t g_twi_transfer_buffer[20];
 uint8_t g_pwm_buffer[DRIVER_COUNT][192];
 bool    g_pwm_buffer_update_required[DRIVER_COUNT] = {false};
 
+// Dirty window over g_pwm_buffer, tracked per driver so flushes only cover
+// the 16-byte transfer chunks that actually changed since the last write.
+// first > last means the buffer is clean.
+static uint8_t g_pwm_buffer_dirty_first[DRIVER_COUNT] = {[0 ... DRIVER_COUNT - 1] = 191};
+static uint8_t g_pwm_buffer_dirty_last[DRIVER_COUNT]  = {0};
+
 uint8_t g_led_control_registers[DRIVER_COUNT][24]             = {0};
 bool    g_led_control_registers_update_required[DRIVER_COUNT] = {false};
 
@@ -107,14 +117,15 @@ bool IS31FL3733_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
     return true;
 }
 
-bool IS31FL3733_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+// Transmit the 16-byte chunks of pwm_buffer covering [first, last].
+static bool IS31FL3733_write_pwm_window(uint8_t addr, uint8_t *pwm_buffer, uint8_t first, uint8_t last) {
     // Assumes PG1 is already selected.
     // If any of the transactions fails function returns false.
-    // Transmit PWM registers in 12 transfers of 16 bytes.
+    // Transmit PWM registers in up to 12 transfers of 16 bytes.
     // g_twi_transfer_buffer[] is 20 bytes
 
     // Iterate over the pwm_buffer contents at 16 byte intervals.
-    for (int i = 0; i < 192; i += 16) {
+    for (int i = first & ~15; i <= last && i < 192; i += 16) {
         g_twi_transfer_buffer[0] = i;
         // Copy the data from i to i+15.
         // Device will auto-increment register for data after the first byte
@@ -138,6 +149,58 @@ bool IS31FL3733_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
     return true;
 }
 
+bool IS31FL3733_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+    return IS31FL3733_write_pwm_window(addr, pwm_buffer, 0, 191);
+}
+
+#ifdef I2C_ASYNC_ENABLE
+// Flushes run as jobs on the I2C worker thread, so the bus traffic overlaps
+// with matrix scanning. Each job reads from a driver-owned snapshot taken at
+// submission time; g_pwm_buffer and g_led_control_registers stay writable
+// while a flush is in flight. Jobs execute one at a time, which also keeps
+// the command-register page selects of different jobs from interleaving.
+typedef struct {
+    uint8_t addr;
+    uint8_t index;
+    uint8_t first;
+    uint8_t last;
+} is31fl3733_pwm_job_t;
+
+typedef struct {
+    uint8_t addr;
+    uint8_t index;
+    uint8_t registers[24];
+} is31fl3733_led_control_job_t;
+
+static uint8_t                      g_pwm_flush_buffer[DRIVER_COUNT][192];
+static is31fl3733_pwm_job_t         g_pwm_job[DRIVER_COUNT];
+static volatile bool                g_pwm_job_in_flight[DRIVER_COUNT]         = {false};
+static is31fl3733_led_control_job_t g_led_control_job[DRIVER_COUNT];
+static volatile bool                g_led_control_job_in_flight[DRIVER_COUNT] = {false};
+
+static void IS31FL3733_pwm_flush_job(void *context) {
+    is31fl3733_pwm_job_t *job = context;
+    IS31FL3733_write_register(job->addr, ISSI_COMMANDREGISTER_WRITELOCK, 0xC5);
+    IS31FL3733_write_register(job->addr, ISSI_COMMANDREGISTER, ISSI_PAGE_PWM);
+    // If any of the transactions fail we risk writing dirty PG0,
+    // refresh page 0 just in case.
+    if (!IS31FL3733_write_pwm_window(job->addr, g_pwm_flush_buffer[job->index], job->first, job->last)) {
+        g_led_control_registers_update_required[job->index] = true;
+    }
+    g_pwm_job_in_flight[job->index] = false;
+}
+
+static void IS31FL3733_led_control_flush_job(void *context) {
+    is31fl3733_led_control_job_t *job = context;
+    IS31FL3733_write_register(job->addr, ISSI_COMMANDREGISTER_WRITELOCK, 0xC5);
+    IS31FL3733_write_register(job->addr, ISSI_COMMANDREGISTER, ISSI_PAGE_LEDCONTROL);
+    for (int i = 0; i < 24; i++) {
+        IS31FL3733_write_register(job->addr, i, job->registers[i]);
+    }
+    g_led_control_job_in_flight[job->index] = false;
+}
+#endif
+
 void IS31FL3733_init(uint8_t addr, uint8_t sync) {
     // In order to avoid the LEDs being driven with garbage data
     // in the LED driver's PWM registers, shutdown is enabled last.
@@ -184,15 +247,26 @@ void IS31FL3733_init(uint8_t addr, uint8_t sync) {
     wait_ms(10);
 }
 
+// Update one PWM buffer byte, extending the dirty window on change.
+static void IS31FL3733_write_pwm_channel(uint8_t driver, uint8_t offset, uint8_t value) {
+    if (g_pwm_buffer[driver][offset] == value) {
+        return;
+    }
+    g_pwm_buffer[driver][offset] = value;
+    if (offset < g_pwm_buffer_dirty_first[driver]) g_pwm_buffer_dirty_first[driver] = offset;
+    if (offset > g_pwm_buffer_dirty_last[driver]) g_pwm_buffer_dirty_last[driver] = offset;
+    g_pwm_buffer_update_required[driver] = true;
+}
+
 void IS31FL3733_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
     is31_led led;
     if (index >= 0 && index < RGB_MATRIX_LED_COUNT) {
         memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
 
-        g_pwm_buffer[led.driver][led.r]          = red;
-        g_pwm_buffer[led.driver][led.g]          = green;
-        g_pwm_buffer[led.driver][led.b]          = blue;
-        g_pwm_buffer_update_required[led.driver] = true;
+        // Only mark what actually changed so unchanged frames flush nothing
+        IS31FL3733_write_pwm_channel(led.driver, led.r, red);
+        IS31FL3733_write_pwm_channel(led.driver, led.g, green);
+        IS31FL3733_write_pwm_channel(led.driver, led.b, blue);
     }
 }
 
@@ -234,27 +308,64 @@ void IS31FL3733_set_led_control_register(uint8_t index, bool red, bool green, bo
 
 void IS31FL3733_update_pwm_buffers(uint8_t addr, uint8_t index) {
     if (g_pwm_buffer_update_required[index]) {
+#ifdef I2C_ASYNC_ENABLE
+        // A flush of this driver is still draining; keep the update flag so
+        // the fresh data goes out on the next invocation.
+        if (g_pwm_job_in_flight[index]) {
+            return;
+        }
+        uint8_t first = g_pwm_buffer_dirty_first[index];
+        uint8_t last  = g_pwm_buffer_dirty_last[index];
+        if (first <= last) {
+            uint8_t start = first & ~15;
+            memcpy(&g_pwm_flush_buffer[index][start], &g_pwm_buffer[index][start], (last | 15) - start + 1);
+            g_pwm_job[index]           = (is31fl3733_pwm_job_t){.addr = addr, .index = index, .first = first, .last = last};
+            g_pwm_job_in_flight[index] = true;
+            if (!i2c_async_submit(IS31FL3733_pwm_flush_job, &g_pwm_job[index], I2C_ASYNC_PRIORITY_LOW)) {
+                // Queue full; retry next frame.
+                g_pwm_job_in_flight[index] = false;
+                return;
+            }
+        }
+#else
         // Firstly we need to unlock the command register and select PG1.
         IS31FL3733_write_register(addr, ISSI_COMMANDREGISTER_WRITELOCK, 0xC5);
         IS31FL3733_write_register(addr, ISSI_COMMANDREGISTER, ISSI_PAGE_PWM);
 
         // If any of the transactions fail we risk writing dirty PG0,
         // refresh page 0 just in case.
-        if (!IS31FL3733_write_pwm_buffer(addr, g_pwm_buffer[index])) {
+        if (!IS31FL3733_write_pwm_window(addr, g_pwm_buffer[index], g_pwm_buffer_dirty_first[index], g_pwm_buffer_dirty_last[index])) {
             g_led_control_registers_update_required[index] = true;
         }
+#endif
+        g_pwm_buffer_dirty_first[index] = 191;
+        g_pwm_buffer_dirty_last[index]  = 0;
     }
     g_pwm_buffer_update_required[index] = false;
 }
 
 void IS31FL3733_update_led_control_registers(uint8_t addr, uint8_t index) {
     if (g_led_control_registers_update_required[index]) {
+#ifdef I2C_ASYNC_ENABLE
+        if (g_led_control_job_in_flight[index]) {
+            return;
+        }
+        g_led_control_job[index].addr  = addr;
+        g_led_control_job[index].index = index;
+        memcpy(g_led_control_job[index].registers, g_led_control_registers[index], 24);
+        g_led_control_job_in_flight[index] = true;
+        if (!i2c_async_submit(IS31FL3733_led_control_flush_job, &g_led_control_job[index], I2C_ASYNC_PRIORITY_LOW)) {
+            g_led_control_job_in_flight[index] = false;
+            return;
+        }
+#else
         // Firstly we need to unlock the command register and select PG0
         IS31FL3733_write_register(addr, ISSI_COMMANDREGISTER_WRITELOCK, 0xC5);
         IS31FL3733_write_register(addr, ISSI_COMMANDREGISTER, ISSI_PAGE_LEDCONTROL);
         for (int i = 0; i < 24; i++) {
             IS31FL3733_write_register(addr, i, g_led_control_registers[index][i]);
         }
+#endif
     }
     g_led_control_registers_update_required[index] = false;
 }
@@ -90,6 +90,15 @@ bool    g_scaling_registers_update_required[DRIVER_COUNT] = {false};
 
 uint8_t g_scaling_registers[DRIVER_COUNT][ISSI_MAX_LEDS];
 
+// Dirty tracking at the chip's natural 18-register transfer granularity. The
+// PG0/PG1 boundary at register 180 falls exactly on a chunk boundary, so a
+// chunk never straddles pages and a flush only re-selects the page when the
+// next dirty chunk actually crosses into PG1.
+#define ISSI_PWM_CHUNK_SIZE 18
+#define ISSI_PWM_CHUNK_COUNT 20 // 19 full chunks plus the 9-register tail
+#define ISSI_PWM_CHUNK_TAIL 9
+static uint32_t g_pwm_buffer_dirty[DRIVER_COUNT] = {0};
+
 void IS31FL3741_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
     g_twi_transfer_buffer[0] = reg;
     g_twi_transfer_buffer[1] = data;
@@ -103,52 +112,68 @@ void IS31FL3741_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
 #endif
 }
 
-bool IS31FL3741_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
-    // unlock the command register and select PG2
-    IS31FL3741_write_register(addr, ISSI_COMMANDREGISTER_WRITELOCK, 0xC5);
-    IS31FL3741_write_register(addr, ISSI_COMMANDREGISTER, ISSI_PAGE_PWM0);
+static bool IS31FL3741_write_pwm_chunks(uint8_t addr, uint8_t *pwm_buffer, uint32_t dirty) {
+    uint8_t current_page = 0xFF;
 
-    for (int i = 0; i < 342; i += 18) {
-        if (i == 180) {
-            // unlock the command register and select PG2
+    for (uint8_t chunk = 0; chunk < ISSI_PWM_CHUNK_COUNT; chunk++) {
+        if (!(dirty & ((uint32_t)1 << chunk))) {
+            continue;
+        }
+
+        uint16_t offset = chunk * ISSI_PWM_CHUNK_SIZE;
+        uint8_t  page   = (offset < 180) ? ISSI_PAGE_PWM0 : ISSI_PAGE_PWM1;
+        if (page != current_page) {
+            // unlock the command register and select the PWM page
             IS31FL3741_write_register(addr, ISSI_COMMANDREGISTER_WRITELOCK, 0xC5);
-            IS31FL3741_write_register(addr, ISSI_COMMANDREGISTER, ISSI_PAGE_PWM1);
+            IS31FL3741_write_register(addr, ISSI_COMMANDREGISTER, page);
+            current_page = page;
         }
 
-        g_twi_transfer_buffer[0] = i % 180;
-        memcpy(g_twi_transfer_buffer + 1, pwm_buffer + i, 18);
+        uint8_t len = (chunk == ISSI_PWM_CHUNK_COUNT - 1) ? ISSI_PWM_CHUNK_TAIL : ISSI_PWM_CHUNK_SIZE;
+
+        g_twi_transfer_buffer[0] = offset % 180;
+        memcpy(g_twi_transfer_buffer + 1, pwm_buffer + offset, len);
 
 #if ISSI_PERSISTENCE > 0
         for (uint8_t i = 0; i < ISSI_PERSISTENCE; i++) {
-            if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 19, ISSI_TIMEOUT) != 0) {
+            if (i2c_transmit(addr << 1, g_twi_transfer_buffer, len + 1, ISSI_TIMEOUT) != 0) {
                 return false;
             }
         }
 #else
-        if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 19, ISSI_TIMEOUT) != 0) {
+        if (i2c_transmit(addr << 1, g_twi_transfer_buffer, len + 1, ISSI_TIMEOUT) != 0) {
             return false;
         }
 #endif
     }
 
-    // transfer the left cause the total number is 351
-    g_twi_transfer_buffer[0] = 162;
-    memcpy(g_twi_transfer_buffer + 1, pwm_buffer + 342, 9);
+    return true;
+}
 
-#if ISSI_PERSISTENCE > 0
-    for (uint8_t i = 0; i < ISSI_PERSISTENCE; i++) {
-        if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 10, ISSI_TIMEOUT) != 0) {
-            return false;
-        }
-    }
-#else
-    if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 10, ISSI_TIMEOUT) != 0) {
-        return false;
-    }
-#endif
+bool IS31FL3741_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+    return IS31FL3741_write_pwm_chunks(addr, pwm_buffer, ((uint32_t)1 << ISSI_PWM_CHUNK_COUNT) - 1);
+}
 
-    return true;
+#ifdef I2C_ASYNC_ENABLE
+// Flushes run as jobs on the I2C worker thread, reading from a driver-owned
+// snapshot taken at submission time so g_pwm_buffer stays writable while a
+// flush is in flight. Only the dirty chunks are snapshotted and transmitted.
+typedef struct {
+    uint8_t  addr;
+    uint8_t  index;
+    uint32_t dirty;
+} is31fl3741_pwm_job_t;
+
+static uint8_t              g_pwm_flush_buffer[DRIVER_COUNT][ISSI_MAX_LEDS];
+static is31fl3741_pwm_job_t g_pwm_job[DRIVER_COUNT];
+static volatile bool        g_pwm_job_in_flight[DRIVER_COUNT] = {false};
+
+static void IS31FL3741_pwm_flush_job(void *context) {
+    is31fl3741_pwm_job_t *job = context;
+    IS31FL3741_write_pwm_chunks(job->addr, g_pwm_flush_buffer[job->index], job->dirty);
+    g_pwm_job_in_flight[job->index] = false;
 }
+#endif
 
 void IS31FL3741_init(uint8_t addr) {
     // In order to avoid the LEDs being driven with garbage data
@@ -182,9 +207,14 @@ void IS31FL3741_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
     if (index >= 0 && index < RGB_MATRIX_LED_COUNT) {
         memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
 
-        g_pwm_buffer[led.driver][led.r]          = red;
-        g_pwm_buffer[led.driver][led.g]          = green;
-        g_pwm_buffer[led.driver][led.b]          = blue;
+        // Skip the update entirely if the color is unchanged
+        if (g_pwm_buffer[led.driver][led.r] == red && g_pwm_buffer[led.driver][led.g] == green && g_pwm_buffer[led.driver][led.b] == blue) {
+            return;
+        }
+        g_pwm_buffer[led.driver][led.r] = red;
+        g_pwm_buffer[led.driver][led.g] = green;
+        g_pwm_buffer[led.driver][led.b] = blue;
+        g_pwm_buffer_dirty[led.driver] |= ((uint32_t)1 << (led.r / ISSI_PWM_CHUNK_SIZE)) | ((uint32_t)1 << (led.g / ISSI_PWM_CHUNK_SIZE)) | ((uint32_t)1 << (led.b / ISSI_PWM_CHUNK_SIZE));
         g_pwm_buffer_update_required[led.driver] = true;
     }
 }
@@ -222,7 +252,30 @@ void IS31FL3741_set_led_control_register(uint8_t index, bool red, bool green, bo
 
 void IS31FL3741_update_pwm_buffers(uint8_t addr, uint8_t index) {
     if (g_pwm_buffer_update_required[index]) {
-        IS31FL3741_write_pwm_buffer(addr, g_pwm_buffer[index]);
+#ifdef I2C_ASYNC_ENABLE
+        // A flush of this driver is still draining; keep the dirty state so
+        // the fresh data goes out on the next invocation.
+        if (g_pwm_job_in_flight[index]) {
+            return;
+        }
+        uint32_t dirty = g_pwm_buffer_dirty[index];
+        for (uint8_t chunk = 0; chunk < ISSI_PWM_CHUNK_COUNT; chunk++) {
+            if (dirty & ((uint32_t)1 << chunk)) {
+                uint16_t offset = chunk * ISSI_PWM_CHUNK_SIZE;
+                memcpy(&g_pwm_flush_buffer[index][offset], &g_pwm_buffer[index][offset], (chunk == ISSI_PWM_CHUNK_COUNT - 1) ? ISSI_PWM_CHUNK_TAIL : ISSI_PWM_CHUNK_SIZE);
+            }
+        }
+        g_pwm_job[index]           = (is31fl3741_pwm_job_t){.addr = addr, .index = index, .dirty = dirty};
+        g_pwm_job_in_flight[index] = true;
+        if (!i2c_async_submit(IS31FL3741_pwm_flush_job, &g_pwm_job[index], I2C_ASYNC_PRIORITY_LOW)) {
+            // Queue full; retry next frame.
+            g_pwm_job_in_flight[index] = false;
+            return;
+        }
+#else
+        IS31FL3741_write_pwm_chunks(addr, g_pwm_buffer[index], g_pwm_buffer_dirty[index]);
+#endif
+        g_pwm_buffer_dirty[index] = 0;
     }
 
     g_pwm_buffer_update_required[index] = false;
@@ -233,6 +286,7 @@ void IS31FL3741_set_pwm_buffer(const is31_led *pled, uint8_t red, uint8_t green,
     g_pwm_buffer[pled->driver][pled->g] = green;
     g_pwm_buffer[pled->driver][pled->b] = blue;
 
+    g_pwm_buffer_dirty[pled->driver] |= ((uint32_t)1 << (pled->r / ISSI_PWM_CHUNK_SIZE)) | ((uint32_t)1 << (pled->g / ISSI_PWM_CHUNK_SIZE)) | ((uint32_t)1 << (pled->b / ISSI_PWM_CHUNK_SIZE));
     g_pwm_buffer_update_required[pled->driver] = true;
 }
 
@@ -203,6 +203,13 @@ void oled_clear(void);
 // Renders the dirty chunks of the buffer to oled display
 void oled_render(void);
 
+#ifdef OLED_RENDER_ASYNC
+// Hands the dirty chunks of the buffer to the background flush thread
+// Returns true if the frame was accepted (or there was nothing to send),
+// false while a previously submitted frame is still being flushed
+bool oled_render_async(void);
+#endif
+
 // Moves cursor to character position indicated by column and line, wraps if out of bounds
 // Max column denoted by 'oled_max_chars()' and max lines by 'oled_max_lines()' functions
 void oled_set_cursor(uint8_t col, uint8_t line);
@@ -230,6 +237,12 @@ void oled_write(const char *data, bool invert);
 // Advances the cursor to the next page, wiring ' ' to the remainder of the current page
 void oled_write_ln(const char *data, bool invert);
 
+// Batched blit of a run of printable characters at the current cursor position
+// The dirty mask is updated once for the whole run instead of per character,
+// making this the cheapest way to redraw full-line status bars every scan
+// Control characters are not interpreted; the run is clipped at the end of the buffer
+void oled_write_aligned(const char *data, bool invert);
+
 // Pans the buffer to the right (or left by passing true) by moving contents of the buffer
 // Useful for moving the screen in preparation for new drawing
 void oled_pan(bool left);
@@ -0,0 +1,45 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "oled_widget.h"
+
+typedef struct oled_widget_t {
+    oled_widget_state_fn  state;
+    oled_widget_render_fn render;
+    uint32_t              last_state;
+    bool                  force_render;
+} oled_widget_t;
+
+static oled_widget_t oled_widgets[OLED_WIDGET_COUNT_MAX];
+static uint8_t       oled_widget_count = 0;
+
+bool oled_widget_register(oled_widget_state_fn state, oled_widget_render_fn render) {
+    if (oled_widget_count >= OLED_WIDGET_COUNT_MAX || !state || !render) {
+        return false;
+    }
+
+    oled_widget_t *widget = &oled_widgets[oled_widget_count++];
+    widget->state         = state;
+    widget->render        = render;
+    widget->force_render  = true;
+    return true;
+}
+
+void oled_widget_task(void) {
+    for (uint8_t i = 0; i < oled_widget_count; i++) {
+        oled_widget_t *widget  = &oled_widgets[i];
+        uint32_t       current = widget->state();
+        if (!widget->force_render && current == widget->last_state) {
+            continue;
+        }
+        widget->last_state   = current;
+        widget->force_render = false;
+        widget->render(current);
+    }
+}
+
+void oled_widget_invalidate(void) {
+    for (uint8_t i = 0; i < oled_widget_count; i++) {
+        oled_widgets[i].force_render = true;
+    }
+}
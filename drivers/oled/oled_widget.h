@@ -0,0 +1,73 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * \file
+ *
+ * \defgroup oled_widget OLED Widget API
+ *
+ * Declarative widgets for the OLED driver. Each widget pairs a cheap state
+ * snapshot function with a render function; `oled_widget_task()` calls the
+ * render function only when the snapshot has changed since the last pass, so
+ * static screen content costs a handful of comparisons per frame instead of
+ * a full redraw into the display buffer.
+ * \{
+ */
+
+#ifndef OLED_WIDGET_COUNT_MAX
+#    define OLED_WIDGET_COUNT_MAX 8
+#endif
+
+/**
+ * \brief Snapshot of the state a widget displays.
+ *
+ * Must be cheap to compute; it is evaluated on every `oled_widget_task()`
+ * call. Fold everything the render function depends on into the value, e.g.
+ * `layer_state`, `get_mods()`, or `get_current_wpm()`.
+ */
+typedef uint32_t (*oled_widget_state_fn)(void);
+
+/**
+ * \brief Draw the widget.
+ *
+ * Called only when the state snapshot differs from the previous pass. The
+ * render function is responsible for positioning via `oled_set_cursor()`.
+ *
+ * \param state The snapshot the widget is being rendered for.
+ */
+typedef void (*oled_widget_render_fn)(uint32_t state);
+
+/**
+ * \brief Register a widget.
+ *
+ * The widget renders unconditionally on the first `oled_widget_task()` pass
+ * after registration.
+ *
+ * \param state The state snapshot function.
+ * \param render The render function.
+ *
+ * \return `true` on success, `false` if the widget table is full.
+ */
+bool oled_widget_register(oled_widget_state_fn state, oled_widget_render_fn render);
+
+/**
+ * \brief Render all widgets whose state has changed.
+ *
+ * Call this from `oled_task_user()` in place of unconditional drawing code.
+ */
+void oled_widget_task(void);
+
+/**
+ * \brief Force every widget to re-render on the next task pass.
+ *
+ * Needed after the display buffer has been wiped behind the widgets' backs,
+ * e.g. by `oled_clear()`.
+ */
+void oled_widget_invalidate(void);
+
+/** \} */
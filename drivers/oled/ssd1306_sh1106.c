@@ -26,6 +26,13 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "keyboard.h"
 
+#ifdef OLED_RENDER_ASYNC
+#    if !defined(PROTOCOL_CHIBIOS)
+#        error "OLED_RENDER_ASYNC requires a background flush thread and is only supported on ChibiOS."
+#    endif
+#    include <ch.h>
+#endif
+
 // Used commands from spec sheet: https://cdn-shop.adafruit.com/datasheets/SSD1306.pdf
 // for SH1106: https://www.velleman.eu/downloads/29/infosheets/sh1106_datasheet.pdf
 
@@ -105,6 +112,19 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #define HAS_FLAGS(bits, flags) ((bits & flags) == flags)
 
+#ifdef OLED_FONT_RAM_CACHE
+#    if defined(__AVR__)
+#        error "OLED_FONT_RAM_CACHE trades RAM for zero-wait-state reads on ARM; AVR gains nothing from it."
+#    endif
+// RAM copy of the font, filled once in oled_init(). On parts running with
+// flash wait-states this makes every glyph fetch a zero-wait SRAM read, and
+// the alignment lets memcpy move whole words.
+static uint8_t font_ram_cache[sizeof(font)] __attribute__((aligned(4)));
+#    define FONT_GLYPH_COPY(dest, offset) memcpy((dest), &font_ram_cache[offset], OLED_FONT_WIDTH)
+#else
+#    define FONT_GLYPH_COPY(dest, offset) memcpy_P((dest), &font[offset], OLED_FONT_WIDTH)
+#endif
+
 // Display buffer's is the same as the OLED memory layout
 // this is so we don't end up with rounding errors with
 // parts of the display unusable or don't get cleared correctly
@@ -134,6 +154,17 @@ uint16_t oled_update_timeout;
 
 // Internal variables to reduce math instructions
 
+#ifdef OLED_RENDER_ASYNC
+// Snapshot of the frame currently streaming out to the display. oled_buffer
+// stays writable while the flush thread drains this copy, so rendering code
+// never waits on the bus.
+static uint8_t                  oled_flush_buffer[OLED_MATRIX_SIZE];
+static volatile OLED_BLOCK_TYPE oled_flush_dirty = 0;
+static binary_semaphore_t       oled_flush_signal;
+static THD_WORKING_AREA(waOledFlushThread, 512);
+static THD_FUNCTION(OledFlushThread, arg);
+#endif
+
 #if defined(__AVR__)
 // identical to i2c_transmit, but for PROGMEM since all initialization is in PROGMEM arrays currently
 // probably should move this into i2c_master...
@@ -175,6 +206,10 @@ bool oled_init(oled_rotation_t rotation) {
     }
     i2c_init();
 
+#ifdef OLED_FONT_RAM_CACHE
+    memcpy_P(font_ram_cache, font, sizeof(font));
+#endif
+
     static const uint8_t PROGMEM display_setup1[] = {
         I2C_CMD,
         DISPLAY_OFF,
@@ -229,6 +264,17 @@ bool oled_init(oled_rotation_t rotation) {
     oled_initialized = true;
     oled_active      = true;
     oled_scrolling   = false;
+
+#ifdef OLED_RENDER_ASYNC
+    // The flush thread runs below the main thread so draining a frame never
+    // delays matrix scanning; the I2C transfers themselves are DMA driven.
+    static bool flush_thread_started = false;
+    if (!flush_thread_started) {
+        chBSemObjectInit(&oled_flush_signal, true);
+        chThdCreateStatic(waOledFlushThread, sizeof(waOledFlushThread), LOWPRIO, OledFlushThread, NULL);
+        flush_thread_started = true;
+    }
+#endif
     return true;
 }
 
@@ -290,6 +336,114 @@ static void rotate_90(const uint8_t *src, uint8_t *dest) {
     }
 }
 
+// Sends one block of the passed framebuffer to the display, bounds command
+// followed by the data chunk. Returns false on any I2C failure.
+static bool oled_send_block(const uint8_t *buffer, uint8_t update_start) {
+    // Set column & page position
+    static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
+    if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+        calc_bounds(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
+    } else {
+        calc_bounds_90(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
+    }
+
+    // Send column & page position
+    if (I2C_TRANSMIT(display_start) != I2C_STATUS_SUCCESS) {
+        print("oled_render offset command failed\n");
+        return false;
+    }
+
+    if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+        // Send render data chunk as is
+        if (I2C_WRITE_REG(I2C_DATA, &buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE) != I2C_STATUS_SUCCESS) {
+            print("oled_render data failed\n");
+            return false;
+        }
+    } else {
+        // Rotate the render chunks
+        const static uint8_t source_map[] = OLED_SOURCE_MAP;
+        const static uint8_t target_map[] = OLED_TARGET_MAP;
+
+        static uint8_t temp_buffer[OLED_BLOCK_SIZE];
+        memset(temp_buffer, 0, sizeof(temp_buffer));
+        for (uint8_t i = 0; i < sizeof(source_map); ++i) {
+            rotate_90(&buffer[OLED_BLOCK_SIZE * update_start + source_map[i]], &temp_buffer[target_map[i]]);
+        }
+
+        // Send render data chunk after rotating
+        if (I2C_WRITE_REG(I2C_DATA, &temp_buffer[0], OLED_BLOCK_SIZE) != I2C_STATUS_SUCCESS) {
+            print("oled_render90 data failed\n");
+            return false;
+        }
+    }
+    return true;
+}
+
+#ifdef OLED_RENDER_ASYNC
+
+static THD_FUNCTION(OledFlushThread, arg) {
+    (void)arg;
+    chRegSetThreadName("oled_flush");
+    while (true) {
+        chBSemWait(&oled_flush_signal);
+        uint8_t update_start = 0;
+        while (oled_flush_dirty) {
+            // Find next dirty block
+            while (!(oled_flush_dirty & ((OLED_BLOCK_TYPE)1 << update_start))) {
+                ++update_start;
+            }
+            if (!oled_send_block(oled_flush_buffer, update_start)) {
+                // Leave the remaining blocks pending; the next frame
+                // submission re-signals us and the transfer is retried.
+                break;
+            }
+            oled_flush_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+        }
+    }
+}
+
+bool oled_render_async(void) {
+    if (!oled_initialized || oled_scrolling) {
+        return true;
+    }
+
+    if (oled_flush_dirty) {
+        // Previous frame is still draining (or retrying after a bus error);
+        // wake the flush thread again and report the frame as not taken.
+        chBSemSignal(&oled_flush_signal);
+        return false;
+    }
+
+    // Do we have work to do?
+    oled_dirty &= OLED_ALL_BLOCKS_MASK;
+    if (!oled_dirty) {
+        return true;
+    }
+
+    // Turn on display if it is off
+    oled_on();
+
+    memcpy(oled_flush_buffer, oled_buffer, sizeof(oled_flush_buffer));
+    oled_flush_dirty = oled_dirty;
+    oled_dirty       = 0;
+    chBSemSignal(&oled_flush_signal);
+    return true;
+}
+
+static inline bool oled_flush_pending(void) {
+    return oled_flush_dirty != 0;
+}
+
+void oled_render(void) {
+    oled_render_async();
+}
+
+#else // OLED_RENDER_ASYNC
+
+static inline bool oled_flush_pending(void) {
+    return false;
+}
+
 void oled_render(void) {
     // Do we have work to do?
     oled_dirty &= OLED_ALL_BLOCKS_MASK;
@@ -308,49 +462,17 @@ void oled_render(void) {
             ++update_start;
         }
 
-        // Set column & page position
-        static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
-        if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-            calc_bounds(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
-        } else {
-            calc_bounds_90(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
-        }
-
-        // Send column & page position
-        if (I2C_TRANSMIT(display_start) != I2C_STATUS_SUCCESS) {
-            print("oled_render offset command failed\n");
+        if (!oled_send_block(oled_buffer, update_start)) {
             return;
         }
 
-        if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-            // Send render data chunk as is
-            if (I2C_WRITE_REG(I2C_DATA, &oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE) != I2C_STATUS_SUCCESS) {
-                print("oled_render data failed\n");
-                return;
-            }
-        } else {
-            // Rotate the render chunks
-            const static uint8_t source_map[] = OLED_SOURCE_MAP;
-            const static uint8_t target_map[] = OLED_TARGET_MAP;
-
-            static uint8_t temp_buffer[OLED_BLOCK_SIZE];
-            memset(temp_buffer, 0, sizeof(temp_buffer));
-            for (uint8_t i = 0; i < sizeof(source_map); ++i) {
-                rotate_90(&oled_buffer[OLED_BLOCK_SIZE * update_start + source_map[i]], &temp_buffer[target_map[i]]);
-            }
-
-            // Send render data chunk after rotating
-            if (I2C_WRITE_REG(I2C_DATA, &temp_buffer[0], OLED_BLOCK_SIZE) != I2C_STATUS_SUCCESS) {
-                print("oled_render90 data failed\n");
-                return;
-            }
-        }
-
         // Clear dirty flag of just rendered block
         oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
     }
 }
 
+#endif // OLED_RENDER_ASYNC
+
 void oled_set_cursor(uint8_t col, uint8_t line) {
     uint16_t index = line * oled_rotation_width + col * OLED_FONT_WIDTH;
 
@@ -427,8 +549,7 @@ void oled_write_char(const char data, bool invert) {
     if (cast_data < OLED_FONT_START || cast_data > OLED_FONT_END) {
         memset(oled_cursor, 0x00, OLED_FONT_WIDTH);
     } else {
-        const uint8_t *glyph = &font[(cast_data - OLED_FONT_START) * OLED_FONT_WIDTH];
-        memcpy_P(oled_cursor, glyph, OLED_FONT_WIDTH);
+        FONT_GLYPH_COPY(oled_cursor, (cast_data - OLED_FONT_START) * OLED_FONT_WIDTH);
     }
 
     // Invert if needed
@@ -461,6 +582,56 @@ void oled_write_ln(const char *data, bool invert) {
     oled_advance_page(true);
 }
 
+void oled_write_aligned(const char *data, bool invert) {
+    uint16_t index       = oled_cursor - &oled_buffer[0];
+    uint16_t changed_min = UINT16_MAX;
+    uint16_t changed_max = 0;
+
+    // Glyphs are composed in an aligned scratch column first so the buffer
+    // compare & copy below run on whole words wherever alignment allows.
+    uint8_t glyph_buf[OLED_FONT_WIDTH] __attribute__((aligned(4)));
+    while (*data && index + OLED_FONT_WIDTH <= OLED_MATRIX_SIZE) {
+        uint8_t cast_data = (uint8_t)*data++; // font based on unsigned type for index
+        if (cast_data < OLED_FONT_START || cast_data > OLED_FONT_END) {
+            memset(glyph_buf, 0x00, OLED_FONT_WIDTH);
+        } else {
+            FONT_GLYPH_COPY(glyph_buf, (cast_data - OLED_FONT_START) * OLED_FONT_WIDTH);
+        }
+
+        if (invert) {
+            InvertCharacter(glyph_buf);
+        }
+
+        if (memcmp(&oled_buffer[index], glyph_buf, OLED_FONT_WIDTH) != 0) {
+            memcpy(&oled_buffer[index], glyph_buf, OLED_FONT_WIDTH);
+            if (index < changed_min) {
+                changed_min = index;
+            }
+            changed_max = index + OLED_FONT_WIDTH - 1;
+        }
+        index += OLED_FONT_WIDTH;
+
+        // Do we have enough space on the current line for the next character
+        uint8_t remainingSpace = oled_rotation_width - (index % oled_rotation_width);
+        if (remainingSpace < OLED_FONT_WIDTH) {
+            index += remainingSpace;
+        }
+    }
+
+    // Mark the changed span dirty in one pass
+    if (changed_min != UINT16_MAX) {
+        for (uint16_t block = changed_min / OLED_BLOCK_SIZE; block <= changed_max / OLED_BLOCK_SIZE; ++block) {
+            oled_dirty |= ((OLED_BLOCK_TYPE)1 << block);
+        }
+    }
+
+    // Did we go out of bounds
+    if (index >= OLED_MATRIX_SIZE) {
+        index = 0;
+    }
+    oled_cursor = &oled_buffer[index];
+}
+
 void oled_pan(bool left) {
     uint16_t i = 0;
     for (uint16_t y = 0; y < OLED_DISPLAY_HEIGHT / 8; y++) {
@@ -655,7 +826,7 @@ bool oled_scroll_right(void) {
 
     // Dont enable scrolling if we need to update the display
     // This prevents scrolling of bad data from starting the scroll too early after init
-    if (!oled_dirty && !oled_scrolling) {
+    if (!oled_dirty && !oled_flush_pending() && !oled_scrolling) {
         uint8_t display_scroll_right[] = {I2C_CMD, SCROLL_RIGHT, 0x00, oled_scroll_start, oled_scroll_speed, oled_scroll_end, 0x00, 0xFF, ACTIVATE_SCROLL};
         if (I2C_TRANSMIT(display_scroll_right) != I2C_STATUS_SUCCESS) {
             print("oled_scroll_right cmd failed\n");
@@ -673,7 +844,7 @@ bool oled_scroll_left(void) {
 
     // Dont enable scrolling if we need to update the display
     // This prevents scrolling of bad data from starting the scroll too early after init
-    if (!oled_dirty && !oled_scrolling) {
+    if (!oled_dirty && !oled_flush_pending() && !oled_scrolling) {
         uint8_t display_scroll_left[] = {I2C_CMD, SCROLL_LEFT, 0x00, oled_scroll_start, oled_scroll_speed, oled_scroll_end, 0x00, 0xFF, ACTIVATE_SCROLL};
         if (I2C_TRANSMIT(display_scroll_left) != I2C_STATUS_SUCCESS) {
             print("oled_scroll_left cmd failed\n");
@@ -31,6 +31,11 @@ bool qp_comms_spi_start(painter_device_t device) {
 }
 
 uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint32_t byte_count) {
+#    if defined(PROTOCOL_CHIBIOS)
+    // A background transfer may still be in flight; the bus must be idle before a blocking send starts.
+    spi_transmit_async_wait();
+#    endif
+
     uint32_t       bytes_remaining = byte_count;
     const uint8_t *p               = (const uint8_t *)data;
     while (bytes_remaining > 0) {
@@ -43,6 +48,37 @@ uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint3
     return byte_count - bytes_remaining;
 }
 
+#    if defined(PROTOCOL_CHIBIOS)
+uint32_t qp_comms_spi_send_data_nonblocking(painter_device_t device, const void *data, uint32_t byte_count) {
+    // Descriptors must stay valid while the chain is in flight -- drain any previous chain before reuse.
+    static spi_sg_descriptor_t descriptors[4];
+    spi_transmit_async_wait();
+
+    uint32_t       bytes_remaining = byte_count;
+    const uint8_t *p               = (const uint8_t *)data;
+    uint8_t        count           = 0;
+    while (bytes_remaining > 0 && count < (sizeof(descriptors) / sizeof(descriptors[0]))) {
+        uint32_t bytes_this_loop  = bytes_remaining < UINT16_MAX ? bytes_remaining : UINT16_MAX;
+        descriptors[count].data   = p;
+        descriptors[count].length = (uint16_t)bytes_this_loop;
+        descriptors[count].dc_pin = NO_PIN;
+        count++;
+        p += bytes_this_loop;
+        bytes_remaining -= bytes_this_loop;
+    }
+
+    // The whole chain is advanced from the SPI interrupt, descriptor by descriptor, so the entire
+    // flush stays in the background; a sensor read may preempt it at any descriptor boundary.
+    spi_transmit_async_sg(descriptors, count);
+
+    return byte_count - bytes_remaining;
+}
+
+void qp_comms_spi_sync(painter_device_t device) {
+    spi_transmit_async_wait();
+}
+#    endif // defined(PROTOCOL_CHIBIOS)
+
 void qp_comms_spi_stop(painter_device_t device) {
     struct painter_driver_t *     driver       = (struct painter_driver_t *)device;
     struct qp_comms_spi_config_t *comms_config = (struct qp_comms_spi_config_t *)driver->comms_config;
@@ -55,6 +91,10 @@ const struct painter_comms_vtable_t spi_comms_vtable = {
     .comms_start = qp_comms_spi_start,
     .comms_send  = qp_comms_spi_send_data,
     .comms_stop  = qp_comms_spi_stop,
+#    if defined(PROTOCOL_CHIBIOS)
+    .comms_send_nonblocking = qp_comms_spi_send_data_nonblocking,
+    .comms_sync             = qp_comms_spi_sync,
+#    endif
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -95,14 +135,66 @@ uint32_t qp_comms_spi_dc_reset_send_data(painter_device_t device, const void *da
     return qp_comms_spi_send_data(device, data, byte_count);
 }
 
+#        if defined(PROTOCOL_CHIBIOS)
+uint32_t qp_comms_spi_dc_reset_send_data_nonblocking(painter_device_t device, const void *data, uint32_t byte_count) {
+    struct painter_driver_t *              driver       = (struct painter_driver_t *)device;
+    struct qp_comms_spi_dc_reset_config_t *comms_config = (struct qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+    writePinHigh(comms_config->dc_pin);
+    return qp_comms_spi_send_data_nonblocking(device, data, byte_count);
+}
+#        endif // defined(PROTOCOL_CHIBIOS)
+
 void qp_comms_spi_dc_reset_send_command(painter_device_t device, uint8_t cmd) {
     struct painter_driver_t *              driver       = (struct painter_driver_t *)device;
     struct qp_comms_spi_dc_reset_config_t *comms_config = (struct qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+#        if defined(PROTOCOL_CHIBIOS)
+    // The D/C pin may not change while a background data transfer is still in flight.
+    spi_transmit_async_wait();
+#    endif
     writePinLow(comms_config->dc_pin);
     spi_write(cmd);
 }
 
 void qp_comms_spi_dc_reset_bulk_command_sequence(painter_device_t device, const uint8_t *sequence, size_t sequence_len) {
+#        if defined(PROTOCOL_CHIBIOS)
+    struct painter_driver_t *              driver       = (struct painter_driver_t *)device;
+    struct qp_comms_spi_dc_reset_config_t *comms_config = (struct qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+
+    // The sequence is compiled into descriptor chains: command bytes ride descriptors that drop D/C,
+    // payloads ride descriptors that raise it, and the SPI interrupt performs the toggles at the
+    // descriptor boundaries. A display init becomes a handful of DMA chains instead of dozens of
+    // blocking single-byte writes with a GPIO toggle around each.
+    static spi_sg_descriptor_t descriptors[QP_COMMS_SPI_DC_RESET_CHAIN_LENGTH];
+    uint8_t                    count = 0;
+    for (size_t i = 0; i < sequence_len;) {
+        uint8_t delay     = sequence[i + 1];
+        uint8_t num_bytes = sequence[i + 2];
+        if (count + 2 > QP_COMMS_SPI_DC_RESET_CHAIN_LENGTH) {
+            spi_transmit_async_sg(descriptors, count);
+            count = 0;
+        }
+        if (count == 0) {
+            // The array may still be referenced by the previous chain -- drain it before rebuilding.
+            spi_transmit_async_wait();
+        }
+        descriptors[count++] = (spi_sg_descriptor_t){.data = &sequence[i], .length = 1, .dc_pin = comms_config->dc_pin, .dc_level = false};
+        if (num_bytes > 0) {
+            descriptors[count++] = (spi_sg_descriptor_t){.data = &sequence[i + 3], .length = num_bytes, .dc_pin = comms_config->dc_pin, .dc_level = true};
+        }
+        if (delay > 0) {
+            // A delay is part of the panel's init contract -- the preceding bytes must have reached the
+            // wire before it starts counting.
+            spi_transmit_async_sg(descriptors, count);
+            spi_transmit_async_wait();
+            count = 0;
+            wait_ms(delay);
+        }
+        i += (3 + num_bytes);
+    }
+    spi_transmit_async_sg(descriptors, count);
+    // The caller's sequence buffer may live on the stack -- it may not be released while still referenced.
+    spi_transmit_async_wait();
+#        else
     for (size_t i = 0; i < sequence_len;) {
         uint8_t command   = sequence[i];
         uint8_t delay     = sequence[i + 1];
@@ -116,6 +208,7 @@ void qp_comms_spi_dc_reset_bulk_command_sequence(painter_device_t device, const
         }
         i += (3 + num_bytes);
     }
+#        endif // defined(PROTOCOL_CHIBIOS)
 }
 
 const struct painter_comms_with_command_vtable_t spi_comms_with_dc_vtable = {
@@ -125,6 +218,10 @@ const struct painter_comms_with_command_vtable_t spi_comms_with_dc_vtable = {
             .comms_start = qp_comms_spi_start,
             .comms_send  = qp_comms_spi_dc_reset_send_data,
             .comms_stop  = qp_comms_spi_stop,
+#        if defined(PROTOCOL_CHIBIOS)
+            .comms_send_nonblocking = qp_comms_spi_dc_reset_send_data_nonblocking,
+            .comms_sync             = qp_comms_spi_sync,
+#        endif
         },
     .send_command          = qp_comms_spi_dc_reset_send_command,
     .bulk_command_sequence = qp_comms_spi_dc_reset_bulk_command_sequence,
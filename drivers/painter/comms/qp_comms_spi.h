@@ -25,6 +25,11 @@ bool     qp_comms_spi_start(painter_device_t device);
 uint32_t qp_comms_spi_send_data(painter_device_t device, const void* data, uint32_t byte_count);
 void     qp_comms_spi_stop(painter_device_t device);
 
+#    if defined(PROTOCOL_CHIBIOS)
+uint32_t qp_comms_spi_send_data_nonblocking(painter_device_t device, const void* data, uint32_t byte_count);
+void     qp_comms_spi_sync(painter_device_t device);
+#    endif // defined(PROTOCOL_CHIBIOS)
+
 extern const struct painter_comms_vtable_t spi_comms_vtable;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -38,8 +43,19 @@ struct qp_comms_spi_dc_reset_config_t {
     pin_t                        reset_pin;
 };
 
+#        if defined(PROTOCOL_CHIBIOS)
+// Number of scatter-gather descriptors a bulk command sequence is compiled into per chain; each
+// sequence entry consumes two (command byte, payload).
+#            ifndef QP_COMMS_SPI_DC_RESET_CHAIN_LENGTH
+#                define QP_COMMS_SPI_DC_RESET_CHAIN_LENGTH 32
+#            endif
+#        endif // defined(PROTOCOL_CHIBIOS)
+
 void     qp_comms_spi_dc_reset_send_command(painter_device_t device, uint8_t cmd);
 uint32_t qp_comms_spi_dc_reset_send_data(painter_device_t device, const void* data, uint32_t byte_count);
+#        if defined(PROTOCOL_CHIBIOS)
+uint32_t qp_comms_spi_dc_reset_send_data_nonblocking(painter_device_t device, const void* data, uint32_t byte_count);
+#        endif // defined(PROTOCOL_CHIBIOS)
 void     qp_comms_spi_dc_reset_bulk_command_sequence(painter_device_t device, const uint8_t* sequence, size_t sequence_len);
 
 extern const struct painter_comms_with_command_vtable_t spi_comms_with_dc_vtable;
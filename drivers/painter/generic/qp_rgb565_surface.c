@@ -2,11 +2,20 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 #include "color.h"
 #include "qp_rgb565_surface.h"
+#include "qp_comms.h"
 #include "qp_draw.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Common
 
+// A single damage rectangle, inclusive bounds
+typedef struct surface_dirty_region_t {
+    uint16_t l;
+    uint16_t t;
+    uint16_t r;
+    uint16_t b;
+} surface_dirty_region_t;
+
 // Device definition
 typedef struct rgb565_surface_painter_device_t {
     struct painter_driver_t base; // must be first, so it can be cast to/from the painter_device_t* type
@@ -24,12 +33,10 @@ typedef struct rgb565_surface_painter_device_t {
     uint16_t pixdata_x;
     uint16_t pixdata_y;
 
-    // Maintain a dirty region so we can stream only what we need
-    bool     is_dirty;
-    uint16_t dirty_l;
-    uint16_t dirty_t;
-    uint16_t dirty_r;
-    uint16_t dirty_b;
+    // Maintain a set of dirty regions so we can stream only what we need
+    bool                   is_dirty;
+    uint8_t                dirty_region_count;
+    surface_dirty_region_t dirty_regions[RGB565_SURFACE_DAMAGE_REGIONS];
 
 } rgb565_surface_painter_device_t;
 
@@ -55,25 +62,77 @@ static inline void increment_pixdata_location(rgb565_surface_painter_device_t *s
     }
 }
 
-static inline void setpixel(rgb565_surface_painter_device_t *surface, uint16_t x, uint16_t y, uint16_t rgb565) {
-    // Skip messing with the dirty info if the original value already matches
-    if (surface->buffer[y * surface->base.panel_width + x] != rgb565) {
-        // Maintain dirty region
-        if (surface->dirty_l > x) {
-            surface->dirty_l = x;
-        }
-        if (surface->dirty_r < x) {
-            surface->dirty_r = x;
+static inline uint32_t region_area(const surface_dirty_region_t *region) {
+    return (uint32_t)(region->r - region->l + 1) * (region->b - region->t + 1);
+}
+
+// Whether two regions overlap or sit directly next to each other, i.e. their union adds no untouched pixels worth keeping apart
+static inline bool regions_touch(const surface_dirty_region_t *a, const surface_dirty_region_t *b) {
+    return !(a->l > (uint32_t)b->r + 1 || b->l > (uint32_t)a->r + 1 || a->t > (uint32_t)b->b + 1 || b->t > (uint32_t)a->b + 1);
+}
+
+static inline void region_union(surface_dirty_region_t *target, const surface_dirty_region_t *other) {
+    target->l = QP_MIN(target->l, other->l);
+    target->t = QP_MIN(target->t, other->t);
+    target->r = QP_MAX(target->r, other->r);
+    target->b = QP_MAX(target->b, other->b);
+}
+
+static void mark_dirty(rgb565_surface_painter_device_t *surface, uint16_t x, uint16_t y) {
+    surface->is_dirty = true;
+
+    // Already covered by an existing damage region?
+    for (uint8_t i = 0; i < surface->dirty_region_count; ++i) {
+        surface_dirty_region_t *region = &surface->dirty_regions[i];
+        if (x >= region->l && x <= region->r && y >= region->t && y <= region->b) {
+            return;
         }
-        if (surface->dirty_t > y) {
-            surface->dirty_t = y;
+    }
+
+    // Start a fresh region if a slot is free
+    if (surface->dirty_region_count < RGB565_SURFACE_DAMAGE_REGIONS) {
+        surface_dirty_region_t *region = &surface->dirty_regions[surface->dirty_region_count++];
+        region->l = region->r = x;
+        region->t = region->b = y;
+        return;
+    }
+
+    // All slots taken -- grow the region that gains the least area from including this pixel
+    surface_dirty_region_t *best_region = &surface->dirty_regions[0];
+    uint32_t                best_growth = UINT32_MAX;
+    for (uint8_t i = 0; i < surface->dirty_region_count; ++i) {
+        surface_dirty_region_t *region = &surface->dirty_regions[i];
+        surface_dirty_region_t  grown  = {QP_MIN(region->l, x), QP_MIN(region->t, y), QP_MAX(region->r, x), QP_MAX(region->b, y)};
+        uint32_t                growth = region_area(&grown) - region_area(region);
+        if (growth < best_growth) {
+            best_growth = growth;
+            best_region = region;
         }
-        if (surface->dirty_b < y) {
-            surface->dirty_b = y;
+    }
+    surface_dirty_region_t pixel = {x, y, x, y};
+    region_union(best_region, &pixel);
+}
+
+// Collapse any damage regions that overlap (or touch) after having grown independently
+static void merge_touching_regions(rgb565_surface_painter_device_t *surface) {
+    for (uint8_t i = 0; i < surface->dirty_region_count; ++i) {
+        for (uint8_t j = i + 1; j < surface->dirty_region_count;) {
+            if (regions_touch(&surface->dirty_regions[i], &surface->dirty_regions[j])) {
+                region_union(&surface->dirty_regions[i], &surface->dirty_regions[j]);
+                surface->dirty_regions[j] = surface->dirty_regions[--surface->dirty_region_count];
+                j                         = i + 1; // the union may now touch regions we already skipped
+            } else {
+                ++j;
+            }
         }
+    }
+}
 
-        // Always dirty after a setpixel
-        surface->is_dirty = true;
+static inline void setpixel(rgb565_surface_painter_device_t *surface, uint16_t x, uint16_t y, uint16_t rgb565) {
+    // Skip messing with the dirty info if the original value already matches
+    if (surface->buffer[y * surface->base.panel_width + x] != rgb565) {
+        // Maintain dirty regions
+        mark_dirty(surface, x, y);
 
         // Update the pixel data in the buffer
         surface->buffer[y * surface->base.panel_width + x] = rgb565;
@@ -115,9 +174,8 @@ static bool qp_rgb565_surface_clear(painter_device_t device) {
 static bool qp_rgb565_surface_flush(painter_device_t device) {
     struct painter_driver_t *        driver  = (struct painter_driver_t *)device;
     rgb565_surface_painter_device_t *surface = (rgb565_surface_painter_device_t *)driver;
-    surface->dirty_l = surface->dirty_t = UINT16_MAX;
-    surface->dirty_r = surface->dirty_b = 0;
-    surface->is_dirty                   = false;
+    surface->dirty_region_count = 0;
+    surface->is_dirty           = false;
     return true;
 }
 
@@ -212,6 +270,14 @@ struct painter_comms_vtable_t rgb565_surface_driver_comms_vtable = {
 // Factory function for creating a handle to an rgb565 surface
 
 painter_device_t qp_rgb565_make_surface(uint16_t panel_width, uint16_t panel_height, void *buffer) {
+    if (!buffer) {
+        // Draw an exactly-sized framebuffer from the painter arena instead of a caller-provided slab
+        buffer = qp_internal_arena_alloc(sizeof(uint16_t) * panel_width * panel_height);
+        if (!buffer) {
+            qp_dprintf("qp_rgb565_make_surface: fail (could not allocate framebuffer from arena)\n");
+            return NULL;
+        }
+    }
     for (uint32_t i = 0; i < RGB565_SURFACE_NUM_DEVICES; ++i) {
         rgb565_surface_painter_device_t *driver = &surface_drivers[i];
         if (!driver->base.driver_vtable) {
@@ -231,19 +297,11 @@ painter_device_t qp_rgb565_make_surface(uint16_t panel_width, uint16_t panel_hei
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Drawing routine to copy out the dirty region and send it to another device
-
-bool qp_rgb565_surface_draw(painter_device_t surface, painter_device_t display, uint16_t x, uint16_t y) {
-    struct painter_driver_t *        surface_driver = (struct painter_driver_t *)surface;
-    rgb565_surface_painter_device_t *surface_handle = (rgb565_surface_painter_device_t *)surface_driver;
-
-    // If we're not dirty... we're done.
-    if (!surface_handle->is_dirty) {
-        return true;
-    }
+// Drawing routines to copy out the dirty regions and send them to another device
 
+static bool stream_dirty_region(rgb565_surface_painter_device_t *surface_handle, painter_device_t display, uint16_t x, uint16_t y, const surface_dirty_region_t *region) {
     // Set the target drawing area
-    bool ok = qp_viewport(display, x + surface_handle->dirty_l, y + surface_handle->dirty_t, x + surface_handle->dirty_r, y + surface_handle->dirty_b);
+    bool ok = qp_viewport(display, x + region->l, y + region->t, x + region->r, y + region->b);
     if (!ok) {
         return false;
     }
@@ -254,8 +312,8 @@ bool qp_rgb565_surface_draw(painter_device_t surface, painter_device_t display,
     uint16_t *target_buffer     = (uint16_t *)qp_internal_global_pixdata_buffer;
 
     // Fill the global pixdata area so that we can start transferring to the panel
-    for (uint16_t y = surface_handle->dirty_t; y <= surface_handle->dirty_b; ++y) {
-        for (uint16_t x = surface_handle->dirty_l; x <= surface_handle->dirty_r; ++x) {
+    for (uint16_t y = region->t; y <= region->b; ++y) {
+        for (uint16_t x = region->l; x <= region->r; ++x) {
             // Update the target buffer
             target_buffer[pixel_counter++] = surface_handle->buffer[y * surface_handle->base.panel_width + x];
 
@@ -279,6 +337,150 @@ bool qp_rgb565_surface_draw(painter_device_t surface, painter_device_t display,
         }
     }
 
+    return true;
+}
+
+bool qp_rgb565_surface_draw(painter_device_t surface, painter_device_t display, uint16_t x, uint16_t y) {
+    struct painter_driver_t *        surface_driver = (struct painter_driver_t *)surface;
+    rgb565_surface_painter_device_t *surface_handle = (rgb565_surface_painter_device_t *)surface_driver;
+
+    // If we're not dirty... we're done.
+    if (!surface_handle->is_dirty) {
+        return true;
+    }
+
+    // Stream each damage region as its own viewport+pixdata burst
+    merge_touching_regions(surface_handle);
+    for (uint8_t i = 0; i < surface_handle->dirty_region_count; ++i) {
+        if (!stream_dirty_region(surface_handle, display, x, y, &surface_handle->dirty_regions[i])) {
+            return false;
+        }
+    }
+
+    // Clear the dirty info for the surface
+    return qp_flush(surface);
+}
+
+// Stream one clipped damage rectangle (surface coordinates) to the panel a span maps it onto.
+// When the panel's comms driver supports background transfers, the pixdata buffer is split into two
+// strips so copying the next burst out of the surface overlaps transmission of the previous one.
+static bool stream_spanned_region(rgb565_surface_painter_device_t *surface_handle, const qp_surface_span_t *span, const surface_dirty_region_t *region) {
+    // Map the region's origin onto the panel and set the target drawing area
+    uint16_t dx = span->display_x + (region->l - span->surface_l);
+    uint16_t dy = span->display_y + (region->t - span->surface_t);
+    if (!qp_viewport(span->display, dx, dy, dx + (region->r - region->l), dy + (region->b - region->t))) {
+        return false;
+    }
+
+    struct painter_driver_t *display_driver = (struct painter_driver_t *)span->display;
+    if (!qp_comms_start(span->display)) {
+        return false;
+    }
+
+    bool     pipelined         = qp_comms_supports_nonblocking(span->display);
+    uint32_t total_pixel_count = QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE / sizeof(uint16_t);
+    if (pipelined) {
+        total_pixel_count /= 2;
+    }
+
+    bool      ok            = true;
+    uint8_t   strip_index   = 0;
+    uint32_t  pixel_counter = 0;
+    uint16_t *target_buffer = (uint16_t *)qp_internal_global_pixdata_buffer;
+
+    for (uint16_t y = region->t; y <= region->b && ok; ++y) {
+        for (uint16_t x = region->l; x <= region->r; ++x) {
+            target_buffer[pixel_counter++] = surface_handle->buffer[y * surface_handle->base.panel_width + x];
+
+            // If we've accumulated enough data, send it
+            if (pixel_counter == total_pixel_count) {
+                if (pipelined) {
+                    // Hand the full strip to the comms driver for background transmission and copy into the
+                    // other strip meanwhile -- starting the next transfer synchronizes with this one.
+                    uint32_t byte_count = pixel_counter * sizeof(uint16_t);
+                    if (qp_comms_send_nonblocking(span->display, target_buffer, byte_count) != byte_count) {
+                        ok = false;
+                        break;
+                    }
+                    strip_index ^= 1;
+                    target_buffer = (uint16_t *)(qp_internal_global_pixdata_buffer + (strip_index * (QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE / 2)));
+                } else {
+                    if (!display_driver->driver_vtable->pixdata(span->display, target_buffer, pixel_counter)) {
+                        ok = false;
+                        break;
+                    }
+                }
+                pixel_counter = 0;
+            }
+        }
+    }
+
+    // If there's any leftover data, send it -- the blocking path synchronizes with any in-flight strip first
+    if (ok && pixel_counter > 0) {
+        ok = display_driver->driver_vtable->pixdata(span->display, target_buffer, pixel_counter);
+    }
+
+    if (pipelined) {
+        qp_comms_sync(span->display);
+    }
+    qp_comms_stop(span->display);
+    return ok;
+}
+
+bool qp_rgb565_surface_draw_spanned(painter_device_t surface, const qp_surface_span_t *spans, uint8_t span_count) {
+    struct painter_driver_t *        surface_driver = (struct painter_driver_t *)surface;
+    rgb565_surface_painter_device_t *surface_handle = (rgb565_surface_painter_device_t *)surface_driver;
+
+    // If we're not dirty... we're done.
+    if (!surface_handle->is_dirty) {
+        return true;
+    }
+
+    // Clip each damage region against each span; panels whose slice is untouched are skipped entirely
+    merge_touching_regions(surface_handle);
+    for (uint8_t s = 0; s < span_count; ++s) {
+        const qp_surface_span_t *span = &spans[s];
+        for (uint8_t i = 0; i < surface_handle->dirty_region_count; ++i) {
+            const surface_dirty_region_t *region  = &surface_handle->dirty_regions[i];
+            surface_dirty_region_t        clipped = {
+                       .l = QP_MAX(region->l, span->surface_l),
+                       .t = QP_MAX(region->t, span->surface_t),
+                       .r = QP_MIN(region->r, span->surface_l + span->width - 1),
+                       .b = QP_MIN(region->b, span->surface_t + span->height - 1),
+            };
+            if (clipped.l > clipped.r || clipped.t > clipped.b) {
+                continue;
+            }
+            if (!stream_spanned_region(surface_handle, span, &clipped)) {
+                return false;
+            }
+        }
+    }
+
     // Clear the dirty info for the surface
     return qp_flush(surface);
 }
+
+bool qp_rgb565_surface_draw_incremental(painter_device_t surface, painter_device_t display, uint16_t x, uint16_t y) {
+    struct painter_driver_t *        surface_driver = (struct painter_driver_t *)surface;
+    rgb565_surface_painter_device_t *surface_handle = (rgb565_surface_painter_device_t *)surface_driver;
+
+    // If we're not dirty... we're done.
+    if (!surface_handle->is_dirty) {
+        return true;
+    }
+
+    // Stream only the first damage region this invocation, bounding the time spent away from the caller's loop
+    merge_touching_regions(surface_handle);
+    if (!stream_dirty_region(surface_handle, display, x, y, &surface_handle->dirty_regions[0])) {
+        return false;
+    }
+
+    // Retire the streamed region; any remaining regions are sent on subsequent calls
+    surface_handle->dirty_regions[0] = surface_handle->dirty_regions[--surface_handle->dirty_region_count];
+    if (surface_handle->dirty_region_count > 0) {
+        return false;
+    }
+
+    return qp_flush(surface);
+}
@@ -13,6 +13,15 @@
 #    define RGB565_SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef RGB565_SURFACE_DAMAGE_REGIONS
+/**
+ * @def This controls the maximum number of disjoint damage rectangles tracked per surface.
+ *      Widgets drawn far apart stay in separate rectangles, so flushing skips the untouched
+ *      pixels between them. Once all slots are taken, further damage grows the nearest rectangle.
+ */
+#    define RGB565_SURFACE_DAMAGE_REGIONS 4
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
@@ -22,8 +31,8 @@
  *
  * @param panel_width[in] the width of the display panel
  * @param panel_height[in] the height of the display panel
- * @param buffer[in] pointer to a preallocated buffer of size `(sizeof(uint16_t) * panel_width * panel_height)`
- * @return the device handle used with all drawing routines in Quantum Painter
+ * @param buffer[in] pointer to a preallocated buffer of size `(sizeof(uint16_t) * panel_width * panel_height)`, or NULL to allocate an exactly-sized framebuffer from the painter arena (requires `QUANTUM_PAINTER_ARENA_SIZE`)
+ * @return the device handle used with all drawing routines in Quantum Painter, or NULL if no device slot or arena space is available
  */
 painter_device_t qp_rgb565_make_surface(uint16_t panel_width, uint16_t panel_height, void *buffer);
 
@@ -39,4 +48,50 @@ painter_device_t qp_rgb565_make_surface(uint16_t panel_width, uint16_t panel_hei
  * @return whether the draw operation completed successfully
  */
 bool qp_rgb565_surface_draw(painter_device_t surface, painter_device_t display, uint16_t x, uint16_t y);
+
+/**
+ * Incremental variant of `qp_rgb565_surface_draw`.
+ *
+ * Streams at most one damage rectangle per invocation, bounding the time spent blocking on comms;
+ * call it once per loop iteration until it reports completion.
+ *
+ * @param surface[in] the surface to copy from
+ * @param display[in] the display to copy into
+ * @param x[in] the x-location of the original position of the framebuffer
+ * @param y[in] the y-location of the original position of the framebuffer
+ * @return true once the surface is fully flushed (or was already clean), false while damage remains to be streamed or on comms failure
+ */
+bool qp_rgb565_surface_draw_incremental(painter_device_t surface, painter_device_t display, uint16_t x, uint16_t y);
+
+/**
+ * Mapping of one rectangular slice of a spanned surface onto a display panel.
+ *
+ * Several spans together describe how a single logical surface is laid out across
+ * multiple physical panels, e.g. two side-by-side 240x240 displays backed by one
+ * 480x240 surface.
+ */
+typedef struct qp_surface_span_t {
+    painter_device_t display;   // the panel this slice lands on
+    uint16_t         surface_l; // left edge of the slice within the surface
+    uint16_t         surface_t; // top edge of the slice within the surface
+    uint16_t         display_x; // where the slice's origin lands on the panel
+    uint16_t         display_y;
+    uint16_t         width;
+    uint16_t         height;
+} qp_surface_span_t;
+
+/**
+ * Draw the dirty contents of a surface spanning multiple display panels.
+ *
+ * Each damage rectangle is clipped against every span, so panels whose slice is
+ * untouched cost nothing. On comms drivers with background transfer support the
+ * pixel copy for the next burst overlaps transmission of the previous one.
+ * After successful completion, the dirty area is reset.
+ *
+ * @param surface[in] the surface to copy from
+ * @param spans[in] array describing how the surface maps onto the panels
+ * @param span_count[in] number of entries in `spans`
+ * @return whether the draw operation completed successfully
+ */
+bool qp_rgb565_surface_draw_spanned(painter_device_t surface, const qp_surface_span_t *spans, uint8_t span_count);
 #endif // QUANTUM_PAINTER_RGB565_SURFACE_ENABLE
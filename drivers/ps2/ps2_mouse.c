@@ -71,6 +71,47 @@ __attribute__((weak)) void ps2_mouse_init_user(void) {}
 
 __attribute__((weak)) void ps2_mouse_moved_user(report_mouse_t *mouse_report) {}
 
+#ifndef PS2_MOUSE_USE_REMOTE_MODE
+#    ifdef PS2_MOUSE_ENABLE_SCROLLING
+#        define PS2_MOUSE_PACKET_SIZE 4
+#    else
+#        define PS2_MOUSE_PACKET_SIZE 3
+#    endif
+
+/* Reassemble a stream mode packet from bytes the receive handler has already
+ * buffered. Returns false until a whole packet is available, so the caller
+ * never waits on the wire for the remainder of a partially received packet. */
+static bool ps2_mouse_read_packet(report_mouse_t *mouse_report) {
+    static uint8_t packet[PS2_MOUSE_PACKET_SIZE];
+    static uint8_t index = 0;
+
+    while (pbuf_has_data()) {
+        uint8_t data = ps2_host_recv();
+        if (ps2_error != PS2_ERR_NONE) {
+            break;
+        }
+        /* The first byte of every packet has bit3 set; drop anything else so
+           a lost byte costs one packet instead of shifting all that follow. */
+        if (index == 0 && !(data & (1 << PS2_MOUSE_ALWAYS_1))) {
+            if (debug_mouse) print("ps2_mouse: dropped out-of-sync byte\n");
+            continue;
+        }
+        packet[index++] = data;
+        if (index == PS2_MOUSE_PACKET_SIZE) {
+            index                = 0;
+            mouse_report->buttons = packet[0];
+            mouse_report->x       = packet[1] * PS2_MOUSE_X_MULTIPLIER;
+            mouse_report->y       = packet[2] * PS2_MOUSE_Y_MULTIPLIER;
+#    ifdef PS2_MOUSE_ENABLE_SCROLLING
+            mouse_report->v = -(packet[3] & PS2_MOUSE_SCROLL_MASK) * PS2_MOUSE_V_MULTIPLIER;
+#    endif
+            return true;
+        }
+    }
+    return false;
+}
+#endif
+
 void ps2_mouse_task(void) {
     static uint8_t buttons_prev = 0;
     extern int     tp_buttons;
@@ -90,16 +131,9 @@ void ps2_mouse_task(void) {
         if (debug_mouse) print("ps2_mouse: fail to get mouse packet\n");
     }
 #else
-    if (pbuf_has_data()) {
-        mouse_report.buttons = ps2_host_recv_response();
-        mouse_report.x       = ps2_host_recv_response() * PS2_MOUSE_X_MULTIPLIER;
-        mouse_report.y       = ps2_host_recv_response() * PS2_MOUSE_Y_MULTIPLIER;
-#    ifdef PS2_MOUSE_ENABLE_SCROLLING
-        mouse_report.v       = -(ps2_host_recv_response() & PS2_MOUSE_SCROLL_MASK) * PS2_MOUSE_V_MULTIPLIER;
-#    endif
-    } else {
-        if (debug_mouse) print("ps2_mouse: fail to get mouse packet\n");
-    }
+    /* Works from buffered bytes only; leaves the report cleared (button
+       handling below still runs) until a whole packet has arrived. */
+    ps2_mouse_read_packet(&mouse_report);
 #endif
 
     mouse_report.buttons |= tp_buttons;
@@ -79,6 +79,7 @@ __attribute__((unused)) static enum ps2_mouse_mode_e {
 #define PS2_MOUSE_BTN_LEFT 0
 #define PS2_MOUSE_BTN_RIGHT 1
 #define PS2_MOUSE_BTN_MIDDLE 2
+#define PS2_MOUSE_ALWAYS_1 3
 #define PS2_MOUSE_X_SIGN 4
 #define PS2_MOUSE_Y_SIGN 5
 #define PS2_MOUSE_X_OVFLW 6
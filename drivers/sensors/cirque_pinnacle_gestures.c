@@ -19,6 +19,7 @@
 #include "cirque_pinnacle_gestures.h"
 #include "pointing_device.h"
 #include "timer.h"
+#include "util.h"
 #include "wait.h"
 #if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
 #    include "keyboard.h"
@@ -63,6 +64,11 @@ static circular_scroll_context_t scroll = {.config = {.outer_ring_pct = 33,
                                                       .trigger_ang    = 9102, /* 50 degrees */
                                                       .wheel_clicks   = 18}};
 
+/*
+ * Integer atan2, returning an angle in radians where pi = 32768.
+ * Error of either variant is a few units at worst, well below the angular thresholds consuming the result.
+ */
+#if defined(__ARM_ARCH_EXT_IDIV__) || defined(__ARM_FEATURE_IDIV)
 static inline uint16_t atan2_16(int32_t dy, int32_t dx) {
     if (dy == 0) {
         if (dx >= 0) {
@@ -86,6 +92,58 @@ static inline uint16_t atan2_16(int32_t dy, int32_t dx) {
     }
     return a;
 }
+#else
+/*
+ * Cores without a hardware integer divider (Cortex-M0/M0+, AVR) pay hundreds of cycles per division in the
+ * linear approximation above, so use a shift-and-add CORDIC vectoring loop instead. atan(2^-i) table in the
+ * same pi = 32768 angle units.
+ */
+static const uint16_t atan2_16_cordic_lut[] = {8192, 4836, 2555, 1297, 651, 326, 163, 81, 41, 20, 10, 5, 3, 1, 1};
+
+static uint16_t atan2_16(int32_t dy, int32_t dx) {
+    if (dy == 0) {
+        if (dx >= 0) {
+            return 0;
+        } else {
+            return 32768;
+        }
+    }
+
+    uint16_t angle = 0;
+
+    /* Pre-rotate into the right half-plane; the left half-plane is handled by the pi offset */
+    if (dx < 0) {
+        dx    = -dx;
+        dy    = -dy;
+        angle = 32768;
+    }
+
+    /* Scale short vectors up so the later micro-rotations don't underflow to zero */
+    uint32_t mag = (uint32_t)dx | (uint32_t)(dy > 0 ? dy : -dy);
+    int8_t   up  = 29 - ((__builtin_clzl(1) + 1) - __builtin_clzl(mag));
+    if (up > 0) {
+        dx <<= up;
+        dy <<= up;
+    }
+
+    /* Rotate the vector onto the positive x axis, accumulating the angle removed at each step */
+    for (uint8_t i = 0; i < ARRAY_SIZE(atan2_16_cordic_lut); i++) {
+        int32_t xs = dx >> i;
+        int32_t ys = dy >> i;
+        if (dy > 0) {
+            dx += ys;
+            dy -= xs;
+            angle += atan2_16_cordic_lut[i];
+        } else {
+            dx -= ys;
+            dy += xs;
+            angle -= atan2_16_cordic_lut[i];
+        }
+    }
+
+    return angle;
+}
+#endif
 
 static circular_scroll_t circular_scroll(pinnacle_data_t touchData) {
     circular_scroll_t report = {0, 0, false};
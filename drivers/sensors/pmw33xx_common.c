@@ -27,16 +27,77 @@ static bool in_burst_right[ARRAY_SIZE(cs_pins_right)] = {0};
 bool __attribute__((cold)) pmw33xx_upload_firmware(uint8_t sensor);
 bool __attribute__((cold)) pmw33xx_check_signature(uint8_t sensor);
 
+#if defined(PMW33XX_MOTION_PIN)
+#    if defined(PROTOCOL_CHIBIOS)
+// Set from the MOTION pin's falling-edge interrupt -- edges arriving while a drain is in progress re-arm the flag, so
+// movement between polls is never missed.
+static volatile bool pmw33xx_motion_flag = false;
+
+static void pmw33xx_motion_pin_callback(void *arg) {
+    (void)arg;
+    pmw33xx_motion_flag = true;
+}
+#    endif
+
+static void pmw33xx_motion_pin_init(void) {
+    // MOTION is active low, open-drain
+    setPinInputHigh(PMW33XX_MOTION_PIN);
+#    if defined(PROTOCOL_CHIBIOS)
+    palEnableLineEvent(PMW33XX_MOTION_PIN, PAL_EVENT_MODE_FALLING_EDGE);
+    palSetLineCallback(PMW33XX_MOTION_PIN, pmw33xx_motion_pin_callback, NULL);
+#    endif
+}
+
+static bool pmw33xx_motion_pending(void) {
+#    if defined(PROTOCOL_CHIBIOS)
+    return pmw33xx_motion_flag;
+#    else
+    return !readPin(PMW33XX_MOTION_PIN);
+#    endif
+}
+#endif // defined(PMW33XX_MOTION_PIN)
+
 void pmw33xx_set_cpi_all_sensors(uint16_t cpi) {
     for (uint8_t sensor = 0; sensor < pmw33xx_number_of_sensors; sensor++) {
         pmw33xx_set_cpi(sensor, cpi);
     }
 }
 
+#if defined(PROTOCOL_CHIBIOS)
+// Set while the sensor transaction has interjected into a paused background display chain.
+static bool spi_preempted = false;
+#endif
+
+static void pmw33xx_spi_stop(void) {
+#if defined(PROTOCOL_CHIBIOS)
+    if (spi_preempted) {
+        spi_preempted = false;
+        // Closes the sensor session and restarts the preempted display chain.
+        spi_resume();
+        return;
+    }
+#endif
+    spi_stop();
+}
+
 bool pmw33xx_spi_start(uint8_t sensor) {
     if (!spi_start(cs_pins[sensor], false, 3, PMW33XX_SPI_DIVISOR)) {
+#if defined(PROTOCOL_CHIBIOS)
+        // The bus may be mid-flight with a display transfer chain; pause it at the next descriptor
+        // boundary and slot this short transaction in between.
+        if (!spi_preempt()) {
+            spi_stop();
+            return false;
+        }
+        spi_preempted = true;
+        if (!spi_start(cs_pins[sensor], false, 3, PMW33XX_SPI_DIVISOR)) {
+            pmw33xx_spi_stop();
+            return false;
+        }
+#else
         spi_stop();
         return false;
+#endif
     }
     // tNCS-SCLK, 10ns
     wait_us(1);
@@ -55,12 +116,13 @@ bool pmw33xx_write(uint8_t sensor, uint8_t reg_addr, uint8_t data) {
     // send address of the register, with MSBit = 1 to indicate it's a write
     uint8_t command[2] = {reg_addr | 0x80, data};
     if (spi_transmit(command, sizeof(command)) != SPI_STATUS_SUCCESS) {
+        pmw33xx_spi_stop();
         return false;
     }
 
     // tSCLK-NCS for write operation is 35us
     wait_us(35);
-    spi_stop();
+    pmw33xx_spi_stop();
 
     // tSWW/tSWR (=18us) minus tSCLK-NCS. Could be shortened, but it looks like
     // a safe lower bound
@@ -81,7 +143,7 @@ uint8_t pmw33xx_read(uint8_t sensor, uint8_t reg_addr) {
 
     // tSCLK-NCS, 120ns
     wait_us(1);
-    spi_stop();
+    pmw33xx_spi_stop();
 
     //  tSRW/tSRR (=20us) mins tSCLK-NCS
     wait_us(19);
@@ -139,7 +201,7 @@ bool pmw33xx_init(uint8_t sensor) {
         return false;
     }
     wait_us(40);
-    spi_stop();
+    pmw33xx_spi_stop();
     wait_us(40);
 
     if (!pmw33xx_write(sensor, REG_Power_Up_Reset, 0x5a)) {
@@ -159,7 +221,7 @@ bool pmw33xx_init(uint8_t sensor) {
         return false;
     }
 
-    spi_stop();
+    pmw33xx_spi_stop();
 
     wait_ms(10);
     pmw33xx_set_cpi(sensor, PMW33XX_CPI);
@@ -175,6 +237,12 @@ bool pmw33xx_init(uint8_t sensor) {
         return false;
     }
 
+#if defined(PMW33XX_MOTION_PIN)
+    if (sensor == 0) {
+        pmw33xx_motion_pin_init();
+    }
+#endif
+
     return true;
 }
 
@@ -207,7 +275,7 @@ pmw33xx_report_t pmw33xx_read_burst(uint8_t sensor) {
         in_burst[sensor] = false;
     }
 
-    spi_stop();
+    pmw33xx_spi_stop();
 
     pd_dprintf("PMW33XX (%d): motion: 0x%x dx: %i dy: %i\n", sensor, report.motion.w, report.delta_x, report.delta_y);
 
@@ -216,3 +284,34 @@ pmw33xx_report_t pmw33xx_read_burst(uint8_t sensor) {
 
     return report;
 }
+
+#if defined(PMW33XX_MOTION_PIN)
+pmw33xx_report_t pmw33xx_read_burst_accumulated(uint8_t sensor) {
+    pmw33xx_report_t accumulated = {0};
+
+    if (!pmw33xx_motion_pending()) {
+        // No movement since the last drain -- skip the SPI transaction entirely this scan
+        return accumulated;
+    }
+
+#    if defined(PROTOCOL_CHIBIOS)
+    pmw33xx_motion_flag = false;
+#    endif
+
+    // Drain the accumulated movement, summing the deltas with saturation
+    for (uint8_t i = 0; i < PMW33XX_BURST_DRAIN_LIMIT; i++) {
+        pmw33xx_report_t report = pmw33xx_read_burst(sensor);
+        accumulated.motion.w    = report.motion.w | (accumulated.motion.w & (1 << 7)); // keep MOT latched across reads
+        if (!report.motion.b.is_motion) {
+            break;
+        }
+
+        int32_t delta_x     = (int32_t)accumulated.delta_x + report.delta_x;
+        int32_t delta_y     = (int32_t)accumulated.delta_y + report.delta_y;
+        accumulated.delta_x = CONSTRAIN(delta_x, INT16_MIN, INT16_MAX);
+        accumulated.delta_y = CONSTRAIN(delta_y, INT16_MIN, INT16_MAX);
+    }
+
+    return accumulated;
+}
+#endif // defined(PMW33XX_MOTION_PIN)
@@ -57,6 +57,10 @@ _Static_assert(sizeof((pmw33xx_report_t){0}.motion) == 1, "pmw33xx_report_t.moti
 #    define PMW33XX_LIFTOFF_DISTANCE 0x02
 #endif
 
+#if !defined(PMW33XX_BURST_DRAIN_LIMIT)
+#    define PMW33XX_BURST_DRAIN_LIMIT 4
+#endif
+
 #if !defined(ROTATIONAL_TRANSFORM_ANGLE)
 #    define ROTATIONAL_TRANSFORM_ANGLE 0x00
 #endif
@@ -151,6 +155,22 @@ void pmw33xx_set_cpi_all_sensors(uint16_t cpi);
  */
 pmw33xx_report_t pmw33xx_read_burst(uint8_t sensor);
 
+#if defined(PMW33XX_MOTION_PIN)
+/**
+ * @brief Motion-pin gated variant of pmw33xx_read_burst. Performs no SPI
+ * traffic at all while the sensor's MOTION pin reports no movement, and drains
+ * up to PMW33XX_BURST_DRAIN_LIMIT burst reads in one go when movement has
+ * accumulated, summing the deltas with saturation. On ChibiOS the MOTION pin
+ * is serviced by a falling-edge interrupt, so movement that occurs between
+ * polls is never missed.
+ *
+ * @param sensor Index of the sensors chip select pin
+ * @return pmw33xx_report_t Accumulated delta values of the sensor, if errors
+ * occurred all fields are set to zero
+ */
+pmw33xx_report_t pmw33xx_read_burst_accumulated(uint8_t sensor);
+#endif // defined(PMW33XX_MOTION_PIN)
+
 /**
  * @brief Read one byte of data from the given register on the sensor
  *
@@ -0,0 +1,254 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "radio.h"
+#include "host.h"
+#include "outputselect.h"
+#include "report.h"
+#include "timer.h"
+
+#ifdef RAW_ENABLE
+#    include "raw_hid.h"
+#endif
+
+/*
+    Frame format, both directions:
+
+        0xA6 | type | length | payload... | checksum
+
+    where checksum is the XOR of type, length and payload bytes. The keyboard
+    sends report frames; the radio MCU sends acks and periodic link-status
+    frames. Anything malformed is discarded byte-by-byte until the next sync
+    byte, so a glitched UART recovers on the following frame.
+*/
+
+#define RADIO_FRAME_SYNC 0xA6
+
+enum radio_frame_type {
+    RADIO_FRAME_KEYBOARD = 0x01,
+    RADIO_FRAME_MOUSE    = 0x02,
+    RADIO_FRAME_EXTRA    = 0x03,
+    RADIO_FRAME_ACK      = 0x80,
+    RADIO_FRAME_LINK     = 0x81, // payload: connected, rssi, retries_lo, retries_hi
+};
+
+#define RADIO_FRAME_MAX_PAYLOAD 32
+
+static radio_link_stats_t link_stats;
+static bool               link_connected = false;
+static uint32_t           link_last_seen = 0;
+static uint32_t           flush_timer    = 0;
+
+/* Aggregation state: keyboard reports queue (a coalesced keyboard report
+ * loses key transitions), mouse and extra coalesce latest-wins. */
+static report_keyboard_t kb_queue[RADIO_REPORT_QUEUE_DEPTH];
+static uint8_t           kb_head = 0, kb_count = 0;
+static report_mouse_t    pending_mouse;
+static bool              mouse_pending = false;
+static report_extra_t    pending_system, pending_consumer;
+static bool              system_pending = false, consumer_pending = false;
+
+static void radio_frame_send(uint8_t type, const void *payload, uint8_t length) {
+    uint8_t        header[3] = {RADIO_FRAME_SYNC, type, length};
+    const uint8_t *p         = (const uint8_t *)payload;
+    uint8_t        checksum  = type ^ length;
+    for (uint8_t i = 0; i < length; i++) {
+        checksum ^= p[i];
+    }
+    radio_transport_write(header, sizeof(header));
+    radio_transport_write(p, length);
+    radio_transport_write(&checksum, 1);
+    link_stats.frames_sent++;
+}
+
+void radio_init(void) {
+    radio_transport_init();
+    flush_timer    = timer_read32();
+    link_last_seen = timer_read32();
+}
+
+bool radio_is_connected(void) {
+    return link_connected;
+}
+
+const radio_link_stats_t *radio_link_stats(void) {
+    return &link_stats;
+}
+
+void radio_send_keyboard(report_keyboard_t *report) {
+    if (kb_count == RADIO_REPORT_QUEUE_DEPTH) {
+        // Overflow: drop the oldest so the newest state still wins
+        kb_head = (kb_head + 1) % RADIO_REPORT_QUEUE_DEPTH;
+        kb_count--;
+        link_stats.frames_dropped++;
+    }
+    kb_queue[(kb_head + kb_count) % RADIO_REPORT_QUEUE_DEPTH] = *report;
+    kb_count++;
+}
+
+void radio_send_mouse(report_mouse_t *report) {
+    pending_mouse = *report;
+    mouse_pending = true;
+}
+
+void radio_send_extra(report_extra_t *report) {
+    if (report->report_id == REPORT_ID_SYSTEM) {
+        pending_system = *report;
+        system_pending = true;
+    } else {
+        pending_consumer = *report;
+        consumer_pending = true;
+    }
+}
+
+static void radio_flush(void) {
+    while (kb_count > 0) {
+        radio_frame_send(RADIO_FRAME_KEYBOARD, &kb_queue[kb_head], sizeof(report_keyboard_t));
+        kb_head = (kb_head + 1) % RADIO_REPORT_QUEUE_DEPTH;
+        kb_count--;
+    }
+    if (mouse_pending) {
+        radio_frame_send(RADIO_FRAME_MOUSE, &pending_mouse, sizeof(report_mouse_t));
+        mouse_pending = false;
+    }
+    if (system_pending) {
+        radio_frame_send(RADIO_FRAME_EXTRA, &pending_system, sizeof(report_extra_t));
+        system_pending = false;
+    }
+    if (consumer_pending) {
+        radio_frame_send(RADIO_FRAME_EXTRA, &pending_consumer, sizeof(report_extra_t));
+        consumer_pending = false;
+    }
+}
+
+static void radio_handle_frame(uint8_t type, const uint8_t *payload, uint8_t length) {
+    switch (type) {
+        case RADIO_FRAME_ACK:
+            link_stats.frames_acked++;
+            break;
+        case RADIO_FRAME_LINK:
+            if (length >= 4) {
+                link_connected = payload[0] != 0;
+                link_stats.rssi = payload[1];
+                link_stats.retries += payload[2] | (payload[3] << 8);
+                link_last_seen = timer_read32();
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static void radio_receive(void) {
+    static uint8_t frame[RADIO_FRAME_MAX_PAYLOAD];
+    static uint8_t state = 0; // 0: sync, 1: type, 2: length, 3: payload, 4: checksum
+    static uint8_t type = 0, length = 0, pos = 0, checksum = 0;
+
+    while (radio_transport_available()) {
+        uint8_t byte = radio_transport_read();
+        switch (state) {
+            case 0:
+                if (byte == RADIO_FRAME_SYNC) state = 1;
+                break;
+            case 1:
+                type     = byte;
+                checksum = byte;
+                state    = 2;
+                break;
+            case 2:
+                length = byte;
+                checksum ^= byte;
+                pos   = 0;
+                state = (length == 0) ? 4 : (length <= RADIO_FRAME_MAX_PAYLOAD ? 3 : 0);
+                break;
+            case 3:
+                frame[pos++] = byte;
+                checksum ^= byte;
+                if (pos == length) state = 4;
+                break;
+            case 4:
+                if (byte == checksum) {
+                    radio_handle_frame(type, frame, length);
+                }
+                state = 0;
+                break;
+        }
+    }
+}
+
+/* Glitch-free failover: when where_to_send() changes transports, the one
+ * losing ownership gets an empty keyboard report so nothing stays held, and
+ * the suppression cache is cleared so the first reports on the new transport
+ * are never elided as duplicates. */
+static void radio_failover_watch(void) {
+    static uint8_t last_output = OUTPUT_NONE;
+
+    uint8_t output = where_to_send();
+    if (output == last_output) {
+        return;
+    }
+
+    report_keyboard_t clear = {0};
+#ifdef KEYBOARD_SHARED_EP
+    clear.report_id = REPORT_ID_KEYBOARD;
+#endif
+    if (last_output == OUTPUT_RF) {
+        radio_send_keyboard(&clear);
+    } else if (last_output == OUTPUT_USB && host_get_driver()) {
+        (*host_get_driver()->send_keyboard)(&clear);
+    }
+    report_cache_clear();
+    last_output = output;
+}
+
+void radio_task(void) {
+    radio_receive();
+
+    if (link_connected && timer_elapsed32(link_last_seen) > RADIO_LINK_TIMEOUT_MS) {
+        link_connected = false;
+    }
+
+    radio_failover_watch();
+
+    if (timer_elapsed32(flush_timer) >= RADIO_REPORT_INTERVAL_MS) {
+        flush_timer = timer_read32();
+        if (link_connected) {
+            radio_flush();
+        } else if (kb_count > 0 || mouse_pending || system_pending || consumer_pending) {
+            // Link down: shed the backlog rather than replaying stale input
+            // on reconnect, and account for it.
+            link_stats.frames_dropped += kb_count + mouse_pending + system_pending + consumer_pending;
+            kb_count      = 0;
+            mouse_pending = system_pending = consumer_pending = false;
+        }
+    }
+}
+
+bool radio_raw_hid_command(uint8_t *data, uint8_t length) {
+    if (length < 1 || data[0] != RADIO_STATS_HID_COMMAND) {
+        return false;
+    }
+
+    /* Response: sent, acked, dropped as little-endian uint32, then retries
+     * (uint16), rssi, connected. */
+    if (length >= 1 + 4 * 3 + 2 + 1 + 1) {
+        uint32_t counters[3] = {link_stats.frames_sent, link_stats.frames_acked, link_stats.frames_dropped};
+        uint8_t *out         = &data[1];
+        for (uint8_t c = 0; c < 3; c++) {
+            for (uint8_t i = 0; i < 4; i++) {
+                *out++ = (counters[c] >> (8 * i)) & 0xFF;
+            }
+        }
+        *out++ = link_stats.retries & 0xFF;
+        *out++ = (link_stats.retries >> 8) & 0xFF;
+        *out++ = link_stats.rssi;
+        *out++ = link_connected ? 1 : 0;
+    }
+
+#ifdef RAW_ENABLE
+    raw_hid_send(data, length);
+#endif
+    return true;
+}
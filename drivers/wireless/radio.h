@@ -0,0 +1,80 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "report.h"
+
+/**
+ * \file
+ *
+ * \brief 2.4GHz dongle transport.
+ *
+ * Reports are framed and handed to a companion radio MCU over a byte
+ * transport (UART by default); the radio MCU owns the air protocol and
+ * reports link state back. The core aggregates reports per radio interval,
+ * keeps link-quality counters, and fails over between USB and RF without
+ * leaving keys stuck on the transport that lost ownership.
+ */
+
+/* How often queued reports are flushed to the radio MCU. Matches the air
+ * interval of typical low-latency dongles; reports arriving faster than this
+ * coalesce (latest-wins for mouse/extra, queued for keyboard). */
+#ifndef RADIO_REPORT_INTERVAL_MS
+#    define RADIO_REPORT_INTERVAL_MS 1
+#endif
+
+/* Keyboard reports queued between flushes. Keyboard reports are never
+ * coalesced - dropping an intermediate report loses a key transition - so
+ * they queue; overflow drops the oldest and counts it. */
+#ifndef RADIO_REPORT_QUEUE_DEPTH
+#    define RADIO_REPORT_QUEUE_DEPTH 8
+#endif
+
+/* The link is considered down when the radio MCU has not sent a link-status
+ * frame for this long. */
+#ifndef RADIO_LINK_TIMEOUT_MS
+#    define RADIO_LINK_TIMEOUT_MS 1000
+#endif
+
+/* Raw HID command id answering link-quality queries; shares the
+ * instrumentation channel convention of LATENCY_HISTOGRAM_HID_COMMAND. */
+#ifndef RADIO_STATS_HID_COMMAND
+#    define RADIO_STATS_HID_COMMAND 0x7D
+#endif
+
+typedef struct {
+    uint32_t frames_sent;
+    uint32_t frames_acked;
+    uint32_t frames_dropped; // queue overflow or send while link down
+    uint16_t retries;        // air retransmissions, as reported by the radio MCU
+    uint8_t  rssi;           // last reported, radio-specific scale
+} radio_link_stats_t;
+
+void radio_init(void);
+
+/* Flushes aggregated reports, parses frames from the radio MCU, and runs the
+ * USB/RF failover watch. Invoked from keyboard_task(). */
+void radio_task(void);
+
+bool radio_is_connected(void);
+
+void radio_send_keyboard(report_keyboard_t *report);
+void radio_send_mouse(report_mouse_t *report);
+void radio_send_extra(report_extra_t *report);
+
+const radio_link_stats_t *radio_link_stats(void);
+
+/* Handle a raw HID request; returns true (and fills `data` with the
+ * response) if the packet was a link-stats command. */
+bool radio_raw_hid_command(uint8_t *data, uint8_t length);
+
+/* Byte transport underneath the framing layer, provided by the selected
+ * RADIO_DRIVER (radio_uart.c for UART) or by the keyboard for `custom`. */
+void    radio_transport_init(void);
+void    radio_transport_write(const uint8_t *data, uint16_t length);
+bool    radio_transport_available(void);
+uint8_t radio_transport_read(void);
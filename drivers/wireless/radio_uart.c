@@ -0,0 +1,29 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "radio.h"
+#include "uart.h"
+
+/* UART byte transport for the radio core. On ChibiOS targets the uart driver
+ * runs on the serial driver's interrupt/DMA machinery, so writes only copy
+ * into its queue; on AVR they spin only when the TX ring is full. */
+
+#ifndef RADIO_UART_BAUD
+#    define RADIO_UART_BAUD 1000000
+#endif
+
+void radio_transport_init(void) {
+    uart_init(RADIO_UART_BAUD);
+}
+
+void radio_transport_write(const uint8_t *data, uint16_t length) {
+    uart_transmit(data, length);
+}
+
+bool radio_transport_available(void) {
+    return uart_available();
+}
+
+uint8_t radio_transport_read(void) {
+    return uart_read();
+}
@@ -89,7 +89,7 @@ uint8_t matrix_scan(void)
     }
   }
 
-  debounce(matrix_debouncing, matrix, matrix_rows(), changed);
+  debounce(matrix_debouncing, matrix, matrix_rows(), changed ? MATRIX_ROW_MASK_ALL : 0);
   matrix_scan_kb();
 
   return (uint8_t)changed;
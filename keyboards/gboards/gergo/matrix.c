@@ -259,7 +259,7 @@ uint8_t matrix_scan(void) {
         unselect_rows();
     }
 
-    debounce(raw_matrix, matrix, MATRIX_ROWS, changed);
+    debounce(raw_matrix, matrix, MATRIX_ROWS, changed ? MATRIX_ROW_MASK_ALL : 0);
     matrix_scan_kb();
 
     enableInterrupts();
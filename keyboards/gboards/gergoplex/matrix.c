@@ -140,7 +140,7 @@ uint8_t matrix_scan(void) {
         unselect_rows();
     }
 
-    debounce(raw_matrix, matrix, MATRIX_ROWS, changed);
+    debounce(raw_matrix, matrix, MATRIX_ROWS, changed ? MATRIX_ROW_MASK_ALL : 0);
     matrix_scan_kb();
 
 #ifdef DEBUG_MATRIX
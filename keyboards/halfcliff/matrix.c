@@ -270,7 +270,7 @@ uint8_t matrix_scan(void) {
         }
     }
 
-    debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, local_changed);
+    debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, local_changed ? MATRIX_ROW_MASK_ALL : 0);
 
     bool remote_changed = matrix_post_scan();
     return (uint8_t)(local_changed || remote_changed);
@@ -67,7 +67,7 @@ static const uint8_t num_in_binary[8][3] = {
 static void select_col_analog(uint8_t col);
 static void mux_pin_control(const uint8_t binary[]);
 void debounce_init(uint8_t num_rows);
-void debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed);
+void debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, matrix_row_mask_t changed_rows);
 
 
 __attribute__ ((weak))
@@ -215,7 +215,7 @@ uint8_t matrix_scan(void)
         changed |= read_cols_on_row(raw_matrix, current_row);
     }
 
-    debounce(raw_matrix, matrix, MATRIX_ROWS, changed);
+    debounce(raw_matrix, matrix, MATRIX_ROWS, changed ? MATRIX_ROW_MASK_ALL : 0);
 
     matrix_scan_kb();
     return (uint8_t)changed;
@@ -233,7 +233,7 @@ uint8_t matrix_scan(void)
   }
 #endif
 
-  debounce(raw_matrix, matrix, MATRIX_ROWS, changed);
+  debounce(raw_matrix, matrix, MATRIX_ROWS, changed ? MATRIX_ROW_MASK_ALL : 0);
 
   matrix_scan_kb();
   return (uint8_t)changed;
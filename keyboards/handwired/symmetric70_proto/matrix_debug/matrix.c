@@ -318,7 +318,7 @@ uint8_t matrix_scan(void) {
     MATRIX_DEBUG_GAP();
 
     MATRIX_DEBUG_SCAN_START();
-    debounce(raw_matrix, matrix, MATRIX_ROWS, changed);
+    debounce(raw_matrix, matrix, MATRIX_ROWS, changed ? MATRIX_ROW_MASK_ALL : 0);
     MATRIX_DEBUG_SCAN_END();
     MATRIX_DEBUG_GAP();
 
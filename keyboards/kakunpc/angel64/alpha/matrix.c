@@ -251,7 +251,7 @@ uint8_t matrix_scan(void)
     changed |= read_rows_on_col(raw_matrix, current_col);
   }
 
-  debounce(raw_matrix, matrix, MATRIX_ROWS, changed);
+  debounce(raw_matrix, matrix, MATRIX_ROWS, changed ? MATRIX_ROW_MASK_ALL : 0);
 
   matrix_scan_kb();
   return (uint8_t)changed;
@@ -197,7 +197,7 @@ uint8_t matrix_scan(void) {
     changed |= read_cols_on_row(raw_matrix, current_row);
   }
 
-  debounce(raw_matrix, matrix, MATRIX_ROWS, changed);
+  debounce(raw_matrix, matrix, MATRIX_ROWS, changed ? MATRIX_ROW_MASK_ALL : 0);
 
   matrix_scan_kb();
 
@@ -125,7 +125,7 @@ uint8_t matrix_scan(void)
     }
   }
 
-  debounce(matrix_debouncing, matrix, MATRIX_ROWS, changed);
+  debounce(matrix_debouncing, matrix, MATRIX_ROWS, changed ? MATRIX_ROW_MASK_ALL : 0);
 
   matrix_scan_kb();
 
@@ -0,0 +1,58 @@
+"""This script bundles raw QGF/QFF files into a Quantum Painter asset pack.
+"""
+import struct
+from qmk.path import normpath
+from milc import cli
+
+PACK_MAGIC = 0x4B415051  # "QPAK"
+PACK_VERSION = 1
+PACK_NAME_LEN = 16
+HEADER_SIZE = 16
+ENTRY_SIZE = PACK_NAME_LEN + 8
+
+
+def _align4(n):
+    return (n + 3) & ~3
+
+
+@cli.argument('-i', '--input', required=True, action='append', help='Raw QGF/QFF file to include, as written by the --raw flag of the converters. May be specified multiple times.')
+@cli.argument('-o', '--output', required=True, help='Specify output pack file.')
+@cli.subcommand('Bundles raw QGF/QFF assets into a Quantum Painter asset pack')
+def painter_make_asset_pack(cli):
+    """Bundles raw QGF/QFF files into a single asset pack binary.
+
+    The pack carries a name index so firmware locates assets with `qp_asset_pack_find()` instead of compiled-in
+    symbols; flash the output at a fixed offset and pass its memory-mapped address to the lookup APIs.
+    """
+    inputs = [normpath(i) for i in cli.args.input]
+    for input_file in inputs:
+        if not input_file.exists():
+            cli.log.error(f'Input file {input_file} does not exist!')
+            cli.print_usage()
+            return False
+
+    names = [i.stem.encode('ascii', errors='replace')[:PACK_NAME_LEN] for i in inputs]
+    if len(set(names)) != len(names):
+        cli.log.error(f'Asset names must be unique within the first {PACK_NAME_LEN} characters!')
+        return False
+
+    # Lay out the blobs after the index, each 4-byte aligned so memory-mapped access stays naturally aligned.
+    blobs = [i.read_bytes() for i in inputs]
+    entries = []
+    offset = HEADER_SIZE + ENTRY_SIZE * len(inputs)
+    for name, blob in zip(names, blobs):
+        offset = _align4(offset)
+        entries.append((name, offset, len(blob)))
+        offset += len(blob)
+    total_size = offset
+
+    output_file = normpath(cli.args.output)
+    with open(output_file, 'wb') as pack:
+        pack.write(struct.pack('<IB3sHHI', PACK_MAGIC, PACK_VERSION, b'\x00\x00\x00', len(entries), 0, total_size))
+        for name, blob_offset, blob_len in entries:
+            pack.write(struct.pack(f'<{PACK_NAME_LEN}sII', name, blob_offset, blob_len))
+        for (name, blob_offset, blob_len), blob in zip(entries, blobs):
+            pack.write(b'\x00' * (blob_offset - pack.tell()))
+            pack.write(blob)
+
+    print(f'Writing {output_file}... {len(entries)} assets, {total_size} bytes')
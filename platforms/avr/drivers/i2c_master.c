@@ -23,6 +23,9 @@
 #include "i2c_master.h"
 #include "timer.h"
 #include "wait.h"
+#ifdef TELEMETRY_COUNTERS_ENABLE
+#    include "telemetry_counters.h"
+#endif
 
 #ifndef F_SCL
 #    define F_SCL 400000UL // SCL frequency
@@ -103,6 +106,12 @@ i2c_status_t i2c_start(uint8_t address, uint16_t timeout) {
     do {
         status = i2c_start_impl(address, time_slice);
     } while ((status < 0) && ((timeout == I2C_TIMEOUT_INFINITE) || (timer_elapsed(timeout_timer) <= timeout)));
+#ifdef TELEMETRY_COUNTERS_ENABLE
+    // Count a transaction that failed outright, not the individual retries
+    if (status < 0) {
+        telemetry_counters_note_i2c_error();
+    }
+#endif
     return status;
 }
 
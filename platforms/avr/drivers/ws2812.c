@@ -94,6 +94,24 @@ void ws2812_setleds(LED_TYPE *ledarray, uint16_t number_of_leds) {
 #    warning "Please consider a higher clockspeed, if possible"
 #endif
 
+/*
+ * Interrupt-window slicing: by default the whole chain is shifted out with
+ * interrupts masked, which on long strips blocks ISRs (and USB NAK handling)
+ * for milliseconds. Defining WS2812_INTERRUPT_WINDOW_LEDS to N re-opens
+ * interrupts for one instruction after every N LEDs, letting a pending ISR
+ * run before transmission continues. The data line idles low across the
+ * window, so the total window length (i.e. the longest ISR) must stay within
+ * the pixels' latch tolerance - about 5us on most WS2812 variants - or the
+ * chain latches the partial frame. Masked time is thereby bounded to roughly
+ * N * 30us (RGB at 800kHz) instead of the full chain.
+ */
+#ifdef WS2812_INTERRUPT_WINDOW_LEDS
+#    if WS2812_INTERRUPT_WINDOW_LEDS < 1
+#        error "WS2812_INTERRUPT_WINDOW_LEDS must be at least 1"
+#    endif
+#    define WS2812_INTERRUPT_WINDOW_BYTES (WS2812_INTERRUPT_WINDOW_LEDS * sizeof(LED_TYPE))
+#endif
+
 #define w_nop1 "nop      \n\t"
 #define w_nop2 "rjmp .+0 \n\t"
 #define w_nop4 w_nop2 w_nop2
@@ -102,6 +120,9 @@ void ws2812_setleds(LED_TYPE *ledarray, uint16_t number_of_leds) {
 
 static inline void ws2812_sendarray_mask(uint8_t *data, uint16_t datlen, uint8_t masklo, uint8_t maskhi) {
     uint8_t curbyte, ctr, sreg_prev;
+#ifdef WS2812_INTERRUPT_WINDOW_LEDS
+    uint16_t window_countdown = WS2812_INTERRUPT_WINDOW_BYTES;
+#endif
 
     sreg_prev = SREG;
     cli();
@@ -166,6 +187,18 @@ static inline void ws2812_sendarray_mask(uint8_t *data, uint16_t datlen, uint8_t
                      "       brne  loop%=\n\t" //  '1' [+3] '0' [+4]
                      : "=&d"(ctr)
                      : "r"(curbyte), "I"(_SFR_IO_ADDR(PORTx_ADDRESS(RGB_DI_PIN))), "r"(maskhi), "r"(masklo));
+
+#ifdef WS2812_INTERRUPT_WINDOW_LEDS
+        if (--window_countdown == 0 && datlen != 0) {
+            window_countdown = WS2812_INTERRUPT_WINDOW_BYTES;
+            // Re-enabling the I flag lets exactly the pending ISRs run: the
+            // AVR executes one more instruction (the nop) after SREG is
+            // written, services whatever is queued, then masks again.
+            SREG = sreg_prev;
+            asm volatile("nop");
+            cli();
+        }
+#endif
     }
 
     SREG = sreg_prev;
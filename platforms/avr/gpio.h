@@ -36,3 +36,14 @@ typedef uint8_t pin_t;
 #define readPin(pin) ((bool)(PINx_ADDRESS(pin) & _BV((pin)&0xF)))
 
 #define togglePin(pin) (PORTx_ADDRESS(pin) ^= _BV((pin)&0xF))
+
+/* Operation of GPIO by port. */
+
+typedef uint8_t port_data_t;
+
+#define readPinPort(pin) PINx_ADDRESS(pin)
+#define pinPortMask(pin) _BV((pin)&0xF)
+#define samePort(pinA, pinB) (((pinA) >> 4) == ((pinB) >> 4))
+
+#define writePortBitsHigh(pin, mask) (PORTx_ADDRESS(pin) |= (mask))
+#define writePortBitsLow(pin, mask) (PORTx_ADDRESS(pin) &= ~(mask))
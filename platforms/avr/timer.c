@@ -106,6 +106,25 @@ inline uint32_t timer_read32(void) {
     return t;
 }
 
+/** \brief timer read, in microseconds
+ *
+ * Combines the millisecond counter with the raw Timer0 count; resolution is one
+ * prescaled timer tick (4us with the default prescaler of 64 at 16MHz).
+ */
+uint32_t timer_read_us(void) {
+    uint32_t ms;
+    uint8_t  raw;
+
+    // Re-read if the millisecond counter ticked between the two samples, so the
+    // raw count is never paired with the wrong millisecond.
+    do {
+        ms  = timer_read32();
+        raw = TIMER_RAW;
+    } while (ms != timer_read32());
+
+    return ms * 1000 + ((uint32_t)raw * 1000) / (TIMER_RAW_TOP + 1);
+}
+
 /** \brief timer elapsed
  *
  * FIXME: needs doc
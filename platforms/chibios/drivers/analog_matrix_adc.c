@@ -0,0 +1,208 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include <ch.h>
+#include <hal.h>
+
+#include "analog_matrix_adc.h"
+#include "analog_matrix.h"
+#include "analog.h"
+#include "gpio.h"
+#include "util.h"
+#include "debug.h"
+
+#if !HAL_USE_ADC
+#    error "You need to set HAL_USE_ADC to TRUE in your halconf.h to use the analog matrix."
+#endif
+#if !HAL_USE_GPT
+#    error "You need to set HAL_USE_GPT to TRUE in your halconf.h to use the analog matrix."
+#endif
+#ifndef ANALOG_MATRIX_COL_PINS
+#    error "analog_matrix_adc requires ANALOG_MATRIX_COL_PINS"
+#endif
+#if MATRIX_COLS > 16
+#    error "analog_matrix_adc supports at most 16 column channels per sequence"
+#endif
+
+// Same family split as analog.c; the sequence registers differ per ADC IP.
+#if defined(STM32F0XX) || defined(STM32L0XX)
+#    define USE_ADCV1
+#elif defined(STM32F1XX) || defined(STM32F2XX) || defined(STM32F4XX) || defined(GD32VF103) || defined(WB32F3G71xx) || defined(WB32FQ95xx)
+#    define USE_ADCV2
+#endif
+
+static const pin_t col_pins[MATRIX_COLS] = ANALOG_MATRIX_COL_PINS;
+#ifdef ANALOG_MATRIX_ROW_SEL_PINS
+static const pin_t row_sel_pins[] = ANALOG_MATRIX_ROW_SEL_PINS;
+#endif
+
+/* Sample index -> column. On ADCv1 and RP2040 the hardware scans enabled
+ * channels in ascending channel order regardless of the pin list order, so
+ * the mapping is built at init; elsewhere it is the identity. */
+static uint8_t sample_order[MATRIX_COLS];
+
+static adcsample_t row_samples[MATRIX_COLS];
+
+/* Frame under construction and last completed frame. The completed frame is
+ * only written in the ADC callback with the current row's samples, and only
+ * read under lock in analog_matrix_driver_read(). */
+static volatile uint16_t frame[MATRIX_ROWS][MATRIX_COLS];
+static volatile uint32_t frame_count    = 0;
+static uint32_t          consumed_frame = 0;
+static volatile uint8_t  current_row    = 0;
+
+static void select_row(uint8_t row) {
+#ifdef ANALOG_MATRIX_ROW_SEL_PINS
+    for (uint8_t bit = 0; bit < ARRAY_SIZE(row_sel_pins); bit++) {
+        writePin(row_sel_pins[bit], (row >> bit) & 1);
+    }
+#else
+    (void)row;
+#endif
+}
+
+static void adc_complete_callback(ADCDriver *adcp) {
+    (void)adcp;
+    uint8_t row = current_row;
+    for (uint8_t i = 0; i < MATRIX_COLS; i++) {
+        frame[row][sample_order[i]] = row_samples[i];
+    }
+    if (++row >= MATRIX_ROWS) {
+        row = 0;
+        frame_count++;
+    }
+    current_row = row;
+    /* Advance the muxes now so the next row settles for a full GPT period
+     * before its conversion starts. */
+    select_row(row);
+}
+
+static ADCConversionGroup conversion_group = {
+    .circular     = FALSE,
+    .num_channels = (uint16_t)(MATRIX_COLS),
+    .end_cb       = adc_complete_callback,
+#if defined(USE_ADCV1)
+    .cfgr1 = ADC_CFGR1_RES_12BIT,
+#elif defined(USE_ADCV2)
+#    if !defined(STM32F1XX) && !defined(GD32VF103) && !defined(WB32F3G71xx) && !defined(WB32FQ95xx)
+    .cr2 = ADC_CR2_SWSTART,
+#    endif
+#elif defined(RP2040)
+// RP2040 does not have any extra config here
+#else
+    .cfgr = ADC_CFGR_RES_12BITS,
+#endif
+};
+
+static void build_sequence(void) {
+    uint8_t inputs[MATRIX_COLS];
+    for (uint8_t i = 0; i < MATRIX_COLS; i++) {
+        adc_mux mux = pinToMux(col_pins[i]);
+        if (mux.adc == 0xFF) {
+            dprintf("analog_matrix_adc: column %u pin has no ADC channel\n", i);
+            chSysHalt("analog_matrix_adc pin");
+        }
+        inputs[i]       = mux.input;
+        sample_order[i] = i;
+    }
+
+#if defined(USE_ADCV1) || defined(RP2040)
+    /* Enabled channels are scanned in ascending channel order; sort the
+     * sample -> column mapping to match. */
+    for (uint8_t i = 1; i < MATRIX_COLS; i++) {
+        for (uint8_t j = i; j > 0 && inputs[sample_order[j - 1]] > inputs[sample_order[j]]; j--) {
+            uint8_t tmp         = sample_order[j];
+            sample_order[j]     = sample_order[j - 1];
+            sample_order[j - 1] = tmp;
+        }
+    }
+#endif
+
+#if defined(USE_ADCV1)
+    for (uint8_t i = 0; i < MATRIX_COLS; i++) {
+        conversion_group.chselr |= 1UL << inputs[i];
+    }
+#elif defined(USE_ADCV2)
+    /* SQ1..SQ6 in SQR3, SQ7..SQ12 in SQR2, SQ13..SQ16 in SQR1; 5 bits each. */
+    for (uint8_t i = 0; i < MATRIX_COLS; i++) {
+        if (i < 6) {
+            conversion_group.sqr3 |= (uint32_t)inputs[i] << (5 * i);
+        } else if (i < 12) {
+            conversion_group.sqr2 |= (uint32_t)inputs[i] << (5 * (i - 6));
+        } else {
+            conversion_group.sqr1 |= (uint32_t)inputs[i] << (5 * (i - 12));
+        }
+    }
+    conversion_group.sqr1 |= ADC_SQR1_NUM_CH(MATRIX_COLS);
+#elif defined(RP2040)
+    for (uint8_t i = 0; i < MATRIX_COLS; i++) {
+        conversion_group.channel_mask |= 1UL << inputs[i];
+    }
+#else
+    /* ADCv3/v4: SQ1..SQ4 in SQR1 (from bit 6), SQ5.. five per register
+     * after that; 6 bits each. */
+    for (uint8_t i = 0; i < MATRIX_COLS; i++) {
+        if (i < 4) {
+            conversion_group.sqr[0] |= (uint32_t)inputs[i] << (6 * (i + 1));
+        } else {
+            conversion_group.sqr[1 + (i - 4) / 5] |= (uint32_t)inputs[i] << (6 * ((i - 4) % 5));
+        }
+    }
+    conversion_group.sqr[0] |= ADC_SQR1_NUM_CH(MATRIX_COLS);
+#endif
+}
+
+static void gpt_tick_callback(GPTDriver *gptp) {
+    (void)gptp;
+    chSysLockFromISR();
+    /* Skip a tick rather than queue if the previous sequence somehow has not
+     * finished; starting a busy driver is a ChibiOS state violation. */
+    if (ANALOG_MATRIX_ADC_DRIVER.state == ADC_READY) {
+        adcStartConversionI(&ANALOG_MATRIX_ADC_DRIVER, &conversion_group, row_samples, 1);
+    }
+    chSysUnlockFromISR();
+}
+
+static const GPTConfig gpt_config = {
+    .frequency = ANALOG_MATRIX_SCAN_FREQUENCY * MATRIX_ROWS,
+    .callback  = gpt_tick_callback,
+};
+
+static ADCConfig adc_config = {};
+
+void analog_matrix_driver_init(void) {
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        palSetLineMode(col_pins[col], PAL_MODE_INPUT_ANALOG);
+    }
+#ifdef ANALOG_MATRIX_ROW_SEL_PINS
+    for (uint8_t bit = 0; bit < ARRAY_SIZE(row_sel_pins); bit++) {
+        setPinOutput(row_sel_pins[bit]);
+    }
+#endif
+    select_row(0);
+
+    build_sequence();
+
+    adcStart(&ANALOG_MATRIX_ADC_DRIVER, &adc_config);
+    gptStart(&ANALOG_MATRIX_GPT_DRIVER, &gpt_config);
+    gptStartContinuous(&ANALOG_MATRIX_GPT_DRIVER, 1);
+}
+
+bool analog_matrix_driver_read(uint16_t raw[MATRIX_ROWS][MATRIX_COLS]) {
+    chSysLock();
+    uint32_t count = frame_count;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            raw[row][col] = frame[row][col];
+        }
+    }
+    chSysUnlock();
+
+    if (count == consumed_frame) {
+        return false;
+    }
+    consumed_frame = count;
+    return true;
+}
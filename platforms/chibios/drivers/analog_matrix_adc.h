@@ -0,0 +1,49 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * \file
+ *
+ * \brief GPT/DMA paced ADC sampling driver for the analog matrix engine.
+ *
+ * Implements `analog_matrix_driver_init()` / `analog_matrix_driver_read()`
+ * (see quantum/analog_matrix.h) for ChibiOS targets. A GPT timer fires once
+ * per row; each tick starts a DMA-backed ADC sequence over all column
+ * channels of the currently selected row. The conversion-complete callback
+ * stores the samples and advances the row select lines, so every row gets a
+ * full timer period of mux settle time before it is sampled. The foreground
+ * never waits on the ADC - it just copies the latest completed frame.
+ *
+ * Hardware model: one analog input per column (`ANALOG_MATRIX_COL_PINS`),
+ * with the keys of each row routed onto those inputs through analog
+ * multiplexers addressed by shared binary select lines
+ * (`ANALOG_MATRIX_ROW_SEL_PINS`, least significant bit first). Boards
+ * without muxes (MATRIX_ROWS == 1) may leave the select pin list empty.
+ *
+ * Select it from a keyboard's rules.mk with:
+ *
+ *     ANALOG_MATRIX_ENABLE = yes
+ *     VPATH += $(PLATFORM_PATH)/$(PLATFORM_KEY)/$(DRIVER_DIR)
+ *     SRC += analog_matrix_adc.c
+ */
+
+/* Full-matrix sample rate in Hz; the GPT runs at this rate times
+ * MATRIX_ROWS. */
+#ifndef ANALOG_MATRIX_SCAN_FREQUENCY
+#    define ANALOG_MATRIX_SCAN_FREQUENCY 8000
+#endif
+
+/* GPT instance used to pace row conversions. */
+#ifndef ANALOG_MATRIX_GPT_DRIVER
+#    define ANALOG_MATRIX_GPT_DRIVER GPTD6
+#endif
+
+/* ADC instance the column channels are converted on. */
+#ifndef ANALOG_MATRIX_ADC_DRIVER
+#    define ANALOG_MATRIX_ADC_DRIVER ADCD1
+#endif
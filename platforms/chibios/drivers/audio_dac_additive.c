@@ -81,11 +81,66 @@ static const dacsample_t dac_buffer_trapezoid[AUDIO_DAC_BUFFER_SIZE] = {0x0,   0
 
 static dacsample_t dac_buffer_empty[AUDIO_DAC_BUFFER_SIZE] = {AUDIO_DAC_OFF_VALUE};
 
-/* keep track of the sample position for for each frequency */
-static float dac_if[AUDIO_MAX_SIMULTANEOUS_TONES] = {0.0};
+#ifdef AUDIO_CLICKY_PCM
+/* Pre-rendered keyclick: the two-tone clicky chirp (2*f then f, for the
+ * default 440Hz) with an exponential decay, rendered offline at the default
+ * generation rate and stored as signed 8-bit PCM in flash. Playback is a
+ * phase-accumulator walk through this table mixed on top of whatever the
+ * additive synth is producing, so triggering a click from the event path is
+ * just arming a pointer - no voice setup, no note state. The Q8 stride set
+ * by audio_driver_click() pitch-shifts the table for the clicky frequency
+ * controls and the per-press randomness. */
+#    define AUDIO_CLICK_PCM_LENGTH 768
+// Left shift applied to the 8-bit samples on mixing; 3 gives roughly a
+// quarter of the DAC's full scale.
+#    ifndef AUDIO_CLICKY_PCM_VOLUME_SHIFT
+#        define AUDIO_CLICKY_PCM_VOLUME_SHIFT 3
+#    endif
+// clang-format off
+static const int8_t dac_click_pcm[AUDIO_CLICK_PCM_LENGTH] = {
+#    include "audio_click_pcm.inc"
+};
+// clang-format on
+
+static volatile bool     click_active = false;
+static uint32_t          click_phase  = 0; // Q8 index into dac_click_pcm
+static uint32_t          click_stride = 1 << 8;
+
+/* Mixes the in-flight click (if any) onto one generated sample, clamped to
+ * the DAC range. Inactive cost is a load and a branch per sample. */
+static inline dacsample_t click_mix(dacsample_t sample) {
+    if (!click_active) {
+        return sample;
+    }
+    uint32_t index = click_phase >> 8;
+    if (index >= AUDIO_CLICK_PCM_LENGTH) {
+        click_active = false;
+        return sample;
+    }
+    click_phase += click_stride;
+    int32_t mixed = (int32_t)sample + ((int32_t)dac_click_pcm[index] << AUDIO_CLICKY_PCM_VOLUME_SHIFT);
+    if (mixed < 0) {
+        mixed = 0;
+    } else if (mixed > AUDIO_DAC_SAMPLE_MAX) {
+        mixed = AUDIO_DAC_SAMPLE_MAX;
+    }
+    return (dacsample_t)mixed;
+}
+#endif
+
+/* keep track of the sample position for each frequency, as a 32-bit phase
+ * accumulator where 2^32 corresponds to one full waveform cycle; overflow
+ * wraps the phase around naturally, so there is no fmod and no float math
+ * in the per-sample path - which matters on FPU-less parts like the F072,
+ * where the previous per-sample float code measurably ate into scan rate */
+static uint32_t dac_phase[AUDIO_MAX_SIMULTANEOUS_TONES]           = {0};
+static uint32_t dac_phase_increment[AUDIO_MAX_SIMULTANEOUS_TONES] = {0};
 
 static float   active_tones_snapshot[AUDIO_MAX_SIMULTANEOUS_TONES] = {0, 0};
 static uint8_t active_tones_snapshot_length                        = 0;
+// 1/active_tones_snapshot_length in Q16, to scale each tone by a multiply
+// and shift instead of a division per sample
+static uint32_t active_tones_scale = 0;
 
 typedef enum {
     OUTPUT_SHOULD_START,
@@ -114,35 +169,28 @@ __attribute__((weak)) uint16_t dac_value_generate(void) {
     }
 
     /* doing additive wave synthesis over all currently playing tones = adding up
-     * sine-wave-samples for each frequency, scaled by the number of active tones
+     * sine-wave-samples for each frequency, scaled by the number of active tones;
+     * integer-only: advance the fixed-point phase accumulator (letting it wrap on
+     * overflow) and scale by the precomputed Q16 reciprocal of the tone count
      */
-    uint16_t value     = 0;
-    float    frequency = 0.0f;
+    uint16_t value = 0;
 
     for (uint8_t i = 0; i < active_tones_snapshot_length; i++) {
         /* Note: a user implementation does not have to rely on the active_tones_snapshot, but
          * could directly query the active frequencies through audio_get_processed_frequency */
-        frequency = active_tones_snapshot[i];
-
-        dac_if[i] = dac_if[i] + ((frequency * AUDIO_DAC_BUFFER_SIZE) / AUDIO_DAC_SAMPLE_RATE) * 2 / 3;
-        /*Note: the 2/3 are necessary to get the correct frequencies on the
-         *      DAC output (as measured with an oscilloscope), since the gpt
-         *      timer runs with 3*AUDIO_DAC_SAMPLE_RATE; and the DAC callback
-         *      is called twice per conversion.*/
-
-        dac_if[i] = fmod(dac_if[i], AUDIO_DAC_BUFFER_SIZE);
+        dac_phase[i] += dac_phase_increment[i];
 
         // Wavetable generation/lookup
-        uint16_t dac_i = (uint16_t)dac_if[i];
+        uint16_t dac_i = (uint16_t)(((uint64_t)dac_phase[i] * AUDIO_DAC_BUFFER_SIZE) >> 32);
 
 #if defined(AUDIO_DAC_SAMPLE_WAVEFORM_SINE)
-        value += dac_buffer_sine[dac_i] / active_tones_snapshot_length;
+        value += ((uint32_t)dac_buffer_sine[dac_i] * active_tones_scale) >> 16;
 #elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRIANGLE)
-        value += dac_buffer_triangle[dac_i] / active_tones_snapshot_length;
+        value += ((uint32_t)dac_buffer_triangle[dac_i] * active_tones_scale) >> 16;
 #elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRAPEZOID)
-        value += dac_buffer_trapezoid[dac_i] / active_tones_snapshot_length;
+        value += ((uint32_t)dac_buffer_trapezoid[dac_i] * active_tones_scale) >> 16;
 #elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_SQUARE)
-        value += dac_buffer_square[dac_i] / active_tones_snapshot_length;
+        value += ((uint32_t)dac_buffer_square[dac_i] * active_tones_scale) >> 16;
 #endif
         /*
         // SINE
@@ -176,7 +224,11 @@ static void dac_end(DACDriver *dacp) {
 
     for (uint8_t s = 0; s < AUDIO_DAC_BUFFER_SIZE / 2; s++) {
         if (OUTPUT_OFF <= state) {
+#ifdef AUDIO_CLICKY_PCM
+            sample_p[s] = click_mix(AUDIO_DAC_OFF_VALUE);
+#else
             sample_p[s] = AUDIO_DAC_OFF_VALUE;
+#endif
             continue;
         } else {
             sample_p[s] = dac_value_generate();
@@ -221,9 +273,21 @@ static void dac_end(DACDriver *dacp) {
             for (uint8_t i = 0; i < active_tones; i++) {
                 float freq = audio_get_processed_frequency(i);
                 if (freq > 0) { // disregard 'rest' notes, with valid frequency 0.0f; which would only lower the resulting waveform volume during the additive synthesis step
-                    active_tones_snapshot[active_tones_snapshot_length++] = freq;
+                    active_tones_snapshot[active_tones_snapshot_length] = freq;
+                    /* phase increment per generated sample, as a 2^32 fixed-point fraction of one cycle.
+                     * Note: the 2/3 are necessary to get the correct frequencies on the
+                     *       DAC output (as measured with an oscilloscope), since the gpt
+                     *       timer runs with 3*AUDIO_DAC_SAMPLE_RATE; and the DAC callback
+                     *       is called twice per conversion.
+                     * this is the only float math left, and it runs once per tone change
+                     * instead of once per sample */
+                    dac_phase_increment[active_tones_snapshot_length] = (uint32_t)(freq * ((2.0f / 3.0f) * 4294967296.0f / AUDIO_DAC_SAMPLE_RATE));
+                    active_tones_snapshot_length++;
                 }
             }
+            if (active_tones_snapshot_length > 0) {
+                active_tones_scale = 0x10000UL / active_tones_snapshot_length;
+            }
 
             if ((0 == active_tones_snapshot_length) && (OUTPUT_REACHED_ZERO_BEFORE_OFF == state)) {
                 state = OUTPUT_OFF;
@@ -232,6 +296,12 @@ static void dac_end(DACDriver *dacp) {
                 state = OUTPUT_RUN_NORMALLY;
             }
         }
+
+#ifdef AUDIO_CLICKY_PCM
+        // mixed in after the state handling, so clicks neither disturb the
+        // zero-crossing detection nor get muted by the start/stop ramps
+        sample_p[s] = click_mix(sample_p[s]);
+#endif
     }
 
     // update audio internal state (note position, current_note, ...)
@@ -243,8 +313,13 @@ static void dac_end(DACDriver *dacp) {
 
     if (OUTPUT_OFF <= state) {
         if (OUTPUT_OFF_2 == state) {
-            // stopping timer6 = stopping the DAC at whatever value it is currently pushing to the output = AUDIO_DAC_OFF_VALUE
-            gptStopTimer(&GPTD6);
+#ifdef AUDIO_CLICKY_PCM
+            // hold the timer while a click is still draining; the next
+            // callback after it finishes performs the stop
+            if (!click_active)
+#endif
+                // stopping timer6 = stopping the DAC at whatever value it is currently pushing to the output = AUDIO_DAC_OFF_VALUE
+                gptStopTimer(&GPTD6);
         } else {
             state++;
         }
@@ -329,9 +404,27 @@ void audio_driver_start(void) {
     gptStartContinuous(&GPTD6, 2U);
 
     for (uint8_t i = 0; i < AUDIO_MAX_SIMULTANEOUS_TONES; i++) {
-        dac_if[i]                = 0.0f;
+        dac_phase[i]             = 0;
+        dac_phase_increment[i]   = 0;
         active_tones_snapshot[i] = 0.0f;
     }
     active_tones_snapshot_length = 0;
+    active_tones_scale           = 0;
     state                        = OUTPUT_SHOULD_START;
 }
+
+#ifdef AUDIO_CLICKY_PCM
+void audio_driver_click(uint16_t stride_q8) {
+    chSysLock();
+    click_phase  = 0;
+    click_stride = stride_q8;
+    click_active = true;
+    // wake the DAC if the additive output is fully off; the click then plays
+    // over silence at AUDIO_DAC_OFF_VALUE and the stop logic re-runs after
+    // it drains
+    if (GPTD6.state == GPT_READY) {
+        gptStartContinuousI(&GPTD6, 2U);
+    }
+    chSysUnlock();
+}
+#endif
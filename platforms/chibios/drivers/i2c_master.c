@@ -29,6 +29,9 @@
 #include <string.h>
 #include <ch.h>
 #include <hal.h>
+#ifdef TELEMETRY_COUNTERS_ENABLE
+#    include "telemetry_counters.h"
+#endif
 
 #ifndef I2C1_SCL_PIN
 #    define I2C1_SCL_PIN B6
@@ -90,6 +93,17 @@
 
 static uint8_t i2c_address;
 
+/* Several drivers (OLED, LED controllers, ...) can share the same bus, and
+ * with background flush threads transfers may be started from more than one
+ * thread, so every transfer exclusively acquires the bus. */
+#if (I2C_USE_MUTUAL_EXCLUSION == TRUE)
+#    define i2c_lock() i2cAcquireBus(&I2C_DRIVER)
+#    define i2c_unlock() i2cReleaseBus(&I2C_DRIVER)
+#else
+#    define i2c_lock()
+#    define i2c_unlock()
+#endif
+
 static const I2CConfig i2cconfig = {
 #if defined(USE_I2CV1_CONTRIB)
     I2C1_CLOCK_SPEED,
@@ -107,6 +121,72 @@ static const I2CConfig i2cconfig = {
 #endif
 };
 
+#ifdef I2C_FAST_CLOCK_ADDRESSES
+/* Per-transaction clock escalation: devices whose (shifted) addresses are
+ * listed in I2C_FAST_CLOCK_ADDRESSES run with the fast timing below, while
+ * everything else keeps the default. Every transfer passes its config to
+ * i2cStart(), which reprograms the peripheral's timing whenever consecutive
+ * transactions target different device classes -- so a 1MHz-capable LED
+ * controller and a 400kHz EEPROM can share the bus without clocking the
+ * EEPROM out of spec. */
+#    ifdef USE_I2CV1
+#        ifndef I2C1_FAST_CLOCK_SPEED
+#            define I2C1_FAST_CLOCK_SPEED 400000
+#        endif
+#        ifndef I2C1_FAST_DUTY_CYCLE
+#            define I2C1_FAST_DUTY_CYCLE FAST_DUTY_CYCLE_2
+#        endif
+#    else
+// The default timing values below configure the I2C clock to 1MHz assuming a 72Mhz clock
+#        ifndef I2C1_FAST_TIMINGR_PRESC
+#            define I2C1_FAST_TIMINGR_PRESC 0U
+#        endif
+#        ifndef I2C1_FAST_TIMINGR_SCLDEL
+#            define I2C1_FAST_TIMINGR_SCLDEL 3U
+#        endif
+#        ifndef I2C1_FAST_TIMINGR_SDADEL
+#            define I2C1_FAST_TIMINGR_SDADEL 0U
+#        endif
+#        ifndef I2C1_FAST_TIMINGR_SCLH
+#            define I2C1_FAST_TIMINGR_SCLH 23U
+#        endif
+#        ifndef I2C1_FAST_TIMINGR_SCLL
+#            define I2C1_FAST_TIMINGR_SCLL 45U
+#        endif
+#    endif
+
+static const I2CConfig i2cconfig_fast = {
+#    if defined(USE_I2CV1_CONTRIB)
+    I2C1_FAST_CLOCK_SPEED,
+#    elif defined(USE_I2CV1)
+    I2C1_OPMODE,
+    I2C1_FAST_CLOCK_SPEED,
+    I2C1_FAST_DUTY_CYCLE,
+#    elif defined(WB32F3G71xx) || defined(WB32FQ95xx)
+    I2C1_OPMODE,
+    I2C1_FAST_CLOCK_SPEED,
+#    else
+    STM32_TIMINGR_PRESC(I2C1_FAST_TIMINGR_PRESC) | STM32_TIMINGR_SCLDEL(I2C1_FAST_TIMINGR_SCLDEL) | STM32_TIMINGR_SDADEL(I2C1_FAST_TIMINGR_SDADEL) | STM32_TIMINGR_SCLH(I2C1_FAST_TIMINGR_SCLH) | STM32_TIMINGR_SCLL(I2C1_FAST_TIMINGR_SCLL), 0, 0
+#    endif
+};
+
+static const uint8_t i2c_fast_clock_addresses[] = I2C_FAST_CLOCK_ADDRESSES;
+
+static const I2CConfig* i2c_config_for(uint8_t address) {
+    for (uint8_t i = 0; i < ARRAY_SIZE(i2c_fast_clock_addresses); i++) {
+        if (i2c_fast_clock_addresses[i] == address) {
+            return &i2cconfig_fast;
+        }
+    }
+    return &i2cconfig;
+}
+#else
+static inline const I2CConfig* i2c_config_for(uint8_t address) {
+    (void)address;
+    return &i2cconfig;
+}
+#endif
+
 /**
  * @brief Handles any I2C error condition by stopping the I2C peripheral and
  * aborting any ongoing transactions. Furthermore ChibiOS status codes are
@@ -125,6 +205,9 @@ static i2c_status_t i2c_epilogue(const msg_t status) {
     // hard stop in case of any error.
     i2c_stop();
 
+#ifdef TELEMETRY_COUNTERS_ENABLE
+    telemetry_counters_note_i2c_error();
+#endif
     return status == MSG_TIMEOUT ? I2C_STATUS_TIMEOUT : I2C_STATUS_ERROR;
 }
 
@@ -150,42 +233,47 @@ __attribute__((weak)) void i2c_init(void) {
 
 i2c_status_t i2c_start(uint8_t address) {
     i2c_address = address;
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    i2cStart(&I2C_DRIVER, i2c_config_for(i2c_address));
     return I2C_STATUS_SUCCESS;
 }
 
 i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_lock();
     i2c_address = address;
-    i2cStart(&I2C_DRIVER, &i2cconfig);
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), data, length, 0, 0, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    i2cStart(&I2C_DRIVER, i2c_config_for(i2c_address));
+    msg_t        status = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), data, length, 0, 0, TIME_MS2I(timeout));
+    i2c_status_t ret    = i2c_epilogue(status);
+    i2c_unlock();
+    return ret;
 }
 
 i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_lock();
     i2c_address = address;
-    i2cStart(&I2C_DRIVER, &i2cconfig);
-    msg_t status = i2cMasterReceiveTimeout(&I2C_DRIVER, (i2c_address >> 1), data, length, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    i2cStart(&I2C_DRIVER, i2c_config_for(i2c_address));
+    msg_t        status = i2cMasterReceiveTimeout(&I2C_DRIVER, (i2c_address >> 1), data, length, TIME_MS2I(timeout));
+    i2c_status_t ret    = i2c_epilogue(status);
+    i2c_unlock();
+    return ret;
 }
 
 i2c_status_t i2c_writeReg(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2c_address = devaddr;
-    i2cStart(&I2C_DRIVER, &i2cconfig);
-
     uint8_t complete_packet[length + 1];
     for (uint16_t i = 0; i < length; i++) {
         complete_packet[i + 1] = data[i];
     }
     complete_packet[0] = regaddr;
 
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), complete_packet, length + 1, 0, 0, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    i2c_lock();
+    i2c_address = devaddr;
+    i2cStart(&I2C_DRIVER, i2c_config_for(i2c_address));
+    msg_t        status = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), complete_packet, length + 1, 0, 0, TIME_MS2I(timeout));
+    i2c_status_t ret    = i2c_epilogue(status);
+    i2c_unlock();
+    return ret;
 }
 
 i2c_status_t i2c_writeReg16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2c_address = devaddr;
-    i2cStart(&I2C_DRIVER, &i2cconfig);
-
     uint8_t complete_packet[length + 2];
     for (uint16_t i = 0; i < length; i++) {
         complete_packet[i + 2] = data[i];
@@ -193,25 +281,109 @@ i2c_status_t i2c_writeReg16(uint8_t devaddr, uint16_t regaddr, const uint8_t* da
     complete_packet[0] = regaddr >> 8;
     complete_packet[1] = regaddr & 0xFF;
 
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), complete_packet, length + 2, 0, 0, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    i2c_lock();
+    i2c_address = devaddr;
+    i2cStart(&I2C_DRIVER, i2c_config_for(i2c_address));
+    msg_t        status = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), complete_packet, length + 2, 0, 0, TIME_MS2I(timeout));
+    i2c_status_t ret    = i2c_epilogue(status);
+    i2c_unlock();
+    return ret;
 }
 
 i2c_status_t i2c_readReg(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_lock();
     i2c_address = devaddr;
-    i2cStart(&I2C_DRIVER, &i2cconfig);
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), &regaddr, 1, data, length, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    i2cStart(&I2C_DRIVER, i2c_config_for(i2c_address));
+    msg_t        status = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), &regaddr, 1, data, length, TIME_MS2I(timeout));
+    i2c_status_t ret    = i2c_epilogue(status);
+    i2c_unlock();
+    return ret;
 }
 
 i2c_status_t i2c_readReg16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2c_address = devaddr;
-    i2cStart(&I2C_DRIVER, &i2cconfig);
     uint8_t register_packet[2] = {regaddr >> 8, regaddr & 0xFF};
-    msg_t   status             = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), register_packet, 2, data, length, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+
+    i2c_lock();
+    i2c_address = devaddr;
+    i2cStart(&I2C_DRIVER, i2c_config_for(i2c_address));
+    msg_t        status = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), register_packet, 2, data, length, TIME_MS2I(timeout));
+    i2c_status_t ret    = i2c_epilogue(status);
+    i2c_unlock();
+    return ret;
 }
 
 void i2c_stop(void) {
     i2cStop(&I2C_DRIVER);
 }
+
+#ifdef I2C_ASYNC_ENABLE
+
+#    ifndef I2C_ASYNC_QUEUE_DEPTH
+#        define I2C_ASYNC_QUEUE_DEPTH 8
+#    endif
+
+typedef struct {
+    i2c_async_job_t job;
+    void*           context;
+    uint8_t         priority;
+} i2c_async_entry_t;
+
+// Guarded by the system lock; entries are kept in submission order and the
+// worker picks the first entry of the highest present priority.
+static i2c_async_entry_t async_queue[I2C_ASYNC_QUEUE_DEPTH];
+static uint8_t           async_queued  = 0;
+static volatile bool     async_running = false;
+static semaphore_t       async_signal;
+static THD_WORKING_AREA(waI2CAsyncThread, 512);
+
+static THD_FUNCTION(I2CAsyncThread, arg) {
+    (void)arg;
+    chRegSetThreadName("i2c_async");
+    for (;;) {
+        chSemWait(&async_signal);
+
+        chSysLock();
+        uint8_t pick = 0;
+        for (uint8_t i = 1; i < async_queued; i++) {
+            if (async_queue[i].priority > async_queue[pick].priority) {
+                pick = i;
+            }
+        }
+        i2c_async_entry_t entry = async_queue[pick];
+        async_queued--;
+        for (uint8_t i = pick; i < async_queued; i++) {
+            async_queue[i] = async_queue[i + 1];
+        }
+        async_running = true;
+        chSysUnlock();
+
+        entry.job(entry.context);
+        async_running = false;
+    }
+}
+
+bool i2c_async_submit(i2c_async_job_t job, void* context, uint8_t priority) {
+    static bool worker_started = false;
+    if (!worker_started) {
+        chSemObjectInit(&async_signal, 0);
+        chThdCreateStatic(waI2CAsyncThread, sizeof(waI2CAsyncThread), LOWPRIO, I2CAsyncThread, NULL);
+        worker_started = true;
+    }
+
+    chSysLock();
+    if (async_queued == I2C_ASYNC_QUEUE_DEPTH) {
+        chSysUnlock();
+        return false;
+    }
+    async_queue[async_queued++] = (i2c_async_entry_t){.job = job, .context = context, .priority = priority};
+    chSysUnlock();
+
+    chSemSignal(&async_signal);
+    return true;
+}
+
+bool i2c_async_pending(void) {
+    return async_queued > 0 || async_running;
+}
+
+#endif
@@ -25,6 +25,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 
 typedef int16_t i2c_status_t;
 
@@ -32,6 +33,28 @@ typedef int16_t i2c_status_t;
 #define I2C_STATUS_ERROR (-1)
 #define I2C_STATUS_TIMEOUT (-2)
 
+#ifdef I2C_ASYNC_ENABLE
+/* Background I2C work queue. A job is a function that performs a complete,
+ * self-contained sequence of bus transfers (e.g. one LED PWM flush) using
+ * the regular blocking API; it runs on a low-priority worker thread, so the
+ * transfers overlap with matrix scanning instead of stalling it. Jobs are
+ * executed one at a time, highest priority first, FIFO within a priority,
+ * which also serializes clients that share stateful devices.
+ *
+ * The submitting code must keep `context` (and any buffers the job reads)
+ * stable until the job has run; snapshot into driver-owned storage before
+ * submitting. Submission fails when the queue is full - callers retry on
+ * their next task invocation. */
+typedef void (*i2c_async_job_t)(void *context);
+
+#    define I2C_ASYNC_PRIORITY_LOW 0
+#    define I2C_ASYNC_PRIORITY_HIGH 1
+
+bool i2c_async_submit(i2c_async_job_t job, void *context, uint8_t priority);
+/* True while any job is queued or executing. */
+bool i2c_async_pending(void);
+#endif
+
 void         i2c_init(void);
 i2c_status_t i2c_start(uint8_t address);
 i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout);
@@ -0,0 +1,223 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <ch.h>
+#include <hal.h>
+
+#include "joystick_adc.h"
+#include "joystick.h"
+#include "analog.h"
+#include "gpio.h"
+#include "debug.h"
+
+#if !HAL_USE_ADC
+#    error "You need to set HAL_USE_ADC to TRUE in your halconf.h to use the async joystick ADC."
+#endif
+#if !HAL_USE_GPT
+#    error "You need to set HAL_USE_GPT to TRUE in your halconf.h to use the async joystick ADC."
+#endif
+
+// Same family split as analog.c; the sequence registers differ per ADC IP.
+#if defined(STM32F0XX) || defined(STM32L0XX)
+#    define USE_ADCV1
+#elif defined(STM32F1XX) || defined(STM32F2XX) || defined(STM32F4XX) || defined(GD32VF103) || defined(WB32F3G71xx) || defined(WB32FQ95xx)
+#    define USE_ADCV2
+#endif
+
+/* Number of non-virtual axes and sample index -> axis mapping, built at init
+ * from joystick_axes. On ADCv1 and RP2040 the hardware scans enabled channels
+ * in ascending channel order regardless of the axis order, so the mapping is
+ * sorted to match there. */
+static uint8_t num_inputs = 0;
+static uint8_t sample_axis[JOYSTICK_AXIS_COUNT];
+
+static adcsample_t sequence_samples[JOYSTICK_AXIS_COUNT];
+
+/* Oversampling ring, indexed by axis. Written only in the ADC callback, read
+ * under lock in joystick_driver_read(). */
+static volatile uint16_t ring[JOYSTICK_OVERSAMPLE][JOYSTICK_AXIS_COUNT];
+static volatile uint32_t batch_count    = 0;
+static uint32_t          consumed_batch = 0;
+static volatile uint8_t  ring_index     = 0;
+
+static void adc_complete_callback(ADCDriver *adcp) {
+    (void)adcp;
+    uint8_t w = ring_index;
+    for (uint8_t i = 0; i < num_inputs; i++) {
+        ring[w][sample_axis[i]] = sequence_samples[i];
+    }
+    if (++w >= JOYSTICK_OVERSAMPLE) {
+        w = 0;
+        batch_count++;
+    }
+    ring_index = w;
+}
+
+static ADCConversionGroup conversion_group = {
+    .circular = FALSE,
+    .end_cb   = adc_complete_callback,
+#if defined(USE_ADCV1)
+    .cfgr1 = ADC_CFGR1_RES_12BIT,
+#elif defined(USE_ADCV2)
+#    if !defined(STM32F1XX) && !defined(GD32VF103) && !defined(WB32F3G71xx) && !defined(WB32FQ95xx)
+    .cr2 = ADC_CR2_SWSTART,
+#    endif
+#elif defined(RP2040)
+// RP2040 does not have any extra config here
+#else
+    .cfgr = ADC_CFGR_RES_12BITS,
+#endif
+};
+
+static void build_sequence(void) {
+    uint8_t inputs[JOYSTICK_AXIS_COUNT];
+    for (uint8_t axis = 0; axis < JOYSTICK_AXIS_COUNT; axis++) {
+        if (joystick_axes[axis].input_pin == JS_VIRTUAL_AXIS) {
+            continue;
+        }
+        adc_mux mux = pinToMux(joystick_axes[axis].input_pin);
+        if (mux.adc == 0xFF) {
+            dprintf("joystick_adc: axis %u pin has no ADC channel\n", axis);
+            chSysHalt("joystick_adc pin");
+        }
+        inputs[num_inputs]      = mux.input;
+        sample_axis[num_inputs] = axis;
+        num_inputs++;
+    }
+
+#if defined(USE_ADCV1) || defined(RP2040)
+    /* Enabled channels are scanned in ascending channel order; sort the
+     * sample -> axis mapping to match. */
+    for (uint8_t i = 1; i < num_inputs; i++) {
+        for (uint8_t j = i; j > 0 && inputs[j - 1] > inputs[j]; j--) {
+            uint8_t tmp_in     = inputs[j];
+            uint8_t tmp_ax     = sample_axis[j];
+            inputs[j]          = inputs[j - 1];
+            sample_axis[j]     = sample_axis[j - 1];
+            inputs[j - 1]      = tmp_in;
+            sample_axis[j - 1] = tmp_ax;
+        }
+    }
+#endif
+
+    conversion_group.num_channels = num_inputs;
+
+#if defined(USE_ADCV1)
+    for (uint8_t i = 0; i < num_inputs; i++) {
+        conversion_group.chselr |= 1UL << inputs[i];
+    }
+#elif defined(USE_ADCV2)
+    /* SQ1..SQ6 in SQR3, SQ7..SQ12 in SQR2, SQ13..SQ16 in SQR1; 5 bits each. */
+    for (uint8_t i = 0; i < num_inputs; i++) {
+        if (i < 6) {
+            conversion_group.sqr3 |= (uint32_t)inputs[i] << (5 * i);
+        } else {
+            conversion_group.sqr2 |= (uint32_t)inputs[i] << (5 * (i - 6));
+        }
+    }
+    conversion_group.sqr1 |= ADC_SQR1_NUM_CH(num_inputs);
+#elif defined(RP2040)
+    for (uint8_t i = 0; i < num_inputs; i++) {
+        conversion_group.channel_mask |= 1UL << inputs[i];
+    }
+#else
+    /* ADCv3/v4: SQ1..SQ4 in SQR1 (from bit 6), five per register after that;
+     * 6 bits each. */
+    for (uint8_t i = 0; i < num_inputs; i++) {
+        if (i < 4) {
+            conversion_group.sqr[0] |= (uint32_t)inputs[i] << (6 * (i + 1));
+        } else {
+            conversion_group.sqr[1 + (i - 4) / 5] |= (uint32_t)inputs[i] << (6 * ((i - 4) % 5));
+        }
+    }
+    conversion_group.sqr[0] |= ADC_SQR1_NUM_CH(num_inputs);
+#endif
+}
+
+static void gpt_tick_callback(GPTDriver *gptp) {
+    (void)gptp;
+    chSysLockFromISR();
+    /* Skip a tick rather than queue if the previous sequence somehow has not
+     * finished; starting a busy driver is a ChibiOS state violation. */
+    if (JOYSTICK_ADC_DRIVER.state == ADC_READY) {
+        adcStartConversionI(&JOYSTICK_ADC_DRIVER, &conversion_group, sequence_samples, 1);
+    }
+    chSysUnlockFromISR();
+}
+
+static const GPTConfig gpt_config = {
+    .frequency = JOYSTICK_ADC_SAMPLE_FREQUENCY,
+    .callback  = gpt_tick_callback,
+};
+
+static ADCConfig adc_config = {};
+
+void joystick_driver_init(void) {
+    /* The blocking path drives output/ground pins around every read; here the
+     * dividers are powered once and left alone. */
+    for (uint8_t axis = 0; axis < JOYSTICK_AXIS_COUNT; axis++) {
+        if (joystick_axes[axis].input_pin == JS_VIRTUAL_AXIS) {
+            continue;
+        }
+        palSetLineMode(joystick_axes[axis].input_pin, PAL_MODE_INPUT_ANALOG);
+        if (joystick_axes[axis].output_pin != JS_VIRTUAL_AXIS) {
+            setPinOutput(joystick_axes[axis].output_pin);
+            writePinHigh(joystick_axes[axis].output_pin);
+        }
+        if (joystick_axes[axis].ground_pin != JS_VIRTUAL_AXIS) {
+            setPinOutput(joystick_axes[axis].ground_pin);
+            writePinLow(joystick_axes[axis].ground_pin);
+        }
+    }
+
+    build_sequence();
+    if (num_inputs == 0) {
+        return;
+    }
+
+    adcStart(&JOYSTICK_ADC_DRIVER, &adc_config);
+    gptStart(&JOYSTICK_ADC_GPT_DRIVER, &gpt_config);
+    gptStartContinuous(&JOYSTICK_ADC_GPT_DRIVER, 1);
+}
+
+/* Median of one axis' column of the ring snapshot. */
+static uint16_t filter_axis(const uint16_t snapshot[JOYSTICK_OVERSAMPLE][JOYSTICK_AXIS_COUNT], uint8_t axis) {
+    uint16_t sorted[JOYSTICK_OVERSAMPLE];
+    for (uint8_t i = 0; i < JOYSTICK_OVERSAMPLE; i++) {
+        uint16_t val = snapshot[i][axis];
+        uint8_t  j   = i;
+        for (; j > 0 && sorted[j - 1] > val; j--) {
+            sorted[j] = sorted[j - 1];
+        }
+        sorted[j] = val;
+    }
+#if JOYSTICK_OVERSAMPLE % 2 == 0
+    return (sorted[JOYSTICK_OVERSAMPLE / 2 - 1] + sorted[JOYSTICK_OVERSAMPLE / 2]) / 2;
+#else
+    return sorted[JOYSTICK_OVERSAMPLE / 2];
+#endif
+}
+
+bool joystick_driver_read(uint16_t raw[JOYSTICK_AXIS_COUNT]) {
+    uint16_t snapshot[JOYSTICK_OVERSAMPLE][JOYSTICK_AXIS_COUNT];
+
+    chSysLock();
+    uint32_t count = batch_count;
+    for (uint8_t i = 0; i < JOYSTICK_OVERSAMPLE; i++) {
+        for (uint8_t i2 = 0; i2 < num_inputs; i2++) {
+            snapshot[i][sample_axis[i2]] = ring[i][sample_axis[i2]];
+        }
+    }
+    chSysUnlock();
+
+    if (count == consumed_batch) {
+        return false;
+    }
+    consumed_batch = count;
+
+    /* Filter in batch, outside the lock. */
+    for (uint8_t i = 0; i < num_inputs; i++) {
+        raw[sample_axis[i]] = filter_axis(snapshot, sample_axis[i]);
+    }
+    return true;
+}
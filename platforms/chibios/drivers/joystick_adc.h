@@ -0,0 +1,39 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/** \file
+ *
+ * Timer-paced ADC sampling backend for the joystick feature.
+ *
+ * A GPT timer starts one ADC conversion sequence covering every non-virtual
+ * axis per tick; completions land in a ring buffer sized by
+ * JOYSTICK_OVERSAMPLE. joystick_driver_read() hands the joystick task a
+ * median-filtered value per axis once per full ring, so the main loop never
+ * blocks on a conversion and the axes are oversampled for free.
+ *
+ * Enable with `JOYSTICK_ASYNC_ADC = yes` in rules.mk alongside
+ * `JOYSTICK_DRIVER = analog`. The axis pin configuration is the regular
+ * `joystick_axes` array; output/ground pins are driven once at init instead
+ * of per read.
+ */
+
+/* Ring depth per axis; the median of these is reported. */
+#ifndef JOYSTICK_OVERSAMPLE
+#    define JOYSTICK_OVERSAMPLE 8
+#endif
+
+/* Conversion sequences per second. Each completed ring of JOYSTICK_OVERSAMPLE
+ * sequences yields one filtered batch, so the defaults produce 1 kHz batches. */
+#ifndef JOYSTICK_ADC_SAMPLE_FREQUENCY
+#    define JOYSTICK_ADC_SAMPLE_FREQUENCY (1000 * JOYSTICK_OVERSAMPLE)
+#endif
+
+#ifndef JOYSTICK_ADC_GPT_DRIVER
+#    define JOYSTICK_ADC_GPT_DRIVER GPTD7
+#endif
+
+#ifndef JOYSTICK_ADC_DRIVER
+#    define JOYSTICK_ADC_DRIVER ADCD1
+#endif
@@ -0,0 +1,151 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include <hal.h>
+
+#include "matrix_dma.h"
+#include "gpio.h"
+#include "util.h"
+#include "debug.h"
+
+#if !defined(MATRIX_ROW_PINS) || !defined(MATRIX_COL_PINS)
+#    error "matrix_dma requires MATRIX_ROW_PINS and MATRIX_COL_PINS"
+#endif
+#if defined(DIODE_DIRECTION) && (DIODE_DIRECTION != COL2ROW)
+#    error "matrix_dma only supports COL2ROW matrices"
+#endif
+
+#ifndef MATRIX_DMA_ROW_STREAM
+#    define MATRIX_DMA_ROW_STREAM STM32_DMA1_STREAM1
+#endif
+#ifndef MATRIX_DMA_COL_STREAM
+#    define MATRIX_DMA_COL_STREAM STM32_DMA1_STREAM2
+#endif
+#if (STM32_DMA_SUPPORTS_DMAMUX == TRUE) && !defined(MATRIX_DMA_DMAMUX_ID)
+#    error "please specify in your config.h: #define MATRIX_DMA_DMAMUX_ID STM32_DMAMUX1_TIM?_UP"
+#endif
+
+static const pin_t row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+static const pin_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+
+/* One BSRR pattern per row: drive the selected row low, all others high. */
+static uint32_t row_select_patterns[MATRIX_ROWS];
+
+/* Column port IDR snapshots, one 16-bit sample per row, double buffered so
+ * the foreground copy never races the DMA writer. */
+static volatile uint16_t col_samples[2][MATRIX_ROWS];
+
+static stm32_gpio_t *row_port;
+static stm32_gpio_t *col_port;
+
+static const GPTConfig gpt_config = {
+    .frequency = MATRIX_DMA_SCAN_FREQUENCY * MATRIX_ROWS,
+    .callback  = NULL,
+    .cr2       = TIM_CR2_MMS_1, /* TRGO on update */
+    .dier      = TIM_DIER_UDE,  /* DMA request on update */
+};
+
+static void build_row_patterns(void) {
+    uint32_t all_rows_mask = 0;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        all_rows_mask |= 1UL << PAL_PAD(row_pins[row]);
+    }
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        uint32_t select_bit = 1UL << PAL_PAD(row_pins[row]);
+        /* BSRR: low half sets, high half resets. Reset (drive low) the
+         * selected row, set every other row high. */
+        row_select_patterns[row] = (all_rows_mask & ~select_bit) | (select_bit << 16);
+    }
+}
+
+static bool pins_share_port(const pin_t *pins, uint8_t count, stm32_gpio_t **port_out) {
+    stm32_gpio_t *port = NULL;
+    for (uint8_t i = 0; i < count; i++) {
+        if (pins[i] == NO_PIN) continue;
+        if (port == NULL) {
+            port = PAL_PORT(pins[i]);
+        } else if (PAL_PORT(pins[i]) != port) {
+            return false;
+        }
+    }
+    *port_out = port;
+    return port != NULL;
+}
+
+void matrix_init_custom(void) {
+    if (!pins_share_port(row_pins, MATRIX_ROWS, &row_port) || !pins_share_port(col_pins, MATRIX_COLS, &col_port)) {
+        dprintf("matrix_dma: row/col pins must each share one GPIO port\n");
+        chSysHalt("matrix_dma pin layout");
+    }
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        setPinOutput(row_pins[row]);
+        writePinHigh(row_pins[row]);
+    }
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        setPinInputHigh(col_pins[col]);
+    }
+
+    build_row_patterns();
+
+    /* Row select stream: circular mem-to-periph, one word per trigger. */
+    dmaStreamAlloc(MATRIX_DMA_ROW_STREAM - STM32_DMA_STREAM(0), 10, NULL, NULL);
+    dmaStreamSetPeripheral(MATRIX_DMA_ROW_STREAM, &row_port->BSRR);
+    dmaStreamSetMemory0(MATRIX_DMA_ROW_STREAM, row_select_patterns);
+    dmaStreamSetTransactionSize(MATRIX_DMA_ROW_STREAM, MATRIX_ROWS);
+    dmaStreamSetMode(MATRIX_DMA_ROW_STREAM, STM32_DMA_CR_DIR_M2P | STM32_DMA_CR_PSIZE_WORD | STM32_DMA_CR_MSIZE_WORD | STM32_DMA_CR_MINC | STM32_DMA_CR_CIRC | STM32_DMA_CR_PL(2));
+
+    /* Column sample stream: circular periph-to-mem over both buffer halves.
+     * It is started one row behind the select stream, giving every row a
+     * full timer period of settle time before its columns are latched. */
+    dmaStreamAlloc(MATRIX_DMA_COL_STREAM - STM32_DMA_STREAM(0), 10, NULL, NULL);
+    dmaStreamSetPeripheral(MATRIX_DMA_COL_STREAM, &col_port->IDR);
+    dmaStreamSetMemory0(MATRIX_DMA_COL_STREAM, col_samples);
+    dmaStreamSetTransactionSize(MATRIX_DMA_COL_STREAM, 2 * MATRIX_ROWS);
+    dmaStreamSetMode(MATRIX_DMA_COL_STREAM, STM32_DMA_CR_DIR_P2M | STM32_DMA_CR_PSIZE_HWORD | STM32_DMA_CR_MSIZE_HWORD | STM32_DMA_CR_MINC | STM32_DMA_CR_CIRC | STM32_DMA_CR_PL(2));
+
+#if STM32_DMA_SUPPORTS_DMAMUX
+    dmaSetRequestSource(MATRIX_DMA_ROW_STREAM, MATRIX_DMA_DMAMUX_ID);
+    dmaSetRequestSource(MATRIX_DMA_COL_STREAM, MATRIX_DMA_DMAMUX_ID);
+#endif
+
+    /* Pre-select row 0, then start sampling offset by one trigger. */
+    row_port->BSRR = row_select_patterns[0];
+    dmaStreamEnable(MATRIX_DMA_COL_STREAM);
+    dmaStreamEnable(MATRIX_DMA_ROW_STREAM);
+
+    gptStart(&MATRIX_DMA_GPT_DRIVER, &gpt_config);
+    gptStartContinuous(&MATRIX_DMA_GPT_DRIVER, 1);
+}
+
+bool matrix_scan_custom(matrix_row_t current_matrix[]) {
+    uint16_t snapshot[MATRIX_ROWS];
+
+    /* Copy whichever half the DMA engine is not currently filling. The
+     * counter runs 2*MATRIX_ROWS..1 over both halves. */
+    size_t remaining = dmaStreamGetTransactionSize(MATRIX_DMA_COL_STREAM);
+    uint8_t idle_half = (remaining > MATRIX_ROWS) ? 1 : 0;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        snapshot[row] = col_samples[idle_half][row];
+    }
+
+    bool changed = false;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix_row_t row_value   = 0;
+        matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+        for (uint8_t col = 0; col < MATRIX_COLS; col++, row_shifter <<= 1) {
+            /* Columns idle high; a pressed key pulls the line to the
+             * selected (low) row. */
+            if (!(snapshot[row] & (1U << PAL_PAD(col_pins[col])))) {
+                row_value |= row_shifter;
+            }
+        }
+        if (current_matrix[row] != row_value) {
+            current_matrix[row] = row_value;
+            changed             = true;
+        }
+    }
+    return changed;
+}
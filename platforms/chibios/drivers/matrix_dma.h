@@ -0,0 +1,49 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "matrix.h"
+
+/**
+ * \file
+ *
+ * \brief Timer/DMA driven matrix scan backend for ChibiOS targets.
+ *
+ * Instead of strobing rows and busy-waiting inside `matrix_scan()`, a GPT
+ * timer triggers two DMA streams in circular mode:
+ *
+ *  - one memory-to-peripheral stream writes precomputed row select patterns
+ *    to the row port's BSRR register, and
+ *  - one peripheral-to-memory stream samples the column port's IDR into a
+ *    double buffer, one sample per row, half a scan behind the row stream so
+ *    that column signals have a full timer period to settle.
+ *
+ * `matrix_scan_custom()` then reduces to copying the most recently completed
+ * buffer half and demultiplexing column bits - no pin banging, no delays.
+ *
+ * Requirements (checked at init where possible):
+ *  - all row pins share one GPIO port, all column pins share one GPIO port
+ *  - COL2ROW diode direction, rows driven (unselected rows are driven high,
+ *    as with `MATRIX_UNSELECT_DRIVE_HIGH`)
+ *
+ * Select it from a keyboard's rules.mk with:
+ *
+ *     CUSTOM_MATRIX = lite
+ *     VPATH += $(PLATFORM_PATH)/$(PLATFORM_KEY)/$(DRIVER_DIR)
+ *     SRC += matrix_dma.c
+ */
+
+/* Effective hardware scan rate in Hz; one full matrix pass is
+ * MATRIX_ROWS timer ticks. */
+#ifndef MATRIX_DMA_SCAN_FREQUENCY
+#    define MATRIX_DMA_SCAN_FREQUENCY 8000
+#endif
+
+/* GPT instance used to pace the row strobe / column sample streams. */
+#ifndef MATRIX_DMA_GPT_DRIVER
+#    define MATRIX_DMA_GPT_DRIVER GPTD6
+#endif
@@ -9,6 +9,280 @@
 #include "printf.h"
 #include "synchronization_util.h"
 
+#if defined(SERIAL_TRANSPORT_STREAMING)
+
+#    if !defined(SERIAL_USART_FULL_DUPLEX) && !defined(MCU_RP)
+#        error "SERIAL_TRANSPORT_STREAMING needs a full-duplex link, enable SERIAL_USART_FULL_DUPLEX."
+#    endif
+
+#    include <string.h>
+#    include <stddef.h>
+#    include "crc.h"
+
+#    if !defined(SERIAL_USART_TIMEOUT)
+#        define SERIAL_USART_TIMEOUT 20
+#    endif
+
+#    if !defined(SERIAL_STREAM_TRIGGER_TIMEOUT)
+#        define SERIAL_STREAM_TRIGGER_TIMEOUT (2 * SERIAL_USART_TIMEOUT)
+#    endif
+
+#    define SERIAL_STREAM_SYNC_BYTE 0xD5
+#    define SERIAL_STREAM_NO_TRIGGER 0xFF
+
+/* On-wire frame exchanged in both directions. Instead of per-transaction
+ * request/response round trips both halves continuously trade complete
+ * snapshots of the split shared memory, each protected by a CRC trailer. The
+ * receiving half only copies back the regions that are owned by the remote
+ * half, as described by the transaction table. */
+typedef struct serial_stream_frame_t {
+    uint8_t sync;
+    uint8_t trigger_id;
+    uint8_t shmem[sizeof(split_shared_memory_t)];
+    uint8_t crc;
+} serial_stream_frame_t;
+
+static serial_stream_frame_t stream_tx_frame;
+static serial_stream_frame_t stream_rx_frame;
+
+/* Transaction ids whose slave callbacks still have to be triggered, oldest
+ * first. Guarded by the split shared memory lock. Completion is tracked with
+ * free running counters so that initiators can wait for their trigger. */
+static uint8_t           trigger_ring[NUM_TOTAL_TRANSACTIONS];
+static uint8_t           trigger_head             = 0;
+static uint8_t           trigger_count            = 0;
+static volatile uint16_t trigger_enqueued_total   = 0;
+static volatile uint16_t trigger_completed_total  = 0;
+static volatile bool     stream_link_up           = false;
+
+static inline uint8_t stream_frame_crc(const serial_stream_frame_t* frame) {
+    return crc8(frame, offsetof(serial_stream_frame_t, crc));
+}
+
+/**
+ * @brief Copy the remote halves regions out of a received snapshot into the
+ * local split shared memory. The master owns all initiator2target regions, the
+ * slave owns all target2initiator regions - only the foreign ones are merged.
+ */
+static void stream_merge_snapshot(const uint8_t* raw, bool initiator) {
+    for (uint8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        split_transaction_desc_t* trans = &split_transaction_table[id];
+        if (initiator) {
+            if (trans->target2initiator_buffer_size) {
+                memcpy(split_trans_target2initiator_buffer(trans), raw + trans->target2initiator_offset, trans->target2initiator_buffer_size);
+            }
+        } else {
+            if (trans->initiator2target_buffer_size) {
+                memcpy(split_trans_initiator2target_buffer(trans), raw + trans->initiator2target_offset, trans->initiator2target_buffer_size);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Perform one full-duplex exchange from the master half: stream out the
+ * local snapshot together with at most one pending slave callback trigger and
+ * merge the slaves snapshot that is received in return. The trigger is only
+ * retired once the slaves answer proves that it was processed.
+ */
+static bool stream_exchange(void) {
+    stream_tx_frame.sync = SERIAL_STREAM_SYNC_BYTE;
+
+    split_shared_memory_lock();
+    stream_tx_frame.trigger_id = trigger_count ? trigger_ring[trigger_head] : SERIAL_STREAM_NO_TRIGGER;
+    memcpy(stream_tx_frame.shmem, split_shmem, sizeof(split_shared_memory_t));
+    split_shared_memory_unlock();
+
+    stream_tx_frame.crc = stream_frame_crc(&stream_tx_frame);
+
+    if (unlikely(!serial_transport_send((uint8_t*)&stream_tx_frame, sizeof(stream_tx_frame)))) {
+        return false;
+    }
+
+    if (unlikely(!serial_transport_receive((uint8_t*)&stream_rx_frame, sizeof(stream_rx_frame)))) {
+        return false;
+    }
+
+    if (unlikely(stream_rx_frame.sync != SERIAL_STREAM_SYNC_BYTE || stream_rx_frame.crc != stream_frame_crc(&stream_rx_frame))) {
+        return false;
+    }
+
+    split_shared_memory_lock();
+    stream_merge_snapshot(stream_rx_frame.shmem, true);
+    if (stream_tx_frame.trigger_id != SERIAL_STREAM_NO_TRIGGER) {
+        trigger_head = (trigger_head + 1) % NUM_TOTAL_TRANSACTIONS;
+        trigger_count--;
+        trigger_completed_total++;
+    }
+    split_shared_memory_unlock();
+
+    stream_link_up = true;
+    return true;
+}
+
+/**
+ * @brief This thread runs on the master and keeps the split shared memory of
+ * both halves synchronized in the background.
+ */
+static THD_WORKING_AREA(waMasterThread, 1024);
+static THD_FUNCTION(MasterThread, arg) {
+    (void)arg;
+    chRegSetThreadName("split_stream_tx_rx");
+
+    while (true) {
+        if (unlikely(!stream_exchange())) {
+            stream_link_up = false;
+            /* Clear the receive queue, to start with a clean slate.
+             * Parts of failed frames or spurious bytes could still be in it. */
+            serial_transport_driver_clear();
+        }
+    }
+}
+
+/**
+ * @brief Answer one streamed frame on the slave: re-align on the sync byte,
+ * verify the CRC, merge the masters snapshot, run a possibly requested slave
+ * callback and stream the local snapshot back.
+ */
+static bool stream_respond(void) {
+    /* Hunt for the sync byte, so we can re-align after bit errors or a master
+     * side reset without ever getting stuck mid-frame. */
+    do {
+        if (unlikely(!serial_transport_receive_blocking(&stream_rx_frame.sync, sizeof(stream_rx_frame.sync)))) {
+            return false;
+        }
+    } while (stream_rx_frame.sync != SERIAL_STREAM_SYNC_BYTE);
+
+    if (unlikely(!serial_transport_receive((uint8_t*)&stream_rx_frame + 1, sizeof(stream_rx_frame) - 1))) {
+        return false;
+    }
+
+    if (unlikely(stream_rx_frame.crc != stream_frame_crc(&stream_rx_frame))) {
+        return false;
+    }
+
+    split_shared_memory_lock();
+    stream_merge_snapshot(stream_rx_frame.shmem, false);
+
+    if (stream_rx_frame.trigger_id < NUM_TOTAL_TRANSACTIONS) {
+        split_transaction_desc_t* trans = &split_transaction_table[stream_rx_frame.trigger_id];
+        if (trans->slave_callback) {
+            trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+        }
+    }
+
+    stream_tx_frame.sync       = SERIAL_STREAM_SYNC_BYTE;
+    stream_tx_frame.trigger_id = SERIAL_STREAM_NO_TRIGGER;
+    memcpy(stream_tx_frame.shmem, split_shmem, sizeof(split_shared_memory_t));
+    split_shared_memory_unlock();
+
+    stream_tx_frame.crc = stream_frame_crc(&stream_tx_frame);
+
+    return serial_transport_send((uint8_t*)&stream_tx_frame, sizeof(stream_tx_frame));
+}
+
+/**
+ * @brief This thread runs on the slave and answers the frames streamed by the
+ * master.
+ */
+static THD_WORKING_AREA(waSlaveThread, 1024);
+static THD_FUNCTION(SlaveThread, arg) {
+    (void)arg;
+    chRegSetThreadName("split_stream_tx_rx");
+
+    while (true) {
+        if (unlikely(!stream_respond())) {
+            /* Clear the receive queue, to start with a clean slate.
+             * Parts of failed frames or spurious bytes could still be in it. */
+            serial_transport_driver_clear();
+        }
+    }
+}
+
+/**
+ * @brief Slave specific initializations.
+ */
+void soft_serial_target_init(void) {
+    serial_transport_driver_slave_init();
+
+    /* Start transport thread. */
+    chThdCreateStatic(waSlaveThread, sizeof(waSlaveThread), HIGHPRIO, SlaveThread, NULL);
+}
+
+/**
+ * @brief Master specific initializations.
+ */
+void soft_serial_initiator_init(void) {
+    serial_transport_driver_master_init();
+
+    /* Start transport thread. */
+    chThdCreateStatic(waMasterThread, sizeof(waMasterThread), HIGHPRIO, MasterThread, NULL);
+}
+
+/**
+ * @brief Start transaction from the master half to the slave half. With the
+ * streaming transport the buffers of this transaction are continuously
+ * exchanged in the background, so only the link health has to be checked and
+ * a possible slave callback has to be scheduled - the actual data movement
+ * already happened or will happen with the next streamed frame.
+ *
+ * @param index Transaction Table index of the transaction to start.
+ * @return bool Indicates success of transaction.
+ */
+bool soft_serial_transaction(int index) {
+    uint8_t transaction_id = (uint8_t)index;
+
+    /* Sanity check that we are actually starting a valid transaction. */
+    if (unlikely(transaction_id >= NUM_TOTAL_TRANSACTIONS)) {
+        serial_dprintf("SPLIT: illegal transaction id\n");
+        return false;
+    }
+
+    if (unlikely(!stream_link_up)) {
+        serial_dprintf("SPLIT: stream link down\n");
+        return false;
+    }
+
+    split_transaction_desc_t* transaction = &split_transaction_table[transaction_id];
+
+    if (!transaction->slave_callback) {
+        return true;
+    }
+
+    uint16_t ticket;
+
+    split_shared_memory_lock();
+    if (unlikely(trigger_count == NUM_TOTAL_TRANSACTIONS)) {
+        /* The trigger ring only overflows if the link is backed up - report
+         * failure so that the initiator retries later. */
+        split_shared_memory_unlock();
+        serial_dprintf("SPLIT: trigger ring full\n");
+        return false;
+    }
+    trigger_ring[(trigger_head + trigger_count) % NUM_TOTAL_TRANSACTIONS] = transaction_id;
+    trigger_count++;
+    ticket = ++trigger_enqueued_total;
+    split_shared_memory_unlock();
+
+    /* Transactions that read data back rely on the slave callback having run
+     * before the response buffer is inspected, so wait until the trigger made
+     * its round trip. Fire-and-forget triggers return immediately. */
+    if (transaction->target2initiator_buffer_size) {
+        uint32_t deadline = timer_read32() + SERIAL_STREAM_TRIGGER_TIMEOUT;
+        while ((int16_t)(trigger_completed_total - ticket) < 0) {
+            if (unlikely(timer_expired32(timer_read32(), deadline))) {
+                serial_dprintf("SPLIT: trigger timed out\n");
+                return false;
+            }
+            wait_ms(1);
+        }
+    }
+
+    return true;
+}
+
+#else /* SERIAL_TRANSPORT_STREAMING */
+
 static inline bool initiate_transaction(uint8_t transaction_id);
 static inline bool react_to_transaction(void);
 
@@ -158,3 +432,5 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
 
     return true;
 }
+
+#endif /* SERIAL_TRANSPORT_STREAMING */
@@ -20,17 +20,72 @@
 
 static pin_t currentSlavePin = NO_PIN;
 
+// At most one background chain may be in flight; a single transfer is a chain of one descriptor. The SPI
+// ISR advances through the descriptors and signals completion of the last one.
+static binary_semaphore_t spi_async_done_sem;
+static volatile bool      spi_async_pending = false;
+
+static const spi_sg_descriptor_t *volatile spi_async_chain = NULL;
+static volatile uint8_t                    spi_async_chain_count;
+static volatile uint8_t                    spi_async_chain_index;
+static volatile bool                       spi_async_chain_active = false;
+static spi_sg_descriptor_t                 spi_async_single;
+
+// Preemption: a short transaction for another slave may interject while a chain is paused between
+// descriptors; the owner's session is parked here until spi_resume().
+static binary_semaphore_t spi_async_pause_sem;
+static volatile bool      spi_pause_request = false;
+static volatile bool      spi_paused        = false;
+static pin_t              preemptedSlavePin = NO_PIN;
+
 #if defined(K20x) || defined(KL2x) || defined(RP2040)
 static SPIConfig spiConfig = {NULL, 0, 0, 0};
 #else
 static SPIConfig spiConfig = {false, NULL, 0, 0, 0, 0};
 #endif
+static SPIConfig preemptedConfig;
+
+static void spi_master_async_end_cb(SPIDriver *spip) {
+    (void)spip;
+    // The end callback fires for blocking transfers as well, including an interjecting client's while the
+    // chain is paused -- only act on completions belonging to a running background chain.
+    if (!spi_async_pending || spi_paused) {
+        return;
+    }
+    chSysLockFromISR();
+    if (spi_async_chain_active && spi_async_chain_index + 1 < spi_async_chain_count) {
+        spi_async_chain_index++;
+        if (spi_pause_request) {
+            // Stop at the descriptor boundary; spi_resume() restarts from this index.
+            spi_paused = true;
+            chBSemSignalI(&spi_async_pause_sem);
+        } else {
+            const spi_sg_descriptor_t *desc = &spi_async_chain[spi_async_chain_index];
+            if (desc->dc_pin != NO_PIN) {
+                writePin(desc->dc_pin, desc->dc_level);
+            }
+            spiStartSendI(&SPI_DRIVER, desc->length, desc->data);
+        }
+    } else {
+        spi_async_chain_active = false;
+        chBSemSignalI(&spi_async_done_sem);
+        if (spi_pause_request) {
+            // The chain finished before a boundary was reached; release the waiting preemptor empty-handed.
+            chBSemSignalI(&spi_async_pause_sem);
+        }
+    }
+    chSysUnlockFromISR();
+}
 
 __attribute__((weak)) void spi_init(void) {
     static bool is_initialised = false;
     if (!is_initialised) {
         is_initialised = true;
 
+        chBSemObjectInit(&spi_async_done_sem, true);
+        chBSemObjectInit(&spi_async_pause_sem, true);
+        spiConfig.end_cb = spi_master_async_end_cb;
+
         // Try releasing special pins for a short time
         setPinInput(SPI_SCK_PIN);
         setPinInput(SPI_MOSI_PIN);
@@ -277,12 +332,104 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    // The single-descriptor slot may still be referenced by a previous chain -- drain it before reuse.
+    spi_transmit_async_wait();
+    spi_async_single.data   = data;
+    spi_async_single.length = length;
+    spi_async_single.dc_pin = NO_PIN;
+    return spi_transmit_async_sg(&spi_async_single, 1);
+}
+
+spi_status_t spi_transmit_async_sg(const spi_sg_descriptor_t *descriptors, uint8_t count) {
+    if (count == 0) {
+        return SPI_STATUS_SUCCESS;
+    }
+    // Only one background chain may be in flight -- starting the next waits for the previous to drain.
+    spi_transmit_async_wait();
+    chSysLock();
+    spi_async_chain        = descriptors;
+    spi_async_chain_count  = count;
+    spi_async_chain_index  = 0;
+    spi_async_chain_active = true;
+    spi_async_pending      = true;
+    chSysUnlock();
+    if (descriptors[0].dc_pin != NO_PIN) {
+        writePin(descriptors[0].dc_pin, descriptors[0].dc_level);
+    }
+    spiStartSend(&SPI_DRIVER, descriptors[0].length, descriptors[0].data);
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_transmit_async_wait(void) {
+    if (spi_async_pending) {
+        chBSemWait(&spi_async_done_sem);
+        spi_async_pending = false;
+    }
+    return SPI_STATUS_SUCCESS;
+}
+
+bool spi_preempt(void) {
+    chSysLock();
+    if (!spi_async_chain_active || spi_paused) {
+        chSysUnlock();
+        return false;
+    }
+    spi_pause_request = true;
+    chSysUnlock();
+
+    // The ISR signals either at the next descriptor boundary or on chain completion.
+    chBSemWait(&spi_async_pause_sem);
+    spi_pause_request = false;
+    if (!spi_paused) {
+        // The chain completed instead of pausing; the owner still holds its session.
+        return false;
+    }
+
+    // The peripheral is idle between descriptors -- park the owner's session and free the bus.
+    preemptedSlavePin = currentSlavePin;
+    preemptedConfig   = spiConfig;
+    spiUnselect(&SPI_DRIVER);
+    spiStop(&SPI_DRIVER);
+    currentSlavePin = NO_PIN;
+    return true;
+}
+
+void spi_resume(void) {
+    if (!spi_paused) {
+        return;
+    }
+
+    // Close the interjecting session, if its client has not already done so.
+    if (currentSlavePin != NO_PIN) {
+        spiUnselect(&SPI_DRIVER);
+        spiStop(&SPI_DRIVER);
+    }
+
+    // Restore the owner's session and restart the chain at the descriptor it was paused on.
+    currentSlavePin   = preemptedSlavePin;
+    spiConfig         = preemptedConfig;
+    preemptedSlavePin = NO_PIN;
+    spiStart(&SPI_DRIVER, &spiConfig);
+    spiSelect(&SPI_DRIVER);
+
+    const spi_sg_descriptor_t *desc = &spi_async_chain[spi_async_chain_index];
+
+    spi_paused = false;
+    if (desc->dc_pin != NO_PIN) {
+        // The interjecting client may have repurposed D/C levels -- reassert the descriptor's before restarting.
+        writePin(desc->dc_pin, desc->dc_level);
+    }
+    spiStartSend(&SPI_DRIVER, desc->length, desc->data);
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
 void spi_stop(void) {
+    spi_transmit_async_wait();
     if (currentSlavePin != NO_PIN) {
         spiUnselect(&SPI_DRIVER);
         spiStop(&SPI_DRIVER);
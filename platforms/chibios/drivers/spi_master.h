@@ -85,6 +85,38 @@ spi_status_t spi_read(void);
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
 
+// One part of a background scatter-gather chain. When `dc_pin` is not NO_PIN, the pin is driven to
+// `dc_level` immediately before the descriptor's bytes start -- from the SPI interrupt for mid-chain
+// descriptors -- so display command/data framing rides the chain instead of blocking the thread.
+typedef struct spi_sg_descriptor_t {
+    const uint8_t *data;
+    uint16_t       length;
+    pin_t          dc_pin;
+    bool           dc_level;
+} spi_sg_descriptor_t;
+
+// Starts transmitting in the background and returns immediately; the buffer must stay untouched until
+// spi_transmit_async_wait() has been called (starting another async transfer waits automatically).
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length);
+
+// Starts transmitting a chain of descriptors in the background; the next descriptor is started from the
+// SPI interrupt, so the whole chain runs without thread involvement. The descriptor array and all buffers
+// it points at must stay untouched until spi_transmit_async_wait() has been called.
+spi_status_t spi_transmit_async_sg(const spi_sg_descriptor_t *descriptors, uint8_t count);
+
+// Blocks until the in-flight background transfer (if any) has completed.
+spi_status_t spi_transmit_async_wait(void);
+
+// Pauses an in-flight background chain at the next descriptor boundary and releases the bus so a short
+// transaction for another slave (e.g. a sensor read) can run via the regular spi_start()/blocking API.
+// Returns false when there is nothing to preempt -- including when the bus is held by a blocking client.
+// At most one client may hold a preemption at a time.
+bool spi_preempt(void);
+
+// Ends a preemption started with spi_preempt(): closes the interjecting session (if still open), restores
+// the preempted session and restarts the paused chain where it stopped. Call this instead of spi_stop().
+void spi_resume(void);
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length);
 
 void spi_stop(void);
@@ -291,7 +291,21 @@ typedef uint16_t ws2812_buffer_t;
 typedef uint8_t ws2812_buffer_t;
 #endif
 
+#ifdef WS2812_PWM_DOUBLE_BUFFER
+static ws2812_buffer_t  ws2812_frame_buffers[2][WS2812_BIT_N + 1]; /**< Front/back buffers for a frame */
+static volatile uint8_t ws2812_render_target    = 0;               /**< Buffer side the next frame is rendered into */
+static volatile bool    ws2812_rendering        = false;           /**< ws2812_setleds() is mid-render */
+static volatile bool    ws2812_transfer_active  = false;           /**< DMA is streaming a buffer */
+static volatile bool    ws2812_transfer_pending = false;           /**< A rendered frame waits for the stream to free */
+#    define ws2812_frame_buffer (ws2812_frame_buffers[ws2812_render_target])
+#    if defined(WB32F3G71xx) || defined(WB32FQ95xx)
+#        define WS2812_DMA_SET_BUFFER(buf) dmaStreamSetSource(WS2812_DMA_STREAM, (buf))
+#    else
+#        define WS2812_DMA_SET_BUFFER(buf) dmaStreamSetMemory0(WS2812_DMA_STREAM, (buf))
+#    endif
+#else
 static ws2812_buffer_t ws2812_frame_buffer[WS2812_BIT_N + 1]; /**< Buffer for a frame */
+#endif
 
 /* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
 /*
@@ -300,6 +314,36 @@ static ws2812_buffer_t ws2812_frame_buffer[WS2812_BIT_N + 1]; /**< Buffer for a
  * write/read to/from the other buffer).
  */
 
+#ifdef WS2812_PWM_DOUBLE_BUFFER
+/* Stream the buffer that was just rendered and flip rendering to the other
+ * side. Callers hold the system lock or run in ISR context. */
+static void ws2812_start_transfer(void) {
+    WS2812_DMA_SET_BUFFER(ws2812_frame_buffers[ws2812_render_target]);
+    dmaStreamSetTransactionSize(WS2812_DMA_STREAM, WS2812_BIT_N);
+    ws2812_render_target ^= 1;
+    ws2812_transfer_active = true;
+    dmaStreamEnable(WS2812_DMA_STREAM);
+}
+
+/* End-of-transfer hook: launch a frame that finished rendering while the
+ * previous one was on the wire. If a render is still in progress the stream
+ * goes idle instead and ws2812_setleds() restarts it - this is what keeps a
+ * half-rendered buffer off the wire. The reset/latch period is part of the
+ * buffer, so back-to-back transfers respect WS2812_TRST_US. */
+static void ws2812_dma_complete_cb(void* param, uint32_t flags) {
+    (void)param;
+    (void)flags;
+    osalSysLockFromISR();
+    if (ws2812_transfer_pending && !ws2812_rendering) {
+        ws2812_transfer_pending = false;
+        ws2812_start_transfer();
+    } else {
+        ws2812_transfer_active = false;
+    }
+    osalSysUnlockFromISR();
+}
+#endif
+
 void ws2812_init(void) {
     // Initialize led frame buffer
     uint32_t i;
@@ -308,6 +352,11 @@ void ws2812_init(void) {
     for (i = 0; i < WS2812_RESET_BIT_N; i++)
         ws2812_frame_buffer[i + WS2812_COLOR_BIT_N] = 0; // All reset bits are zero
 
+#ifdef WS2812_PWM_DOUBLE_BUFFER
+    for (i = 0; i < WS2812_BIT_N; i++)
+        ws2812_frame_buffers[1][i] = ws2812_frame_buffers[0][i];
+#endif
+
     palSetLineMode(RGB_DI_PIN, WS2812_OUTPUT_MODE);
 
     // PWM Configuration
@@ -329,17 +378,33 @@ void ws2812_init(void) {
     // Configure DMA
     // dmaInit(); // Joe added this
 #if defined(WB32F3G71xx) || defined(WB32FQ95xx)
+#    ifdef WS2812_PWM_DOUBLE_BUFFER
+    // One-shot transfers re-armed per frame from the completion interrupt
+    dmaStreamAlloc(WS2812_DMA_STREAM - WB32_DMA_STREAM(0), 10, ws2812_dma_complete_cb, NULL);
+    dmaStreamSetDestination(WS2812_DMA_STREAM, &(WS2812_PWM_DRIVER.tim->CCR[WS2812_PWM_CHANNEL - 1])); // Ziel ist der An-Zeit im Cap-Comp-Register
+    dmaStreamSetMode(WS2812_DMA_STREAM, WB32_DMA_CHCFG_HWHIF(WS2812_DMA_CHANNEL) | WB32_DMA_CHCFG_DIR_M2P | WB32_DMA_CHCFG_PSIZE_WORD | WB32_DMA_CHCFG_MSIZE_WORD | WB32_DMA_CHCFG_MINC | WB32_DMA_CHCFG_TCIE | WB32_DMA_CHCFG_PL(3));
+#    else
     dmaStreamAlloc(WS2812_DMA_STREAM - WB32_DMA_STREAM(0), 10, NULL, NULL);
     dmaStreamSetSource(WS2812_DMA_STREAM, ws2812_frame_buffer);
     dmaStreamSetDestination(WS2812_DMA_STREAM, &(WS2812_PWM_DRIVER.tim->CCR[WS2812_PWM_CHANNEL - 1])); // Ziel ist der An-Zeit im Cap-Comp-Register
     dmaStreamSetMode(WS2812_DMA_STREAM, WB32_DMA_CHCFG_HWHIF(WS2812_DMA_CHANNEL) | WB32_DMA_CHCFG_DIR_M2P | WB32_DMA_CHCFG_PSIZE_WORD | WB32_DMA_CHCFG_MSIZE_WORD | WB32_DMA_CHCFG_MINC | WB32_DMA_CHCFG_CIRC | WB32_DMA_CHCFG_TCIE | WB32_DMA_CHCFG_PL(3));
+#    endif
 #else
+#    ifdef WS2812_PWM_DOUBLE_BUFFER
+    // One-shot transfers re-armed per frame from the completion interrupt
+    dmaStreamAlloc(WS2812_DMA_STREAM - STM32_DMA_STREAM(0), 10, ws2812_dma_complete_cb, NULL);
+    dmaStreamSetPeripheral(WS2812_DMA_STREAM, &(WS2812_PWM_DRIVER.tim->CCR[WS2812_PWM_CHANNEL - 1])); // Ziel ist der An-Zeit im Cap-Comp-Register
+    dmaStreamSetMode(WS2812_DMA_STREAM, STM32_DMA_CR_CHSEL(WS2812_DMA_CHANNEL) | STM32_DMA_CR_DIR_M2P | WS2812_DMA_PERIPHERAL_WIDTH | WS2812_DMA_MEMORY_WIDTH | STM32_DMA_CR_MINC | STM32_DMA_CR_TCIE | STM32_DMA_CR_PL(3));
+#    else
     dmaStreamAlloc(WS2812_DMA_STREAM - STM32_DMA_STREAM(0), 10, NULL, NULL);
     dmaStreamSetPeripheral(WS2812_DMA_STREAM, &(WS2812_PWM_DRIVER.tim->CCR[WS2812_PWM_CHANNEL - 1])); // Ziel ist der An-Zeit im Cap-Comp-Register
     dmaStreamSetMemory0(WS2812_DMA_STREAM, ws2812_frame_buffer);
     dmaStreamSetMode(WS2812_DMA_STREAM, STM32_DMA_CR_CHSEL(WS2812_DMA_CHANNEL) | STM32_DMA_CR_DIR_M2P | WS2812_DMA_PERIPHERAL_WIDTH | WS2812_DMA_MEMORY_WIDTH | STM32_DMA_CR_MINC | STM32_DMA_CR_CIRC | STM32_DMA_CR_PL(3));
+#    endif
 #endif
+#ifndef WS2812_PWM_DOUBLE_BUFFER
     dmaStreamSetTransactionSize(WS2812_DMA_STREAM, WS2812_BIT_N);
+#endif
     // M2P: Memory 2 Periph; PL: Priority Level
 
 #if (STM32_DMA_SUPPORTS_DMAMUX == TRUE)
@@ -347,8 +412,10 @@ void ws2812_init(void) {
     dmaSetRequestSource(WS2812_DMA_STREAM, WS2812_DMAMUX_ID);
 #endif
 
+#ifndef WS2812_PWM_DOUBLE_BUFFER
     // Start DMA
     dmaStreamEnable(WS2812_DMA_STREAM);
+#endif
 
     // Configure PWM
     // NOTE: It's required that preload be enabled on the timer channel CCR register. This is currently enabled in the
@@ -386,6 +453,10 @@ void ws2812_setleds(LED_TYPE* ledarray, uint16_t leds) {
         s_init = true;
     }
 
+#ifdef WS2812_PWM_DOUBLE_BUFFER
+    ws2812_rendering = true;
+#endif
+
     for (uint16_t i = 0; i < leds; i++) {
 #ifdef RGBW
         ws2812_write_led_rgbw(i, ledarray[i].r, ledarray[i].g, ledarray[i].b, ledarray[i].w);
@@ -393,4 +464,18 @@ void ws2812_setleds(LED_TYPE* ledarray, uint16_t leds) {
         ws2812_write_led(i, ledarray[i].r, ledarray[i].g, ledarray[i].b);
 #endif
     }
+
+#ifdef WS2812_PWM_DOUBLE_BUFFER
+    /* Hand the rendered frame to the DMA stream; if the previous frame is
+     * still on the wire, leave it for the completion interrupt to launch. */
+    osalSysLock();
+    ws2812_rendering = false;
+    if (ws2812_transfer_active) {
+        ws2812_transfer_pending = true;
+    } else {
+        ws2812_transfer_pending = false;
+        ws2812_start_transfer();
+    }
+    osalSysUnlock();
+#endif
 }
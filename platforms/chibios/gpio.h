@@ -43,3 +43,15 @@ typedef ioline_t pin_t;
 #define readPin(pin) palReadLine(pin)
 
 #define togglePin(pin) palToggleLine(pin)
+
+/* Operation of GPIO by port. */
+
+typedef ioportmask_t port_data_t;
+
+#define readPinPort(pin) palReadPort(PAL_PORT(pin))
+#define pinPortMask(pin) ((port_data_t)1 << PAL_PAD(pin))
+#define samePort(pinA, pinB) (PAL_PORT(pinA) == PAL_PORT(pinB))
+
+// Single set/clear store on parts with dedicated registers (e.g. BSRR).
+#define writePortBitsHigh(pin, mask) palSetPort(PAL_PORT(pin), (mask))
+#define writePortBitsLow(pin, mask) palClearPort(PAL_PORT(pin), (mask))
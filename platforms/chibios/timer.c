@@ -98,6 +98,25 @@ uint32_t timer_read32(void) {
     return (uint32_t)TIME_I2MS(ticks) + ms_offset_copy;
 }
 
+uint32_t timer_read_us(void) {
+    chSysLock();
+    uint32_t ticks = get_system_time_ticks() - ticks_offset;
+    if (ticks < last_ticks) {
+        // Same wrap handling as timer_read32() above.
+        ticks -= OVERFLOW_ADJUST_TICKS;
+        ticks_offset += OVERFLOW_ADJUST_TICKS;
+        ms_offset += OVERFLOW_ADJUST_MS;
+    }
+    last_ticks              = ticks;
+    uint32_t ms_offset_copy = ms_offset; // read while still holding the lock to ensure a consistent value
+    chSysUnlock();
+
+    // Convert ticks to microseconds in 64-bit to avoid intermediate overflow; the result wraps
+    // modulo 2**32 together with the millisecond offset, so TIMER_DIFF_32 on two readings stays
+    // correct across the wrap. Resolution is one system tick (10us at CH_CFG_ST_FREQUENCY=100000).
+    return (uint32_t)(((uint64_t)ticks * 1000000) / CH_CFG_ST_FREQUENCY) + ms_offset_copy * 1000;
+}
+
 uint16_t timer_elapsed(uint16_t last) {
     return TIMER_DIFF_16(timer_read(), last);
 }
@@ -7,6 +7,10 @@ ifeq ($(strip $(WS2812_DRIVER)), vendor)
     OPT_DEFS += -DRP_DMA_REQUIRED=TRUE
 endif
 
+ifeq ($(strip $(MATRIX_DRIVER)), vendor)
+    OPT_DEFS += -DRP_DMA_REQUIRED=TRUE
+endif
+
 #
 # Raspberry Pi Pico SDK Support
 ##############################################################################
@@ -62,6 +66,11 @@ PLATFORM_RP2040_PATH := $(PLATFORM_PATH)/$(PLATFORM_KEY)/vendors/$(MCU_FAMILY)
 PLATFORM_SRC +=	$(PLATFORM_RP2040_PATH)/stage2_bootloaders.c \
 				$(PLATFORM_RP2040_PATH)/pico_sdk_shims.c
 
+ifeq ($(strip $(RP2040_CORE1_ENABLE)), yes)
+    OPT_DEFS += -DRP2040_CORE1_ENABLE
+    PLATFORM_SRC += $(PLATFORM_RP2040_PATH)/rp2040_core1.c
+endif
+
 EXTRAINCDIRS += $(PLATFORM_RP2040_PATH)
 
 #
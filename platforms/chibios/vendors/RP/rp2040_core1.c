@@ -0,0 +1,93 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rp2040_core1.h"
+
+#include "hardware/structs/sio.h"
+#include "hardware/structs/scb.h"
+#include "hardware/sync.h"
+
+/* Launch and mailbox support for the second core. The launch sequence is the
+ * bootrom wakeup protocol from the RP2040 datasheet section 2.8.2: core 1
+ * sits in the bootrom waiting for {0, 0, 1, VTOR, SP, entry} on the SIO
+ * FIFO, echoing each word back; a mismatch restarts the sequence. */
+
+static void (*core1_entry_fn)(void);
+static uint32_t core1_stack[RP2040_CORE1_STACK_SIZE / sizeof(uint32_t)] __attribute__((aligned(8)));
+
+void rp2040_fifo_push_blocking(uint32_t data) {
+    /* Make prior writes to shared buffers visible before the doorbell. */
+    __dmb();
+    while (!(sio_hw->fifo_st & SIO_FIFO_ST_RDY_BITS)) {
+    }
+    sio_hw->fifo_wr = data;
+    __sev();
+}
+
+uint32_t rp2040_fifo_pop_blocking(void) {
+    while (!(sio_hw->fifo_st & SIO_FIFO_ST_VLD_BITS)) {
+        __wfe();
+    }
+    uint32_t data = sio_hw->fifo_rd;
+    /* Order the doorbell read before any reads of the shared buffers. */
+    __dmb();
+    return data;
+}
+
+bool rp2040_fifo_try_push(uint32_t data) {
+    if (!(sio_hw->fifo_st & SIO_FIFO_ST_RDY_BITS)) {
+        return false;
+    }
+    __dmb();
+    sio_hw->fifo_wr = data;
+    __sev();
+    return true;
+}
+
+bool rp2040_fifo_try_pop(uint32_t *data) {
+    if (!(sio_hw->fifo_st & SIO_FIFO_ST_VLD_BITS)) {
+        return false;
+    }
+    *data = sio_hw->fifo_rd;
+    __dmb();
+    return true;
+}
+
+static void core1_fifo_drain(void) {
+    while (sio_hw->fifo_st & SIO_FIFO_ST_VLD_BITS) {
+        (void)sio_hw->fifo_rd;
+    }
+}
+
+/* First code core 1 executes outside the bootrom; never returns. */
+static void core1_trampoline(void) {
+    core1_entry_fn();
+    /* The entry function is not supposed to return; park the core. */
+    while (true) {
+        __wfi();
+    }
+}
+
+void rp2040_core1_launch(void (*entry)(void)) {
+    core1_entry_fn = entry;
+
+    /* Core 1 shares core 0's vector table but never enables interrupts;
+     * only the fault handlers matter. */
+    const uint32_t cmds[] = {0, 0, 1, scb_hw->vtor, (uint32_t)&core1_stack[RP2040_CORE1_STACK_SIZE / sizeof(uint32_t)], (uint32_t)core1_trampoline};
+
+    unsigned seq = 0;
+    while (seq < sizeof(cmds) / sizeof(cmds[0])) {
+        uint32_t cmd = cmds[seq];
+        if (cmd == 0) {
+            /* Zero starts a new handshake; flush stale echoes first and
+             * wake the bootrom's WFE. */
+            core1_fifo_drain();
+            __sev();
+        }
+        rp2040_fifo_push_blocking(cmd);
+        seq = (rp2040_fifo_pop_blocking() == cmd) ? seq + 1 : 0;
+    }
+
+    /* Leave the FIFO empty for mailbox use. */
+    core1_fifo_drain();
+}
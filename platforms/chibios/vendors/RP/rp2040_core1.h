@@ -0,0 +1,60 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * \file
+ *
+ * \brief Execution environment for the second RP2040 core.
+ *
+ * With `RP2040_CORE1_ENABLE = yes` the second core can be brought up from
+ * `keyboard_post_init_*()` to run best-effort compute work -- effect frame
+ * rendering, display composition and the like -- while core 0 keeps the
+ * input pipeline. Core 1 runs bare-metal: ChibiOS is not SMP-aware on this
+ * port, so code on core 1 must not call any ChibiOS or QMK service that
+ * takes OS locks (I2C/SPI drivers, timers, printing, ...). Pure computation
+ * on RAM buffers plus direct pico-sdk hardware access is safe.
+ *
+ * Data is handed between the cores through the SIO inter-processor FIFO,
+ * used as a doorbell/mailbox: publish the shared buffer first, then push a
+ * word. The push/pop helpers issue the data memory barriers that make the
+ * buffer contents visible to the other core before the doorbell word is
+ * observed, so a consumer that has popped the word may read the buffer
+ * without further ceremony.
+ */
+
+/* Core 1 stack in bytes; lives in .bss next to the launch machinery. */
+#ifndef RP2040_CORE1_STACK_SIZE
+#    define RP2040_CORE1_STACK_SIZE 2048
+#endif
+
+/**
+ * \brief Start the second core and run \p entry on it.
+ *
+ * The entry function is expected to loop forever; if it returns, core 1 is
+ * parked in a sleep loop. May only be called once, from core 0, after the
+ * system is up (e.g. `keyboard_post_init_kb()`).
+ */
+void rp2040_core1_launch(void (*entry)(void));
+
+/**
+ * \brief Push a mailbox word to the other core, spinning while the FIFO is
+ * full. Orders all previous memory writes before the word becomes visible.
+ */
+void rp2040_fifo_push_blocking(uint32_t data);
+
+/**
+ * \brief Pop a mailbox word from the other core, sleeping (WFE) while the
+ * FIFO is empty.
+ */
+uint32_t rp2040_fifo_pop_blocking(void);
+
+/**
+ * \brief Non-blocking variants; return false if the FIFO is full/empty.
+ */
+bool rp2040_fifo_try_push(uint32_t data);
+bool rp2040_fifo_try_pop(uint32_t *data);
@@ -4,6 +4,13 @@
 #include "suspend.h"
 #include "matrix.h"
 
+#ifdef SUSPEND_WAKE_INTERRUPT_ENABLE
+#    ifndef MATRIX_IDLE_ENABLE
+#        error "SUSPEND_WAKE_INTERRUPT_ENABLE reuses the matrix idle wake hooks; enable MATRIX_IDLE_ENABLE = yes"
+#    endif
+#    include "matrix_idle.h"
+#endif
+
 // TODO: Move to more correct location
 __attribute__((weak)) void matrix_power_up(void) {}
 __attribute__((weak)) void matrix_power_down(void) {}
@@ -41,6 +48,19 @@ __attribute__((weak)) void suspend_wakeup_init_kb(void) {
  * FIXME: needs doc
  */
 bool suspend_wakeup_condition(void) {
+#ifdef SUSPEND_WAKE_INTERRUPT_ENABLE
+    if (matrix_is_idle()) {
+        return matrix_idle_wake_requested();
+    }
+    // First pass after the host suspended the bus: park the matrix with wake
+    // interrupts armed (all rows driven, any column edge wakes), so the
+    // suspend loop polls a flag instead of strobing the whole matrix and the
+    // board can meet the USB suspend current budget. If the board has no
+    // wake interrupts this falls through to the full scan below.
+    if (matrix_idle_park()) {
+        return false;
+    }
+#endif
     matrix_power_up();
     matrix_scan();
     matrix_power_down();
@@ -10,6 +10,7 @@ void suspend_wakeup_init(void);
 void suspend_wakeup_init_user(void);
 void suspend_wakeup_init_kb(void);
 void suspend_wakeup_init_quantum(void);
+void suspend_wakeup_task(void);
 void suspend_power_down_user(void);
 void suspend_power_down_kb(void);
 void suspend_power_down_quantum(void);
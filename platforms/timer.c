@@ -6,3 +6,9 @@
 // Generate out-of-line copies for inline functions defined in timer.h.
 extern inline fast_timer_t timer_read_fast(void);
 extern inline fast_timer_t timer_elapsed_fast(fast_timer_t last);
+
+// Fallback for platforms without a sub-millisecond time source; resolution is
+// one millisecond. Overridden by the AVR and ChibiOS implementations.
+__attribute__((weak)) uint32_t timer_read_us(void) {
+    return timer_read32() * 1000;
+}
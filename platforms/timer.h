@@ -43,6 +43,12 @@ uint32_t timer_read32(void);
 uint16_t timer_elapsed(uint16_t last);
 uint32_t timer_elapsed32(uint32_t last);
 
+// Microsecond timestamp, wrapping at 2**32 (~71 minutes); compare with
+// TIMER_DIFF_32. Sub-millisecond resolution where the platform timer allows it
+// (system tick granularity on ChibiOS, Timer0 prescaler granularity on AVR);
+// platforms without a finer time source fall back to millisecond steps.
+uint32_t timer_read_us(void);
+
 // Utility functions to check if a future time has expired & autmatically handle time wrapping if checked / reset frequently (half of max value)
 #define timer_expired(current, future) ((uint16_t)(current - future) < UINT16_MAX / 2)
 #define timer_expired32(current, future) ((uint32_t)(current - future) < UINT32_MAX / 2)
@@ -28,6 +28,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "action_tapping.h"
 #include "action_util.h"
 #include "action.h"
+#ifdef LATENCY_HISTOGRAM_ENABLE
+#    include "latency_histogram.h"
+#endif
+#ifdef EVENT_TRACE_ENABLE
+#    include "event_trace.h"
+#endif
 #include "wait.h"
 #include "keycode_config.h"
 
@@ -71,6 +77,12 @@ __attribute__((weak)) bool pre_process_record_quantum(keyrecord_t *record) {
  */
 void action_exec(keyevent_t event) {
     if (IS_EVENT(event)) {
+#ifdef LATENCY_HISTOGRAM_ENABLE
+        latency_histogram_note_event(event.time);
+#endif
+#ifdef EVENT_TRACE_ENABLE
+        event_trace_note_event(event);
+#endif
         ac_dprintf("\n---- action_exec: start -----\n");
         ac_dprintf("EVENT: ");
         debug_event(event);
@@ -119,7 +131,7 @@ void action_exec(keyevent_t event) {
     }
 #    endif
     if (IS_NOEVENT(record.event) || pre_process_record_quantum(&record)) {
-        action_tapping_process(record);
+        action_tapping_process(&record);
     }
 #else
     if (IS_NOEVENT(record.event) || pre_process_record_quantum(&record)) {
@@ -127,7 +139,7 @@ void action_exec(keyevent_t event) {
     }
     if (IS_EVENT(record.event)) {
         ac_dprintf("processed: ");
-        debug_record(record);
+        debug_record(&record);
         dprintln();
     }
 #endif
@@ -268,7 +280,7 @@ void process_record(keyrecord_t *record) {
 }
 
 void process_record_handler(keyrecord_t *record) {
-#ifdef COMBO_ENABLE
+#if defined(COMBO_ENABLE) || defined(REPEAT_KEY_ENABLE)
     action_t action;
     if (record->keycode) {
         action = action_for_keycode(record->keycode);
@@ -1099,7 +1111,7 @@ bool is_tap_record(keyrecord_t *record) {
         return false;
     }
 
-#ifdef COMBO_ENABLE
+#if defined(COMBO_ENABLE) || defined(REPEAT_KEY_ENABLE)
     action_t action;
     if (record->keycode) {
         action = action_for_keycode(record->keycode);
@@ -1151,10 +1163,10 @@ void debug_event(keyevent_t event) {
  *
  * FIXME: Needs documentation.
  */
-void debug_record(keyrecord_t record) {
-    debug_event(record.event);
+void debug_record(const keyrecord_t *record) {
+    debug_event(record->event);
 #ifndef NO_ACTION_TAPPING
-    ac_dprintf(":%u%c", record.tap.count, (record.tap.interrupted ? '-' : ' '));
+    ac_dprintf(":%u%c", record->tap.count, (record->tap.interrupted ? '-' : ' '));
 #endif
 }
 
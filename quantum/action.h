@@ -50,7 +50,7 @@ typedef struct {
 #ifndef NO_ACTION_TAPPING
     tap_t tap;
 #endif
-#ifdef COMBO_ENABLE
+#if defined(COMBO_ENABLE) || defined(REPEAT_KEY_ENABLE)
     uint16_t keycode;
 #endif
 } keyrecord_t;
@@ -133,7 +133,7 @@ void process_record_tap_hint(keyrecord_t *record);
 #endif
 
 void debug_event(keyevent_t event);
-void debug_record(keyrecord_t record);
+void debug_record(const keyrecord_t *record);
 void debug_action(action_t action);
 
 #ifdef __cplusplus
@@ -6,6 +6,12 @@
 #include "action.h"
 #include "util.h"
 #include "action_layer.h"
+#ifdef LAYER_FALLTHROUGH_CACHE_ENABLE
+#    include "keymap_introspection.h"
+#endif
+#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_LAYER_INDICATOR_MAP)
+#    include "rgb_matrix.h"
+#endif
 
 /** \brief Default Layer State
  */
@@ -39,6 +45,12 @@ static void default_layer_state_set(layer_state_t state) {
     default_layer_state = state;
     default_layer_debug();
     ac_dprintf("\n");
+#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_LAYER_INDICATOR_MAP)
+    rgb_matrix_layer_indicators_invalidate();
+#endif
+#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_INDICATOR_RULES)
+    rgb_matrix_indicator_rules_invalidate();
+#endif
 #if defined(STRICT_LAYER_RELEASE)
     clear_keyboard_but_mods(); // To avoid stuck keys
 #elif defined(SEMI_STRICT_LAYER_RELEASE)
@@ -119,6 +131,12 @@ void layer_state_set(layer_state_t state) {
     layer_state = state;
     layer_debug();
     ac_dprintf("\n");
+#    if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_LAYER_INDICATOR_MAP)
+    rgb_matrix_layer_indicators_invalidate();
+#    endif
+#    if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_INDICATOR_RULES)
+    rgb_matrix_indicator_rules_invalidate();
+#    endif
 #    if defined(STRICT_LAYER_RELEASE)
     clear_keyboard_but_mods(); // To avoid stuck keys
 #    elif defined(SEMI_STRICT_LAYER_RELEASE)
@@ -220,10 +238,36 @@ void layer_debug(void) {
 /** \brief source layer cache
  */
 
+#    if !defined(__AVR__) && !defined(SOURCE_LAYERS_CACHE_PACKED)
+// On RAM-rich targets spend a full byte per key so that a cache access is a
+// single indexed load/store instead of a MAX_LAYER_BITS pack/unpack loop.
+// AVR keeps the packed form; define SOURCE_LAYERS_CACHE_PACKED to force it
+// elsewhere.
+uint8_t source_layers_cache[MATRIX_ROWS * MATRIX_COLS] = {0};
+#        ifdef ENCODER_MAP_ENABLE
+uint8_t encoder_source_layers_cache[NUM_ENCODERS] = {0};
+#        endif // ENCODER_MAP_ENABLE
+
+/** \brief update source layers cache impl
+ *
+ * Updates the supplied cache when changing layers
+ */
+void update_source_layers_cache_impl(uint8_t layer, uint16_t entry_number, uint8_t cache[]) {
+    cache[entry_number] = layer;
+}
+
+/** \brief read source layers cache
+ *
+ * reads the cached keys stored when the layer was changed
+ */
+uint8_t read_source_layers_cache_impl(uint16_t entry_number, uint8_t cache[]) {
+    return cache[entry_number];
+}
+#    else
 uint8_t source_layers_cache[((MATRIX_ROWS * MATRIX_COLS) + (CHAR_BIT)-1) / (CHAR_BIT)][MAX_LAYER_BITS] = {{0}};
-#    ifdef ENCODER_MAP_ENABLE
+#        ifdef ENCODER_MAP_ENABLE
 uint8_t encoder_source_layers_cache[(NUM_ENCODERS + (CHAR_BIT)-1) / (CHAR_BIT)][MAX_LAYER_BITS] = {{0}};
-#    endif // ENCODER_MAP_ENABLE
+#        endif // ENCODER_MAP_ENABLE
 
 /** \brief update source layers cache impl
  *
@@ -252,6 +296,30 @@ uint8_t read_source_layers_cache_impl(uint16_t entry_number, uint8_t cache[][MAX
 
     return layer;
 }
+#    endif // !defined(__AVR__) && !defined(SOURCE_LAYERS_CACHE_PACKED)
+
+#    ifdef SOURCE_ACTION_CACHE_ENABLE
+// Widened companion to the source layer cache: the action resolved on press
+// is stored verbatim, so a release is served by a single cache load instead
+// of re-walking action_for_key(). Encoder clockwise and counter-clockwise
+// positions resolve to different actions and get separate slots.
+static action_t source_actions_cache[MATRIX_ROWS * MATRIX_COLS];
+#        ifdef ENCODER_MAP_ENABLE
+static action_t encoder_source_actions_cache[NUM_ENCODERS * 2];
+#        endif // ENCODER_MAP_ENABLE
+
+static action_t *source_action_cache_entry(keypos_t key) {
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        return &source_actions_cache[(uint16_t)(key.row * MATRIX_COLS) + key.col];
+    }
+#        ifdef ENCODER_MAP_ENABLE
+    else if (key.row == KEYLOC_ENCODER_CW || key.row == KEYLOC_ENCODER_CCW) {
+        return &encoder_source_actions_cache[(uint16_t)key.col * 2 + (key.row == KEYLOC_ENCODER_CCW ? 1 : 0)];
+    }
+#        endif // ENCODER_MAP_ENABLE
+    return NULL;
+}
+#    endif // SOURCE_ACTION_CACHE_ENABLE
 
 /** \brief update encoder source layers cache
  *
@@ -307,7 +375,21 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
     if (pressed) {
         layer = layer_switch_get_layer(key);
         update_source_layers_cache(key, layer);
+#    ifdef SOURCE_ACTION_CACHE_ENABLE
+        action_t  action = action_for_key(layer, key);
+        action_t *cached = source_action_cache_entry(key);
+        if (cached != NULL) {
+            *cached = action;
+        }
+        return action;
+#    endif // SOURCE_ACTION_CACHE_ENABLE
     } else {
+#    ifdef SOURCE_ACTION_CACHE_ENABLE
+        const action_t *cached = source_action_cache_entry(key);
+        if (cached != NULL) {
+            return *cached;
+        }
+#    endif // SOURCE_ACTION_CACHE_ENABLE
         layer = read_source_layers_cache(key);
     }
     return action_for_key(layer, key);
@@ -322,6 +404,16 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
  */
 uint8_t layer_switch_get_layer(keypos_t key) {
 #ifndef NO_ACTION_LAYER
+#    ifdef LAYER_FALLTHROUGH_CACHE_ENABLE
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        /* single indexed load: active layers that do not fall through here */
+        layer_state_t effective = (layer_state | default_layer_state) & keymap_layer_fallthrough_mask(key.row, key.col);
+        if (effective) {
+            return get_highest_layer(effective);
+        }
+        return 0;
+    }
+#    endif
     action_t action;
     action.code = ACTION_TRANSPARENT;
 
@@ -7,6 +7,17 @@
 #include "keycode.h"
 #include "timer.h"
 
+/* Settlement points report to the event trace so a dump shows when (and why)
+ * each tap-hold decision landed. */
+#ifdef EVENT_TRACE_ENABLE
+#    include "event_trace.h"
+#    define TAP_TRACE_DECISION(decision) event_trace_note_decision(decision)
+#else
+#    define TAP_TRACE_DECISION(decision) \
+        do {                             \
+        } while (0)
+#endif
+
 #ifndef NO_ACTION_TAPPING
 
 #    if defined(IGNORE_MOD_TAP_INTERRUPT_PER_KEY)
@@ -21,13 +32,26 @@
 #    define IS_TAPPING_PRESSED() (IS_TAPPING() && tapping_key.event.pressed)
 #    define IS_TAPPING_RELEASED() (IS_TAPPING() && !tapping_key.event.pressed)
 #    define IS_TAPPING_KEY(k) (IS_TAPPING() && KEYEQ(tapping_key.event.key, (k)))
-#    ifndef COMBO_ENABLE
+#    if !defined(COMBO_ENABLE) && !defined(REPEAT_KEY_ENABLE)
 #        define IS_TAPPING_RECORD(r) (IS_TAPPING() && KEYEQ(tapping_key.event.key, (r->event.key)))
 #    else
 #        define IS_TAPPING_RECORD(r) (IS_TAPPING() && KEYEQ(tapping_key.event.key, (r->event.key)) && tapping_key.keycode == r->keycode)
 #    endif
-#    define WITHIN_TAPPING_TERM(e) (TIMER_DIFF_16(e.time, tapping_key.event.time) < GET_TAPPING_TERM(get_record_keycode(&tapping_key, false), &tapping_key))
-#    define WITHIN_QUICK_TAP_TERM(e) (TIMER_DIFF_16(e.time, tapping_key.event.time) < GET_QUICK_TAP_TERM(get_record_keycode(&tapping_key, false), &tapping_key))
+#    ifdef KEY_EVENT_TIME_US
+/* Compare the microsecond captures, so tap-term decisions are not quantized
+ * to the matrix scan period; the millisecond terms scale up to microseconds. */
+#        define TAPPING_TIME_ELAPSED(e) TIMER_DIFF_32((e).time_us, tapping_key.event.time_us)
+#        define TAPPING_TERM_SCALE 1000UL
+#    else
+#        define TAPPING_TIME_ELAPSED(e) TIMER_DIFF_16((e).time, tapping_key.event.time)
+#        define TAPPING_TERM_SCALE 1
+#    endif
+#    ifdef TAPPING_TERM_CACHE_ENABLE
+#        define WITHIN_TAPPING_TERM(e) (TAPPING_TIME_ELAPSED(e) < TAPPING_TERM_SCALE * tapping_term_cached())
+#    else
+#        define WITHIN_TAPPING_TERM(e) (TAPPING_TIME_ELAPSED(e) < TAPPING_TERM_SCALE * GET_TAPPING_TERM(get_record_keycode(&tapping_key, false), &tapping_key))
+#    endif
+#    define WITHIN_QUICK_TAP_TERM(e) (TAPPING_TIME_ELAPSED(e) < TAPPING_TERM_SCALE * GET_QUICK_TAP_TERM(get_record_keycode(&tapping_key, false), &tapping_key))
 
 #    ifdef DYNAMIC_TAPPING_TERM_ENABLE
 uint16_t g_tapping_term = TAPPING_TERM;
@@ -70,8 +94,37 @@ static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE] = {};
 static uint8_t     waiting_buffer_head                 = 0;
 static uint8_t     waiting_buffer_tail                 = 0;
 
+/* Ring indexing by mask: the modulo on every buffer walk is a division call
+ * on AVR. */
+_Static_assert((WAITING_BUFFER_SIZE & (WAITING_BUFFER_SIZE - 1)) == 0, "WAITING_BUFFER_SIZE must be a power of two");
+#    define WAITING_BUFFER_NEXT(i) (((i) + 1) & (WAITING_BUFFER_SIZE - 1))
+
+#    ifdef TAPPING_TERM_CACHE_ENABLE
+/* Resolving the tapping term is not free: get_record_keycode() walks the
+ * layer stack to find the tapping key's keycode, and a per-key
+ * get_tapping_term() may do arbitrary work on top of that.
+ * WITHIN_TAPPING_TERM() repeats that resolution on every evaluation, and is
+ * evaluated several times per event -- including once per buffered record in
+ * waiting_buffer_scan_tap() -- even though the result cannot change while the
+ * same key is being resolved.  Memoize it for the lifetime of the current
+ * tapping key; the key's matrix position and press timestamp together change
+ * whenever a new tap-hold decision starts.
+ */
+static uint16_t tapping_term_cached(void) {
+    static keypos_t cached_key;
+    static uint16_t cached_time;
+    static uint16_t cached_term;
+    if (!KEYEQ(cached_key, tapping_key.event.key) || cached_time != tapping_key.event.time) {
+        cached_key  = tapping_key.event.key;
+        cached_time = tapping_key.event.time;
+        cached_term = GET_TAPPING_TERM(get_record_keycode(&tapping_key, false), &tapping_key);
+    }
+    return cached_term;
+}
+#    endif
+
 static bool process_tapping(keyrecord_t *record);
-static bool waiting_buffer_enq(keyrecord_t record);
+static bool waiting_buffer_enq(const keyrecord_t *record);
 static void waiting_buffer_clear(void);
 static bool waiting_buffer_typed(keyevent_t event);
 static bool waiting_buffer_has_anykey_pressed(void);
@@ -83,9 +136,9 @@ static void debug_waiting_buffer(void);
  *
  * FIXME: Needs doc
  */
-void action_tapping_process(keyrecord_t record) {
-    if (process_tapping(&record)) {
-        if (IS_EVENT(record.event)) {
+void action_tapping_process(keyrecord_t *record) {
+    if (process_tapping(record)) {
+        if (IS_EVENT(record->event)) {
             ac_dprintf("processed: ");
             debug_record(record);
             ac_dprintf("\n");
@@ -101,19 +154,19 @@ void action_tapping_process(keyrecord_t record) {
     }
 
     // process waiting_buffer
-    if (IS_EVENT(record.event) && waiting_buffer_head != waiting_buffer_tail) {
+    if (IS_EVENT(record->event) && waiting_buffer_head != waiting_buffer_tail) {
         ac_dprintf("---- action_exec: process waiting_buffer -----\n");
     }
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = WAITING_BUFFER_NEXT(waiting_buffer_tail)) {
         if (process_tapping(&waiting_buffer[waiting_buffer_tail])) {
             ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
-            debug_record(waiting_buffer[waiting_buffer_tail]);
+            debug_record(&waiting_buffer[waiting_buffer_tail]);
             ac_dprintf("\n\n");
         } else {
             break;
         }
     }
-    if (IS_EVENT(record.event)) {
+    if (IS_EVENT(record->event)) {
         ac_dprintf("\n");
     }
 }
@@ -134,7 +187,7 @@ void action_tapping_process(keyrecord_t record) {
 #        else
 #            define TAP_GET_RETRO_TAPPING true
 #        endif
-#        define MAYBE_RETRO_SHIFTING(ev) (TAP_GET_RETRO_TAPPING && (RETRO_SHIFT + 0) != 0 && TIMER_DIFF_16((ev).time, tapping_key.event.time) < (RETRO_SHIFT + 0))
+#        define MAYBE_RETRO_SHIFTING(ev) (TAP_GET_RETRO_TAPPING && (RETRO_SHIFT + 0) != 0 && TAPPING_TIME_ELAPSED(ev) < TAPPING_TERM_SCALE * (RETRO_SHIFT + 0))
 #        define TAP_IS_LT IS_QK_LAYER_TAP(tapping_keycode)
 #        define TAP_IS_MT IS_QK_MOD_TAP(tapping_keycode)
 #        define TAP_IS_RETRO IS_RETRO(tapping_keycode)
@@ -188,6 +241,7 @@ bool process_tapping(keyrecord_t *keyp) {
 #    endif
                     // first tap!
                     ac_dprintf("Tapping: First tap(0->1).\n");
+                    TAP_TRACE_DECISION(EVENT_TRACE_DECISION_TAP);
                     tapping_key.tap.count = 1;
                     debug_tapping_key();
                     process_record(&tapping_key);
@@ -230,6 +284,7 @@ bool process_tapping(keyrecord_t *keyp) {
                 ) {
                     // clang-format on
                     ac_dprintf("Tapping: End. No tap. Interfered by typing key\n");
+                    TAP_TRACE_DECISION(EVENT_TRACE_DECISION_HOLD);
                     process_record(&tapping_key);
                     tapping_key = (keyrecord_t){};
                     debug_tapping_key();
@@ -275,6 +330,7 @@ bool process_tapping(keyrecord_t *keyp) {
                         tapping_key.tap.interrupted = true;
                         if (TAP_GET_HOLD_ON_OTHER_KEY_PRESS) {
                             ac_dprintf("Tapping: End. No tap. Interfered by pressed key\n");
+                            TAP_TRACE_DECISION(EVENT_TRACE_DECISION_HOLD);
                             process_record(&tapping_key);
                             tapping_key = (keyrecord_t){};
                             debug_tapping_key();
@@ -304,7 +360,7 @@ bool process_tapping(keyrecord_t *keyp) {
                             .event.key     = tapping_key.event.key,
                             .event.time    = event.time,
                             .event.pressed = false,
-#    ifdef COMBO_ENABLE
+#    if defined(COMBO_ENABLE) || defined(REPEAT_KEY_ENABLE)
                             .keycode = tapping_key.keycode,
 #    endif
                         });
@@ -330,6 +386,7 @@ bool process_tapping(keyrecord_t *keyp) {
                 ac_dprintf("Tapping: End. Timeout. Not tap(0): ");
                 debug_event(event);
                 ac_dprintf("\n");
+                TAP_TRACE_DECISION(EVENT_TRACE_DECISION_HOLD);
                 process_record(&tapping_key);
                 tapping_key = (keyrecord_t){};
                 debug_tapping_key();
@@ -350,7 +407,7 @@ bool process_tapping(keyrecord_t *keyp) {
                             .event.key     = tapping_key.event.key,
                             .event.time    = event.time,
                             .event.pressed = false,
-#    ifdef COMBO_ENABLE
+#    if defined(COMBO_ENABLE) || defined(REPEAT_KEY_ENABLE)
                             .keycode = tapping_key.keycode,
 #    endif
                         });
@@ -437,18 +494,20 @@ bool process_tapping(keyrecord_t *keyp) {
  *
  * FIXME: Needs docs
  */
-bool waiting_buffer_enq(keyrecord_t record) {
-    if (IS_NOEVENT(record.event)) {
+bool waiting_buffer_enq(const keyrecord_t *record) {
+    if (IS_NOEVENT(record->event)) {
         return true;
     }
 
-    if ((waiting_buffer_head + 1) % WAITING_BUFFER_SIZE == waiting_buffer_tail) {
+    if (WAITING_BUFFER_NEXT(waiting_buffer_head) == waiting_buffer_tail) {
         ac_dprintf("waiting_buffer_enq: Over flow.\n");
         return false;
     }
 
-    waiting_buffer[waiting_buffer_head] = record;
-    waiting_buffer_head                 = (waiting_buffer_head + 1) % WAITING_BUFFER_SIZE;
+    // One of the two deliberate copy points in the pipeline (the other is
+    // tapping_key); everything else passes the record by pointer.
+    waiting_buffer[waiting_buffer_head] = *record;
+    waiting_buffer_head                 = WAITING_BUFFER_NEXT(waiting_buffer_head);
 
     ac_dprintf("waiting_buffer_enq: ");
     debug_waiting_buffer();
@@ -469,7 +528,7 @@ void waiting_buffer_clear(void) {
  * FIXME: Needs docs
  */
 bool waiting_buffer_typed(keyevent_t event) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = WAITING_BUFFER_NEXT(i)) {
         if (KEYEQ(event.key, waiting_buffer[i].event.key) && event.pressed != waiting_buffer[i].event.pressed) {
             return true;
         }
@@ -482,7 +541,7 @@ bool waiting_buffer_typed(keyevent_t event) {
  * FIXME: Needs docs
  */
 __attribute__((unused)) bool waiting_buffer_has_anykey_pressed(void) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = WAITING_BUFFER_NEXT(i)) {
         if (waiting_buffer[i].event.pressed) return true;
     }
     return false;
@@ -498,7 +557,7 @@ void waiting_buffer_scan_tap(void) {
     // invalid state: tapping_key released && tap.count == 0
     if (!tapping_key.event.pressed) return;
 
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = WAITING_BUFFER_NEXT(i)) {
         if (IS_TAPPING_KEY(waiting_buffer[i].event.key) && !waiting_buffer[i].event.pressed && WITHIN_TAPPING_TERM(waiting_buffer[i].event)) {
             tapping_key.tap.count       = 1;
             waiting_buffer[i].tap.count = 1;
@@ -517,7 +576,7 @@ void waiting_buffer_scan_tap(void) {
  */
 static void debug_tapping_key(void) {
     ac_dprintf("TAPPING_KEY=");
-    debug_record(tapping_key);
+    debug_record(&tapping_key);
     ac_dprintf("\n");
 }
 
@@ -527,9 +586,9 @@ static void debug_tapping_key(void) {
  */
 static void debug_waiting_buffer(void) {
     ac_dprintf("{ ");
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = WAITING_BUFFER_NEXT(i)) {
         ac_dprintf("[%u]=", i);
-        debug_record(waiting_buffer[i]);
+        debug_record(&waiting_buffer[i]);
         ac_dprintf(" ");
     }
     ac_dprintf("}\n");
@@ -240,6 +240,78 @@ bool is_oneshot_enabled(void) {
 
 #endif
 
+/* Hand the composed keyboard_report to the host, deduplicating identical
+ * consecutive reports where the protocol allows it. */
+static void send_keyboard_report_now(void) {
+#ifdef PROTOCOL_VUSB
+    host_keyboard_send(keyboard_report);
+#else
+    static report_keyboard_t last_report;
+
+    /* Only send the report if there are changes to propagate to the host. */
+    if (memcmp(keyboard_report, &last_report, sizeof(report_keyboard_t)) != 0) {
+        memcpy(&last_report, keyboard_report, sizeof(report_keyboard_t));
+        host_keyboard_send(keyboard_report);
+    }
+#endif
+}
+
+#ifdef KEYBOARD_REPORT_BATCHING
+static report_keyboard_t report_batch_pending;
+static report_keyboard_t report_batch_seen; // last state the host has observed
+static bool              report_batch_active = false;
+static bool              report_batch_dirty  = false;
+
+/* True if overwriting `pending` with `next` would hide a transient from the
+ * host: a key or modifier that went down and back up within the batch (a
+ * tap), or up and back down (a retrigger). Steady transitions - a press
+ * that stays pressed, a release of something the host already saw pressed -
+ * are covered by the final report and need no intermediate send. */
+static bool report_batch_transient(report_keyboard_t *seen, report_keyboard_t *pending, report_keyboard_t *next) {
+    const uint8_t tap_mods       = pending->mods & ~next->mods & ~seen->mods;
+    const uint8_t retrigger_mods = ~pending->mods & next->mods & seen->mods;
+    if (tap_mods | retrigger_mods) {
+        return true;
+    }
+#    ifdef NKRO_ENABLE
+    if (keyboard_protocol && keymap_config.nkro) {
+        for (uint8_t i = 0; i < KEYBOARD_REPORT_BITS; i++) {
+            if ((pending->nkro.bits[i] & ~next->nkro.bits[i] & ~seen->nkro.bits[i]) | (~pending->nkro.bits[i] & next->nkro.bits[i] & seen->nkro.bits[i])) {
+                return true;
+            }
+        }
+        return false;
+    }
+#    endif
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (pending->keys[i] && !is_key_pressed(next, pending->keys[i]) && !is_key_pressed(seen, pending->keys[i])) {
+            return true;
+        }
+        if (next->keys[i] && !is_key_pressed(pending, next->keys[i]) && is_key_pressed(seen, next->keys[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void keyboard_report_batch_begin(void) {
+    report_batch_active = true;
+    memcpy(&report_batch_seen, keyboard_report, sizeof(report_keyboard_t));
+}
+
+void keyboard_report_batch_commit(void) {
+    if (!report_batch_active) {
+        return;
+    }
+    report_batch_active = false;
+    if (report_batch_dirty) {
+        report_batch_dirty = false;
+        memcpy(keyboard_report, &report_batch_pending, sizeof(report_keyboard_t));
+        send_keyboard_report_now();
+    }
+}
+#endif
+
 /** \brief Send keyboard report
  *
  * FIXME: needs doc
@@ -270,17 +342,25 @@ void send_keyboard_report(void) {
     keyboard_report->mods |= weak_override_mods;
 #endif
 
-#ifdef PROTOCOL_VUSB
-    host_keyboard_send(keyboard_report);
-#else
-    static report_keyboard_t last_report;
-
-    /* Only send the report if there are changes to propagate to the host. */
-    if (memcmp(keyboard_report, &last_report, sizeof(report_keyboard_t)) != 0) {
-        memcpy(&last_report, keyboard_report, sizeof(report_keyboard_t));
-        host_keyboard_send(keyboard_report);
+#ifdef KEYBOARD_REPORT_BATCHING
+    if (report_batch_active) {
+        /* A tap or retrigger inside the batch means the staged report holds
+         * a state the host has to see before it is overwritten - flush it. */
+        if (report_batch_dirty && report_batch_transient(&report_batch_seen, &report_batch_pending, keyboard_report)) {
+            report_keyboard_t current;
+            memcpy(&current, keyboard_report, sizeof(report_keyboard_t));
+            memcpy(keyboard_report, &report_batch_pending, sizeof(report_keyboard_t));
+            send_keyboard_report_now();
+            memcpy(&report_batch_seen, keyboard_report, sizeof(report_keyboard_t));
+            memcpy(keyboard_report, &current, sizeof(report_keyboard_t));
+        }
+        memcpy(&report_batch_pending, keyboard_report, sizeof(report_keyboard_t));
+        report_batch_dirty = true;
+        return;
     }
 #endif
+
+    send_keyboard_report_now();
 }
 
 /** \brief Get mods
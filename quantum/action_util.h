@@ -28,6 +28,13 @@ extern report_keyboard_t *keyboard_report;
 
 void send_keyboard_report(void);
 
+#ifdef KEYBOARD_REPORT_BATCHING
+/* Coalesce the keyboard reports of one scan batch into a single send; see
+ * keyboard.c. Intermediate tap states inside the batch are still flushed. */
+void keyboard_report_batch_begin(void);
+void keyboard_report_batch_commit(void);
+#endif
+
 /* key */
 inline void add_key(uint8_t key) {
     add_key_to_report(keyboard_report, key);
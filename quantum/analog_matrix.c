@@ -0,0 +1,237 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "analog_matrix.h"
+#include "eeconfig.h"
+#include "debug.h"
+
+#if (EECONFIG_KB_DATA_SIZE) > 0
+_Static_assert(sizeof(analog_matrix_calibration_t) <= (EECONFIG_KB_DATA_SIZE), "EECONFIG_KB_DATA_SIZE is too small for the analog matrix calibration table");
+// The datablock read/update helpers transfer the whole block, so back the
+// table with a full-size buffer.
+static union {
+    analog_matrix_calibration_t table;
+    uint8_t                     block[EECONFIG_KB_DATA_SIZE];
+} cal;
+#else
+static union {
+    analog_matrix_calibration_t table;
+} cal;
+#endif
+
+static uint16_t raw_frame[MATRIX_ROWS][MATRIX_COLS];
+static uint8_t  travel[MATRIX_ROWS][MATRIX_COLS];
+static uint8_t  actuation_point = ANALOG_MATRIX_ACTUATION;
+static bool     calibrating     = false;
+static bool     rest_seeded     = false;
+
+#ifdef ANALOG_MATRIX_RAPID_TRIGGER_DEFAULT_ON
+static bool rapid_trigger = true;
+#else
+static bool rapid_trigger = false;
+#endif
+// Last direction-reversal extreme per key while rapid trigger is active.
+static uint8_t rt_extreme[MATRIX_ROWS][MATRIX_COLS];
+
+// Sampling driver defaults; boards without a driver scan as all-released.
+__attribute__((weak)) void analog_matrix_driver_init(void) {}
+
+__attribute__((weak)) bool analog_matrix_driver_read(uint16_t raw[MATRIX_ROWS][MATRIX_COLS]) {
+    (void)raw;
+    return false;
+}
+
+static uint8_t compute_travel(uint8_t row, uint8_t col) {
+    const analog_key_calibration_t *k   = &cal.table.key[row][col];
+    uint16_t                        raw = raw_frame[row][col];
+
+    uint16_t delta;
+    uint16_t range;
+    if (k->pressed == k->rest) {
+        // Not yet calibrated: assume the default range, either direction.
+        delta = (raw > k->rest) ? (raw - k->rest) : (k->rest - raw);
+        range = ANALOG_MATRIX_DEFAULT_RANGE;
+    } else if (k->pressed > k->rest) {
+        delta = (raw > k->rest) ? (raw - k->rest) : 0;
+        range = k->pressed - k->rest;
+    } else {
+        delta = (raw < k->rest) ? (k->rest - raw) : 0;
+        range = k->rest - k->pressed;
+    }
+
+    if (delta >= range) {
+        return 255;
+    }
+    return (uint8_t)(((uint32_t)delta * 255) / range);
+}
+
+static void calibration_learn(uint8_t row, uint8_t col) {
+    analog_key_calibration_t *k   = &cal.table.key[row][col];
+    uint16_t                  raw = raw_frame[row][col];
+
+    uint16_t deviation = (raw > k->rest) ? (raw - k->rest) : (k->rest - raw);
+    if (deviation < ANALOG_MATRIX_CAL_THRESHOLD) {
+        return;
+    }
+
+    // Track the furthest excursion from rest as the fully-pressed value.
+    uint16_t learned = (k->pressed > k->rest) ? (k->pressed - k->rest) : (k->rest - k->pressed);
+    if (deviation > learned) {
+        k->pressed = raw;
+    }
+}
+
+static bool key_state(uint8_t row, uint8_t col, bool was_pressed) {
+    uint8_t t = travel[row][col];
+
+    if (rapid_trigger) {
+        uint8_t *extreme = &rt_extreme[row][col];
+        if (t <= ANALOG_MATRIX_RAPID_TRIGGER_DEADZONE) {
+            // Fully up: always released, re-arm tracking.
+            *extreme = t;
+            return false;
+        }
+        if (was_pressed) {
+            if (t > *extreme) {
+                *extreme = t; // still travelling down
+            } else if (*extreme - t >= ANALOG_MATRIX_RAPID_TRIGGER_SENSITIVITY) {
+                *extreme = t; // reversed upward far enough
+                return false;
+            }
+            return true;
+        }
+        if (t < *extreme) {
+            *extreme = t; // still travelling up
+        } else if (t - *extreme >= ANALOG_MATRIX_RAPID_TRIGGER_SENSITIVITY) {
+            *extreme = t; // reversed downward far enough
+            return true;
+        }
+        return false;
+    }
+
+    // Fixed actuation point with hysteresis on release.
+    if (was_pressed) {
+        uint8_t release_point = (actuation_point > ANALOG_MATRIX_HYSTERESIS) ? (actuation_point - ANALOG_MATRIX_HYSTERESIS) : 0;
+        return t > release_point;
+    }
+    return t >= actuation_point;
+}
+
+void matrix_init_custom(void) {
+    analog_matrix_driver_init();
+
+    memset(&cal, 0, sizeof(cal));
+#if (EECONFIG_KB_DATA_SIZE) > 0
+    if (eeconfig_is_kb_datablock_valid()) {
+        eeconfig_read_kb_datablock(cal.block);
+    }
+#endif
+    if (cal.table.magic != ANALOG_MATRIX_CAL_MAGIC) {
+        // No stored table; rest values are seeded from the first frame.
+        memset(&cal, 0, sizeof(cal));
+    } else {
+        rest_seeded = true;
+    }
+}
+
+bool matrix_scan_custom(matrix_row_t current_matrix[]) {
+    if (!analog_matrix_driver_read(raw_frame)) {
+        return false; // no fresh frame; keep the previous state
+    }
+
+    if (!rest_seeded) {
+        // First frame after power-up with no stored calibration: take it as
+        // the resting position of every key.
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                cal.table.key[row][col].rest    = raw_frame[row][col];
+                cal.table.key[row][col].pressed = raw_frame[row][col];
+            }
+        }
+        rest_seeded = true;
+        return false;
+    }
+
+    bool changed = false;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix_row_t new_row = 0;
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (calibrating) {
+                calibration_learn(row, col);
+            }
+            travel[row][col] = compute_travel(row, col);
+
+            const matrix_row_t mask = (matrix_row_t)(MATRIX_ROW_SHIFTER << col);
+            if (key_state(row, col, current_matrix[row] & mask)) {
+                new_row |= mask;
+            }
+        }
+        if (current_matrix[row] != new_row) {
+            current_matrix[row] = new_row;
+            changed             = true;
+        }
+    }
+    return changed;
+}
+
+uint8_t analog_matrix_get_travel(uint8_t row, uint8_t col) {
+    if (row >= MATRIX_ROWS || col >= MATRIX_COLS) {
+        return 0;
+    }
+    return travel[row][col];
+}
+
+uint16_t analog_matrix_get_raw(uint8_t row, uint8_t col) {
+    if (row >= MATRIX_ROWS || col >= MATRIX_COLS) {
+        return 0;
+    }
+    return raw_frame[row][col];
+}
+
+void analog_matrix_set_actuation(uint8_t actuation) {
+    actuation_point = actuation;
+}
+
+uint8_t analog_matrix_get_actuation(void) {
+    return actuation_point;
+}
+
+void analog_matrix_rapid_trigger_enable(bool enable) {
+    rapid_trigger = enable;
+    memset(rt_extreme, 0, sizeof(rt_extreme));
+}
+
+bool analog_matrix_rapid_trigger_enabled(void) {
+    return rapid_trigger;
+}
+
+void analog_matrix_calibrate_start(void) {
+    // Re-seed rest from the current (hopefully untouched) readings and start
+    // learning pressed extremes from scratch.
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            cal.table.key[row][col].rest    = raw_frame[row][col];
+            cal.table.key[row][col].pressed = raw_frame[row][col];
+        }
+    }
+    calibrating = true;
+    dprintf("analog_matrix: calibration started\n");
+}
+
+void analog_matrix_calibrate_stop(void) {
+    calibrating     = false;
+    cal.table.magic = ANALOG_MATRIX_CAL_MAGIC;
+#if (EECONFIG_KB_DATA_SIZE) > 0
+    eeconfig_update_kb_datablock(cal.block);
+    dprintf("analog_matrix: calibration stored\n");
+#else
+    // No datablock configured; the table lives in RAM only.
+    dprintf("analog_matrix: calibration kept in RAM (EECONFIG_KB_DATA_SIZE is 0)\n");
+#endif
+}
+
+bool analog_matrix_calibrating(void) {
+    return calibrating;
+}
@@ -0,0 +1,118 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "matrix.h"
+
+/**
+ * \file
+ *
+ * \brief Analog (hall-effect / electrocapacitive) matrix engine.
+ *
+ * With `ANALOG_MATRIX_ENABLE = yes` this module provides the custom matrix
+ * entry points (`matrix_init_custom()` / `matrix_scan_custom()`), turning
+ * per-key analog readings into the digital matrix the rest of QMK consumes.
+ * The hardware access is delegated to a sampling driver (see
+ * `analog_matrix_driver_read()`); a GPT/DMA-paced ADC driver for ChibiOS
+ * targets lives in `platforms/chibios/drivers/analog_matrix_adc.c`.
+ *
+ * Raw readings are normalised per key into 0..255 "travel" using a
+ * calibration table (rest and fully-pressed values, learned at runtime and
+ * persisted in the eeconfig keyboard datablock). Digital state then comes
+ * from either a fixed actuation point with hysteresis, or rapid-trigger
+ * tracking where press/release follow direction reversals of the key itself.
+ */
+
+/* Default actuation point, in travel units (0 = rest, 255 = bottom-out). */
+#ifndef ANALOG_MATRIX_ACTUATION
+#    define ANALOG_MATRIX_ACTUATION 128
+#endif
+
+/* Hysteresis below the actuation point before a key releases, in travel
+ * units; keeps noise near the actuation point from chattering. */
+#ifndef ANALOG_MATRIX_HYSTERESIS
+#    define ANALOG_MATRIX_HYSTERESIS 12
+#endif
+
+/* Travel a key must move against its last extreme before rapid trigger
+ * registers a press/release. */
+#ifndef ANALOG_MATRIX_RAPID_TRIGGER_SENSITIVITY
+#    define ANALOG_MATRIX_RAPID_TRIGGER_SENSITIVITY 20
+#endif
+
+/* Travel below which a key is always considered released and rapid-trigger
+ * tracking re-arms; guards against drift holding a key active forever. */
+#ifndef ANALOG_MATRIX_RAPID_TRIGGER_DEADZONE
+#    define ANALOG_MATRIX_RAPID_TRIGGER_DEADZONE 24
+#endif
+
+/* Raw counts a reading must move from rest before it contributes to
+ * calibration, filtering sensor noise while learning the travel range. */
+#ifndef ANALOG_MATRIX_CAL_THRESHOLD
+#    define ANALOG_MATRIX_CAL_THRESHOLD 48
+#endif
+
+/* Fallback full-travel range in raw counts, used for keys that have not been
+ * calibrated yet. */
+#ifndef ANALOG_MATRIX_DEFAULT_RANGE
+#    define ANALOG_MATRIX_DEFAULT_RANGE 1024
+#endif
+
+#if defined(__GNUC__)
+#    define PACKED __attribute__((__packed__))
+#else
+#    define PACKED
+#endif
+
+/* Per-key calibration: raw reading at rest and at full travel. `pressed`
+ * equal to `rest` marks a key as not yet calibrated. */
+typedef struct PACKED {
+    uint16_t rest;
+    uint16_t pressed;
+} analog_key_calibration_t;
+
+typedef struct PACKED {
+    uint32_t                 magic; // ANALOG_MATRIX_CAL_MAGIC when the table is valid
+    analog_key_calibration_t key[MATRIX_ROWS][MATRIX_COLS];
+} analog_matrix_calibration_t;
+
+#define ANALOG_MATRIX_CAL_MAGIC 0x414D4331 // "AMC1"
+
+/* Sampling driver interface ------------------------------------------------ */
+
+/* Bring up the sampling hardware; called from matrix_init_custom(). */
+void analog_matrix_driver_init(void);
+
+/* Copy the most recent full frame of raw readings. Returns true when the
+ * frame is newer than the previously returned one. Must not block: drivers
+ * sample continuously (DMA/interrupt paced) and hand out the latest data. */
+bool analog_matrix_driver_read(uint16_t raw[MATRIX_ROWS][MATRIX_COLS]);
+
+/* Runtime API -------------------------------------------------------------- */
+
+/* Normalised travel of a key, 0 (rest) to 255 (bottom-out). */
+uint8_t analog_matrix_get_travel(uint8_t row, uint8_t col);
+
+/* Most recent raw reading of a key. */
+uint16_t analog_matrix_get_raw(uint8_t row, uint8_t col);
+
+/* Actuation point in travel units; runtime changes are not persisted. */
+void    analog_matrix_set_actuation(uint8_t actuation);
+uint8_t analog_matrix_get_actuation(void);
+
+/* Rapid trigger: presses/releases follow per-key direction reversals instead
+ * of a fixed actuation point. Defaults to off unless
+ * ANALOG_MATRIX_RAPID_TRIGGER_DEFAULT_ON is defined. */
+void analog_matrix_rapid_trigger_enable(bool enable);
+bool analog_matrix_rapid_trigger_enabled(void);
+
+/* Calibration: while active, rest values are re-seeded from the current
+ * readings and pressed extremes are learned from keys as they are pressed to
+ * the bottom. Stopping persists the table to the eeconfig kb datablock. */
+void analog_matrix_calibrate_start(void);
+void analog_matrix_calibrate_stop(void);
+bool analog_matrix_calibrating(void);
@@ -222,6 +222,17 @@ void audio_driver_initialize(void);
 void audio_driver_start(void);
 void audio_driver_stop(void);
 
+#ifdef AUDIO_CLICKY_PCM
+/**
+ * @brief play the pre-rendered keyclick sample (dac_additive driver only)
+ * @details mixes the flash-resident click PCM on top of whatever the synth
+ *          is producing; costs a pointer arm instead of voice setup
+ * @param[in] stride_q8 playback stride through the sample in Q8 fixed point;
+ *            256 plays the click at its rendered pitch, larger is higher
+ */
+void audio_driver_click(uint16_t stride_q8);
+#endif
+
 /**
  * @brief get the number of currently active tones
  * @return number, 0=none active
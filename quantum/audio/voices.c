@@ -50,11 +50,32 @@ float mod(float a, int b) {
     return r < 0 ? r + b : r;
 }
 
+/* The vibrato LUT with the strength exponent already applied, so the hot path
+ * is a plain multiply instead of a pow() per evaluation. Rebuilt lazily
+ * whenever the strength or rate setters have changed the parameters.
+ */
+static float vibrato_lut_scaled[VIBRATO_LUT_LENGTH];
+static float vibrato_counter_scale   = 0.0f;
+static float vibrato_strength_cached = -1.0f;
+static float vibrato_rate_cached     = -1.0f;
+
+static void vibrato_params_refresh(void) {
+    if (vibrato_strength_cached != vibrato_strength || vibrato_rate_cached != vibrato_rate) {
+        vibrato_strength_cached = vibrato_strength;
+        vibrato_rate_cached     = vibrato_rate;
+        vibrato_counter_scale   = 1.0f / (100.0f * vibrato_rate);
+        for (uint8_t i = 0; i < VIBRATO_LUT_LENGTH; i++) {
+            vibrato_lut_scaled[i] = pow(vibrato_lut[i], vibrato_strength);
+        }
+    }
+}
+
 // Effect: 'vibrate' a given target frequency slightly above/below its initial value
 float voice_add_vibrato(float average_freq) {
-    float vibrato_counter = mod(timer_read() / (100 * vibrato_rate), VIBRATO_LUT_LENGTH);
+    vibrato_params_refresh();
+    float vibrato_counter = mod(timer_read() * vibrato_counter_scale, VIBRATO_LUT_LENGTH);
 
-    return average_freq * pow(vibrato_lut[(int)vibrato_counter], vibrato_strength);
+    return average_freq * vibrato_lut_scaled[(int)vibrato_counter];
 }
 
 // Effect: 'slides' the 'frequency' from the starting-point, to the target frequency
@@ -69,10 +90,32 @@ float voice_add_glissando(float from_freq, float to_freq) {
 }
 #endif
 
+#ifdef AUDIO_VOICES
+/* Every parameter the voice effects evaluate is derived from a millisecond
+ * timer, so re-running the effect switch for several driver queries within
+ * the same millisecond cannot produce a different result. The last
+ * evaluation is memoized and replayed until the clock ticks, the input
+ * frequency moves, or the voice changes - effectively a 1kHz control rate
+ * for the envelope/LFO math, with repeat queries reduced to three compares.
+ */
+static uint16_t   envelope_cache_time  = 0;
+static float      envelope_cache_in    = -1.0f;
+static float      envelope_cache_out   = 0.0f;
+static voice_type envelope_cache_voice = default_voice;
+#endif
+
 float voice_envelope(float frequency) {
     // envelope_index ranges from 0 to 0xFFFF, which is preserved at 880.0 Hz
 //    __attribute__((unused)) uint16_t compensated_index = (uint16_t)((float)envelope_index * (880.0 / frequency));
 #ifdef AUDIO_VOICES
+    uint16_t now = timer_read();
+    if (now == envelope_cache_time && frequency == envelope_cache_in && voice == envelope_cache_voice) {
+        return envelope_cache_out;
+    }
+    envelope_cache_time  = now;
+    envelope_cache_in    = frequency;
+    envelope_cache_voice = voice;
+
     uint16_t envelope_index    = timer_elapsed(voices_timer); // TODO: multiply in some factor?
     uint16_t compensated_index = envelope_index / 100;        // TODO: correct factor would be?
 #endif
@@ -324,6 +367,8 @@ float voice_envelope(float frequency) {
         // TODO: where to keep track of the start-frequency?
         // frequency = voice_add_glissando(??, frequency);
     }
+
+    envelope_cache_out = frequency;
 #endif // AUDIO_VOICES
 
     return frequency;
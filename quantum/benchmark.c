@@ -0,0 +1,98 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdbool.h>
+
+#include "benchmark.h"
+#include "matrix.h"
+#include "timer.h"
+#include "print.h"
+
+#ifdef PROTOCOL_CHIBIOS
+#    include <ch.h>
+#    include <hal.h>
+#endif
+
+// The CMSIS headers only define DWT for cores that have the cycle counter
+// (Cortex-M3 and later); Cortex-M0/M0+ fall through to the ms timer.
+#if defined(PROTOCOL_CHIBIOS) && defined(DWT)
+#    define BENCHMARK_USE_DWT
+#endif
+
+static uint32_t ticks_per_sec = 1000;
+
+void benchmark_init(void) {
+#ifdef BENCHMARK_USE_DWT
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+uint32_t benchmark_timestamp(void) {
+#ifdef BENCHMARK_USE_DWT
+    return DWT->CYCCNT;
+#else
+    return timer_read32();
+#endif
+}
+
+uint32_t benchmark_ticks_per_sec(void) {
+    return ticks_per_sec;
+}
+
+// Measures the cycle counter against the ms timer instead of relying on a
+// per-MCU clock macro; runs once, just before the benchmark pass.
+static void benchmark_calibrate(void) {
+#ifdef BENCHMARK_USE_DWT
+    uint32_t start = timer_read32();
+    while (timer_read32() == start)
+        ; // align to a tick edge
+    uint32_t begin = benchmark_timestamp();
+    start          = timer_read32();
+    while (timer_elapsed32(start) < 10)
+        ;
+    ticks_per_sec = (benchmark_timestamp() - begin) * 100;
+#endif
+}
+
+void benchmark_run(const char *name, benchmark_fn_t fn, uint16_t iterations) {
+    uint32_t min = UINT32_MAX;
+    uint32_t max = 0;
+
+    uint32_t begin = benchmark_timestamp();
+    for (uint16_t i = 0; i < iterations; i++) {
+        uint32_t t0 = benchmark_timestamp();
+        fn();
+        uint32_t delta = benchmark_timestamp() - t0;
+        if (delta < min) min = delta;
+        if (delta > max) max = delta;
+    }
+    uint32_t total = benchmark_timestamp() - begin;
+
+    // With a coarse (ms) timestamp only the average is meaningful; min and
+    // max are still printed so the line format stays fixed.
+    xprintf("BENCH,%s,%u,%lu,%lu,%lu,%lu\n", name, iterations, ticks_per_sec, min, iterations ? total / iterations : 0, max);
+}
+
+static void benchmark_matrix_scan(void) {
+    matrix_scan();
+}
+
+__attribute__((weak)) void benchmark_user(void) {}
+
+__attribute__((weak)) void benchmark_kb(void) {
+    benchmark_user();
+}
+
+void benchmark_task(void) {
+    static bool done = false;
+    if (done || timer_read32() < BENCHMARK_AUTORUN_DELAY) {
+        return;
+    }
+    done = true;
+
+    benchmark_calibrate();
+    benchmark_run("matrix_scan", benchmark_matrix_scan, 1000);
+    benchmark_kb();
+}
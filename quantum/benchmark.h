@@ -0,0 +1,55 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * \file
+ *
+ * \brief On-device microbenchmark harness.
+ *
+ * With `BENCHMARK_ENABLE = yes` the firmware times selected functions on
+ * real hardware and reports the results over the console endpoint in a
+ * machine-readable form:
+ *
+ *     BENCH,<name>,<iterations>,<ticks_per_sec>,<min>,<avg>,<max>
+ *
+ * Timestamps use the DWT cycle counter on Cortex-M3 and later (one tick
+ * per CPU cycle); elsewhere they fall back to the millisecond timer, where
+ * only the average over many iterations is meaningful. `ticks_per_sec`
+ * lets the host normalize either way.
+ *
+ * The built-in workload benchmarks `matrix_scan()` once, a few seconds
+ * after boot so the console can attach first; keyboards and keymaps add
+ * their own workloads by overriding `benchmark_kb()`/`benchmark_user()`
+ * and calling `benchmark_run()`. The timestamp functions can also be used
+ * directly to instrument a section by hand.
+ */
+
+// Delay before the one-shot benchmark pass, allowing hid_listen to attach.
+#ifndef BENCHMARK_AUTORUN_DELAY
+#    define BENCHMARK_AUTORUN_DELAY 5000
+#endif
+
+typedef void (*benchmark_fn_t)(void);
+
+/* Starts the cycle counter where the core has one; called once from
+ * keyboard_init(). */
+void benchmark_init(void);
+
+/* Raw timestamp and its rate; ticks wrap at 32 bits. */
+uint32_t benchmark_timestamp(void);
+uint32_t benchmark_ticks_per_sec(void);
+
+/* Times `iterations` calls of `fn` and prints one BENCH line. */
+void benchmark_run(const char *name, benchmark_fn_t fn, uint16_t iterations);
+
+/* Runs the benchmark pass once the autorun delay has passed; called from
+ * keyboard_task(). */
+void benchmark_task(void);
+
+/* Override these to script keyboard/keymap workloads. */
+void benchmark_kb(void);
+void benchmark_user(void);
@@ -28,6 +28,29 @@ static bool caps_word_active = false;
 #        error "CAPS_WORD_IDLE_TIMEOUT must be between 100 and 30000 ms"
 #    endif
 
+#    ifdef SEQUENCE_DEFERRED_TIMEOUT
+#        ifndef DEFERRED_EXEC_ENABLE
+#            error "SEQUENCE_DEFERRED_TIMEOUT requires DEFERRED_EXEC_ENABLE"
+#        endif
+#        include "deferred_exec.h"
+
+/** @brief Deferred executor deadline standing in for the idle timer poll. */
+static deferred_token idle_timeout_token = INVALID_DEFERRED_TOKEN;
+
+static uint32_t caps_word_idle_callback(uint32_t trigger_time, void *cb_arg) {
+    idle_timeout_token = INVALID_DEFERRED_TOKEN;
+    caps_word_off();
+    return 0;
+}
+
+void caps_word_task(void) {}
+
+void caps_word_reset_idle_timer(void) {
+    if (!extend_deferred_exec(idle_timeout_token, CAPS_WORD_IDLE_TIMEOUT)) {
+        idle_timeout_token = defer_exec(CAPS_WORD_IDLE_TIMEOUT, caps_word_idle_callback, NULL);
+    }
+}
+#    else
 /** @brief Deadline for idle timeout. */
 static uint16_t idle_timer = 0;
 
@@ -40,6 +63,7 @@ void caps_word_task(void) {
 void caps_word_reset_idle_timer(void) {
     idle_timer = timer_read() + CAPS_WORD_IDLE_TIMEOUT;
 }
+#    endif // SEQUENCE_DEFERRED_TIMEOUT
 #else
 void caps_word_task(void) {}
 #endif // CAPS_WORD_IDLE_TIMEOUT > 0
@@ -68,6 +92,10 @@ void caps_word_off(void) {
 
     unregister_weak_mods(MOD_MASK_SHIFT); // Make sure weak shift is off.
     caps_word_active = false;
+#if CAPS_WORD_IDLE_TIMEOUT > 0 && defined(SEQUENCE_DEFERRED_TIMEOUT)
+    cancel_deferred_exec(idle_timeout_token);
+    idle_timeout_token = INVALID_DEFERRED_TOKEN;
+#endif
     caps_word_set_user(false);
 }
 
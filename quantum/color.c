@@ -18,15 +18,18 @@
 #include "led_tables.h"
 #include "progmem.h"
 
-RGB hsv_to_rgb_impl(HSV hsv, bool use_cie) {
+static RGB hsv_to_rgb_compute(HSV hsv, bool use_cie) {
     RGB      rgb;
+#ifndef HSV_TO_RGB_LUT
     uint8_t  region, remainder, p, q, t;
-    uint16_t h, s, v;
+    uint16_t h;
+#endif
+    uint16_t s, v;
 
     if (hsv.s == 0) {
 #ifdef USE_CIE1931_CURVE
         if (use_cie) {
-            rgb.r = rgb.g = rgb.b = pgm_read_byte(&CIE1931_CURVE[hsv.v]);
+            rgb.r = rgb.g = rgb.b = cie1931_curve_read(hsv.v);
         } else {
             rgb.r = hsv.v;
             rgb.g = hsv.v;
@@ -40,11 +43,13 @@ RGB hsv_to_rgb_impl(HSV hsv, bool use_cie) {
         return rgb;
     }
 
+#ifndef HSV_TO_RGB_LUT
     h = hsv.h;
+#endif
     s = hsv.s;
 #ifdef USE_CIE1931_CURVE
     if (use_cie) {
-        v = pgm_read_byte(&CIE1931_CURVE[hsv.v]);
+        v = cie1931_curve_read(hsv.v);
     } else {
         v = hsv.v;
     }
@@ -52,6 +57,18 @@ RGB hsv_to_rgb_impl(HSV hsv, bool use_cie) {
     v = hsv.v;
 #endif
 
+#ifdef HSV_TO_RGB_LUT
+    // Table-driven conversion: look up the pure hue, blend toward white by
+    // saturation, scale by value. Two multiplies per channel, no sextant
+    // arithmetic; the divisions by 255 reduce to multiply-and-shift.
+    uint16_t s_comp = 255 - s;
+
+    rgb.r = (uint8_t)(((((uint16_t)hue_rgb_table_read(hsv.h, 0) * s) / 255 + s_comp) * v) / 255);
+    rgb.g = (uint8_t)(((((uint16_t)hue_rgb_table_read(hsv.h, 1) * s) / 255 + s_comp) * v) / 255);
+    rgb.b = (uint8_t)(((((uint16_t)hue_rgb_table_read(hsv.h, 2) * s) / 255 + s_comp) * v) / 255);
+
+    return rgb;
+#else
     region    = h * 6 / 255;
     remainder = (h * 2 - region * 85) * 3;
 
@@ -94,6 +111,31 @@ RGB hsv_to_rgb_impl(HSV hsv, bool use_cie) {
     }
 
     return rgb;
+#endif
+}
+
+RGB hsv_to_rgb_impl(HSV hsv, bool use_cie) {
+#ifdef HSV_TO_RGB_CACHE
+    // Effects tend to convert one HSV for a whole frame (solid colors,
+    // breathing, band effects), and rgblight and rgb_matrix share this
+    // path, so a single-entry memo elides most conversions per frame.
+    static HSV  last_hsv;
+    static RGB  last_rgb;
+    static bool last_use_cie;
+    static bool cache_valid = false;
+
+    if (cache_valid && use_cie == last_use_cie && hsv.h == last_hsv.h && hsv.s == last_hsv.s && hsv.v == last_hsv.v) {
+        return last_rgb;
+    }
+
+    last_hsv     = hsv;
+    last_use_cie = use_cie;
+    last_rgb     = hsv_to_rgb_compute(hsv, use_cie);
+    cache_valid  = true;
+    return last_rgb;
+#else
+    return hsv_to_rgb_compute(hsv, use_cie);
+#endif
 }
 
 RGB hsv_to_rgb(HSV hsv) {
@@ -6,11 +6,15 @@
  * @param raw The current key state
  * @param cooked The debounced key state
  * @param num_rows Number of rows to debounce
- * @param changed True if raw has changed since the last call
+ * @param changed_rows Bitmask of rows (see `matrix_row_mask()`) whose raw
+ *                     value changed since the last call; zero if nothing
+ *                     changed. Algorithms may use this to skip untouched
+ *                     rows. Callers without per-row information may pass
+ *                     `MATRIX_ROW_MASK_ALL` for "something changed".
  * @return true Cooked has new keychanges after debouncing
  * @return false Cooked is the same as before
  */
-bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed);
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, matrix_row_mask_t changed_rows);
 
 void debounce_init(uint8_t num_rows);
 
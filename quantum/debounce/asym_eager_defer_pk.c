@@ -56,15 +56,19 @@ static fast_timer_t        last_time;
 static bool                counters_need_update;
 static bool                matrix_need_update;
 static bool                cooked_changed;
+static matrix_row_mask_t   pending_rows;  // rows that may hold running counters
+static matrix_row_mask_t   transfer_rows; // rows with expired eager counters awaiting transfer
 
 #    define DEBOUNCE_ELAPSED 0
 
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
-static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, matrix_row_mask_t changed_rows);
 
 // we use num_rows rather than MATRIX_ROWS to support split keyboards
 void debounce_init(uint8_t num_rows) {
     debounce_counters = malloc(num_rows * MATRIX_COLS * sizeof(debounce_counter_t));
+    pending_rows      = 0;
+    transfer_rows     = 0;
     int i             = 0;
     for (uint8_t r = 0; r < num_rows; r++) {
         for (uint8_t c = 0; c < MATRIX_COLS; c++) {
@@ -78,7 +82,7 @@ void debounce_free(void) {
     debounce_counters = NULL;
 }
 
-bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, matrix_row_mask_t changed_rows) {
     bool updated_last = false;
     cooked_changed    = false;
 
@@ -97,12 +101,12 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
         }
     }
 
-    if (changed || matrix_need_update) {
+    if (changed_rows || matrix_need_update) {
         if (!updated_last) {
             last_time = timer_read_fast();
         }
 
-        transfer_matrix_values(raw, cooked, num_rows);
+        transfer_matrix_values(raw, cooked, num_rows, changed_rows);
     }
 
     return cooked_changed;
@@ -110,21 +114,29 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
     debounce_counter_t *debounce_pointer = debounce_counters;
+    matrix_row_mask_t   still_pending    = 0;
 
     counters_need_update = false;
     matrix_need_update   = false;
 
-    for (uint8_t row = 0; row < num_rows; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+    for (uint8_t row = 0; row < num_rows; row++, debounce_pointer += MATRIX_COLS) {
+        // Rows without running counters have nothing to tick down
+        if (!(pending_rows & matrix_row_mask(row))) {
+            continue;
+        }
+
+        debounce_counter_t *counter = debounce_pointer;
+        for (uint8_t col = 0; col < MATRIX_COLS; col++, counter++) {
             matrix_row_t col_mask = (ROW_SHIFTER << col);
 
-            if (debounce_pointer->time != DEBOUNCE_ELAPSED) {
-                if (debounce_pointer->time <= elapsed_time) {
-                    debounce_pointer->time = DEBOUNCE_ELAPSED;
+            if (counter->time != DEBOUNCE_ELAPSED) {
+                if (counter->time <= elapsed_time) {
+                    counter->time = DEBOUNCE_ELAPSED;
 
-                    if (debounce_pointer->pressed) {
+                    if (counter->pressed) {
                         // key-down: eager
                         matrix_need_update = true;
+                        transfer_rows |= matrix_row_mask(row);
                     } else {
                         // key-up: defer
                         matrix_row_t cooked_next = (cooked[row] & ~col_mask) | (raw[row] & col_mask);
@@ -132,42 +144,52 @@ static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[],
                         cooked[row] = cooked_next;
                     }
                 } else {
-                    debounce_pointer->time -= elapsed_time;
+                    counter->time -= elapsed_time;
                     counters_need_update = true;
+                    still_pending |= matrix_row_mask(row);
                 }
             }
-            debounce_pointer++;
         }
     }
+    pending_rows = still_pending;
 }
 
-static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, matrix_row_mask_t changed_rows) {
+    matrix_row_mask_t   dirty_rows       = changed_rows | transfer_rows;
     debounce_counter_t *debounce_pointer = debounce_counters;
 
-    for (uint8_t row = 0; row < num_rows; row++) {
-        matrix_row_t delta = raw[row] ^ cooked[row];
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+    transfer_rows = 0;
+
+    for (uint8_t row = 0; row < num_rows; row++, debounce_pointer += MATRIX_COLS) {
+        // Only rows with fresh raw changes or newly expired counters can differ
+        if (!(dirty_rows & matrix_row_mask(row))) {
+            continue;
+        }
+
+        matrix_row_t        delta   = raw[row] ^ cooked[row];
+        debounce_counter_t *counter = debounce_pointer;
+        for (uint8_t col = 0; col < MATRIX_COLS; col++, counter++) {
             matrix_row_t col_mask = (ROW_SHIFTER << col);
 
             if (delta & col_mask) {
-                if (debounce_pointer->time == DEBOUNCE_ELAPSED) {
-                    debounce_pointer->pressed = (raw[row] & col_mask);
-                    debounce_pointer->time    = DEBOUNCE;
-                    counters_need_update      = true;
+                if (counter->time == DEBOUNCE_ELAPSED) {
+                    counter->pressed     = (raw[row] & col_mask);
+                    counter->time        = DEBOUNCE;
+                    counters_need_update = true;
+                    pending_rows |= matrix_row_mask(row);
 
-                    if (debounce_pointer->pressed) {
+                    if (counter->pressed) {
                         // key-down: eager
                         cooked[row] ^= col_mask;
                         cooked_changed = true;
                     }
                 }
-            } else if (debounce_pointer->time != DEBOUNCE_ELAPSED) {
-                if (!debounce_pointer->pressed) {
+            } else if (counter->time != DEBOUNCE_ELAPSED) {
+                if (!counter->pressed) {
                     // key-up: defer
-                    debounce_pointer->time = DEBOUNCE_ELAPSED;
+                    counter->time = DEBOUNCE_ELAPSED;
                 }
             }
-            debounce_pointer++;
         }
     }
 }
@@ -0,0 +1,218 @@
+/*
+ * Copyright 2017 Alex Ong <the.onga@gmail.com>
+ * Copyright 2020 Andrei Purdea <andrei@purdea.ro>
+ * Copyright 2021 Simon Arlott
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+Mixed per-key algorithm: each key runs either sym_eager_pk or sym_defer_pk,
+selected by a per-row bitmask. Keys in the mask report both edges
+immediately and then ignore changes for DEBOUNCE milliseconds; keys outside
+it report only after the state has been stable for DEBOUNCE milliseconds.
+One 8-bit counter per key serves both behaviors.
+
+Override debounce_eager_mask() to choose the eager keys; the default
+debounces every key symmetrically deferred. On split keyboards the row
+index is local to the half being debounced.
+*/
+
+#include "matrix.h"
+#include "timer.h"
+#include "quantum.h"
+#include <stdlib.h>
+
+#ifdef PROTOCOL_CHIBIOS
+#    if CH_CFG_USE_MEMCORE == FALSE
+#        error ChibiOS is configured without a memory allocator. Your keyboard may have set `#define CH_CFG_USE_MEMCORE FALSE`, which is incompatible with this debounce algorithm.
+#    endif
+#endif
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+#define ROW_SHIFTER ((matrix_row_t)1)
+
+typedef uint8_t debounce_counter_t;
+
+__attribute__((weak)) matrix_row_t debounce_eager_mask(uint8_t row) {
+    return 0;
+}
+
+static inline matrix_row_t effective_eager_mask(uint8_t row) {
+#ifdef GAME_MODE_ENABLE
+    // Game mode: every key reports both edges immediately.
+    if (game_mode_is_active()) {
+        return ~(matrix_row_t)0;
+    }
+#endif
+    return debounce_eager_mask(row);
+}
+
+#if DEBOUNCE > 0
+static debounce_counter_t *debounce_counters;
+static fast_timer_t        last_time;
+static bool                counters_need_update;
+static bool                matrix_need_update;
+static bool                cooked_changed;
+static matrix_row_mask_t   pending_rows;  // rows that may hold running counters
+static matrix_row_mask_t   transfer_rows; // rows with expired eager counters awaiting transfer
+
+#    define DEBOUNCE_ELAPSED 0
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
+static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, matrix_row_mask_t changed_rows);
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    debounce_counters = (debounce_counter_t *)malloc(num_rows * MATRIX_COLS * sizeof(debounce_counter_t));
+    pending_rows      = 0;
+    transfer_rows     = 0;
+    int i             = 0;
+    for (uint8_t r = 0; r < num_rows; r++) {
+        for (uint8_t c = 0; c < MATRIX_COLS; c++) {
+            debounce_counters[i++] = DEBOUNCE_ELAPSED;
+        }
+    }
+}
+
+void debounce_free(void) {
+    free(debounce_counters);
+    debounce_counters = NULL;
+}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, matrix_row_mask_t changed_rows) {
+    bool updated_last = false;
+    cooked_changed    = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        if (elapsed_time > UINT8_MAX) {
+            elapsed_time = UINT8_MAX;
+        }
+
+        if (elapsed_time > 0) {
+            update_debounce_counters_and_transfer_if_expired(raw, cooked, num_rows, elapsed_time);
+        }
+    }
+
+    if (changed_rows || matrix_need_update) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        transfer_matrix_values(raw, cooked, num_rows, changed_rows);
+    }
+
+    return cooked_changed;
+}
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
+    debounce_counter_t *debounce_pointer = debounce_counters;
+    matrix_row_mask_t   still_pending    = 0;
+
+    counters_need_update = false;
+    matrix_need_update   = false;
+
+    for (uint8_t row = 0; row < num_rows; row++, debounce_pointer += MATRIX_COLS) {
+        // Rows without running counters have nothing to tick down
+        if (!(pending_rows & matrix_row_mask(row))) {
+            continue;
+        }
+
+        matrix_row_t        eager   = effective_eager_mask(row);
+        debounce_counter_t *counter = debounce_pointer;
+        for (uint8_t col = 0; col < MATRIX_COLS; col++, counter++) {
+            matrix_row_t col_mask = (ROW_SHIFTER << col);
+
+            if (*counter != DEBOUNCE_ELAPSED) {
+                if (*counter <= elapsed_time) {
+                    *counter = DEBOUNCE_ELAPSED;
+
+                    if (eager & col_mask) {
+                        // eager key: hold-off over, look for changes missed during it
+                        matrix_need_update = true;
+                        transfer_rows |= matrix_row_mask(row);
+                    } else {
+                        // deferred key: state was stable, push it
+                        matrix_row_t cooked_next = (cooked[row] & ~col_mask) | (raw[row] & col_mask);
+                        cooked_changed |= cooked_next ^ cooked[row];
+                        cooked[row] = cooked_next;
+                    }
+                } else {
+                    *counter -= elapsed_time;
+                    counters_need_update = true;
+                    still_pending |= matrix_row_mask(row);
+                }
+            }
+        }
+    }
+    pending_rows = still_pending;
+}
+
+static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, matrix_row_mask_t changed_rows) {
+    matrix_row_mask_t   dirty_rows       = changed_rows | transfer_rows;
+    debounce_counter_t *debounce_pointer = debounce_counters;
+
+    transfer_rows = 0;
+
+    for (uint8_t row = 0; row < num_rows; row++, debounce_pointer += MATRIX_COLS) {
+        // Only rows with fresh raw changes or newly expired counters can differ
+        if (!(dirty_rows & matrix_row_mask(row))) {
+            continue;
+        }
+
+        matrix_row_t        eager   = effective_eager_mask(row);
+        matrix_row_t        delta   = raw[row] ^ cooked[row];
+        debounce_counter_t *counter = debounce_pointer;
+        for (uint8_t col = 0; col < MATRIX_COLS; col++, counter++) {
+            matrix_row_t col_mask = (ROW_SHIFTER << col);
+
+            if (delta & col_mask) {
+                if (*counter == DEBOUNCE_ELAPSED) {
+                    *counter             = DEBOUNCE;
+                    counters_need_update = true;
+                    pending_rows |= matrix_row_mask(row);
+
+                    if (eager & col_mask) {
+                        // eager key: push the edge, the counter just blanks repeats
+                        cooked[row] ^= col_mask;
+                        cooked_changed = true;
+                    }
+                }
+            } else if (*counter != DEBOUNCE_ELAPSED) {
+                if (!(eager & col_mask)) {
+                    // deferred key: state returned before the counter expired
+                    *counter = DEBOUNCE_ELAPSED;
+                }
+            }
+        }
+    }
+}
+
+#else
+#    include "none.c"
+#endif
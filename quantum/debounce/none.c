@@ -21,7 +21,7 @@
 
 void debounce_init(uint8_t num_rows) {}
 
-bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, matrix_row_mask_t changed_rows) {
     bool cooked_changed = memcmp(raw, cooked, sizeof(matrix_row_t) * num_rows) != 0;
 
     memcpy(cooked, raw, sizeof(matrix_row_t) * num_rows);
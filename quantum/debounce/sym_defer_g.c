@@ -31,10 +31,10 @@ static fast_timer_t debouncing_time;
 
 void debounce_init(uint8_t num_rows) {}
 
-bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, matrix_row_mask_t changed_rows) {
     bool cooked_changed = false;
 
-    if (changed) {
+    if (changed_rows) {
         debouncing      = true;
         debouncing_time = timer_read_fast();
     }
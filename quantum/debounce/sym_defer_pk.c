@@ -49,15 +49,17 @@ static debounce_counter_t *debounce_counters;
 static fast_timer_t        last_time;
 static bool                counters_need_update;
 static bool                cooked_changed;
+static matrix_row_mask_t   pending_rows; // rows that may hold running counters
 
 #    define DEBOUNCE_ELAPSED 0
 
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
-static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, matrix_row_mask_t changed_rows);
 
 // we use num_rows rather than MATRIX_ROWS to support split keyboards
 void debounce_init(uint8_t num_rows) {
     debounce_counters = (debounce_counter_t *)malloc(num_rows * MATRIX_COLS * sizeof(debounce_counter_t));
+    pending_rows      = 0;
     int i             = 0;
     for (uint8_t r = 0; r < num_rows; r++) {
         for (uint8_t c = 0; c < MATRIX_COLS; c++) {
@@ -71,7 +73,7 @@ void debounce_free(void) {
     debounce_counters = NULL;
 }
 
-bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, matrix_row_mask_t changed_rows) {
     bool updated_last = false;
     cooked_changed    = false;
 
@@ -90,12 +92,12 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
         }
     }
 
-    if (changed) {
+    if (changed_rows) {
         if (!updated_last) {
             last_time = timer_read_fast();
         }
 
-        start_debounce_counters(raw, cooked, num_rows);
+        start_debounce_counters(raw, cooked, num_rows, changed_rows);
     }
 
     return cooked_changed;
@@ -103,39 +105,55 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
     counters_need_update                 = false;
+    matrix_row_mask_t   still_pending    = 0;
     debounce_counter_t *debounce_pointer = debounce_counters;
-    for (uint8_t row = 0; row < num_rows; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-            if (*debounce_pointer != DEBOUNCE_ELAPSED) {
-                if (*debounce_pointer <= elapsed_time) {
-                    *debounce_pointer        = DEBOUNCE_ELAPSED;
+    for (uint8_t row = 0; row < num_rows; row++, debounce_pointer += MATRIX_COLS) {
+        // Rows without running counters have nothing to tick down
+        if (!(pending_rows & matrix_row_mask(row))) {
+            continue;
+        }
+
+        debounce_counter_t *counter = debounce_pointer;
+        for (uint8_t col = 0; col < MATRIX_COLS; col++, counter++) {
+            if (*counter != DEBOUNCE_ELAPSED) {
+                if (*counter <= elapsed_time) {
+                    *counter                 = DEBOUNCE_ELAPSED;
                     matrix_row_t cooked_next = (cooked[row] & ~(ROW_SHIFTER << col)) | (raw[row] & (ROW_SHIFTER << col));
                     cooked_changed |= cooked[row] ^ cooked_next;
                     cooked[row] = cooked_next;
                 } else {
-                    *debounce_pointer -= elapsed_time;
+                    *counter -= elapsed_time;
                     counters_need_update = true;
+                    still_pending |= matrix_row_mask(row);
                 }
             }
-            debounce_pointer++;
         }
     }
+    // Every row with its bit set was just examined, so this drops only rows
+    // that no longer hold running counters.
+    pending_rows = still_pending;
 }
 
-static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, matrix_row_mask_t changed_rows) {
     debounce_counter_t *debounce_pointer = debounce_counters;
-    for (uint8_t row = 0; row < num_rows; row++) {
-        matrix_row_t delta = raw[row] ^ cooked[row];
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+    for (uint8_t row = 0; row < num_rows; row++, debounce_pointer += MATRIX_COLS) {
+        // Only rows whose raw value changed can start or cancel counters
+        if (!(changed_rows & matrix_row_mask(row))) {
+            continue;
+        }
+
+        matrix_row_t        delta   = raw[row] ^ cooked[row];
+        debounce_counter_t *counter = debounce_pointer;
+        for (uint8_t col = 0; col < MATRIX_COLS; col++, counter++) {
             if (delta & (ROW_SHIFTER << col)) {
-                if (*debounce_pointer == DEBOUNCE_ELAPSED) {
-                    *debounce_pointer    = DEBOUNCE;
+                if (*counter == DEBOUNCE_ELAPSED) {
+                    *counter             = DEBOUNCE;
                     counters_need_update = true;
+                    pending_rows |= matrix_row_mask(row);
                 }
             } else {
-                *debounce_pointer = DEBOUNCE_ELAPSED;
+                *counter = DEBOUNCE_ELAPSED;
             }
-            debounce_pointer++;
         }
     }
 }
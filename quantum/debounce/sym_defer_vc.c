@@ -0,0 +1,162 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+Symmetric deferred debounce using vertical counters.
+
+Per-key counters are stored as bit-planes: one matrix_row_t word per
+counter bit per row, so a whole row of counters is advanced with a
+handful of bitwise operations instead of a loop over individual keys.
+A key's state is pushed once its raw value has disagreed with the cooked
+value for DEBOUNCE consecutive milliseconds, matching sym_defer_pk's
+behaviour at O(rows * log2(DEBOUNCE)) cost instead of O(keys).
+*/
+
+#include "matrix.h"
+#include "timer.h"
+#include "quantum.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef PROTOCOL_CHIBIOS
+#    if CH_CFG_USE_MEMCORE == FALSE
+#        error ChibiOS is configured without a memory allocator. Your keyboard may have set `#define CH_CFG_USE_MEMCORE FALSE`, which is incompatible with this debounce algorithm.
+#    endif
+#endif
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+#if DEBOUNCE > 0
+
+// Number of counter bit-planes needed to count up to DEBOUNCE
+#    if DEBOUNCE < 2
+#        define COUNTER_BITS 1
+#    elif DEBOUNCE < 4
+#        define COUNTER_BITS 2
+#    elif DEBOUNCE < 8
+#        define COUNTER_BITS 3
+#    elif DEBOUNCE < 16
+#        define COUNTER_BITS 4
+#    elif DEBOUNCE < 32
+#        define COUNTER_BITS 5
+#    elif DEBOUNCE < 64
+#        define COUNTER_BITS 6
+#    elif DEBOUNCE < 128
+#        define COUNTER_BITS 7
+#    else
+#        define COUNTER_BITS 8
+#    endif
+
+typedef struct {
+    matrix_row_t planes[COUNTER_BITS]; // bit b of every counter in the row
+    matrix_row_t waiting;              // keys whose counters were running last call
+} row_counters_t;
+
+static row_counters_t *  counters;
+static fast_timer_t      last_time;
+static matrix_row_mask_t pending_rows; // rows with keys mid-debounce
+
+void debounce_init(uint8_t num_rows) {
+    counters = (row_counters_t *)malloc(num_rows * sizeof(row_counters_t));
+    memset(counters, 0, num_rows * sizeof(row_counters_t));
+    pending_rows = 0;
+}
+
+void debounce_free(void) {
+    free(counters);
+    counters = NULL;
+}
+
+// Advance the counters of all keys in `active` by one. Returns the keys
+// whose counter has reached DEBOUNCE; their counters are cleared.
+static matrix_row_t tick_row_counters(matrix_row_t planes[], matrix_row_t active) {
+    matrix_row_t carry = active;
+    for (uint8_t b = 0; b < COUNTER_BITS; b++) {
+        matrix_row_t next = planes[b] ^ carry;
+        carry             = planes[b] & carry;
+        planes[b]         = next;
+    }
+
+    // Select keys whose counter value equals DEBOUNCE
+    matrix_row_t done = active;
+    for (uint8_t b = 0; b < COUNTER_BITS; b++) {
+        done &= ((DEBOUNCE >> b) & 1) ? planes[b] : ~planes[b];
+    }
+    for (uint8_t b = 0; b < COUNTER_BITS; b++) {
+        planes[b] &= ~done;
+    }
+    return done;
+}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, matrix_row_mask_t changed_rows) {
+    bool cooked_changed = false;
+
+    matrix_row_mask_t dirty_rows = pending_rows | changed_rows;
+    if (!dirty_rows) {
+        return false;
+    }
+
+    fast_timer_t now = timer_read_fast();
+    fast_timer_t elapsed;
+    if (pending_rows) {
+        elapsed = TIMER_DIFF_FAST(now, last_time);
+        if (elapsed > DEBOUNCE) {
+            elapsed = DEBOUNCE;
+        }
+    } else {
+        // First change after a quiet period; start counting from now
+        elapsed = 0;
+    }
+    last_time = now;
+
+    matrix_row_mask_t still_pending = 0;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        if (!(dirty_rows & matrix_row_mask(row))) {
+            continue;
+        }
+
+        row_counters_t *rc    = &counters[row];
+        matrix_row_t    delta = raw[row] ^ cooked[row];
+
+        // Keys still mid-debounce; anything that reverted resets its counter
+        matrix_row_t active = rc->waiting & delta;
+        for (uint8_t b = 0; b < COUNTER_BITS; b++) {
+            rc->planes[b] &= active;
+        }
+
+        // One counter step per elapsed millisecond. Keys that changed this
+        // call are not in `active` yet, so they start counting from zero.
+        matrix_row_t done = 0;
+        for (fast_timer_t tick = 0; tick < elapsed && active; tick++) {
+            done |= tick_row_counters(rc->planes, active);
+            active &= ~done;
+        }
+
+        if (done) {
+            cooked[row] ^= done;
+            cooked_changed = true;
+            delta          = raw[row] ^ cooked[row];
+        }
+
+        rc->waiting = delta;
+        if (delta) {
+            still_pending |= matrix_row_mask(row);
+        }
+    }
+
+    pending_rows = still_pending;
+
+    return cooked_changed;
+}
+
+#else // no debouncing.
+#    include "none.c"
+#endif
@@ -50,15 +50,19 @@ static fast_timer_t        last_time;
 static bool                counters_need_update;
 static bool                matrix_need_update;
 static bool                cooked_changed;
+static matrix_row_mask_t   pending_rows;  // rows that may hold running counters
+static matrix_row_mask_t   transfer_rows; // rows with expired counters awaiting transfer
 
 #    define DEBOUNCE_ELAPSED 0
 
 static void update_debounce_counters(uint8_t num_rows, uint8_t elapsed_time);
-static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, matrix_row_mask_t changed_rows);
 
 // we use num_rows rather than MATRIX_ROWS to support split keyboards
 void debounce_init(uint8_t num_rows) {
     debounce_counters = (debounce_counter_t *)malloc(num_rows * MATRIX_COLS * sizeof(debounce_counter_t));
+    pending_rows      = 0;
+    transfer_rows     = 0;
     int i             = 0;
     for (uint8_t r = 0; r < num_rows; r++) {
         for (uint8_t c = 0; c < MATRIX_COLS; c++) {
@@ -72,7 +76,7 @@ void debounce_free(void) {
     debounce_counters = NULL;
 }
 
-bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, matrix_row_mask_t changed_rows) {
     bool updated_last = false;
     cooked_changed    = false;
 
@@ -91,12 +95,12 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
         }
     }
 
-    if (changed || matrix_need_update) {
+    if (changed_rows || matrix_need_update) {
         if (!updated_last) {
             last_time = timer_read_fast();
         }
 
-        transfer_matrix_values(raw, cooked, num_rows);
+        transfer_matrix_values(raw, cooked, num_rows, changed_rows);
     }
 
     return cooked_changed;
@@ -106,40 +110,57 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 static void update_debounce_counters(uint8_t num_rows, uint8_t elapsed_time) {
     counters_need_update                 = false;
     matrix_need_update                   = false;
+    matrix_row_mask_t   still_pending    = 0;
     debounce_counter_t *debounce_pointer = debounce_counters;
-    for (uint8_t row = 0; row < num_rows; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-            if (*debounce_pointer != DEBOUNCE_ELAPSED) {
-                if (*debounce_pointer <= elapsed_time) {
-                    *debounce_pointer  = DEBOUNCE_ELAPSED;
+    for (uint8_t row = 0; row < num_rows; row++, debounce_pointer += MATRIX_COLS) {
+        // Rows without running counters have nothing to tick down
+        if (!(pending_rows & matrix_row_mask(row))) {
+            continue;
+        }
+
+        debounce_counter_t *counter = debounce_pointer;
+        for (uint8_t col = 0; col < MATRIX_COLS; col++, counter++) {
+            if (*counter != DEBOUNCE_ELAPSED) {
+                if (*counter <= elapsed_time) {
+                    *counter           = DEBOUNCE_ELAPSED;
                     matrix_need_update = true;
+                    transfer_rows |= matrix_row_mask(row);
                 } else {
-                    *debounce_pointer -= elapsed_time;
+                    *counter -= elapsed_time;
                     counters_need_update = true;
+                    still_pending |= matrix_row_mask(row);
                 }
             }
-            debounce_pointer++;
         }
     }
+    pending_rows = still_pending;
 }
 
 // upload from raw_matrix to final matrix;
-static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, matrix_row_mask_t changed_rows) {
+    matrix_row_mask_t   dirty_rows       = changed_rows | transfer_rows;
     debounce_counter_t *debounce_pointer = debounce_counters;
-    for (uint8_t row = 0; row < num_rows; row++) {
-        matrix_row_t delta        = raw[row] ^ cooked[row];
-        matrix_row_t existing_row = cooked[row];
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+    transfer_rows                        = 0;
+    for (uint8_t row = 0; row < num_rows; row++, debounce_pointer += MATRIX_COLS) {
+        // Only rows with fresh raw changes or newly expired counters can differ
+        if (!(dirty_rows & matrix_row_mask(row))) {
+            continue;
+        }
+
+        matrix_row_t        delta        = raw[row] ^ cooked[row];
+        matrix_row_t        existing_row = cooked[row];
+        debounce_counter_t *counter      = debounce_pointer;
+        for (uint8_t col = 0; col < MATRIX_COLS; col++, counter++) {
             matrix_row_t col_mask = (ROW_SHIFTER << col);
             if (delta & col_mask) {
-                if (*debounce_pointer == DEBOUNCE_ELAPSED) {
-                    *debounce_pointer    = DEBOUNCE;
+                if (*counter == DEBOUNCE_ELAPSED) {
+                    *counter             = DEBOUNCE;
                     counters_need_update = true;
+                    pending_rows |= matrix_row_mask(row);
                     existing_row ^= col_mask; // flip the bit.
                     cooked_changed = true;
                 }
             }
-            debounce_pointer++;
         }
         cooked[row] = existing_row;
     }
@@ -60,6 +60,7 @@ void DebounceTest::runEventsInternal() {
     debounce_init(MATRIX_ROWS);
     set_time(time_offset_);
     std::fill(std::begin(input_matrix_), std::end(input_matrix_), 0);
+    std::fill(std::begin(previous_input_matrix_), std::end(previous_input_matrix_), 0);
     std::fill(std::begin(output_matrix_), std::end(output_matrix_), 0);
 
     for (auto &event : events_) {
@@ -125,7 +126,17 @@ void DebounceTest::runDebounce(bool changed) {
     std::copy(std::begin(input_matrix_), std::end(input_matrix_), std::begin(raw_matrix_));
     std::copy(std::begin(output_matrix_), std::end(output_matrix_), std::begin(cooked_matrix_));
 
-    bool cooked_changed = debounce(raw_matrix_, cooked_matrix_, MATRIX_ROWS, changed);
+    /* Build the changed-row bitmask exactly as matrix_scan() does */
+    matrix_row_mask_t changed_rows = 0;
+    for (int row = 0; row < MATRIX_ROWS; row++) {
+        if (previous_input_matrix_[row] != input_matrix_[row]) {
+            previous_input_matrix_[row] = input_matrix_[row];
+            changed_rows |= matrix_row_mask(row);
+        }
+    }
+    ASSERT_EQ(changed_rows != 0, changed) << "Test event inputs do not match the raw matrix difference at " << strTime();
+
+    bool cooked_changed = debounce(raw_matrix_, cooked_matrix_, MATRIX_ROWS, changed_rows);
 
     if (!std::equal(std::begin(input_matrix_), std::end(input_matrix_), std::begin(raw_matrix_))) {
         FAIL() << "Fatal error: debounce() modified raw matrix at " << strTime() << "\ninput_matrix: changed=" << changed << "\n" << strMatrix(input_matrix_) << "\nraw_matrix:\n" << strMatrix(raw_matrix_);
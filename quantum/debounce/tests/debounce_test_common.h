@@ -72,6 +72,7 @@ class DebounceTest : public ::testing::Test {
     std::list<DebounceTestEvent> events_;
 
     matrix_row_t input_matrix_[MATRIX_ROWS];
+    matrix_row_t previous_input_matrix_[MATRIX_ROWS];
     matrix_row_t raw_matrix_[MATRIX_ROWS];
     matrix_row_t cooked_matrix_[MATRIX_ROWS];
     matrix_row_t output_matrix_[MATRIX_ROWS];
@@ -0,0 +1,128 @@
+/* Copyright 2021 Simon Arlott
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+
+#include "debounce_test_common.h"
+
+/* Column 1 is eager on every row; all other columns are deferred. */
+extern "C" matrix_row_t debounce_eager_mask(uint8_t row) {
+    return (matrix_row_t)1 << 1;
+}
+
+TEST_F(DebounceTest, EagerKeyShort1) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {{0, 1, DOWN}}},
+        {1, {{0, 1, UP}}, {}},
+
+        {5, {}, {{0, 1, UP}}},
+        /* Press key again after 1ms delay (debounce has not yet finished) */
+        {6, {{0, 1, DOWN}}, {}},
+        {10, {}, {{0, 1, DOWN}}}, /* 5ms after UP at time 5 */
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, EagerKeyBounceDuringHoldoff) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {{0, 1, DOWN}}},
+        /* Chatter settles back to the reported state before the hold-off ends */
+        {1, {{0, 1, UP}}, {}},
+        {2, {{0, 1, DOWN}}, {}},
+
+        {5, {}, {}}, /* Hold-off over, raw agrees with cooked, nothing to do */
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, DeferKeyShort1) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 2, DOWN}}, {}},
+
+        {5, {}, {{0, 2, DOWN}}},
+        /* 0ms delay (fast scan rate) */
+        {5, {{0, 2, UP}}, {}},
+
+        {10, {}, {{0, 2, UP}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, DeferKeyBounceCancels) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 2, DOWN}}, {}},
+        /* Chatter reverts the state before the counter expires; no event */
+        {2, {{0, 2, UP}}, {}},
+
+        {10, {}, {}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, MixedSimultaneous) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        /* The eager key reports immediately, the deferred key 5ms later */
+        {0, {{0, 1, DOWN}, {0, 2, DOWN}}, {{0, 1, DOWN}}},
+
+        {5, {}, {{0, 2, DOWN}}},
+
+        {20, {{0, 1, UP}, {0, 2, UP}}, {{0, 1, UP}}},
+
+        {25, {}, {{0, 2, UP}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, MixedSimultaneousRows) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}, {2, 3, DOWN}}, {{0, 1, DOWN}}},
+
+        {5, {}, {{2, 3, DOWN}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, EagerChangeDuringHoldoff) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {{0, 1, DOWN}}},
+        /* Release during the hold-off is only seen once it expires */
+        {3, {{0, 1, UP}}, {}},
+
+        {5, {}, {{0, 1, UP}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, DeferKeyLong) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 2, DOWN}}, {}},
+
+        {5, {}, {{0, 2, DOWN}}},
+
+        {50, {{0, 2, UP}}, {}},
+
+        {55, {}, {{0, 2, UP}}},
+    });
+    runEvents();
+}
@@ -115,6 +115,30 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     return false;
 }
 
+uint32_t deferred_exec_advanced_time_until_next(deferred_executor_t *table, size_t table_count) {
+    // Ignore request if the table is not valid
+    if (!table || table_count == 0) {
+        return UINT32_MAX;
+    }
+
+    // Find the soonest deadline among the occupied slots
+    bool     found   = false;
+    uint32_t soonest = 0;
+    for (int i = 0; i < table_count; ++i) {
+        deferred_executor_t *entry = &table[i];
+        if (entry->token != INVALID_DEFERRED_TOKEN && (!found || ((int32_t)TIMER_DIFF_32(entry->trigger_time, soonest)) < 0)) {
+            found   = true;
+            soonest = entry->trigger_time;
+        }
+    }
+
+    if (!found) {
+        return UINT32_MAX;
+    }
+    int32_t diff = (int32_t)TIMER_DIFF_32(soonest, timer_read32());
+    return diff <= 0 ? 0 : (uint32_t)diff;
+}
+
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
     uint32_t now = timer_read32();
 
@@ -157,15 +181,50 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
 static uint32_t            last_deferred_exec_check                = 0;
 static deferred_executor_t basic_executors[MAX_DEFERRED_EXECUTORS] = {0};
 
+// Cached soonest deadline across basic_executors, so the per-loop task can
+// decide whether anything is due with one comparison instead of scanning the
+// whole table. Recomputed on every mutation and after each execution pass.
+static bool     basic_exec_pending    = false;
+static uint32_t basic_soonest_trigger = 0;
+
+static void recompute_basic_soonest(void) {
+    basic_exec_pending = false;
+    for (int i = 0; i < MAX_DEFERRED_EXECUTORS; ++i) {
+        deferred_executor_t *entry = &basic_executors[i];
+        if (entry->token != INVALID_DEFERRED_TOKEN && (!basic_exec_pending || ((int32_t)TIMER_DIFF_32(entry->trigger_time, basic_soonest_trigger)) < 0)) {
+            basic_exec_pending    = true;
+            basic_soonest_trigger = entry->trigger_time;
+        }
+    }
+}
+
 deferred_token defer_exec(uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
-    return defer_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, delay_ms, callback, cb_arg);
+    deferred_token token = defer_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, delay_ms, callback, cb_arg);
+    recompute_basic_soonest();
+    return token;
 }
 bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
-    return extend_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token, delay_ms);
+    bool okay = extend_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token, delay_ms);
+    recompute_basic_soonest();
+    return okay;
 }
 bool cancel_deferred_exec(deferred_token token) {
-    return cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
+    bool okay = cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
+    recompute_basic_soonest();
+    return okay;
+}
+uint32_t deferred_exec_time_until_next(void) {
+    if (!basic_exec_pending) {
+        return UINT32_MAX;
+    }
+    int32_t diff = (int32_t)TIMER_DIFF_32(basic_soonest_trigger, timer_read32());
+    return diff <= 0 ? 0 : (uint32_t)diff;
 }
 void deferred_exec_task(void) {
+    // Skip the table scan entirely until the soonest deadline is actually due
+    if (!basic_exec_pending || ((int32_t)TIMER_DIFF_32(timer_read32(), basic_soonest_trigger)) < 0) {
+        return;
+    }
     deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
+    recompute_basic_soonest();
 }
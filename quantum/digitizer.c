@@ -15,6 +15,16 @@
  */
 
 #include "digitizer.h"
+#include "timer.h"
+
+// Minimum spacing between reports. Burst updates from a touch surface
+// coalesce latest-wins into digitizer_state while a send is pending, so a
+// fast swipe costs at most one report per interval instead of flooding the
+// endpoint; digitizer_task() sends the pending state once the interval
+// expires.
+#ifndef DIGITIZER_TASK_THROTTLE_MS
+#    define DIGITIZER_TASK_THROTTLE_MS 1
+#endif
 
 digitizer_t digitizer_state = {
     .in_range = false,
@@ -25,13 +35,98 @@ digitizer_t digitizer_state = {
     .dirty    = false,
 };
 
+static uint32_t digitizer_last_send = 0;
+
+#ifdef DIGITIZER_INTERPOLATE
+/* Upsampling stage: cheap touch sensors deliver 60-100Hz, which reaches the
+ * host as visible steps. Each new sample becomes the target of a linear ramp
+ * from wherever the output currently is, replayed at the task throttle rate
+ * over one measured sensor interval - so added latency is bounded to a
+ * single sensor interval and the output stays continuous under arrival
+ * jitter. Positions interpolate in Q16 fixed point with a Q8 ramp fraction;
+ * floats are only touched once per sensor sample and once per emitted
+ * report. */
+#    ifndef DIGITIZER_INTERPOLATE_MAX_INTERVAL_MS
+#        define DIGITIZER_INTERPOLATE_MAX_INTERVAL_MS 50
+#    endif
+
+typedef struct {
+    int32_t x;
+    int32_t y;
+} digitizer_q16_t;
+
+static digitizer_q16_t interp_from;        // ramp start: the output when the sample arrived
+static digitizer_q16_t interp_to;          // ramp target: the latest sensor sample
+static digitizer_q16_t interp_out;         // currently emitted position
+static uint32_t        interp_sampled  = 0; // arrival time of interp_to
+static uint16_t        interp_interval = 0; // measured sensor interval in ms, 0 = no ramp
+static bool            interp_tracking = false;
+
+static inline int32_t interp_q16(float v) {
+    return (int32_t)(v * 65536.0f);
+}
+
+static void digitizer_interpolate_push(float x, float y) {
+    digitizer_q16_t sample = {interp_q16(x), interp_q16(y)};
+    uint32_t        since  = timer_elapsed32(interp_sampled);
+
+    if (!interp_tracking || since > DIGITIZER_INTERPOLATE_MAX_INTERVAL_MS) {
+        // First contact, or the stream went stale: jump straight there.
+        interp_from     = sample;
+        interp_out      = sample;
+        interp_interval = 0;
+        digitizer_state.x     = x;
+        digitizer_state.y     = y;
+        digitizer_state.dirty = true;
+        digitizer_flush();
+    } else {
+        interp_from     = interp_out;
+        interp_interval = (uint16_t)(since ? since : 1);
+    }
+    interp_to       = sample;
+    interp_sampled  = timer_read32();
+    interp_tracking = true;
+}
+
+static void digitizer_interpolate_step(void) {
+    if (interp_interval == 0) {
+        return;
+    }
+    uint32_t elapsed = timer_elapsed32(interp_sampled);
+    // Q8 fraction of the way through the ramp; delta * fraction fits 32 bits.
+    int32_t frac = (elapsed >= interp_interval) ? 256 : (int32_t)((elapsed << 8) / interp_interval);
+    if (frac == 256) {
+        interp_interval = 0; // ramp complete; hold at the sample
+    }
+
+    digitizer_q16_t next = {
+        interp_from.x + (((interp_to.x - interp_from.x) * frac) >> 8),
+        interp_from.y + (((interp_to.y - interp_from.y) * frac) >> 8),
+    };
+    if (next.x != interp_out.x || next.y != interp_out.y) {
+        interp_out            = next;
+        digitizer_state.x     = (float)interp_out.x / 65536.0f;
+        digitizer_state.y     = (float)interp_out.y / 65536.0f;
+        digitizer_state.dirty = true;
+    }
+}
+#endif // DIGITIZER_INTERPOLATE
+
 void digitizer_flush(void) {
-    if (digitizer_state.dirty) {
+    if (digitizer_state.dirty && timer_elapsed32(digitizer_last_send) >= DIGITIZER_TASK_THROTTLE_MS) {
         host_digitizer_send(&digitizer_state);
         digitizer_state.dirty = false;
+        digitizer_last_send   = timer_read32();
     }
 }
 
+void digitizer_task(void) {
+#ifdef DIGITIZER_INTERPOLATE
+    digitizer_interpolate_step();
+#endif
+    digitizer_flush();
+}
+
 void digitizer_in_range_on(void) {
     digitizer_state.in_range = true;
     digitizer_state.dirty    = true;
@@ -69,8 +164,12 @@ void digitizer_barrel_switch_off(void) {
 }
 
 void digitizer_set_position(float x, float y) {
+#ifdef DIGITIZER_INTERPOLATE
+    digitizer_interpolate_push(x, y);
+#else
     digitizer_state.x     = x;
     digitizer_state.y     = y;
     digitizer_state.dirty = true;
     digitizer_flush();
+#endif
 }
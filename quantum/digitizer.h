@@ -43,6 +43,9 @@ extern digitizer_t digitizer_state;
  */
 void digitizer_flush(void);
 
+/* Sends any coalesced state once the throttle interval has expired. */
+void digitizer_task(void);
+
 /**
  * \brief Assert the "in range" indicator, and flush the report.
  */
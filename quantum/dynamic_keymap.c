@@ -14,11 +14,16 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
 #include "keymap.h" // to get keymaps[][][]
 #include "eeprom.h"
 #include "progmem.h" // to read default from flash
 #include "quantum.h" // for send_string()
 #include "dynamic_keymap.h"
+#include "keymap_introspection.h"
+#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_LAYER_INDICATOR_MAP)
+#    include "rgb_matrix.h"
+#endif
 
 #ifdef VIA_ENABLE
 #    include "via.h" // for VIA_EEPROM_CONFIG_END
@@ -102,6 +107,36 @@ uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
 
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+// Opt-in RAM mirror of the keymap (and encoder map) region. Keycode lookups happen on
+// every key event, and on external I2C EEPROM each one is a bus transaction; targets
+// with the spare RAM can serve all reads from the mirror instead. Writes still go
+// through eeprom_update_byte() so the EEPROM stays authoritative across reboots.
+// The macro region is not mirrored -- macro playback is rare and buffer-oriented.
+
+#    define DYNAMIC_KEYMAP_RAM_CACHE_KEYMAP_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+#    ifdef ENCODER_MAP_ENABLE
+#        define DYNAMIC_KEYMAP_RAM_CACHE_ENCODER_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * NUM_ENCODERS * 2 * 2)
+#    endif
+
+static uint8_t keymap_mirror[DYNAMIC_KEYMAP_RAM_CACHE_KEYMAP_SIZE];
+#    ifdef ENCODER_MAP_ENABLE
+static uint8_t encoder_mirror[DYNAMIC_KEYMAP_RAM_CACHE_ENCODER_SIZE];
+#    endif
+static bool mirror_loaded = false;
+
+static void ram_cache_ensure(void) {
+    if (mirror_loaded) {
+        return;
+    }
+    eeprom_read_block(keymap_mirror, (void *)DYNAMIC_KEYMAP_EEPROM_ADDR, DYNAMIC_KEYMAP_RAM_CACHE_KEYMAP_SIZE);
+#    ifdef ENCODER_MAP_ENABLE
+    eeprom_read_block(encoder_mirror, (void *)DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR, DYNAMIC_KEYMAP_RAM_CACHE_ENCODER_SIZE);
+#    endif
+    mirror_loaded = true;
+}
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
+
 void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t column) {
     // TODO: optimize this with some left shifts
     return ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + (layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2);
@@ -110,10 +145,16 @@ void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t c
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    ram_cache_ensure();
+    uint16_t mirror_offset = (uint16_t)((uintptr_t)address - DYNAMIC_KEYMAP_EEPROM_ADDR);
+    return (keymap_mirror[mirror_offset] << 8) | keymap_mirror[mirror_offset + 1];
+#else
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = eeprom_read_byte(address) << 8;
     keycode |= eeprom_read_byte(address + 1);
     return keycode;
+#endif
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
@@ -122,6 +163,29 @@ void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address, (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    ram_cache_ensure();
+    uint16_t mirror_offset           = (uint16_t)((uintptr_t)address - DYNAMIC_KEYMAP_EEPROM_ADDR);
+    keymap_mirror[mirror_offset]     = (uint8_t)(keycode >> 8);
+    keymap_mirror[mirror_offset + 1] = (uint8_t)(keycode & 0xFF);
+#endif
+#ifdef LAYER_FALLTHROUGH_CACHE_ENABLE
+    keymap_layer_fallthrough_invalidate();
+#endif
+#ifdef MATRIX_HAS_GHOST
+    matrix_ghost_masks_invalidate();
+#endif
+#if defined(POINTING_DEVICE_AUTO_MOUSE_ENABLE) && defined(AUTO_MOUSE_KEYCLASS_CACHE)
+    auto_mouse_keyclass_cache_invalidate();
+#endif
+#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_LAYER_INDICATOR_MAP)
+    keymap_layer_led_map_invalidate();
+    rgb_matrix_layer_indicators_invalidate();
+#endif
+#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_INDICATOR_RULES)
+    keymap_indicator_rule_led_map_invalidate();
+    rgb_matrix_indicator_rules_invalidate();
+#endif
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -132,10 +196,16 @@ void *dynamic_keymap_encoder_to_eeprom_address(uint8_t layer, uint8_t encoder_id
 uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
+#    ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    ram_cache_ensure();
+    uint16_t mirror_offset = (uint16_t)((uintptr_t)address - DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR) + (clockwise ? 0 : 2);
+    return (encoder_mirror[mirror_offset] << 8) | encoder_mirror[mirror_offset + 1];
+#    else
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = ((uint16_t)eeprom_read_byte(address + (clockwise ? 0 : 2))) << 8;
     keycode |= eeprom_read_byte(address + (clockwise ? 0 : 2) + 1);
     return keycode;
+#    endif
 }
 
 void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
@@ -144,6 +214,12 @@ void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwis
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address + (clockwise ? 0 : 2), (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + (clockwise ? 0 : 2) + 1, (uint8_t)(keycode & 0xFF));
+#    ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    ram_cache_ensure();
+    uint16_t mirror_offset            = (uint16_t)((uintptr_t)address - DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR) + (clockwise ? 0 : 2);
+    encoder_mirror[mirror_offset]     = (uint8_t)(keycode >> 8);
+    encoder_mirror[mirror_offset + 1] = (uint8_t)(keycode & 0xFF);
+#    endif
 }
 #endif // ENCODER_MAP_ENABLE
 
@@ -173,32 +249,43 @@ void dynamic_keymap_reset(void) {
     }
 }
 
+// Clamp an [offset, offset+size) window to the number of bytes actually
+// backed by storage, so buffer transfers can run as one block operation on
+// the in-range prefix instead of a bounds check per byte. On external I2C/SPI
+// EEPROMs a block transfer is a handful of page-sized bus transactions where
+// the byte loop was one transaction per byte.
+static uint16_t clamp_transfer_size(uint16_t offset, uint16_t size, uint16_t storage_size) {
+    if (offset >= storage_size) {
+        return 0;
+    }
+    uint16_t available = storage_size - offset;
+    return (size < available) ? size : available;
+}
+
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *target                     = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
-        }
-        source++;
-        target++;
+    uint16_t valid                      = clamp_transfer_size(offset, size, dynamic_keymap_eeprom_size);
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    ram_cache_ensure();
+    memcpy(data, &keymap_mirror[offset], valid);
+#else
+    if (valid > 0) {
+        eeprom_read_block(data, (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset), valid);
     }
+#endif
+    memset(data + valid, 0x00, size - valid);
 }
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   target                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *source                     = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
-            eeprom_update_byte(target, *source);
-        }
-        source++;
-        target++;
+    uint16_t valid                      = clamp_transfer_size(offset, size, dynamic_keymap_eeprom_size);
+    if (valid > 0) {
+        eeprom_update_block(data, (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset), valid);
     }
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    ram_cache_ensure();
+    memcpy(&keymap_mirror[offset], data, valid);
+#endif
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -226,37 +313,32 @@ uint16_t dynamic_keymap_macro_get_buffer_size(void) {
 }
 
 void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   source = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *target = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
-        }
-        source++;
-        target++;
+    uint16_t valid = clamp_transfer_size(offset, size, DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
+    if (valid > 0) {
+        eeprom_read_block(data, (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset), valid);
     }
+    memset(data + valid, 0x00, size - valid);
 }
 
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   target = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *source = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            eeprom_update_byte(target, *source);
-        }
-        source++;
-        target++;
+    uint16_t valid = clamp_transfer_size(offset, size, DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
+    if (valid > 0) {
+        eeprom_update_block(data, (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset), valid);
     }
 }
 
 void dynamic_keymap_macro_reset(void) {
-    void *p   = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR);
-    void *end = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
-    while (p != end) {
-        eeprom_update_byte(p, 0);
-        ++p;
+    // Zero the buffer in block-sized strides; one eeprom_update_block per
+    // stride rather than one update per byte.
+    uint8_t zeroes[32];
+    memset(zeroes, 0, sizeof(zeroes));
+    uint16_t remaining = DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE;
+    void *   p         = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR);
+    while (remaining > 0) {
+        uint16_t stride = (remaining < sizeof(zeroes)) ? remaining : sizeof(zeroes);
+        eeprom_update_block(zeroes, p, stride);
+        p = (uint8_t *)p + stride;
+        remaining -= stride;
     }
 }
 
@@ -19,6 +19,59 @@ void via_eeprom_set_valid(bool valid);
 void eeconfig_init_via(void);
 #endif
 
+#ifdef EECONFIG_BOOT_CACHE
+/* Boot-time image of the core eeconfig block, filled by one block read
+ * instead of the dozen scattered byte/word reads the init path would
+ * otherwise issue (each a full transaction on external EEPROMs). The cache
+ * only serves reads between eeconfig_boot_cache_load() in keyboard_init()
+ * and eeconfig_boot_cache_release() on the first housekeeping cycle, which
+ * re-validates the signature against the EEPROM itself. Any write path
+ * drops the cache, so a first-boot initialization falls back to direct
+ * reads. */
+static uint8_t boot_cache[EECONFIG_BASE_SIZE];
+static bool    boot_cache_active = false;
+
+void eeconfig_boot_cache_load(void) {
+    eeprom_read_block(boot_cache, (const void *)EECONFIG_MAGIC, EECONFIG_BASE_SIZE);
+    boot_cache_active = true;
+}
+
+static void boot_cache_invalidate(void) {
+    boot_cache_active = false;
+}
+
+static inline bool boot_cache_hit(const void *addr) {
+    return boot_cache_active && (uintptr_t)addr < EECONFIG_BASE_SIZE;
+}
+
+static inline uint8_t boot_cache_read_byte(const void *addr) {
+    return boot_cache[(uintptr_t)addr];
+}
+
+static inline uint16_t boot_cache_read_word(const void *addr) {
+    return boot_cache_read_byte(addr) | ((uint16_t)boot_cache_read_byte((const uint8_t *)addr + 1) << 8);
+}
+
+static inline uint32_t boot_cache_read_dword(const void *addr) {
+    return boot_cache_read_word(addr) | ((uint32_t)boot_cache_read_word((const uint8_t *)addr + 2) << 16);
+}
+
+void eeconfig_boot_cache_release(void) {
+    if (!boot_cache_active) {
+        return;
+    }
+    boot_cache_active = false;
+    /* Full validation, deferred off the boot path: if the cached block went
+     * stale (e.g. a host-driven write since the block was read), the direct
+     * signature check catches it now. */
+    if (!eeconfig_is_enabled()) {
+        eeconfig_init();
+    }
+}
+#else
+static inline void boot_cache_invalidate(void) {}
+#endif
+
 /** \brief eeconfig enable
  *
  * FIXME: needs doc
@@ -43,6 +96,7 @@ __attribute__((weak)) void eeconfig_init_kb(void) {
  * FIXME: needs doc
  */
 void eeconfig_init_quantum(void) {
+    boot_cache_invalidate();
 #if defined(EEPROM_DRIVER)
     eeprom_driver_erase();
 #endif
@@ -60,6 +114,9 @@ void eeconfig_init_quantum(void) {
     eeprom_update_byte(EECONFIG_VELOCIKEY, 0);
     eeprom_update_dword(EECONFIG_RGB_MATRIX, 0);
     eeprom_update_word(EECONFIG_RGB_MATRIX_EXTENDED, 0);
+#if defined(OS_DETECTION_EEPROM_ENABLE)
+    eeprom_update_byte(EECONFIG_OS_DETECTION, 0); // OS_UNSURE
+#endif
 
 #if defined(HAPTIC_ENABLE)
     haptic_reset();
@@ -102,6 +159,7 @@ void eeconfig_init(void) {
  * FIXME: needs doc
  */
 void eeconfig_enable(void) {
+    boot_cache_invalidate();
     eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
 }
 
@@ -110,6 +168,7 @@ void eeconfig_enable(void) {
  * FIXME: needs doc
  */
 void eeconfig_disable(void) {
+    boot_cache_invalidate();
 #if defined(EEPROM_DRIVER)
     eeprom_driver_erase();
 #endif
@@ -121,7 +180,11 @@ void eeconfig_disable(void) {
  * FIXME: needs doc
  */
 bool eeconfig_is_enabled(void) {
+#ifdef EECONFIG_BOOT_CACHE
+    bool is_eeprom_enabled = boot_cache_hit(EECONFIG_MAGIC) ? (boot_cache_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER) : (eeprom_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER);
+#else
     bool is_eeprom_enabled = (eeprom_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER);
+#endif
 #ifdef VIA_ENABLE
     if (is_eeprom_enabled) {
         is_eeprom_enabled = via_eeprom_is_valid();
@@ -135,7 +198,11 @@ bool eeconfig_is_enabled(void) {
  * FIXME: needs doc
  */
 bool eeconfig_is_disabled(void) {
+#ifdef EECONFIG_BOOT_CACHE
+    bool is_eeprom_disabled = boot_cache_hit(EECONFIG_MAGIC) ? (boot_cache_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER_OFF) : (eeprom_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER_OFF);
+#else
     bool is_eeprom_disabled = (eeprom_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER_OFF);
+#endif
 #ifdef VIA_ENABLE
     if (!is_eeprom_disabled) {
         is_eeprom_disabled = !via_eeprom_is_valid();
@@ -149,6 +216,11 @@ bool eeconfig_is_disabled(void) {
  * FIXME: needs doc
  */
 uint8_t eeconfig_read_debug(void) {
+#ifdef EECONFIG_BOOT_CACHE
+    if (boot_cache_hit(EECONFIG_DEBUG)) {
+        return boot_cache_read_byte(EECONFIG_DEBUG);
+    }
+#endif
     return eeprom_read_byte(EECONFIG_DEBUG);
 }
 /** \brief eeconfig update debug
@@ -156,6 +228,7 @@ uint8_t eeconfig_read_debug(void) {
  * FIXME: needs doc
  */
 void eeconfig_update_debug(uint8_t val) {
+    boot_cache_invalidate();
     eeprom_update_byte(EECONFIG_DEBUG, val);
 }
 
@@ -164,6 +237,11 @@ void eeconfig_update_debug(uint8_t val) {
  * FIXME: needs doc
  */
 uint8_t eeconfig_read_default_layer(void) {
+#ifdef EECONFIG_BOOT_CACHE
+    if (boot_cache_hit(EECONFIG_DEFAULT_LAYER)) {
+        return boot_cache_read_byte(EECONFIG_DEFAULT_LAYER);
+    }
+#endif
     return eeprom_read_byte(EECONFIG_DEFAULT_LAYER);
 }
 /** \brief eeconfig update default layer
@@ -171,6 +249,7 @@ uint8_t eeconfig_read_default_layer(void) {
  * FIXME: needs doc
  */
 void eeconfig_update_default_layer(uint8_t val) {
+    boot_cache_invalidate();
     eeprom_update_byte(EECONFIG_DEFAULT_LAYER, val);
 }
 
@@ -179,6 +258,11 @@ void eeconfig_update_default_layer(uint8_t val) {
  * FIXME: needs doc
  */
 uint16_t eeconfig_read_keymap(void) {
+#ifdef EECONFIG_BOOT_CACHE
+    if (boot_cache_hit(EECONFIG_KEYMAP)) {
+        return boot_cache_read_word(EECONFIG_KEYMAP);
+    }
+#endif
     return eeprom_read_word(EECONFIG_KEYMAP);
 }
 /** \brief eeconfig update keymap
@@ -186,6 +270,7 @@ uint16_t eeconfig_read_keymap(void) {
  * FIXME: needs doc
  */
 void eeconfig_update_keymap(uint16_t val) {
+    boot_cache_invalidate();
     eeprom_update_word(EECONFIG_KEYMAP, val);
 }
 
@@ -194,6 +279,11 @@ void eeconfig_update_keymap(uint16_t val) {
  * FIXME: needs doc
  */
 uint8_t eeconfig_read_audio(void) {
+#ifdef EECONFIG_BOOT_CACHE
+    if (boot_cache_hit(EECONFIG_AUDIO)) {
+        return boot_cache_read_byte(EECONFIG_AUDIO);
+    }
+#endif
     return eeprom_read_byte(EECONFIG_AUDIO);
 }
 /** \brief eeconfig update audio
@@ -201,6 +291,7 @@ uint8_t eeconfig_read_audio(void) {
  * FIXME: needs doc
  */
 void eeconfig_update_audio(uint8_t val) {
+    boot_cache_invalidate();
     eeprom_update_byte(EECONFIG_AUDIO, val);
 }
 
@@ -210,6 +301,11 @@ void eeconfig_update_audio(uint8_t val) {
  * FIXME: needs doc
  */
 uint32_t eeconfig_read_kb(void) {
+#ifdef EECONFIG_BOOT_CACHE
+    if (boot_cache_hit(EECONFIG_KEYBOARD)) {
+        return boot_cache_read_dword(EECONFIG_KEYBOARD);
+    }
+#endif
     return eeprom_read_dword(EECONFIG_KEYBOARD);
 }
 /** \brief eeconfig update kb
@@ -217,6 +313,7 @@ uint32_t eeconfig_read_kb(void) {
  * FIXME: needs doc
  */
 void eeconfig_update_kb(uint32_t val) {
+    boot_cache_invalidate();
     eeprom_update_dword(EECONFIG_KEYBOARD, val);
 }
 #endif // (EECONFIG_KB_DATA_SIZE) == 0
@@ -227,6 +324,11 @@ void eeconfig_update_kb(uint32_t val) {
  * FIXME: needs doc
  */
 uint32_t eeconfig_read_user(void) {
+#ifdef EECONFIG_BOOT_CACHE
+    if (boot_cache_hit(EECONFIG_USER)) {
+        return boot_cache_read_dword(EECONFIG_USER);
+    }
+#endif
     return eeprom_read_dword(EECONFIG_USER);
 }
 /** \brief eeconfig update user
@@ -234,6 +336,7 @@ uint32_t eeconfig_read_user(void) {
  * FIXME: needs doc
  */
 void eeconfig_update_user(uint32_t val) {
+    boot_cache_invalidate();
     eeprom_update_dword(EECONFIG_USER, val);
 }
 #endif // (EECONFIG_USER_DATA_SIZE) == 0
@@ -243,6 +346,11 @@ void eeconfig_update_user(uint32_t val) {
  * FIXME: needs doc
  */
 uint32_t eeconfig_read_haptic(void) {
+#ifdef EECONFIG_BOOT_CACHE
+    if (boot_cache_hit(EECONFIG_HAPTIC)) {
+        return boot_cache_read_dword(EECONFIG_HAPTIC);
+    }
+#endif
     return eeprom_read_dword(EECONFIG_HAPTIC);
 }
 /** \brief eeconfig update haptic
@@ -250,6 +358,7 @@ uint32_t eeconfig_read_haptic(void) {
  * FIXME: needs doc
  */
 void eeconfig_update_haptic(uint32_t val) {
+    boot_cache_invalidate();
     eeprom_update_dword(EECONFIG_HAPTIC, val);
 }
 
@@ -258,13 +367,27 @@ void eeconfig_update_haptic(uint32_t val) {
  * FIXME: needs doc
  */
 bool eeconfig_read_handedness(void) {
-    return !!eeprom_read_byte(EECONFIG_HANDEDNESS);
+#ifdef SPLIT_ROLE_CACHE
+    // The split role cache borrows the upper bits of this byte, so only
+    // bit 0 carries the handedness.
+#    define HANDEDNESS_VALUE(byte) ((byte)&1)
+#else
+#    define HANDEDNESS_VALUE(byte) (!!(byte))
+#endif
+#ifdef EECONFIG_BOOT_CACHE
+    if (boot_cache_hit(EECONFIG_HANDEDNESS)) {
+        return HANDEDNESS_VALUE(boot_cache_read_byte(EECONFIG_HANDEDNESS));
+    }
+#endif
+    return HANDEDNESS_VALUE(eeprom_read_byte(EECONFIG_HANDEDNESS));
+#undef HANDEDNESS_VALUE
 }
 /** \brief eeconfig update split handedness
  *
  * FIXME: needs doc
  */
 void eeconfig_update_handedness(bool val) {
+    boot_cache_invalidate();
     eeprom_update_byte(EECONFIG_HANDEDNESS, !!val);
 }
 
@@ -51,7 +51,44 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define EECONFIG_RGB_MATRIX_EXTENDED (uint16_t *)32
 
 // Size of EEPROM being used for core data storage
-#define EECONFIG_BASE_SIZE 34
+#ifdef TUNABLES_ENABLE
+// Runtime tunables occupy a fixed block after the core data: one version
+// byte plus two bytes per slot. The slot count is fixed so the datablock
+// addresses below do not shift with the set of enabled features.
+#    define EECONFIG_TUNABLES ((uint8_t *)34)
+#    ifndef EECONFIG_TUNABLES_MAX_ENTRIES
+#        define EECONFIG_TUNABLES_MAX_ENTRIES 8
+#    endif
+#    define EECONFIG_TUNABLES_SIZE (1 + 2 * (EECONFIG_TUNABLES_MAX_ENTRIES))
+#    define EECONFIG_CORE_SIZE (34 + (EECONFIG_TUNABLES_SIZE))
+#else
+#    define EECONFIG_CORE_SIZE 34
+#endif
+
+#ifdef OS_DETECTION_EEPROM_ENABLE
+// Last finalized OS detection verdict, reported at boot until the current
+// host's enumeration settles.
+#    define EECONFIG_OS_DETECTION ((uint8_t *)(EECONFIG_CORE_SIZE))
+#    define EECONFIG_OS_DETECTION_SIZE 1
+#else
+#    define EECONFIG_OS_DETECTION_SIZE 0
+#endif
+
+#ifdef TELEMETRY_COUNTERS_ENABLE
+// Checkpoint slot ring for the persistent profiling counters. The slot size
+// is fixed here rather than taken from telemetry_counters.h; the module
+// statically asserts that its struct still matches.
+#    ifndef TELEMETRY_COUNTERS_SLOTS
+#        define TELEMETRY_COUNTERS_SLOTS 4
+#    endif
+#    define EECONFIG_TELEMETRY_COUNTERS_SLOT_SIZE 28
+#    define EECONFIG_TELEMETRY_COUNTERS ((uint8_t *)((EECONFIG_CORE_SIZE) + (EECONFIG_OS_DETECTION_SIZE)))
+#    define EECONFIG_TELEMETRY_COUNTERS_SIZE ((TELEMETRY_COUNTERS_SLOTS) * (EECONFIG_TELEMETRY_COUNTERS_SLOT_SIZE))
+#else
+#    define EECONFIG_TELEMETRY_COUNTERS_SIZE 0
+#endif
+
+#define EECONFIG_BASE_SIZE ((EECONFIG_CORE_SIZE) + (EECONFIG_OS_DETECTION_SIZE) + (EECONFIG_TELEMETRY_COUNTERS_SIZE))
 
 // Size of EEPROM dedicated to keyboard- and user-specific data
 #ifndef EECONFIG_KB_DATA_SIZE
@@ -133,6 +170,11 @@ void     eeconfig_update_haptic(uint32_t val);
 bool eeconfig_read_handedness(void);
 void eeconfig_update_handedness(bool val);
 
+#ifdef EECONFIG_BOOT_CACHE
+void eeconfig_boot_cache_load(void);    // read the core eeconfig block into RAM in one transaction (called early in keyboard_init())
+void eeconfig_boot_cache_release(void); // drop the boot cache and run the deferred full validation (called from housekeeping)
+#endif
+
 #if (EECONFIG_KB_DATA_SIZE) > 0
 bool eeconfig_is_kb_datablock_valid(void);
 void eeconfig_read_kb_datablock(void *data);
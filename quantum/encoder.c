@@ -28,6 +28,13 @@
 #    define ENCODER_MAP_KEY_DELAY TAP_CODE_DELAY
 #endif
 
+#ifdef ENCODER_MAP_FAST_TAP
+#    ifndef ENCODER_MAP_ENABLE
+#        error ENCODER_MAP_FAST_TAP requires ENCODER_MAP_ENABLE
+#    endif
+#    include "quantum.h"
+#endif
+
 #if !defined(ENCODER_RESOLUTIONS) && !defined(ENCODER_RESOLUTION)
 #    define ENCODER_RESOLUTION 4
 #endif
@@ -36,6 +43,15 @@
 #    error "No encoder pads defined by ENCODERS_PAD_A and ENCODERS_PAD_B"
 #endif
 
+#ifdef ENCODER_INTERRUPT_ENABLE
+#    if !defined(PROTOCOL_CHIBIOS)
+#        error "ENCODER_INTERRUPT_ENABLE is currently only supported on ChibiOS boards"
+#    endif
+#    ifdef ENCODER_DEFAULT_POS
+#        error "ENCODER_INTERRUPT_ENABLE cannot be combined with ENCODER_DEFAULT_POS"
+#    endif
+#endif
+
 extern volatile bool isLeftHand;
 
 static pin_t encoders_pad_a[NUM_ENCODERS_MAX_PER_SIDE] = ENCODERS_PAD_A;
@@ -68,6 +84,72 @@ static uint8_t thatCount;
 
 static uint8_t encoder_value[NUM_ENCODERS] = {0};
 
+#ifdef ENCODER_VELOCITY_ENABLE
+#    ifndef ENCODER_VELOCITY_SMOOTHING
+#        define ENCODER_VELOCITY_SMOOTHING 4
+#    endif
+
+static uint16_t encoder_detent_time[NUM_ENCODERS]     = {0};
+static uint16_t encoder_detent_interval[NUM_ENCODERS] = {0};
+
+/* Fold the gap since the previous detent into a moving average of the
+ * inter-detent interval.  This is called from every place a detent is
+ * emitted, including detents replayed from the other half of a split.
+ */
+static void encoder_velocity_record(uint8_t index) {
+    uint16_t now     = timer_read();
+    uint16_t elapsed = TIMER_DIFF_16(now, encoder_detent_time[index]);
+    if (elapsed > 1000) {
+        elapsed = 1000; // anything slower than one detent per second is a fresh start
+    }
+    encoder_detent_time[index]     = now;
+    encoder_detent_interval[index] = (encoder_detent_interval[index] * (ENCODER_VELOCITY_SMOOTHING - 1) + elapsed) / ENCODER_VELOCITY_SMOOTHING;
+}
+
+uint16_t encoder_get_velocity(uint8_t index) {
+    if (index >= NUM_ENCODERS) {
+        return 0;
+    }
+    uint16_t interval = encoder_detent_interval[index];
+    if (interval == 0) {
+        return 0; // no detents recorded yet
+    }
+    // Once the dial has been at rest for longer than the average interval,
+    // past detents no longer say anything -- age the estimate with the idle
+    // time so it falls back towards zero.
+    uint16_t idle = TIMER_DIFF_16(timer_read(), encoder_detent_time[index]);
+    if (idle > interval) {
+        interval = idle;
+    }
+    if (interval >= 1000) {
+        return 0;
+    }
+    return 1000 / interval;
+}
+#else // ENCODER_VELOCITY_ENABLE
+#    define encoder_velocity_record(index)
+#endif // ENCODER_VELOCITY_ENABLE
+
+#ifdef ENCODER_INTERRUPT_ENABLE
+/* With ENCODER_INTERRUPT_ENABLE the quadrature decode runs from pad-change
+ * interrupts, so edges can't be lost while the scan loop is busy with
+ * something slow.  The ISR only accumulates raw pulses; detent emission and
+ * all callbacks still happen from encoder_read() on the main loop, which now
+ * boils down to draining a counter per encoder.
+ */
+static volatile int16_t encoder_isr_pulses[NUM_ENCODERS_MAX_PER_SIDE] = {0};
+static volatile uint8_t encoder_isr_state[NUM_ENCODERS_MAX_PER_SIDE]  = {0};
+
+static void encoder_pad_callback(void *param) {
+    uint8_t i     = (uint8_t)(uintptr_t)param;
+    uint8_t state = (readPin(encoders_pad_a[i]) << 0) | (readPin(encoders_pad_b[i]) << 1);
+    if ((encoder_isr_state[i] & 0x3) != state) {
+        encoder_isr_state[i] = (encoder_isr_state[i] << 2) | state;
+        encoder_isr_pulses[i] += encoder_LUT[encoder_isr_state[i] & 0xF];
+    }
+}
+#endif // ENCODER_INTERRUPT_ENABLE
+
 __attribute__((weak)) void encoder_wait_pullup_charge(void) {
     wait_us(100);
 }
@@ -102,6 +184,10 @@ void encoder_init(void) {
     memset(encoder_value, 0, sizeof(encoder_value));
     memset(encoder_state, 0, sizeof(encoder_state));
     memset(encoder_pulses, 0, sizeof(encoder_pulses));
+#    ifdef ENCODER_VELOCITY_ENABLE
+    memset(encoder_detent_time, 0, sizeof(encoder_detent_time));
+    memset(encoder_detent_interval, 0, sizeof(encoder_detent_interval));
+#    endif
     static const pin_t encoders_pad_a_left[] = ENCODERS_PAD_A;
     static const pin_t encoders_pad_b_left[] = ENCODERS_PAD_B;
     for (uint8_t i = 0; i < thisCount; i++) {
@@ -142,10 +228,53 @@ void encoder_init(void) {
     for (uint8_t i = 0; i < thisCount; i++) {
         encoder_state[i] = (readPin(encoders_pad_a[i]) << 0) | (readPin(encoders_pad_b[i]) << 1);
     }
+
+#ifdef ENCODER_INTERRUPT_ENABLE
+    for (uint8_t i = 0; i < thisCount; i++) {
+        encoder_isr_state[i]  = encoder_state[i];
+        encoder_isr_pulses[i] = 0;
+        palSetLineCallback(encoders_pad_a[i], encoder_pad_callback, (void *)(uintptr_t)i);
+        palSetLineCallback(encoders_pad_b[i], encoder_pad_callback, (void *)(uintptr_t)i);
+        palEnableLineEvent(encoders_pad_a[i], PAL_EVENT_MODE_BOTH_EDGES);
+        palEnableLineEvent(encoders_pad_b[i], PAL_EVENT_MODE_BOTH_EDGES);
+    }
+#endif // ENCODER_INTERRUPT_ENABLE
 }
 
 #ifdef ENCODER_MAP_ENABLE
+#    ifdef ENCODER_MAP_FAST_TAP
+/* Fast path for plain taps: resolve the mapped keycode up front and send it
+ * directly, instead of pushing synthetic press/release events through the full
+ * process chain.  A fast spin emits detents back to back and each one
+ * otherwise pays for two complete action_exec() passes; basic (optionally
+ * modded) keycodes like volume don't need any of that machinery.  Anything
+ * else -- layer switches, custom keycodes, tap dances -- falls back to the
+ * full mapping path below.
+ */
+static bool encoder_exec_fast_tap(uint8_t index, bool clockwise) {
+    keypos_t key     = MAKE_KEYPOS(clockwise ? KEYLOC_ENCODER_CW : KEYLOC_ENCODER_CCW, index);
+    uint16_t keycode = keymap_key_to_keycode(layer_switch_get_layer(key), key);
+    if (!IS_QK_BASIC(keycode) && !IS_QK_MODS(keycode)) {
+        return false;
+    }
+    if (keycode == KC_NO) {
+        return true; // mapped to nothing -- swallow the detent without waking the process chain
+    }
+    tap_code16_delay(keycode, ENCODER_MAP_KEY_DELAY);
+#        if ENCODER_MAP_KEY_DELAY > 0
+    wait_ms(ENCODER_MAP_KEY_DELAY);
+#        endif // ENCODER_MAP_KEY_DELAY > 0
+    return true;
+}
+#    endif // ENCODER_MAP_FAST_TAP
+
 static void encoder_exec_mapping(uint8_t index, bool clockwise) {
+#    ifdef ENCODER_MAP_FAST_TAP
+    if (encoder_exec_fast_tap(index, clockwise)) {
+        return;
+    }
+#    endif // ENCODER_MAP_FAST_TAP
+
     // The delays below cater for Windows and its wonderful requirements.
     action_exec(clockwise ? ENCODER_CW_EVENT(index, true) : ENCODER_CCW_EVENT(index, true));
 #    if ENCODER_MAP_KEY_DELAY > 0
@@ -183,6 +312,7 @@ static bool encoder_update(uint8_t index, uint8_t state) {
 
             encoder_value[index]++;
             changed = true;
+            encoder_velocity_record(index);
 #ifdef SPLIT_KEYBOARD
             if (should_process_encoder())
 #endif // SPLIT_KEYBOARD
@@ -200,6 +330,7 @@ static bool encoder_update(uint8_t index, uint8_t state) {
 #endif
             encoder_value[index]--;
             changed = true;
+            encoder_velocity_record(index);
 #ifdef SPLIT_KEYBOARD
             if (should_process_encoder())
 #endif // SPLIT_KEYBOARD
@@ -217,6 +348,74 @@ static bool encoder_update(uint8_t index, uint8_t state) {
     return changed;
 }
 
+#ifdef ENCODER_INTERRUPT_ENABLE
+
+/* Apply a batch of interrupt-accumulated pulses to one encoder.  Unlike
+ * encoder_update() this can emit several detents per call, since an arbitrary
+ * number of pulses may have piled up between two drains.
+ */
+static bool encoder_handle_pulses(uint8_t index, int16_t pulses) {
+    bool    changed = false;
+    uint8_t i       = index;
+
+#    ifdef ENCODER_RESOLUTIONS
+    const uint8_t resolution = encoder_resolutions[i];
+#    else
+    const uint8_t resolution = ENCODER_RESOLUTION;
+#    endif
+
+#    ifdef SPLIT_KEYBOARD
+    index += thisHand;
+#    endif
+    int16_t sum = encoder_pulses[i] + pulses;
+    while (sum >= resolution) {
+        sum -= resolution;
+        encoder_value[index]++;
+        changed = true;
+        encoder_velocity_record(index);
+#    ifdef SPLIT_KEYBOARD
+        if (should_process_encoder())
+#    endif // SPLIT_KEYBOARD
+#    ifdef ENCODER_MAP_ENABLE
+            encoder_exec_mapping(index, ENCODER_COUNTER_CLOCKWISE);
+#    else  // ENCODER_MAP_ENABLE
+        encoder_update_kb(index, ENCODER_COUNTER_CLOCKWISE);
+#    endif // ENCODER_MAP_ENABLE
+    }
+    while (sum <= -resolution) {
+        sum += resolution;
+        encoder_value[index]--;
+        changed = true;
+        encoder_velocity_record(index);
+#    ifdef SPLIT_KEYBOARD
+        if (should_process_encoder())
+#    endif // SPLIT_KEYBOARD
+#    ifdef ENCODER_MAP_ENABLE
+            encoder_exec_mapping(index, ENCODER_CLOCKWISE);
+#    else  // ENCODER_MAP_ENABLE
+        encoder_update_kb(index, ENCODER_CLOCKWISE);
+#    endif // ENCODER_MAP_ENABLE
+    }
+    encoder_pulses[i] = (int8_t)sum;
+    return changed;
+}
+
+bool encoder_read(void) {
+    bool changed = false;
+    for (uint8_t i = 0; i < thisCount; i++) {
+        chSysLock();
+        int16_t pulses        = encoder_isr_pulses[i];
+        encoder_isr_pulses[i] = 0;
+        chSysUnlock();
+        if (pulses != 0) {
+            changed |= encoder_handle_pulses(i, pulses);
+        }
+    }
+    return changed;
+}
+
+#else // ENCODER_INTERRUPT_ENABLE
+
 bool encoder_read(void) {
     bool changed = false;
     for (uint8_t i = 0; i < thisCount; i++) {
@@ -230,6 +429,8 @@ bool encoder_read(void) {
     return changed;
 }
 
+#endif // ENCODER_INTERRUPT_ENABLE
+
 #ifdef SPLIT_KEYBOARD
 void last_encoder_activity_trigger(void);
 
@@ -246,6 +447,7 @@ void encoder_update_raw(uint8_t *slave_state) {
             delta--;
             encoder_value[index]++;
             changed = true;
+            encoder_velocity_record(index);
 #    ifdef ENCODER_MAP_ENABLE
             encoder_exec_mapping(index, ENCODER_COUNTER_CLOCKWISE);
 #    else  // ENCODER_MAP_ENABLE
@@ -256,6 +458,7 @@ void encoder_update_raw(uint8_t *slave_state) {
             delta++;
             encoder_value[index]--;
             changed = true;
+            encoder_velocity_record(index);
 #    ifdef ENCODER_MAP_ENABLE
             encoder_exec_mapping(index, ENCODER_CLOCKWISE);
 #    else  // ENCODER_MAP_ENABLE
@@ -26,6 +26,12 @@ bool encoder_read(void);
 bool encoder_update_kb(uint8_t index, bool clockwise);
 bool encoder_update_user(uint8_t index, bool clockwise);
 
+#ifdef ENCODER_VELOCITY_ENABLE
+/* Current turn rate of the given encoder in detents per second, decaying to
+ * zero once the dial comes to rest. */
+uint16_t encoder_get_velocity(uint8_t index);
+#endif // ENCODER_VELOCITY_ENABLE
+
 #ifdef SPLIT_KEYBOARD
 
 void encoder_state_raw(uint8_t* slave_state);
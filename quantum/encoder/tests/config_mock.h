@@ -11,6 +11,8 @@
 #define ENCODERS_PAD_B \
     { 1 }
 
+#define ENCODER_VELOCITY_ENABLE
+
 #ifdef __cplusplus
 extern "C" {
 #endif
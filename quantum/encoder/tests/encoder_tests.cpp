@@ -142,3 +142,32 @@ TEST_F(EncoderTest, TestHalfway) {
     EXPECT_EQ(updates[0].index, 0);
     EXPECT_EQ(updates[0].clockwise, true);
 }
+
+extern "C" {
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+TEST_F(EncoderTest, TestVelocity) {
+    updates_array_idx = 0;
+    set_time(0);
+    encoder_init();
+    // a resting encoder has no velocity
+    EXPECT_EQ(encoder_get_velocity(0), 0);
+    // turn steadily at one detent per 50ms, i.e. 20 detents per second
+    for (int i = 0; i < 12; i++) {
+        advance_time(50);
+        setAndRead(0, false);
+        setAndRead(1, false);
+        setAndRead(0, true);
+        setAndRead(1, true);
+    }
+    EXPECT_EQ(updates_array_idx, 12);
+    // the smoothed estimate should have converged close to 20 detents/s
+    uint16_t velocity = encoder_get_velocity(0);
+    EXPECT_GE(velocity, 18);
+    EXPECT_LE(velocity, 22);
+    // and decay back to zero once the dial rests
+    advance_time(2000);
+    EXPECT_EQ(encoder_get_velocity(0), 0);
+}
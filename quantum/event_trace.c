@@ -0,0 +1,122 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "event_trace.h"
+#include "timer.h"
+
+#ifndef SECURE_ENABLE
+#    error "EVENT_TRACE_ENABLE requires SECURE_ENABLE: the trace dump is gated behind the secure unlock"
+#endif
+#include "secure.h"
+
+#ifdef RAW_ENABLE
+#    include "raw_hid.h"
+#endif
+
+static event_trace_entry_t trace[EVENT_TRACE_DEPTH];
+static uint8_t             trace_head = 0; // slot the next event is written to
+
+void event_trace_note_event(keyevent_t event) {
+    event_trace_entry_t *entry = &trace[trace_head];
+    trace_head                 = (trace_head + 1) % EVENT_TRACE_DEPTH;
+
+    entry->row           = event.key.row;
+    entry->col           = event.key.col;
+    entry->flags         = EVENT_TRACE_FLAG_VALID | (event.pressed ? EVENT_TRACE_FLAG_PRESSED : 0);
+    entry->decision      = EVENT_TRACE_DECISION_NONE;
+    entry->capture_time  = event.time;
+    entry->process_time  = timer_read();
+    entry->decision_time = 0;
+    entry->report_time   = 0;
+}
+
+// Decisions and reports attach to the newest entry: both fire synchronously
+// while the triggering event is still being processed, the same attribution
+// the latency histogram uses.
+static event_trace_entry_t *newest_entry(void) {
+    uint8_t              slot  = (trace_head + EVENT_TRACE_DEPTH - 1) % EVENT_TRACE_DEPTH;
+    event_trace_entry_t *entry = &trace[slot];
+    return (entry->flags & EVENT_TRACE_FLAG_VALID) ? entry : NULL;
+}
+
+void event_trace_note_decision(uint8_t decision) {
+    event_trace_entry_t *entry = newest_entry();
+    if (entry) {
+        entry->decision      = decision;
+        entry->decision_time = timer_read();
+    }
+}
+
+void event_trace_note_report(void) {
+    event_trace_entry_t *entry = newest_entry();
+    // Only once per event; reports sent outside event processing (e.g.
+    // unregister sweeps) keep the first attribution.
+    if (entry && entry->report_time == 0) {
+        entry->report_time = timer_read();
+    }
+}
+
+void event_trace_reset(void) {
+    memset(trace, 0, sizeof(trace));
+    trace_head = 0;
+}
+
+bool event_trace_raw_hid_command(uint8_t *data, uint8_t length) {
+    if (length < 4 || data[0] != EVENT_TRACE_HID_COMMAND) {
+        return false;
+    }
+
+    uint8_t subcommand = data[1];
+    uint8_t chunk      = data[2];
+
+    // data[3] is the status byte of the response: 0 = ok, 1 = locked.
+    if (!secure_is_unlocked()) {
+        data[3] = 1;
+        memset(&data[4], 0, length - 4);
+    } else if (subcommand == 0xFF) {
+        event_trace_reset();
+        data[3] = 0;
+        memset(&data[4], 0, length - 4);
+    } else if (subcommand == 0x00) {
+        // Entries are returned oldest-first, two 12-byte entries per packet;
+        // slots past the depth (or never written) come back zeroed.
+        data[3]     = 0;
+        uint8_t out = 4;
+        for (uint8_t i = chunk * 2; i < (uint8_t)(chunk * 2 + 2) && i < EVENT_TRACE_DEPTH; i++) {
+            if (out + sizeof(event_trace_entry_t) > length) {
+                break;
+            }
+            uint8_t slot = (trace_head + i) % EVENT_TRACE_DEPTH;
+            memcpy(&data[out], &trace[slot], sizeof(event_trace_entry_t));
+            out += sizeof(event_trace_entry_t);
+        }
+        memset(&data[out], 0, length - out);
+    } else {
+        return false;
+    }
+
+#ifdef RAW_ENABLE
+    raw_hid_send(data, length);
+#endif
+    return true;
+}
+
+#if defined(RAW_ENABLE) && !defined(VIA_ENABLE) && !defined(RAW_HID_STREAM_ENABLE) && !defined(LATENCY_HISTOGRAM_ENABLE)
+#    ifdef TELEMETRY_COUNTERS_ENABLE
+#        include "telemetry_counters.h"
+#    endif
+// Keyboards with their own raw HID protocol override this and forward
+// matching packets to event_trace_raw_hid_command() themselves. When the
+// latency histogram (or VIA / the raw HID stream) owns the endpoint, its
+// dispatch forwards trace queries here instead.
+__attribute__((weak)) void raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (event_trace_raw_hid_command(data, length)) {
+        return;
+    }
+#    ifdef TELEMETRY_COUNTERS_ENABLE
+    telemetry_counters_raw_hid_command(data, length);
+#    endif
+}
+#endif
@@ -0,0 +1,76 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "keyboard.h"
+
+/**
+ * \file
+ *
+ * \brief Volatile key event trace for offline latency forensics.
+ *
+ * With `EVENT_TRACE_ENABLE = yes`, the last `EVENT_TRACE_DEPTH` key events
+ * are kept in a RAM-only ring: matrix position, capture and processing
+ * timestamps, the tap-hold/combo decision (and when it settled), and when
+ * the resulting report went to the host. Nothing is ever persisted; the
+ * trace is lost on power loss and can be cleared over the wire.
+ *
+ * Host access goes over raw HID with the same conventions as the latency
+ * histogram: a request whose first byte is `EVENT_TRACE_HID_COMMAND` is
+ * answered in place. Dumping (and clearing) the trace requires the secure
+ * unlock from `secure.c` -- a keylogger-shaped buffer must not be readable
+ * from a locked device -- so `SECURE_ENABLE = yes` is mandatory.
+ */
+
+#ifndef EVENT_TRACE_DEPTH
+#    define EVENT_TRACE_DEPTH 32
+#endif
+
+#ifndef EVENT_TRACE_HID_COMMAND
+#    define EVENT_TRACE_HID_COMMAND 0x7C
+#endif
+
+enum event_trace_decision {
+    EVENT_TRACE_DECISION_NONE = 0, // no tap-hold/combo engine touched the event
+    EVENT_TRACE_DECISION_TAP,
+    EVENT_TRACE_DECISION_HOLD,
+    EVENT_TRACE_DECISION_COMBO_FIRED,
+    EVENT_TRACE_DECISION_COMBO_EXPIRED,
+};
+
+// One traced key event; all timestamps are the millisecond timer. Serialized
+// verbatim (little-endian) into dump packets, so layout changes are protocol
+// changes.
+typedef struct event_trace_entry_t {
+    uint8_t  row;
+    uint8_t  col;
+    uint8_t  flags; // bit 0: pressed, bit 1: entry valid
+    uint8_t  decision;
+    uint16_t capture_time;
+    uint16_t process_time;
+    uint16_t decision_time;
+    uint16_t report_time;
+} event_trace_entry_t;
+
+#define EVENT_TRACE_FLAG_PRESSED (1 << 0)
+#define EVENT_TRACE_FLAG_VALID (1 << 1)
+
+/* Called from action_exec() for every real key event. */
+void event_trace_note_event(keyevent_t event);
+
+/* Attributes a tap-hold or combo decision to the most recent traced event. */
+void event_trace_note_decision(uint8_t decision);
+
+/* Called from host_keyboard_send(); attributes the report to the most
+ * recently traced event, once. */
+void event_trace_note_report(void);
+
+void event_trace_reset(void);
+
+/* Handle a raw HID request; returns true (and fills `data` with the
+ * response) if the packet was a trace command. */
+bool event_trace_raw_hid_command(uint8_t *data, uint8_t length);
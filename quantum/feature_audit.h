@@ -0,0 +1,71 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/**
+ * \file
+ *
+ * \brief Build audit for periodic task hooks.
+ *
+ * A task-bearing feature burns scan loop cycles whether or not the keymap
+ * can reach it, and an inherited rules.mk layer can re-enable one without
+ * anybody noticing. A board that never wants to pay for a feature can
+ * declare that in config.h:
+ *
+ *     #define FEATURE_AUDIT_DENY_MOUSEKEY
+ *
+ * and the build fails if the feature is compiled in anyway. The matching
+ * build-time inventory - enabled options, their keyboard_task() hooks,
+ * image RAM totals - is emitted as a JSON artifact by the
+ * `feature_manifest` make target.
+ */
+
+#if defined(FEATURE_AUDIT_DENY_MOUSEKEY) && defined(MOUSEKEY_ENABLE)
+#    error "mousekey_task() is compiled in but this board denies mousekey"
+#endif
+#if defined(FEATURE_AUDIT_DENY_PS2_MOUSE) && defined(PS2_MOUSE_ENABLE)
+#    error "ps2_mouse_task() is compiled in but this board denies ps2_mouse"
+#endif
+#if defined(FEATURE_AUDIT_DENY_POINTING_DEVICE) && defined(POINTING_DEVICE_ENABLE)
+#    error "pointing_device_task() is compiled in but this board denies pointing_device"
+#endif
+#if defined(FEATURE_AUDIT_DENY_DIGITIZER) && defined(DIGITIZER_ENABLE)
+#    error "digitizer_task() is compiled in but this board denies digitizer"
+#endif
+#if defined(FEATURE_AUDIT_DENY_PROGRAMMABLE_BUTTON) && defined(PROGRAMMABLE_BUTTON_ENABLE)
+#    error "programmable_button_task() is compiled in but this board denies programmable_button"
+#endif
+#if defined(FEATURE_AUDIT_DENY_MIDI) && defined(MIDI_ENABLE)
+#    error "midi_task() is compiled in but this board denies midi"
+#endif
+#if defined(FEATURE_AUDIT_DENY_AUDIO) && defined(AUDIO_ENABLE)
+#    error "audio is compiled in but this board denies audio"
+#endif
+#if defined(FEATURE_AUDIT_DENY_JOYSTICK) && defined(JOYSTICK_ENABLE)
+#    error "joystick_task() is compiled in but this board denies joystick"
+#endif
+#if defined(FEATURE_AUDIT_DENY_BLUETOOTH) && defined(BLUETOOTH_ENABLE)
+#    error "bluetooth_task() is compiled in but this board denies bluetooth"
+#endif
+#if defined(FEATURE_AUDIT_DENY_RGBLIGHT) && defined(RGBLIGHT_ENABLE)
+#    error "rgblight_task() is compiled in but this board denies rgblight"
+#endif
+#if defined(FEATURE_AUDIT_DENY_LED_MATRIX) && defined(LED_MATRIX_ENABLE)
+#    error "led_matrix_task() is compiled in but this board denies led_matrix"
+#endif
+#if defined(FEATURE_AUDIT_DENY_RGB_MATRIX) && defined(RGB_MATRIX_ENABLE)
+#    error "rgb_matrix_task() is compiled in but this board denies rgb_matrix"
+#endif
+#if defined(FEATURE_AUDIT_DENY_BACKLIGHT) && defined(BACKLIGHT_ENABLE)
+#    error "backlight_task() is compiled in but this board denies backlight"
+#endif
+#if defined(FEATURE_AUDIT_DENY_ENCODER) && defined(ENCODER_ENABLE)
+#    error "encoder tasks are compiled in but this board denies encoder"
+#endif
+#if defined(FEATURE_AUDIT_DENY_OLED) && defined(OLED_ENABLE)
+#    error "oled_task() is compiled in but this board denies oled"
+#endif
+#if defined(FEATURE_AUDIT_DENY_ST7565) && defined(ST7565_ENABLE)
+#    error "st7565_task() is compiled in but this board denies st7565"
+#endif
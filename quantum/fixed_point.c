@@ -0,0 +1,53 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "fixed_point.h"
+
+// clang-format off
+
+// Q0.16 reciprocals, fp_recip16_q16[x] = round(65536 / x) clamped to 16 bits.
+// Entry 0 is unused (callers handle the zero case) and saturates.
+const uint16_t fp_recip16_q16[256] PROGMEM = {
+    65535, 65535, 32768, 21845, 16384, 13107, 10923,  9362,
+     8192,  7282,  6554,  5958,  5461,  5041,  4681,  4369,
+     4096,  3855,  3641,  3449,  3277,  3121,  2979,  2849,
+     2731,  2621,  2521,  2427,  2341,  2260,  2185,  2114,
+     2048,  1986,  1928,  1872,  1820,  1771,  1725,  1680,
+     1638,  1598,  1560,  1524,  1489,  1456,  1425,  1394,
+     1365,  1337,  1311,  1285,  1260,  1237,  1214,  1192,
+     1170,  1150,  1130,  1111,  1092,  1074,  1057,  1040,
+     1024,  1008,   993,   978,   964,   950,   936,   923,
+      910,   898,   886,   874,   862,   851,   840,   830,
+      819,   809,   799,   790,   780,   771,   762,   753,
+      745,   736,   728,   720,   712,   705,   697,   690,
+      683,   676,   669,   662,   655,   649,   643,   636,
+      630,   624,   618,   612,   607,   601,   596,   590,
+      585,   580,   575,   570,   565,   560,   555,   551,
+      546,   542,   537,   533,   529,   524,   520,   516,
+      512,   508,   504,   500,   496,   493,   489,   485,
+      482,   478,   475,   471,   468,   465,   462,   458,
+      455,   452,   449,   446,   443,   440,   437,   434,
+      431,   428,   426,   423,   420,   417,   415,   412,
+      410,   407,   405,   402,   400,   397,   395,   392,
+      390,   388,   386,   383,   381,   379,   377,   374,
+      372,   370,   368,   366,   364,   362,   360,   358,
+      356,   354,   352,   350,   349,   347,   345,   343,
+      341,   340,   338,   336,   334,   333,   331,   329,
+      328,   326,   324,   323,   321,   320,   318,   317,
+      315,   314,   312,   311,   309,   308,   306,   305,
+      303,   302,   301,   299,   298,   297,   295,   294,
+      293,   291,   290,   289,   287,   286,   285,   284,
+      282,   281,   280,   279,   278,   277,   275,   274,
+      273,   272,   271,   270,   269,   267,   266,   265,
+      264,   263,   262,   261,   260,   259,   258,   257,
+};
+
+// First-octant arctangent in 1/256ths of a turn,
+// fp_atan_q6[i] = round(atan(i / 64) * 256 / (2 * pi)).
+const uint8_t fp_atan_q6[65] PROGMEM = {
+     0,  1,  1,  2,  3,  3,  4,  4,  5,  6,  6,  7,  8,  8,  9,  9,
+    10, 11, 11, 12, 12, 13, 13, 14, 15, 15, 16, 16, 17, 17, 18, 18,
+    19, 19, 20, 20, 21, 21, 22, 22, 23, 23, 24, 24, 25, 25, 25, 26,
+    26, 27, 27, 27, 28, 28, 29, 29, 29, 30, 30, 30, 31, 31, 31, 32,
+    32,
+};
@@ -0,0 +1,121 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "progmem.h"
+
+/**
+ * \file
+ *
+ * \brief Fixed-point math helpers for per-LED effect rendering.
+ *
+ * lib8tion covers most 8-bit effect math, but the distance and angle
+ * helpers it offers (`sqrt16`, `atan2_8`) loop over 8x8 multiplies or
+ * divide 16-bit values per LED, which dominates frame time on AVR. The
+ * replacements here are table-driven: a Q0.16 reciprocal table turns the
+ * divisions into multiplies, and distance uses the alpha-max-beta-min
+ * approximation. Both stay within a couple of least-significant bits of
+ * the exact result, which is below what an 8-bit hue or value step shows.
+ *
+ * Q8.8 saturating primitives are also provided for effects that need more
+ * range than a byte without falling back to floats.
+ */
+
+/** Q8.8 signed fixed point: 1 sign bit, 7 integer bits, 8 fraction bits. */
+typedef int16_t q8_8_t;
+
+/** Convert a compile-time constant to Q8.8. */
+#define Q8_8(x) ((q8_8_t)((x)*256))
+
+/** Reciprocal table, `fp_recip16_q16[x] ~= 65536 / x` (Q0.16). */
+extern const uint16_t fp_recip16_q16[256] PROGMEM;
+
+/** First-octant arctangent, indexed by ratio in 1/64ths (Q0.6). */
+extern const uint8_t fp_atan_q6[65] PROGMEM;
+
+/** Saturating Q8.8 addition. */
+static inline q8_8_t q8_8_sadd(q8_8_t a, q8_8_t b) {
+    int32_t sum = (int32_t)a + b;
+    if (sum > INT16_MAX) return INT16_MAX;
+    if (sum < INT16_MIN) return INT16_MIN;
+    return (q8_8_t)sum;
+}
+
+/** Saturating Q8.8 subtraction. */
+static inline q8_8_t q8_8_ssub(q8_8_t a, q8_8_t b) {
+    int32_t diff = (int32_t)a - b;
+    if (diff > INT16_MAX) return INT16_MAX;
+    if (diff < INT16_MIN) return INT16_MIN;
+    return (q8_8_t)diff;
+}
+
+/** Saturating Q8.8 multiplication. */
+static inline q8_8_t q8_8_mul(q8_8_t a, q8_8_t b) {
+    int32_t product = ((int32_t)a * b) >> 8;
+    if (product > INT16_MAX) return INT16_MAX;
+    if (product < INT16_MIN) return INT16_MIN;
+    return (q8_8_t)product;
+}
+
+/** Integer part of a Q8.8 value, rounded to nearest. */
+static inline int8_t q8_8_to_int(q8_8_t a) {
+    return (int8_t)((a + 128) >> 8);
+}
+
+/**
+ * \brief Euclidean distance approximation, replacing `sqrt16(dx*dx + dy*dy)`.
+ *
+ * Alpha-max-beta-min with 123/128 and 51/128 coefficients: two 8x8
+ * multiplies and a shift instead of the iterative square root, at most
+ * ~4% from the exact distance. Inputs are clamped into the 8-bit LED
+ * coordinate range.
+ */
+static inline uint8_t fp_dist8(int16_t dx, int16_t dy) {
+    uint16_t ax = dx < 0 ? -dx : dx;
+    uint16_t ay = dy < 0 ? -dy : dy;
+    if (ax > 255) ax = 255;
+    if (ay > 255) ay = 255;
+
+    uint16_t maxv = ax > ay ? ax : ay;
+    uint16_t minv = ax > ay ? ay : ax;
+
+    uint16_t dist = (maxv * 123 + minv * 51) >> 7;
+    if (dist < maxv) dist = maxv; // true distance is never below the larger leg
+    if (dist > 255) dist = 255;
+    return (uint8_t)dist;
+}
+
+/**
+ * \brief Table-driven `atan2_8` replacement; same 0-255 angle convention.
+ *
+ * The first-octant ratio is formed with the reciprocal table (one 8x16
+ * multiply) and looked up in the arctangent table, avoiding the per-LED
+ * 16-bit divisions of the lib8tion version. Matches `atan2_8` within 2/256
+ * of a turn.
+ */
+static inline uint8_t fp_atan2_8(int16_t dy, int16_t dx) {
+    if (dy == 0) {
+        return dx >= 0 ? 0 : 128;
+    }
+
+    uint16_t ax = dx < 0 ? -dx : dx;
+    uint16_t ay = dy < 0 ? -dy : dy;
+    while (ax > 255 || ay > 255) {
+        ax >>= 1;
+        ay >>= 1;
+    }
+
+    uint16_t maxv = ax > ay ? ax : ay;
+    uint16_t minv = ax > ay ? ay : ax;
+
+    uint8_t index = (uint8_t)((((uint32_t)minv * pgm_read_word(&fp_recip16_q16[maxv])) + 512) >> 10); // Q0.16 ratio -> rounded 1/64ths
+    if (index > 64) index = 64;
+    uint8_t octant = pgm_read_byte(&fp_atan_q6[index]);
+
+    uint8_t a = ay <= ax ? octant : 64 - octant;
+    if (dx < 0) a = 128 - a;
+    if (dy < 0) a = -a;
+    return a;
+}
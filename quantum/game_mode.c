@@ -0,0 +1,48 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "game_mode.h"
+
+#ifdef CAPS_WORD_ENABLE
+#    include "caps_word.h"
+#endif
+
+static bool game_mode_active = false;
+
+__attribute__((weak)) void game_mode_changed_user(bool active) {
+    (void)active;
+}
+
+__attribute__((weak)) void game_mode_changed_kb(bool active) {
+    game_mode_changed_user(active);
+}
+
+static void game_mode_set(bool active) {
+    if (game_mode_active == active) {
+        return;
+    }
+    game_mode_active = active;
+    if (active) {
+#ifdef CAPS_WORD_ENABLE
+        // Bypassed handlers stop shifting; end the word cleanly instead.
+        caps_word_off();
+#endif
+    }
+    game_mode_changed_kb(active);
+}
+
+void game_mode_on(void) {
+    game_mode_set(true);
+}
+
+void game_mode_off(void) {
+    game_mode_set(false);
+}
+
+void game_mode_toggle(void) {
+    game_mode_set(!game_mode_active);
+}
+
+bool game_mode_is_active(void) {
+    return game_mode_active;
+}
@@ -0,0 +1,40 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+
+/**
+ * \file
+ *
+ * \brief Runtime low-latency (game mode) profile.
+ *
+ * One firmware for both typing and gaming: the QK_GAME_MODE_* keycodes (or
+ * the API below) switch the board between the full typing feature set and a
+ * raw-latency profile without reflashing. While game mode is active:
+ *
+ *  - the typing-feature block of the process_record chain (key overrides,
+ *    tap dance, caps word, unicode input, leader, auto shift, space cadet,
+ *    autocorrect) and the combo preprocessor are lifted out of the event
+ *    path by a single flag test per event, not per-handler conditionals
+ *  - every key debounces eagerly under the mixed_eager_defer_pk algorithm
+ *  - each keyboard report is sent immediately instead of coalesced per
+ *    scan (KEYBOARD_REPORT_BATCHING)
+ *  - the rgb_matrix frame governor parks at maximum decimation
+ *    (RGB_MATRIX_FRAME_GOVERNOR)
+ *
+ * The switch itself is one RAM flag, so toggling is atomic with respect to
+ * the event loop. Features with in-flight state wind down on their own
+ * (pending combo buffers dump when their term expires); caps word is
+ * turned off on entry so it cannot resume half-shifted afterwards.
+ */
+
+void game_mode_on(void);
+void game_mode_off(void);
+void game_mode_toggle(void);
+bool game_mode_is_active(void);
+
+/** \brief Called when the profile changes; override to retune more state. */
+void game_mode_changed_kb(bool active);
+void game_mode_changed_user(bool active);
@@ -15,6 +15,7 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "haptic.h"
+#include "keyboard.h"
 #include "eeconfig.h"
 #include "debug.h"
 #include "usb_device_state.h"
@@ -31,6 +32,18 @@ extern uint8_t split_haptic_play;
 
 haptic_config_t haptic_config;
 
+/* Key events only enqueue feedback; the queued pulses are played back from
+ * haptic_task() on the next scan, so the I2C traffic to drivers like the
+ * DRV2605L never blocks the keystroke that triggered it.
+ */
+#ifndef HAPTIC_QUEUE_SIZE
+#    define HAPTIC_QUEUE_SIZE 8
+#endif
+
+static uint8_t haptic_queue[HAPTIC_QUEUE_SIZE];
+static uint8_t haptic_queue_head = 0;
+static uint8_t haptic_queue_tail = 0;
+
 static void update_haptic_enable_gpios(void) {
     if (haptic_config.enable && ((!HAPTIC_OFF_IN_LOW_POWER) || (usb_device_state == USB_DEVICE_STATE_CONFIGURED))) {
 #if defined(HAPTIC_ENABLE_PIN)
@@ -94,10 +107,34 @@ void haptic_init(void) {
 #endif
 }
 
-void haptic_task(void) {
+static void haptic_play_pulse(uint8_t mode) {
+#ifdef DRV2605L
+    DRV_pulse(mode);
+#    if defined(SPLIT_KEYBOARD) && defined(SPLIT_HAPTIC_ENABLE)
+    split_haptic_play = mode;
+#    endif
+#endif
 #ifdef SOLENOID_ENABLE
+    solenoid_fire_handler();
+#    if defined(SPLIT_KEYBOARD) && defined(SPLIT_HAPTIC_ENABLE)
+    split_haptic_play = 1;
+#    endif
+#endif
+}
+
+void haptic_task(void) {
+#if defined(SOLENOID_ENABLE) && !defined(SOLENOID_TIMER_SCHEDULED)
+    // With SOLENOID_TIMER_SCHEDULED, dwell and buzz run from one-shot timer
+    // callbacks and there is nothing to poll here.
     solenoid_check();
 #endif
+    // Play at most one queued pulse per scan; anything more recent than that
+    // is still waiting its turn in the queue.
+    if (haptic_queue_head != haptic_queue_tail) {
+        uint8_t mode      = haptic_queue[haptic_queue_tail];
+        haptic_queue_tail = (haptic_queue_tail + 1) % HAPTIC_QUEUE_SIZE;
+        haptic_play_pulse(mode);
+    }
 }
 
 void eeconfig_debug_haptic(void) {
@@ -318,20 +355,20 @@ void haptic_cont_decrease(void) {
 }
 
 void haptic_play(void) {
-#ifdef DRV2605L
-    uint8_t play_eff = 0;
-    play_eff         = haptic_config.mode;
-    DRV_pulse(play_eff);
-#    if defined(SPLIT_KEYBOARD) && defined(SPLIT_HAPTIC_ENABLE)
-    split_haptic_play = haptic_config.mode;
-#    endif
-#endif
-#ifdef SOLENOID_ENABLE
-    solenoid_fire_handler();
-#    if defined(SPLIT_KEYBOARD) && defined(SPLIT_HAPTIC_ENABLE)
-    split_haptic_play = 1;
-#    endif
+#ifdef SPLIT_KEYBOARD
+    if (!is_keyboard_master()) {
+        // Split slaves receive pulses over the transport, outside the key
+        // event path, and don't run haptic_task() -- play immediately.
+        haptic_play_pulse(haptic_config.mode);
+        return;
+    }
 #endif
+    uint8_t next = (haptic_queue_head + 1) % HAPTIC_QUEUE_SIZE;
+    if (next == haptic_queue_tail) {
+        return; // queue full -- drop the pulse rather than block the event path
+    }
+    haptic_queue[haptic_queue_head] = haptic_config.mode;
+    haptic_queue_head               = next;
 }
 
 void haptic_shutdown(void) {
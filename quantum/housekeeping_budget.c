@@ -0,0 +1,79 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "housekeeping_budget.h"
+#include "keyboard.h"
+#include "timer.h"
+
+#if defined(EEPROM_DRIVER) && defined(EEPROM_WRITE_CACHE)
+#    include "eeprom_driver.h"
+#endif
+#ifdef EECONFIG_BOOT_CACHE
+#    include "eeconfig.h"
+#endif
+
+typedef struct {
+    housekeeping_item_fn_t fn;
+    housekeeping_cost_t    cost;
+} housekeeping_item_t;
+
+static housekeeping_item_t items[HOUSEKEEPING_BUDGET_MAX_ITEMS];
+static uint8_t             item_count = 0;
+// Round-robin position among the budgeted items, carried across loops so
+// items cut off by the budget run first on the next iteration.
+static uint8_t cursor = 0;
+
+bool housekeeping_budget_register(housekeeping_item_fn_t fn, housekeeping_cost_t cost) {
+    if (item_count == HOUSEKEEPING_BUDGET_MAX_ITEMS) {
+        return false;
+    }
+    items[item_count].fn   = fn;
+    items[item_count].cost = cost;
+    item_count++;
+    return true;
+}
+
+static void register_builtins(void) {
+    housekeeping_budget_register(housekeeping_task_kb, HOUSEKEEPING_COST_BUDGETED);
+    housekeeping_budget_register(housekeeping_task_user, HOUSEKEEPING_COST_BUDGETED);
+#if defined(EEPROM_DRIVER) && defined(EEPROM_WRITE_CACHE)
+    housekeeping_budget_register(eeprom_driver_task, HOUSEKEEPING_COST_BUDGETED);
+#endif
+#ifdef EECONFIG_BOOT_CACHE
+    housekeeping_budget_register(eeconfig_boot_cache_release, HOUSEKEEPING_COST_LIGHT);
+#endif
+}
+
+void housekeeping_budget_task(void) {
+    static bool initialized = false;
+    if (!initialized) {
+        initialized = true;
+        register_builtins();
+    }
+
+    uint8_t budgeted = 0;
+    for (uint8_t i = 0; i < item_count; i++) {
+        if (items[i].cost == HOUSEKEEPING_COST_LIGHT) {
+            items[i].fn();
+        } else {
+            budgeted++;
+        }
+    }
+    if (budgeted == 0) {
+        return;
+    }
+
+    // Round-robin over the budgeted items: always at least one, then keep
+    // going while the budget holds, at most one full pass.
+    const uint32_t start = timer_read_us();
+    for (uint8_t ran = 0; ran < budgeted; ran++) {
+        while (items[cursor].cost != HOUSEKEEPING_COST_BUDGETED) {
+            cursor = (cursor + 1) % item_count;
+        }
+        items[cursor].fn();
+        cursor = (cursor + 1) % item_count;
+        if (timer_read_us() - start >= HOUSEKEEPING_BUDGET_US) {
+            break;
+        }
+    }
+}
@@ -0,0 +1,59 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * \file
+ *
+ * \brief Budgeted housekeeping scheduler.
+ *
+ * With `HOUSEKEEPING_BUDGET_ENABLE = yes`, housekeeping_task() no longer
+ * runs every registered item on every main loop iteration. Items carry a
+ * cost class: light items still run each loop, while budgeted items are
+ * dispatched round-robin until `HOUSEKEEPING_BUDGET_US` microseconds have
+ * elapsed, with the remainder carried over to the next iteration. A heavy
+ * keyboard or user hook then costs at most one budget window per loop
+ * instead of an unbounded slice of the scan.
+ *
+ * The built-in items (the `housekeeping_task_kb`/`_user` hooks, the EEPROM
+ * write-cache flush and the eeconfig boot cache release) are registered
+ * automatically; additional items can be added with
+ * `housekeeping_budget_register()`.
+ */
+
+/* Per-loop budget for round-robin dispatched items, in microseconds. At
+ * least one budgeted item runs per loop regardless, so progress is always
+ * made. */
+#ifndef HOUSEKEEPING_BUDGET_US
+#    define HOUSEKEEPING_BUDGET_US 200
+#endif
+
+/* Total item slots, including the built-ins. */
+#ifndef HOUSEKEEPING_BUDGET_MAX_ITEMS
+#    define HOUSEKEEPING_BUDGET_MAX_ITEMS 8
+#endif
+
+typedef void (*housekeeping_item_fn_t)(void);
+
+typedef enum {
+    HOUSEKEEPING_COST_LIGHT,    // flag-level work; runs every loop, outside the budget
+    HOUSEKEEPING_COST_BUDGETED, // dispatched round-robin under HOUSEKEEPING_BUDGET_US
+} housekeeping_cost_t;
+
+/**
+ * \brief Register a housekeeping item.
+ *
+ * \return false if all `HOUSEKEEPING_BUDGET_MAX_ITEMS` slots are taken.
+ */
+bool housekeeping_budget_register(housekeeping_item_fn_t fn, housekeeping_cost_t cost);
+
+/**
+ * \brief Runs light items, then budgeted items until the budget is spent.
+ *
+ * Called from housekeeping_task() in place of the direct hook calls.
+ */
+void housekeeping_budget_task(void);
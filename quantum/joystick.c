@@ -58,6 +58,26 @@ void unregister_joystick_button(uint8_t button) {
     joystick_flush();
 }
 
+// scale a converted value into the signed, clamped axis range
+static int16_t joystick_axis_scale(uint8_t axis, int16_t axis_val) {
+    // test the converted value against the lower range
+    int32_t ref        = joystick_axes[axis].mid_digit;
+    int32_t range      = joystick_axes[axis].min_digit;
+    int32_t ranged_val = ((axis_val - ref) * -JOYSTICK_MAX_VALUE) / (range - ref);
+
+    if (ranged_val > 0) {
+        // the value is in the higher range
+        range      = joystick_axes[axis].max_digit;
+        ranged_val = ((axis_val - ref) * JOYSTICK_MAX_VALUE) / (range - ref);
+    }
+
+    // clamp the result in the valid range
+    ranged_val = ranged_val < -JOYSTICK_MAX_VALUE ? -JOYSTICK_MAX_VALUE : ranged_val;
+    ranged_val = ranged_val > JOYSTICK_MAX_VALUE ? JOYSTICK_MAX_VALUE : ranged_val;
+
+    return ranged_val;
+}
+
 int16_t joystick_read_axis(uint8_t axis) {
     if (axis >= JOYSTICK_AXIS_COUNT) return 0;
 
@@ -93,26 +113,33 @@ int16_t joystick_read_axis(uint8_t axis) {
     int16_t axis_val = joystick_axes[axis].mid_digit;
 #endif
 
-    // test the converted value against the lower range
-    int32_t ref        = joystick_axes[axis].mid_digit;
-    int32_t range      = joystick_axes[axis].min_digit;
-    int32_t ranged_val = ((axis_val - ref) * -JOYSTICK_MAX_VALUE) / (range - ref);
+    return joystick_axis_scale(axis, axis_val);
+}
 
-    if (ranged_val > 0) {
-        // the value is in the higher range
-        range      = joystick_axes[axis].max_digit;
-        ranged_val = ((axis_val - ref) * JOYSTICK_MAX_VALUE) / (range - ref);
+void joystick_read_axes(void) {
+#if JOYSTICK_AXIS_COUNT > 0
+#    ifdef JOYSTICK_ASYNC_ADC
+    static bool driver_initialized = false;
+    if (!driver_initialized) {
+        joystick_driver_init();
+        driver_initialized = true;
     }
 
-    // clamp the result in the valid range
-    ranged_val = ranged_val < -JOYSTICK_MAX_VALUE ? -JOYSTICK_MAX_VALUE : ranged_val;
-    ranged_val = ranged_val > JOYSTICK_MAX_VALUE ? JOYSTICK_MAX_VALUE : ranged_val;
+    // no blocking conversions here - consume the latest filtered batch from
+    // the sampling driver, or bail if it has not completed a new one yet
+    uint16_t raw[JOYSTICK_AXIS_COUNT];
+    if (!joystick_driver_read(raw)) {
+        return;
+    }
 
-    return ranged_val;
-}
+    for (int i = 0; i < JOYSTICK_AXIS_COUNT; ++i) {
+        if (joystick_axes[i].input_pin == JS_VIRTUAL_AXIS) {
+            continue;
+        }
 
-void joystick_read_axes(void) {
-#if JOYSTICK_AXIS_COUNT > 0
+        joystick_set_axis(i, joystick_axis_scale(i, (int16_t)raw[i]));
+    }
+#    else
     for (int i = 0; i < JOYSTICK_AXIS_COUNT; ++i) {
         if (joystick_axes[i].input_pin == JS_VIRTUAL_AXIS) {
             continue;
@@ -120,6 +147,7 @@ void joystick_read_axes(void) {
 
         joystick_set_axis(i, joystick_read_axis(i));
     }
+#    endif
 
     joystick_flush();
 #endif
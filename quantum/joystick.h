@@ -119,6 +119,24 @@ int16_t joystick_read_axis(uint8_t axis);
 
 void joystick_read_axes(void);
 
+#ifdef JOYSTICK_ASYNC_ADC
+/**
+ * \brief Initialize the asynchronous axis sampling driver.
+ *
+ * Called once from the joystick task before the first read.
+ */
+void joystick_driver_init(void);
+
+/**
+ * \brief Fetch the latest filtered raw values from the asynchronous driver.
+ *
+ * \param raw Filled with one filtered ADC value per axis; virtual axis slots are left untouched.
+ *
+ * \return `true` if a new batch was available since the last call.
+ */
+bool joystick_driver_read(uint16_t raw[JOYSTICK_AXIS_COUNT]);
+#endif
+
 /**
  * \brief Set the value of the given axis.
  *
@@ -0,0 +1,98 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "key_event_queue.h"
+#include "action.h"
+#include "action_util.h"
+#include "atomic_util.h"
+#ifdef GAME_MODE_ENABLE
+#    include "game_mode.h"
+#endif
+
+#ifdef MATRIX_SCAN_THREAD_ENABLE
+#    include "wait.h"
+#endif
+
+// Same single-producer/single-consumer shape as quantum/ring_buffer.h,
+// widened from bytes to whole keyevent_t entries.
+static keyevent_t event_queue[KEY_EVENT_QUEUE_SIZE];
+static uint8_t    queue_head = 0;
+static uint8_t    queue_tail = 0;
+
+static bool enqueue(keyevent_t event) {
+    bool ret = false;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        uint8_t next = (queue_head + 1) % KEY_EVENT_QUEUE_SIZE;
+        if (next != queue_tail) {
+            event_queue[queue_head] = event;
+            queue_head              = next;
+            ret                     = true;
+        }
+    }
+    return ret;
+}
+
+static bool dequeue(keyevent_t *event) {
+    bool ret = false;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        if (queue_head != queue_tail) {
+            *event     = event_queue[queue_tail];
+            queue_tail = (queue_tail + 1) % KEY_EVENT_QUEUE_SIZE;
+            ret        = true;
+        }
+    }
+    return ret;
+}
+
+bool key_event_queue_is_empty(void) {
+    bool empty;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        empty = queue_head == queue_tail;
+    }
+    return empty;
+}
+
+void key_event_queue_enqueue(keyevent_t event) {
+#ifdef MATRIX_SCAN_THREAD_ENABLE
+    // The consumer runs on the main thread; draining here would run the
+    // processing chain on the scan thread. Sleep until space opens up,
+    // which also lets the main thread run.
+    while (!enqueue(event)) {
+        wait_ms(1);
+    }
+#else
+    if (!enqueue(event)) {
+        // Queue overrun: process the backlog now rather than dropping or
+        // reordering events. This momentarily reintroduces inline
+        // processing, which beats losing keystrokes.
+        key_event_queue_task();
+        enqueue(event);
+    }
+#endif
+}
+
+void key_event_queue_task(void) {
+    keyevent_t event;
+#ifdef KEYBOARD_REPORT_BATCHING
+    // Coalesce the reports of the whole backlog into a single send; game
+    // mode skips the batch so every report leaves immediately
+#    ifdef GAME_MODE_ENABLE
+    if (!game_mode_is_active()) {
+        keyboard_report_batch_begin();
+    }
+#    else
+    keyboard_report_batch_begin();
+#    endif
+#endif
+    while (dequeue(&event)) {
+#ifdef MATRIX_SCAN_THREAD_ENABLE
+        // Reactive lighting hooks run here, on the consumer side, instead
+        // of on the scan thread; effect state is main-thread-owned.
+        keyboard_switch_event(event.key.row, event.key.col, event.pressed);
+#endif
+        action_exec(event);
+    }
+#ifdef KEYBOARD_REPORT_BATCHING
+    keyboard_report_batch_commit();
+#endif
+}
@@ -0,0 +1,46 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+
+#include "keyboard.h"
+
+/**
+ * \file
+ *
+ * \brief Queued key event processing.
+ *
+ * With `KEY_EVENT_QUEUE_ENABLE = yes`, the matrix scan loop no longer runs
+ * the `process_record` chain inline. Instead, events are captured with
+ * their original timestamps into a small ring buffer and drained once per
+ * `keyboard_task()` iteration, so a slow `process_record_user()` (OLED
+ * drawing, macros, ...) delays event *processing* but never the next
+ * matrix scan. Tap-hold decisions are unaffected because they evaluate
+ * `event.time`, which is stamped at capture.
+ */
+
+/* Number of events the queue can hold; at 1kHz scanning this is also the
+ * number of milliseconds of burst the queue absorbs. */
+#ifndef KEY_EVENT_QUEUE_SIZE
+#    define KEY_EVENT_QUEUE_SIZE 32
+#endif
+
+/**
+ * \brief Append a key event to the queue.
+ *
+ * If the queue is full, the pending events are drained first so capture
+ * order is always preserved.
+ */
+void key_event_queue_enqueue(keyevent_t event);
+
+/**
+ * \brief Run the processing chain for all queued events.
+ */
+void key_event_queue_task(void);
+
+/**
+ * \brief Whether no events are waiting to be processed.
+ */
+bool key_event_queue_is_empty(void);
@@ -31,11 +31,33 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "command.h"
 #include "util.h"
 #include "sendchar.h"
+#ifdef DEFERRED_LOGGING_ENABLE
+#    include "deferred_logging.h"
+#endif
+#ifdef BENCHMARK_ENABLE
+#    include "benchmark.h"
+#endif
+#include "task_accounting.h"
+#include "power_telemetry.h"
+#ifdef TELEMETRY_COUNTERS_ENABLE
+#    include "telemetry_counters.h"
+#endif
+#include "feature_audit.h"
+#include "socd_cleaner.h"
+#ifdef TUNABLES_ENABLE
+#    include "tunables.h"
+#endif
 #include "eeconfig.h"
 #include "action_layer.h"
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
 #endif
+#ifdef KEY_EVENT_QUEUE_ENABLE
+#    include "key_event_queue.h"
+#endif
+#ifdef MATRIX_IDLE_ENABLE
+#    include "matrix_idle.h"
+#endif
 #ifdef MOUSEKEY_ENABLE
 #    include "mousekey.h"
 #endif
@@ -63,6 +85,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef MIDI_ENABLE
 #    include "process_midi.h"
 #endif
+#ifdef DIGITIZER_ENABLE
+#    include "digitizer.h"
+#endif
+#ifdef PROGRAMMABLE_BUTTON_ENABLE
+#    include "programmable_button.h"
+#endif
 #ifdef JOYSTICK_ENABLE
 #    include "process_joystick.h"
 #endif
@@ -75,9 +103,6 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef ST7565_ENABLE
 #    include "st7565.h"
 #endif
-#ifdef VELOCIKEY_ENABLE
-#    include "velocikey.h"
-#endif
 #ifdef VIA_ENABLE
 #    include "via.h"
 #endif
@@ -102,12 +127,21 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef BLUETOOTH_ENABLE
 #    include "bluetooth.h"
 #endif
+#ifdef RADIO_ENABLE
+#    include "radio.h"
+#endif
 #ifdef CAPS_WORD_ENABLE
 #    include "caps_word.h"
 #endif
 #ifdef LEADER_ENABLE
 #    include "leader.h"
 #endif
+#ifdef OS_DETECTION_ENABLE
+#    include "os_detection.h"
+#endif
+#ifdef HOUSEKEEPING_BUDGET_ENABLE
+#    include "housekeeping_budget.h"
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -139,44 +173,109 @@ void last_encoder_activity_trigger(void) {
     last_encoder_modification_time = last_input_modification_time = timer_read32();
 }
 
-// Only enable this if console is enabled to print to
-#if defined(DEBUG_MATRIX_SCAN_RATE)
+// Only enable this if console is enabled to print to, or if something
+// (e.g. the rgb_matrix frame governor or the scan rate floor) consumes the
+// measured rate
+#if defined(DEBUG_MATRIX_SCAN_RATE) || defined(RGB_MATRIX_FRAME_GOVERNOR) || defined(MATRIX_SCAN_RATE_STATS) || defined(MATRIX_SCAN_RATE_FLOOR)
 static uint32_t matrix_timer           = 0;
 static uint32_t matrix_scan_count      = 0;
 static uint32_t last_matrix_scan_count = 0;
 
+#    ifdef MATRIX_SCAN_RATE_STATS
+static uint32_t scan_loop_start_us;
+static uint32_t scan_time_ewma_us;
+static uint32_t scan_time_max_window_us;
+static uint32_t scan_time_max_us;
+#    endif
+
+#    ifdef MATRIX_SCAN_RATE_FLOOR
+// Suppresses the floor check for the partial window right after boot.
+static bool scan_rate_window_valid = false;
+
+__attribute__((weak)) void matrix_scan_rate_warning_user(uint32_t scan_rate) {}
+
+__attribute__((weak)) void matrix_scan_rate_warning_kb(uint32_t scan_rate) {
+    matrix_scan_rate_warning_user(scan_rate);
+}
+#    endif
+
 void matrix_scan_perf_task(void) {
     matrix_scan_count++;
 
+#    ifdef MATRIX_SCAN_RATE_STATS
+    // Loop period: EWMA (alpha 1/16) for the average, plus the worst loop of
+    // the current window as a jitter measure. One timer read per loop.
+    uint32_t loop_now_us = timer_read_us();
+    if (scan_loop_start_us != 0) {
+        uint32_t loop_time_us = TIMER_DIFF_32(loop_now_us, scan_loop_start_us);
+        scan_time_ewma_us += ((int32_t)loop_time_us - (int32_t)scan_time_ewma_us) >> 4;
+        if (loop_time_us > scan_time_max_window_us) {
+            scan_time_max_window_us = loop_time_us;
+        }
+    }
+    scan_loop_start_us = loop_now_us | 1;
+#    endif
+
     uint32_t timer_now = timer_read32();
     if (TIMER_DIFF_32(timer_now, matrix_timer) >= 1000) {
-#    if defined(CONSOLE_ENABLE)
+#    if defined(DEBUG_MATRIX_SCAN_RATE) && defined(CONSOLE_ENABLE)
         dprintf("matrix scan frequency: %lu\n", matrix_scan_count);
 #    endif
         last_matrix_scan_count = matrix_scan_count;
         matrix_timer           = timer_now;
         matrix_scan_count      = 0;
+#    ifdef MATRIX_SCAN_RATE_STATS
+        scan_time_max_us        = scan_time_max_window_us;
+        scan_time_max_window_us = 0;
+#    endif
+#    ifdef MATRIX_SCAN_RATE_FLOOR
+        if (scan_rate_window_valid && last_matrix_scan_count < (MATRIX_SCAN_RATE_FLOOR)) {
+            dprintf("matrix scan rate below floor: %lu < %u\n", last_matrix_scan_count, (uint16_t)(MATRIX_SCAN_RATE_FLOOR));
+            matrix_scan_rate_warning_kb(last_matrix_scan_count);
+        }
+        scan_rate_window_valid = true;
+#    endif
     }
 }
 
 uint32_t get_matrix_scan_rate(void) {
     return last_matrix_scan_count;
 }
+
+#    ifdef MATRIX_SCAN_RATE_STATS
+uint32_t get_matrix_scan_time_avg_us(void) {
+    return scan_time_ewma_us;
+}
+
+uint32_t get_matrix_scan_time_max_us(void) {
+    return scan_time_max_us;
+}
+#    endif
 #else
 #    define matrix_scan_perf_task()
 #endif
 
 #ifdef MATRIX_HAS_GHOST
-static matrix_row_t get_real_keys(uint8_t row, matrix_row_t rowdata) {
-    matrix_row_t out = 0;
-    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-        // read each key in the row data and check if the keymap defines it as a real key
-        if (keycode_at_keymap_location(0, row, col) && (rowdata & (1 << col))) {
-            // this creates new row data, if a key is defined in the keymap, it will be set here
-            out |= 1 << col;
-        }
-    }
-    return out;
+#    if (MATRIX_ROWS <= 8)
+typedef uint8_t ghost_rows_mask_t;
+#    elif (MATRIX_ROWS <= 16)
+typedef uint16_t ghost_rows_mask_t;
+#    elif (MATRIX_ROWS <= 32)
+typedef uint32_t ghost_rows_mask_t;
+#    else
+#        error "MATRIX_ROWS: invalid value"
+#    endif
+
+// Lazily built from the layer 0 keymap: per row, the columns holding a real
+// key, and the set of rows sharing at least two real columns with it - the
+// only rows a ghost can form with. Dropped after dynamic keymap writes via
+// matrix_ghost_masks_invalidate() and rebuilt on the next check.
+static matrix_row_t      real_key_masks[MATRIX_ROWS];
+static ghost_rows_mask_t ghost_candidate_rows[MATRIX_ROWS];
+static bool              ghost_masks_valid = false;
+
+void matrix_ghost_masks_invalidate(void) {
+    ghost_masks_valid = false;
 }
 
 static inline bool popcount_more_than_one(matrix_row_t rowdata) {
@@ -184,12 +283,37 @@ static inline bool popcount_more_than_one(matrix_row_t rowdata) {
     return rowdata;
 }
 
+static void build_ghost_masks(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix_row_t mask = 0;
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (keycode_at_keymap_location(0, row, col)) {
+                mask |= (matrix_row_t)1 << col;
+            }
+        }
+        real_key_masks[row] = mask;
+    }
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        ghost_rows_mask_t candidates = 0;
+        for (uint8_t i = 0; i < MATRIX_ROWS; i++) {
+            if (i != row && popcount_more_than_one(real_key_masks[row] & real_key_masks[i])) {
+                candidates |= (ghost_rows_mask_t)1 << i;
+            }
+        }
+        ghost_candidate_rows[row] = candidates;
+    }
+    ghost_masks_valid = true;
+}
+
 static inline bool has_ghost_in_row(uint8_t row, matrix_row_t rowdata) {
+    if (!ghost_masks_valid) {
+        build_ghost_masks();
+    }
     /* No ghost exists when less than 2 keys are down on the row.
     If there are "active" blanks in the matrix, the key can't be pressed by the user,
     there is no doubt as to which keys are really being pressed.
     The ghosts will be ignored, they are KC_NO.   */
-    rowdata = get_real_keys(row, rowdata);
+    rowdata &= real_key_masks[row];
     if ((popcount_more_than_one(rowdata)) == 0) {
         return false;
     }
@@ -197,11 +321,13 @@ static inline bool has_ghost_in_row(uint8_t row, matrix_row_t rowdata) {
     and two columns are read on each row. Blanks in the matrix don't matter,
     so they are filtered out.
     If there are two or more real keys pressed and they match columns with
-    at least two of another row's real keys, the row will be ignored. Keep in mind,
-    we are checking one row at a time, not all of them at once.
+    at least two of another row's real keys, the row will be ignored. Only the
+    precomputed candidate rows can possibly satisfy that, so the others are
+    skipped without touching their matrix data.
     */
-    for (uint8_t i = 0; i < MATRIX_ROWS; i++) {
-        if (i != row && popcount_more_than_one(get_real_keys(i, matrix_get_row(i)) & rowdata)) {
+    ghost_rows_mask_t candidates = ghost_candidate_rows[row];
+    for (uint8_t i = 0; candidates != 0; i++, candidates >>= 1) {
+        if ((candidates & 1) && popcount_more_than_one(matrix_get_row(i) & real_key_masks[i] & rowdata)) {
             return true;
         }
     }
@@ -265,7 +391,11 @@ __attribute__((weak)) bool matrix_can_read(void) {
  * FIXME: needs doc
  */
 void keyboard_setup(void) {
+#ifdef DEFERRED_LOGGING_ENABLE
+    print_set_sendchar(deferred_logging_sendchar);
+#else
     print_set_sendchar(sendchar);
+#endif
 #ifdef EEPROM_DRIVER
     eeprom_driver_init();
 #endif
@@ -321,8 +451,18 @@ __attribute__((weak)) void housekeeping_task_user(void) {}
  * Invokes hooks for executing code after QMK is done after each loop iteration.
  */
 void housekeeping_task(void) {
+#ifdef HOUSEKEEPING_BUDGET_ENABLE
+    housekeeping_budget_task();
+#else
     housekeeping_task_kb();
     housekeeping_task_user();
+#    if defined(EEPROM_DRIVER) && defined(EEPROM_WRITE_CACHE)
+    eeprom_driver_task();
+#    endif
+#    ifdef EECONFIG_BOOT_CACHE
+    eeconfig_boot_cache_release();
+#    endif
+#endif
 }
 
 /** \brief Init tasks previously located in matrix_init_quantum
@@ -335,23 +475,120 @@ void quantum_init(void) {
 #ifdef BACKLIGHT_ENABLE
     backlight_init_ports();
 #endif
-#ifdef AUDIO_ENABLE
+#if defined(AUDIO_ENABLE) && !defined(DEFERRED_PERIPHERAL_INIT)
     audio_init();
 #endif
-#ifdef LED_MATRIX_ENABLE
+#if defined(LED_MATRIX_ENABLE) && !defined(DEFERRED_PERIPHERAL_INIT)
     led_matrix_init();
 #endif
-#ifdef RGB_MATRIX_ENABLE
+#if defined(RGB_MATRIX_ENABLE) && !defined(DEFERRED_PERIPHERAL_INIT)
     rgb_matrix_init();
 #endif
 #if defined(UNICODE_COMMON_ENABLE)
     unicode_input_mode_init();
 #endif
-#ifdef HAPTIC_ENABLE
+#if defined(HAPTIC_ENABLE) && !defined(DEFERRED_PERIPHERAL_INIT)
     haptic_init();
 #endif
 }
 
+#ifdef DEFERRED_PERIPHERAL_INIT
+/* Staged peripheral bring-up. keyboard_init() only performs the work needed
+ * for a functional matrix; the slow peripheral init sequences below (display
+ * command sequences, LED controller bring-up, sensor power-up waits) then run
+ * one step per scan from keyboard_task(), so the first accepted keystroke
+ * does not wait behind them. Steps run in the same order as the serial init
+ * they replace, which preserves the existing ordering constraints (e.g.
+ * pointing devices after split init). */
+typedef void (*deferred_init_step_t)(void);
+
+#    ifdef AUDIO_ENABLE
+static void deferred_init_audio(void) {
+    audio_init();
+}
+#    endif
+#    ifdef LED_MATRIX_ENABLE
+static void deferred_init_led_matrix(void) {
+    led_matrix_init();
+}
+#    endif
+#    ifdef RGB_MATRIX_ENABLE
+static void deferred_init_rgb_matrix(void) {
+    rgb_matrix_init();
+}
+#    endif
+#    ifdef HAPTIC_ENABLE
+static void deferred_init_haptic(void) {
+    haptic_init();
+}
+#    endif
+#    ifdef OLED_ENABLE
+static void deferred_init_oled(void) {
+    oled_init(OLED_ROTATION_0);
+}
+#    endif
+#    ifdef ST7565_ENABLE
+static void deferred_init_st7565(void) {
+    st7565_init(DISPLAY_ROTATION_0);
+}
+#    endif
+#    ifdef PS2_MOUSE_ENABLE
+static void deferred_init_ps2_mouse(void) {
+    ps2_mouse_init();
+}
+#    endif
+#    ifdef POINTING_DEVICE_ENABLE
+static void deferred_init_pointing_device(void) {
+    pointing_device_init();
+}
+#    endif
+static void deferred_init_post(void) {
+    keyboard_post_init_kb(); /* Always keep this last */
+}
+
+static deferred_init_step_t const deferred_init_steps[] = {
+#    ifdef AUDIO_ENABLE
+    deferred_init_audio,
+#    endif
+#    ifdef LED_MATRIX_ENABLE
+    deferred_init_led_matrix,
+#    endif
+#    ifdef RGB_MATRIX_ENABLE
+    deferred_init_rgb_matrix,
+#    endif
+#    ifdef HAPTIC_ENABLE
+    deferred_init_haptic,
+#    endif
+#    ifdef OLED_ENABLE
+    deferred_init_oled,
+#    endif
+#    ifdef ST7565_ENABLE
+    deferred_init_st7565,
+#    endif
+#    ifdef PS2_MOUSE_ENABLE
+    deferred_init_ps2_mouse,
+#    endif
+#    ifdef POINTING_DEVICE_ENABLE
+    deferred_init_pointing_device,
+#    endif
+    deferred_init_post,
+};
+
+static uint8_t deferred_init_step_index = 0;
+
+static bool keyboard_init_deferred_pending(void) {
+    return deferred_init_step_index < ARRAY_SIZE(deferred_init_steps);
+}
+
+/* Runs at most one bring-up step per invocation. */
+static void keyboard_init_deferred_task(void) {
+    if (keyboard_init_deferred_pending()) {
+        deferred_init_steps[deferred_init_step_index]();
+        deferred_init_step_index++;
+    }
+}
+#endif
+
 /** \brief keyboard_init
  *
  * FIXME: needs doc
@@ -359,6 +596,9 @@ void quantum_init(void) {
 void keyboard_init(void) {
     timer_init();
     sync_timer_init();
+#ifdef EECONFIG_BOOT_CACHE
+    eeconfig_boot_cache_load();
+#endif
 #ifdef VIA_ENABLE
     via_init();
 #endif
@@ -370,16 +610,23 @@ void keyboard_init(void) {
 #endif
     matrix_init();
     quantum_init();
+#ifdef TUNABLES_ENABLE
+    tunables_init();
+#endif
 #if defined(CRC_ENABLE)
     crc_init();
 #endif
-#ifdef OLED_ENABLE
+#ifdef TELEMETRY_COUNTERS_ENABLE
+    // After crc_init(): checkpoint slots are CRC8-validated
+    telemetry_counters_init();
+#endif
+#if defined(OLED_ENABLE) && !defined(DEFERRED_PERIPHERAL_INIT)
     oled_init(OLED_ROTATION_0);
 #endif
-#ifdef ST7565_ENABLE
+#if defined(ST7565_ENABLE) && !defined(DEFERRED_PERIPHERAL_INIT)
     st7565_init(DISPLAY_ROTATION_0);
 #endif
-#ifdef PS2_MOUSE_ENABLE
+#if defined(PS2_MOUSE_ENABLE) && !defined(DEFERRED_PERIPHERAL_INIT)
     ps2_mouse_init();
 #endif
 #ifdef BACKLIGHT_ENABLE
@@ -407,19 +654,30 @@ void keyboard_init(void) {
 #ifdef SPLIT_KEYBOARD
     split_post_init();
 #endif
-#ifdef POINTING_DEVICE_ENABLE
+#if defined(POINTING_DEVICE_ENABLE) && !defined(DEFERRED_PERIPHERAL_INIT)
     // init after split init
     pointing_device_init();
 #endif
 #ifdef BLUETOOTH_ENABLE
     bluetooth_init();
 #endif
+#ifdef RADIO_ENABLE
+    radio_init();
+#endif
 
 #if defined(DEBUG_MATRIX_SCAN_RATE) && defined(CONSOLE_ENABLE)
     debug_enable = true;
 #endif
 
+#ifdef BENCHMARK_ENABLE
+    benchmark_init();
+#endif
+
+#ifndef DEFERRED_PERIPHERAL_INIT
     keyboard_post_init_kb(); /* Always keep this last */
+#endif
+    // With DEFERRED_PERIPHERAL_INIT, keyboard_post_init_kb() instead runs as
+    // the final staged bring-up step, after all peripherals are up.
 }
 
 /** \brief key_event_task
@@ -441,6 +699,12 @@ void switch_events(uint8_t row, uint8_t col, bool pressed) {
  * internal QMK state machine.
  */
 static inline void generate_tick_event(void) {
+#ifdef KEY_EVENT_QUEUE_ENABLE
+    // Queued events still waiting; ticking now would process out of order
+    if (!key_event_queue_is_empty()) {
+        return;
+    }
+#endif
     static uint16_t last_tick = 0;
     const uint16_t  now       = timer_read();
     if (TIMER_DIFF_16(now, last_tick) != 0) {
@@ -458,23 +722,28 @@ static inline void generate_tick_event(void) {
  */
 static bool matrix_task(void) {
     if (!matrix_can_read()) {
+#ifndef MATRIX_SCAN_THREAD_ENABLE
         generate_tick_event();
+#endif
         return false;
     }
 
     static matrix_row_t matrix_previous[MATRIX_ROWS];
 
     matrix_scan();
+    socd_update();
     bool matrix_changed = false;
     for (uint8_t row = 0; row < MATRIX_ROWS && !matrix_changed; row++) {
-        matrix_changed |= matrix_previous[row] ^ matrix_get_row(row);
+        matrix_changed |= matrix_previous[row] ^ socd_apply_row(row, matrix_get_row(row));
     }
 
     matrix_scan_perf_task();
 
     // Short-circuit the complete matrix processing if it is not necessary
     if (!matrix_changed) {
+#ifndef MATRIX_SCAN_THREAD_ENABLE
         generate_tick_event();
+#endif
         return matrix_changed;
     }
 
@@ -484,8 +753,20 @@ static bool matrix_task(void) {
 
     const bool process_keypress = should_process_keypress();
 
+#if defined(KEYBOARD_REPORT_BATCHING) && !defined(KEY_EVENT_QUEUE_ENABLE)
+    // Coalesce the reports of all key events in this scan into a single send;
+    // game mode skips the batch so every report leaves immediately
+#    ifdef GAME_MODE_ENABLE
+    if (!game_mode_is_active()) {
+        keyboard_report_batch_begin();
+    }
+#    else
+    keyboard_report_batch_begin();
+#    endif
+#endif
+
     for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
-        const matrix_row_t current_row = matrix_get_row(row);
+        const matrix_row_t current_row = socd_apply_row(row, matrix_get_row(row));
         const matrix_row_t row_changes = current_row ^ matrix_previous[row];
 
         if (!row_changes || has_ghost_in_row(row, current_row)) {
@@ -497,20 +778,74 @@ static bool matrix_task(void) {
             if (row_changes & col_mask) {
                 const bool key_pressed = current_row & col_mask;
 
+#ifdef TELEMETRY_COUNTERS_ENABLE
+                // Every post-debounce state change; a chattering switch
+                // inflates this far faster than typing can
+                telemetry_counters_note_debounce_event();
+#endif
                 if (process_keypress) {
-                    action_exec(MAKE_KEYEVENT(row, col, key_pressed));
+                    keyevent_t event = MAKE_KEYEVENT(row, col, key_pressed);
+#ifdef KEY_EVENT_TIME_US
+                    // Backdate the event to the strobe that sampled the change,
+                    // rather than this point of the diff loop.
+                    const uint32_t strobe_us = matrix_get_strobe_time_us(row, col);
+                    if (strobe_us) {
+                        event.time_us = strobe_us;
+                    }
+#endif
+#ifdef KEY_EVENT_QUEUE_ENABLE
+                    key_event_queue_enqueue(event);
+#else
+                    action_exec(event);
+#endif
                 }
 
+#ifndef MATRIX_SCAN_THREAD_ENABLE
                 switch_events(row, col, key_pressed);
+#endif
             }
         }
 
         matrix_previous[row] = current_row;
     }
 
+#if defined(KEYBOARD_REPORT_BATCHING) && !defined(KEY_EVENT_QUEUE_ENABLE)
+    keyboard_report_batch_commit();
+#endif
+
     return matrix_changed;
 }
 
+#ifdef MATRIX_SCAN_THREAD_ENABLE
+#    ifndef PROTOCOL_CHIBIOS
+#        error "MATRIX_SCAN_THREAD_ENABLE is only supported on ChibiOS targets"
+#    endif
+#    ifndef KEY_EVENT_QUEUE_ENABLE
+#        error "MATRIX_SCAN_THREAD_ENABLE requires KEY_EVENT_QUEUE_ENABLE"
+#    endif
+#    ifdef SPLIT_KEYBOARD
+#        error "MATRIX_SCAN_THREAD_ENABLE is not supported on split keyboards; the split transport runs from the matrix scan and is not thread-safe"
+#    endif
+#    ifdef MATRIX_IDLE_ENABLE
+#        error "MATRIX_SCAN_THREAD_ENABLE is incompatible with MATRIX_IDLE_ENABLE"
+#    endif
+
+// Set by the scan thread when a pass saw the matrix change; read and
+// cleared by keyboard_task() on the main thread, which keeps activity
+// tracking and display wake main-thread-owned.
+static volatile bool scan_thread_matrix_changed = false;
+
+void keyboard_scan_thread_iteration(void) {
+    if (matrix_task()) {
+        scan_thread_matrix_changed = true;
+    }
+}
+
+void keyboard_switch_event(uint8_t row, uint8_t col, bool pressed) {
+    switch_events(row, col, pressed);
+}
+#endif
+
 /** \brief Tasks previously located in matrix_scan_quantum
  *
  * TODO: rationalise against keyboard_task and current split role
@@ -588,30 +923,90 @@ void quantum_task(void) {
 #ifdef SECURE_ENABLE
     secure_task();
 #endif
+
+#if defined(STENO_ENABLE) && defined(STENO_PACKET_BUFFER_ENABLE)
+    steno_task();
+#endif
 }
 
+/* On split slaves, run at most one cosmetic task per scan loop iteration so
+ * that transport service windows are never delayed by a full render pass. */
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_SLAVE_TASK_SCHEDULER)
+#    define SLAVE_TASK_GATE(task) split_slave_task_gate(task)
+#else
+#    define SLAVE_TASK_GATE(task) true
+#endif
+
+/* While staged peripheral bring-up is still in progress, the affected
+ * subsystem tasks must not touch their uninitialized drivers. */
+#ifdef DEFERRED_PERIPHERAL_INIT
+#    define DEFERRED_INIT_GATE() (!keyboard_init_deferred_pending())
+#else
+#    define DEFERRED_INIT_GATE() true
+#endif
+
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
+    task_accounting_begin(TASK_ACCT_MATRIX);
+#if defined(MATRIX_SCAN_THREAD_ENABLE)
+    // The matrix is scanned on the dedicated thread; only its activity
+    // signal is collected here.
+    const bool matrix_changed  = scan_thread_matrix_changed;
+    scan_thread_matrix_changed = false;
+#elif defined(MATRIX_IDLE_ENABLE)
+    const bool matrix_changed = matrix_idle_task() ? false : matrix_task();
+#else
     const bool matrix_changed = matrix_task();
+#endif
+    task_accounting_end(TASK_ACCT_MATRIX);
     if (matrix_changed) {
         last_matrix_activity_trigger();
     }
 
+#ifdef DEFERRED_PERIPHERAL_INIT
+    // One peripheral bring-up step per scan, after the matrix has already
+    // been read and its events processed.
+    keyboard_init_deferred_task();
+#endif
+
+#ifdef KEY_EVENT_QUEUE_ENABLE
+    key_event_queue_task();
+#    ifdef MATRIX_SCAN_THREAD_ENABLE
+    // Tick events originate here rather than on the scan thread so the
+    // whole action state machine stays on the main thread.
+    generate_tick_event();
+#    endif
+#endif
+
+    task_accounting_begin(TASK_ACCT_QUANTUM);
     quantum_task();
+    task_accounting_end(TASK_ACCT_QUANTUM);
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
     split_watchdog_task();
 #endif
 
 #if defined(RGBLIGHT_ENABLE)
-    rgblight_task();
+    if (SLAVE_TASK_GATE(SPLIT_SLAVE_TASK_RGBLIGHT)) {
+        task_accounting_begin(TASK_ACCT_RGBLIGHT);
+        rgblight_task();
+        task_accounting_end(TASK_ACCT_RGBLIGHT);
+    }
 #endif
 
 #ifdef LED_MATRIX_ENABLE
-    led_matrix_task();
+    if (DEFERRED_INIT_GATE() && SLAVE_TASK_GATE(SPLIT_SLAVE_TASK_LED_MATRIX)) {
+        task_accounting_begin(TASK_ACCT_LED_MATRIX);
+        led_matrix_task();
+        task_accounting_end(TASK_ACCT_LED_MATRIX);
+    }
 #endif
 #ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_task();
+    if (DEFERRED_INIT_GATE() && SLAVE_TASK_GATE(SPLIT_SLAVE_TASK_RGB_MATRIX)) {
+        task_accounting_begin(TASK_ACCT_RGB_MATRIX);
+        rgb_matrix_task();
+        task_accounting_end(TASK_ACCT_RGB_MATRIX);
+    }
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
@@ -621,14 +1016,20 @@ void keyboard_task(void) {
 #endif
 
 #ifdef ENCODER_ENABLE
+    task_accounting_begin(TASK_ACCT_ENCODER);
     const bool encoders_changed = encoder_read();
+    task_accounting_end(TASK_ACCT_ENCODER);
     if (encoders_changed) {
         last_encoder_activity_trigger();
     }
 #endif
 
 #ifdef OLED_ENABLE
-    oled_task();
+    if (DEFERRED_INIT_GATE() && SLAVE_TASK_GATE(SPLIT_SLAVE_TASK_OLED)) {
+        task_accounting_begin(TASK_ACCT_OLED);
+        oled_task();
+        task_accounting_end(TASK_ACCT_OLED);
+    }
 #    if OLED_TIMEOUT > 0
     // Wake up oled if user is using those fabulous keys or spinning those encoders!
 #        ifdef ENCODER_ENABLE
@@ -640,7 +1041,11 @@ void keyboard_task(void) {
 #endif
 
 #ifdef ST7565_ENABLE
-    st7565_task();
+    if (DEFERRED_INIT_GATE() && SLAVE_TASK_GATE(SPLIT_SLAVE_TASK_ST7565)) {
+        task_accounting_begin(TASK_ACCT_ST7565);
+        st7565_task();
+        task_accounting_end(TASK_ACCT_ST7565);
+    }
 #    if ST7565_TIMEOUT > 0
     // Wake up display if user is using those fabulous keys or spinning those encoders!
 #        ifdef ENCODER_ENABLE
@@ -653,33 +1058,78 @@ void keyboard_task(void) {
 
 #ifdef MOUSEKEY_ENABLE
     // mousekey repeat & acceleration
+    task_accounting_begin(TASK_ACCT_MOUSEKEY);
     mousekey_task();
+    task_accounting_end(TASK_ACCT_MOUSEKEY);
 #endif
 
 #ifdef PS2_MOUSE_ENABLE
-    ps2_mouse_task();
+    if (DEFERRED_INIT_GATE()) {
+        ps2_mouse_task();
+    }
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
-    pointing_device_task();
+    if (DEFERRED_INIT_GATE()) {
+        task_accounting_begin(TASK_ACCT_POINTING_DEVICE);
+        pointing_device_task();
+        task_accounting_end(TASK_ACCT_POINTING_DEVICE);
+    }
 #endif
 
-#ifdef MIDI_ENABLE
-    midi_task();
+#ifdef DIGITIZER_ENABLE
+    // send any digitizer state coalesced while sends were throttled
+    digitizer_task();
 #endif
 
-#ifdef VELOCIKEY_ENABLE
-    if (velocikey_enabled()) {
-        velocikey_decelerate();
-    }
+#ifdef PROGRAMMABLE_BUTTON_ENABLE
+    programmable_button_task();
+#endif
+
+#ifdef MIDI_ENABLE
+    task_accounting_begin(TASK_ACCT_MIDI);
+    midi_task();
+    task_accounting_end(TASK_ACCT_MIDI);
 #endif
 
 #ifdef JOYSTICK_ENABLE
+    task_accounting_begin(TASK_ACCT_JOYSTICK);
     joystick_task();
+    task_accounting_end(TASK_ACCT_JOYSTICK);
 #endif
 
 #ifdef BLUETOOTH_ENABLE
+    task_accounting_begin(TASK_ACCT_BLUETOOTH);
     bluetooth_task();
+    task_accounting_end(TASK_ACCT_BLUETOOTH);
+#endif
+
+#ifdef RADIO_ENABLE
+    task_accounting_begin(TASK_ACCT_RADIO);
+    radio_task();
+    task_accounting_end(TASK_ACCT_RADIO);
+#endif
+
+#ifdef OS_DETECTION_ENABLE
+    os_detection_task();
+#endif
+
+    task_accounting_task();
+    power_telemetry_task();
+#ifdef TELEMETRY_COUNTERS_ENABLE
+    telemetry_counters_task();
+#endif
+
+    // Restore cosmetic drivers after a host wake, once key input is already
+    // being serviced for this iteration.
+    suspend_wakeup_task();
+
+#ifdef DEFERRED_LOGGING_ENABLE
+    deferred_logging_task();
+#endif
+
+#ifdef BENCHMARK_ENABLE
+    benchmark_task();
 #endif
 
     led_task();
@@ -35,6 +35,9 @@ typedef struct {
     keypos_t key;
     bool     pressed;
     uint16_t time;
+#ifdef KEY_EVENT_TIME_US
+    uint32_t time_us; // microsecond capture of the same instant as `time`; for matrix keys, the row/column strobe that observed the change
+#endif
 } keyevent_t;
 
 /* equivalent test of keypos_t */
@@ -78,7 +81,11 @@ static inline bool IS_RELEASED(keyevent_t event) {
 /**
  * @brief Constructs a key event for a pressed or released key.
  */
-#define MAKE_KEYEVENT(row_num, col_num, press) ((keyevent_t){.key = MAKE_KEYPOS((row_num), (col_num)), .pressed = (press), .time = (timer_read() | 1)})
+#ifdef KEY_EVENT_TIME_US
+#    define MAKE_KEYEVENT(row_num, col_num, press) ((keyevent_t){.key = MAKE_KEYPOS((row_num), (col_num)), .pressed = (press), .time = (timer_read() | 1), .time_us = timer_read_us()})
+#else
+#    define MAKE_KEYEVENT(row_num, col_num, press) ((keyevent_t){.key = MAKE_KEYPOS((row_num), (col_num)), .pressed = (press), .time = (timer_read() | 1)})
+#endif
 
 /**
  * @brief Constructs a internal tick event that is used to drive the internal QMK state machine.
@@ -97,8 +104,27 @@ void keyboard_setup(void);
 void keyboard_init(void);
 /* it runs repeatedly in main loop */
 void keyboard_task(void);
+#ifdef MATRIX_HAS_GHOST
+// Drop the cached ghost-detection masks, e.g. after a dynamic keymap write;
+// rebuilt on the next check.
+void matrix_ghost_masks_invalidate(void);
+#endif
+#ifdef MATRIX_SCAN_THREAD_ENABLE
+/* one matrix scan pass; runs on the dedicated scan thread */
+void keyboard_scan_thread_iteration(void);
+/* reactive per-switch hooks for a dequeued event; runs on the main thread */
+void keyboard_switch_event(uint8_t row, uint8_t col, bool pressed);
+#endif
 /* it runs whenever code has to behave differently on a slave */
 bool is_keyboard_master(void);
+#if defined(SPLIT_ROLE_MASTER)
+/* Role fixed at build time (SPLIT_ROLE=master/slave): fold the check to a
+ * constant so the other role's code paths become dead and are discarded by the
+ * compiler and --gc-sections. */
+#    define is_keyboard_master() true
+#elif defined(SPLIT_ROLE_SLAVE)
+#    define is_keyboard_master() false
+#endif
 /* it runs whenever code has to behave differently on left vs right split */
 bool is_keyboard_left(void);
 
@@ -122,6 +148,16 @@ uint32_t last_encoder_activity_elapsed(void); // Number of milliseconds since th
 
 uint32_t get_matrix_scan_rate(void);
 
+#ifdef MATRIX_SCAN_RATE_STATS
+uint32_t get_matrix_scan_time_avg_us(void); // EWMA of the main loop period, in microseconds
+uint32_t get_matrix_scan_time_max_us(void); // Longest loop period of the last measurement window
+#endif
+
+#ifdef MATRIX_SCAN_RATE_FLOOR
+void matrix_scan_rate_warning_kb(uint32_t scan_rate);   // Called when the scan rate drops below MATRIX_SCAN_RATE_FLOOR
+void matrix_scan_rate_warning_user(uint32_t scan_rate); // To be overridden by user/keymap-level code
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,27 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode_class.h"
+#include "keycode.h"
+#include "progmem.h"
+
+// clang-format off
+static const uint8_t keycode_class_table[256] PROGMEM = {
+    [KC_A ... KC_Z]            = KC_CLASS_ALPHA | KC_CLASS_WPM,
+    [KC_1 ... KC_0]            = KC_CLASS_NUMERIC | KC_CLASS_WPM,
+    [KC_TAB]                   = KC_CLASS_SPECIAL | KC_CLASS_WPM,
+    [KC_SPACE]                 = KC_CLASS_WPM,
+    [KC_MINUS ... KC_SLASH]    = KC_CLASS_SPECIAL | KC_CLASS_WPM,
+    [KC_NONUS_BACKSLASH]       = KC_CLASS_SPECIAL,
+    [KC_BACKSPACE]             = KC_CLASS_EDIT,
+    [KC_DELETE]                = KC_CLASS_EDIT,
+    [KC_LEFT_CTRL ... KC_RIGHT_GUI] = KC_CLASS_MODIFIER,
+};
+// clang-format on
+
+uint8_t keycode_class(uint16_t keycode) {
+    if (keycode > 0xFF) {
+        return 0;
+    }
+    return pgm_read_byte(keycode_class_table + keycode);
+}
@@ -0,0 +1,35 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+/* Shared classification of the basic (8-bit) keycode range, so that features
+ * which need to sort events into "alpha", "numeric" and similar buckets can
+ * do it with a single table lookup instead of each running its own chain of
+ * range compares per event.
+ *
+ * The table only covers basic keycodes; callers are expected to have already
+ * collapsed mod-taps, layer-taps and modified keycodes down to their tap
+ * keycode, the same way the previous per-feature switches did.
+ */
+enum keycode_class_flags {
+    // KC_A ... KC_Z, matches AUTO_SHIFT_ALPHA.
+    KC_CLASS_ALPHA = 1 << 0,
+    // KC_1 ... KC_0, matches AUTO_SHIFT_NUMERIC.
+    KC_CLASS_NUMERIC = 1 << 1,
+    // KC_TAB, KC_MINUS ... KC_SLASH, KC_NONUS_BACKSLASH, matches AUTO_SHIFT_SPECIAL.
+    KC_CLASS_SPECIAL = 1 << 2,
+    // KC_BACKSPACE, KC_DELETE.
+    KC_CLASS_EDIT = 1 << 3,
+    // Keys counted by the default WPM estimate: KC_A ... KC_0, KC_TAB ... KC_SLASH.
+    KC_CLASS_WPM = 1 << 4,
+    // KC_LEFT_CTRL ... KC_RIGHT_GUI, the plain modifier keys.
+    KC_CLASS_MODIFIER = 1 << 5,
+};
+
+/* Returns the class flags for `keycode`, or 0 for anything outside the basic
+ * keycode range.
+ */
+uint8_t keycode_class(uint16_t keycode);
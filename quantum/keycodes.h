@@ -721,6 +721,11 @@ enum qk_keycode_defines {
     QK_AUTOCORRECT_TOGGLE = 0x7C76,
     QK_TRI_LAYER_LOWER = 0x7C77,
     QK_TRI_LAYER_UPPER = 0x7C78,
+    QK_REPEAT_KEY = 0x7C79,
+    QK_ALT_REPEAT_KEY = 0x7C7A,
+    QK_GAME_MODE_ON = 0x7C7B,
+    QK_GAME_MODE_OFF = 0x7C7C,
+    QK_GAME_MODE_TOGGLE = 0x7C7D,
     QK_KB_0 = 0x7E00,
     QK_KB_1 = 0x7E01,
     QK_KB_2 = 0x7E02,
@@ -1362,6 +1367,11 @@ enum qk_keycode_defines {
     AC_TOGG    = QK_AUTOCORRECT_TOGGLE,
     TL_LOWR    = QK_TRI_LAYER_LOWER,
     TL_UPPR    = QK_TRI_LAYER_UPPER,
+    QK_REP     = QK_REPEAT_KEY,
+    QK_AREP    = QK_ALT_REPEAT_KEY,
+    GM_ON      = QK_GAME_MODE_ON,
+    GM_OFF     = QK_GAME_MODE_OFF,
+    GM_TOGG    = QK_GAME_MODE_TOGGLE,
 };
 
 // Range Helpers
@@ -0,0 +1,172 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+// Opt-in C++14 frontend for keymap validation and compile-time generation of
+// keymap-derived tables. Nothing here is referenced by the C core: a keymap
+// adds its own .cpp translation unit to SRC, includes this header, and defines
+// the extern "C" tables that the *_PRECOMPUTED switches in
+// keymap_introspection.c consume. Builders are plain constexpr functions, so
+// bad layer references and oversized tables become build errors (via
+// static_assert) instead of runtime surprises, and the tables land in flash
+// with zero startup cost.
+//
+// The result structs are standard-layout mirrors of the typedefs the C side
+// declares; the keymap's .cpp may equally include the QMK headers directly for
+// layer_state_t and matrix_row_t (the native test suite already compiles them
+// as C++).
+
+#ifndef __cplusplus
+#    error "keymap_constexpr.hpp must be compiled as C++ - include it from a .cpp file added to SRC"
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "quantum_keycodes.h"
+
+namespace qmk {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Layer reference validation
+
+// Target layer of a layer-switching keycode, or -1 for any other keycode.
+constexpr int16_t layer_reference(uint16_t kc) {
+    return IS_QK_TO(kc)               ? (int16_t)QK_TO_GET_LAYER(kc)
+           : IS_QK_MOMENTARY(kc)      ? (int16_t)QK_MOMENTARY_GET_LAYER(kc)
+           : IS_QK_DEF_LAYER(kc)      ? (int16_t)QK_DEF_LAYER_GET_LAYER(kc)
+           : IS_QK_TOGGLE_LAYER(kc)   ? (int16_t)QK_TOGGLE_LAYER_GET_LAYER(kc)
+           : IS_QK_ONE_SHOT_LAYER(kc) ? (int16_t)QK_ONE_SHOT_LAYER_GET_LAYER(kc)
+           : IS_QK_LAYER_TAP_TOGGLE(kc) ? (int16_t)QK_LAYER_TAP_TOGGLE_GET_LAYER(kc)
+           : IS_QK_LAYER_MOD(kc)      ? (int16_t)QK_LAYER_MOD_GET_LAYER(kc)
+           : IS_QK_LAYER_TAP(kc)      ? (int16_t)QK_LAYER_TAP_GET_LAYER(kc)
+                                      : -1;
+}
+
+// Flat index (layer * Rows * Cols + row * Cols + col) of the first keycode
+// referencing a layer the keymap does not define, or -1 when all references
+// are in range. Meant for a static_assert in the keymap's translation unit.
+template <size_t Layers, size_t Rows, size_t Cols>
+constexpr int32_t first_invalid_layer_reference(const uint16_t (&km)[Layers][Rows][Cols]) {
+    for (size_t l = 0; l < Layers; l++) {
+        for (size_t r = 0; r < Rows; r++) {
+            for (size_t c = 0; c < Cols; c++) {
+                if (layer_reference(km[l][r][c]) >= (int16_t)Layers) {
+                    return (int32_t)(l * Rows * Cols + r * Cols + c);
+                }
+            }
+        }
+    }
+    return -1;
+}
+
+template <size_t Layers, size_t Rows, size_t Cols>
+constexpr bool layer_references_in_range(const uint16_t (&km)[Layers][Rows][Cols]) {
+    return first_invalid_layer_reference(km) < 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Layer fallthrough masks (LAYER_FALLTHROUGH_CACHE_PRECOMPUTED)
+
+// mask_t must match the configured layer_state_t width.
+template <typename mask_t, size_t Rows, size_t Cols>
+struct layer_fallthrough_table {
+    mask_t masks[Rows][Cols];
+};
+
+template <typename mask_t, size_t Layers, size_t Rows, size_t Cols>
+constexpr layer_fallthrough_table<mask_t, Rows, Cols> build_layer_fallthrough_masks(const uint16_t (&km)[Layers][Rows][Cols]) {
+    layer_fallthrough_table<mask_t, Rows, Cols> table{};
+    for (size_t r = 0; r < Rows; r++) {
+        for (size_t c = 0; c < Cols; c++) {
+            for (size_t l = 0; l < Layers; l++) {
+                if (km[l][r][c] != KC_TRNS) {
+                    table.masks[r][c] = (mask_t)(table.masks[r][c] | ((mask_t)1 << l));
+                }
+            }
+        }
+    }
+    return table;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Eager debounce masks (DEBOUNCE_EAGER_KEYMAP_MASK_PRECOMPUTED)
+
+// row_t must match the configured matrix_row_t width. Classification matches
+// the runtime builder: a key may debounce eagerly when every layer gives it a
+// plain, non-modifier keycode.
+template <typename row_t, size_t Rows>
+struct eager_debounce_table {
+    row_t masks[Rows];
+};
+
+template <typename row_t, size_t Layers, size_t Rows, size_t Cols>
+constexpr eager_debounce_table<row_t, Rows> build_eager_debounce_masks(const uint16_t (&km)[Layers][Rows][Cols]) {
+    eager_debounce_table<row_t, Rows> table{};
+    for (size_t r = 0; r < Rows; r++) {
+        for (size_t c = 0; c < Cols; c++) {
+            bool plain = false;
+            for (size_t l = 0; l < Layers; l++) {
+                const uint16_t kc = km[l][r][c];
+                if (kc == KC_TRNS || kc == KC_NO) {
+                    continue;
+                }
+                if (IS_BASIC_KEYCODE(kc) && !IS_MODIFIER_KEYCODE(kc)) {
+                    plain = true;
+                } else {
+                    plain = false;
+                    break;
+                }
+            }
+            if (plain) {
+                table.masks[r] = (row_t)(table.masks[r] | ((row_t)1 << c));
+            }
+        }
+    }
+    return table;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Combo inverted index (COMBO_KEY_INDEX_PRECOMPUTED)
+
+// Standard-layout mirrors of combo_key_index_entry_t and the table typedef in
+// keymap_introspection.c; MaxEntries must equal COMBO_KEY_INDEX_MAX_ENTRIES.
+struct combo_key_index_entry {
+    uint16_t keycode;
+    uint16_t combo_index;
+};
+
+template <size_t MaxEntries>
+struct combo_key_index_table {
+    combo_key_index_entry entries[MaxEntries];
+    uint16_t              length;
+    bool                  usable; // false when MaxEntries was too small - static_assert on this
+};
+
+// Builds the sorted keycode -> combo index from each combo's key list (each
+// terminated by COMBO_END), with the same ordering as the runtime builder:
+// ascending by keycode, entries of one keycode in combo definition order.
+template <size_t MaxEntries, size_t NumCombos>
+constexpr combo_key_index_table<MaxEntries> build_combo_key_index(const uint16_t *const (&combo_keys)[NumCombos]) {
+    combo_key_index_table<MaxEntries> table{};
+    table.usable = true;
+    for (size_t combo_index = 0; combo_index < NumCombos; combo_index++) {
+        for (size_t i = 0; combo_keys[combo_index][i] != 0 /* COMBO_END */; i++) {
+            if (table.length == MaxEntries) {
+                table.usable = false;
+                return table;
+            }
+            const uint16_t key = combo_keys[combo_index][i];
+            size_t         pos = table.length;
+            while (pos > 0 && table.entries[pos - 1].keycode > key) {
+                table.entries[pos] = table.entries[pos - 1];
+                pos--;
+            }
+            table.entries[pos] = combo_key_index_entry{key, (uint16_t)combo_index};
+            table.length++;
+        }
+    }
+    return table;
+}
+
+} // namespace qmk
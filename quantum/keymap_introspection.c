@@ -16,8 +16,15 @@
 
 #define NUM_KEYMAP_LAYERS_RAW ((uint8_t)(sizeof(keymaps) / ((MATRIX_ROWS) * (MATRIX_COLS) * sizeof(uint16_t))))
 
+#ifdef KEYMAP_SPARSE_LAYERS
+#    define NUM_KEYMAP_SPARSE_ENTRIES ((uint16_t)(sizeof(keymap_sparse_entries) / sizeof(keymap_sparse_entry_t)))
+#    define NUM_KEYMAP_LAYERS_TOTAL ((uint8_t)((NUM_KEYMAP_LAYERS_RAW) + (KEYMAP_SPARSE_LAYER_COUNT)))
+#else
+#    define NUM_KEYMAP_LAYERS_TOTAL NUM_KEYMAP_LAYERS_RAW
+#endif // KEYMAP_SPARSE_LAYERS
+
 uint8_t keymap_layer_count_raw(void) {
-    return NUM_KEYMAP_LAYERS_RAW;
+    return NUM_KEYMAP_LAYERS_TOTAL;
 }
 
 __attribute__((weak)) uint8_t keymap_layer_count(void) {
@@ -25,14 +32,46 @@ __attribute__((weak)) uint8_t keymap_layer_count(void) {
 }
 
 #ifdef DYNAMIC_KEYMAP_ENABLE
-_Static_assert(NUM_KEYMAP_LAYERS_RAW <= MAX_LAYER, "Number of keymap layers exceeds maximum set by DYNAMIC_KEYMAP_LAYER_COUNT");
+_Static_assert(NUM_KEYMAP_LAYERS_TOTAL <= MAX_LAYER, "Number of keymap layers exceeds maximum set by DYNAMIC_KEYMAP_LAYER_COUNT");
 #else
-_Static_assert(NUM_KEYMAP_LAYERS_RAW <= MAX_LAYER, "Number of keymap layers exceeds maximum set by LAYER_STATE_(8|16|32)BIT");
+_Static_assert(NUM_KEYMAP_LAYERS_TOTAL <= MAX_LAYER, "Number of keymap layers exceeds maximum set by LAYER_STATE_(8|16|32)BIT");
 #endif
 
+#ifdef KEYMAP_SPARSE_LAYERS
+// Binary search of the sorted exception list; locations without an entry are
+// transparent. Upper-layer resolution touches O(log n) entries instead of a
+// dense [layers][rows][cols] slab, and the unlisted majority costs no flash.
+static uint16_t keycode_at_sparse_location(uint8_t layer_num, uint8_t row, uint8_t column) {
+    const uint32_t key = ((uint32_t)layer_num << 16) | ((uint32_t)row << 8) | column;
+
+    uint16_t lo = 0;
+    uint16_t hi = NUM_KEYMAP_SPARSE_ENTRIES;
+    while (lo < hi) {
+        const uint16_t               mid   = lo + (hi - lo) / 2;
+        const keymap_sparse_entry_t *entry = &keymap_sparse_entries[mid];
+        const uint32_t               mid_key = ((uint32_t)pgm_read_byte(&entry->layer) << 16) | ((uint32_t)pgm_read_byte(&entry->row) << 8) | pgm_read_byte(&entry->col);
+        if (mid_key < key) {
+            lo = mid + 1;
+        } else if (mid_key > key) {
+            hi = mid;
+        } else {
+            return pgm_read_word(&entry->keycode);
+        }
+    }
+    return KC_TRNS;
+}
+#endif // KEYMAP_SPARSE_LAYERS
+
 uint16_t keycode_at_keymap_location_raw(uint8_t layer_num, uint8_t row, uint8_t column) {
-    if (layer_num < NUM_KEYMAP_LAYERS_RAW && row < MATRIX_ROWS && column < MATRIX_COLS) {
-        return pgm_read_word(&keymaps[layer_num][row][column]);
+    if (row < MATRIX_ROWS && column < MATRIX_COLS) {
+        if (layer_num < NUM_KEYMAP_LAYERS_RAW) {
+            return pgm_read_word(&keymaps[layer_num][row][column]);
+        }
+#ifdef KEYMAP_SPARSE_LAYERS
+        if (layer_num < NUM_KEYMAP_LAYERS_TOTAL) {
+            return keycode_at_sparse_location(layer_num, row, column);
+        }
+#endif // KEYMAP_SPARSE_LAYERS
     }
     return KC_TRNS;
 }
@@ -41,6 +80,357 @@ __attribute__((weak)) uint16_t keycode_at_keymap_location(uint8_t layer_num, uin
     return keycode_at_keymap_location_raw(layer_num, row, column);
 }
 
+#ifdef LAYER_FALLTHROUGH_CACHE_ENABLE
+
+#    ifdef LAYER_FALLTHROUGH_CACHE_PRECOMPUTED
+
+#        ifdef DYNAMIC_KEYMAP_ENABLE
+#            error "LAYER_FALLTHROUGH_CACHE_PRECOMPUTED cannot be used with DYNAMIC_KEYMAP_ENABLE - the keymap can change at runtime"
+#        endif
+
+// The keymap supplies the table, e.g. built at compile time by the
+// keymap_constexpr.hpp frontend. The static keymap cannot change, so
+// invalidation is a no-op.
+typedef struct keymap_layer_fallthrough_table_t {
+    layer_state_t masks[MATRIX_ROWS][MATRIX_COLS];
+} keymap_layer_fallthrough_table_t;
+
+extern const keymap_layer_fallthrough_table_t keymap_layer_fallthrough_precomputed;
+
+void keymap_layer_fallthrough_invalidate(void) {}
+
+layer_state_t keymap_layer_fallthrough_mask(uint8_t row, uint8_t column) {
+    return keymap_layer_fallthrough_precomputed.masks[row][column];
+}
+
+#    else
+
+static layer_state_t key_layer_masks[MATRIX_ROWS][MATRIX_COLS];
+static bool          key_layer_masks_valid = false;
+
+void keymap_layer_fallthrough_invalidate(void) {
+    key_layer_masks_valid = false;
+}
+
+layer_state_t keymap_layer_fallthrough_mask(uint8_t row, uint8_t column) {
+    if (!key_layer_masks_valid) {
+        uint8_t layer_count = keymap_layer_count();
+        for (uint8_t r = 0; r < MATRIX_ROWS; r++) {
+            for (uint8_t c = 0; c < MATRIX_COLS; c++) {
+                layer_state_t mask = 0;
+                for (uint8_t layer_num = 0; layer_num < layer_count; layer_num++) {
+                    if (keycode_at_keymap_location(layer_num, r, c) != KC_TRNS) {
+                        mask |= (layer_state_t)1 << layer_num;
+                    }
+                }
+                key_layer_masks[r][c] = mask;
+            }
+        }
+        key_layer_masks_valid = true;
+    }
+    return key_layer_masks[row][column];
+}
+
+#    endif // LAYER_FALLTHROUGH_CACHE_PRECOMPUTED
+
+#endif // LAYER_FALLTHROUGH_CACHE_ENABLE
+
+#ifdef DEBOUNCE_EAGER_KEYMAP_MASK
+
+#    ifdef DEBOUNCE_EAGER_KEYMAP_MASK_PRECOMPUTED
+
+#        ifdef DYNAMIC_KEYMAP_ENABLE
+#            error "DEBOUNCE_EAGER_KEYMAP_MASK_PRECOMPUTED cannot be used with DYNAMIC_KEYMAP_ENABLE - the keymap can change at runtime"
+#        endif
+
+// The keymap supplies the table, e.g. built at compile time by the
+// keymap_constexpr.hpp frontend.
+typedef struct keymap_eager_debounce_table_t {
+    matrix_row_t masks[MATRIX_ROWS];
+} keymap_eager_debounce_table_t;
+
+extern const keymap_eager_debounce_table_t keymap_eager_debounce_precomputed;
+
+void keymap_eager_debounce_mask_invalidate(void) {}
+
+matrix_row_t keymap_eager_debounce_mask(uint8_t row) {
+    return keymap_eager_debounce_precomputed.masks[row];
+}
+
+#    else
+
+static matrix_row_t eager_debounce_masks[MATRIX_ROWS];
+static bool         eager_debounce_masks_valid = false;
+
+void keymap_eager_debounce_mask_invalidate(void) {
+    eager_debounce_masks_valid = false;
+}
+
+matrix_row_t keymap_eager_debounce_mask(uint8_t row) {
+    if (!eager_debounce_masks_valid) {
+        uint8_t layer_count = keymap_layer_count();
+        for (uint8_t r = 0; r < MATRIX_ROWS; r++) {
+            matrix_row_t mask = 0;
+            for (uint8_t c = 0; c < MATRIX_COLS; c++) {
+                bool plain = false;
+                for (uint8_t layer_num = 0; layer_num < layer_count; layer_num++) {
+                    uint16_t keycode = keycode_at_keymap_location(layer_num, r, c);
+                    if (keycode == KC_TRNS || keycode == KC_NO) {
+                        continue;
+                    }
+                    if (IS_BASIC_KEYCODE(keycode) && !IS_MODIFIER_KEYCODE(keycode)) {
+                        plain = true;
+                    } else {
+                        // anything layered, tapped or modifying reverts the key to deferred
+                        plain = false;
+                        break;
+                    }
+                }
+                if (plain) {
+                    mask |= (matrix_row_t)1 << c;
+                }
+            }
+            eager_debounce_masks[r] = mask;
+        }
+        eager_debounce_masks_valid = true;
+    }
+    return eager_debounce_masks[row];
+}
+
+#    endif // DEBOUNCE_EAGER_KEYMAP_MASK_PRECOMPUTED
+
+#endif // DEBOUNCE_EAGER_KEYMAP_MASK
+
+#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_LAYER_INDICATOR_MAP)
+
+#    include <string.h>
+#    include "action_layer.h"
+#    include "rgb_matrix.h"
+
+#    define LAYER_LED_MAP_BYTES ((RGB_MATRIX_LED_COUNT + 7) / 8)
+
+static uint8_t layer_led_maps[MAX_LAYER][LAYER_LED_MAP_BYTES];
+static bool    layer_led_maps_valid = false;
+
+void keymap_layer_led_map_invalidate(void) {
+    layer_led_maps_valid = false;
+}
+
+const uint8_t *keymap_layer_led_map(uint8_t layer_num) {
+    if (layer_num >= MAX_LAYER) {
+        return NULL;
+    }
+    if (!layer_led_maps_valid) {
+        uint8_t layer_count = keymap_layer_count();
+        if (layer_count > MAX_LAYER) {
+            layer_count = MAX_LAYER;
+        }
+        memset(layer_led_maps, 0, sizeof(layer_led_maps));
+        for (uint8_t layer = 0; layer < layer_count; layer++) {
+            for (uint8_t r = 0; r < MATRIX_ROWS; r++) {
+                for (uint8_t c = 0; c < MATRIX_COLS; c++) {
+                    uint8_t led = g_led_config.matrix_co[r][c];
+                    if (led != NO_LED && keycode_at_keymap_location(layer, r, c) > KC_TRNS) {
+                        layer_led_maps[layer][led / 8] |= 1 << (led % 8);
+                    }
+                }
+            }
+        }
+        layer_led_maps_valid = true;
+    }
+    return layer_led_maps[layer_num];
+}
+
+#endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_LAYER_INDICATOR_MAP)
+
+#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_INDICATOR_RULES)
+
+#    include <string.h>
+#    include "rgb_matrix.h"
+
+#    define NUM_INDICATOR_RULES ((uint8_t)(sizeof(rgb_matrix_indicator_rules) / sizeof(rgb_matrix_indicator_rule_t)))
+#    define INDICATOR_RULE_MAP_BYTES ((RGB_MATRIX_LED_COUNT + 7) / 8)
+
+uint8_t rgb_matrix_indicator_rules_count_raw(void) {
+    return NUM_INDICATOR_RULES;
+}
+
+__attribute__((weak)) uint8_t rgb_matrix_indicator_rules_count(void) {
+    return rgb_matrix_indicator_rules_count_raw();
+}
+
+rgb_matrix_indicator_rule_t rgb_matrix_indicator_rule_get_raw(uint8_t rule_index) {
+    rgb_matrix_indicator_rule_t rule;
+    memcpy_P(&rule, &rgb_matrix_indicator_rules[rule_index], sizeof(rule));
+    return rule;
+}
+
+__attribute__((weak)) rgb_matrix_indicator_rule_t rgb_matrix_indicator_rule_get(uint8_t rule_index) {
+    return rgb_matrix_indicator_rule_get_raw(rule_index);
+}
+
+static uint8_t indicator_rule_maps[NUM_INDICATOR_RULES][INDICATOR_RULE_MAP_BYTES];
+static bool    indicator_rule_maps_valid = false;
+
+void keymap_indicator_rule_led_map_invalidate(void) {
+    indicator_rule_maps_valid = false;
+}
+
+const uint8_t *keymap_indicator_rule_led_map(uint8_t rule_index) {
+    if (rule_index >= NUM_INDICATOR_RULES) {
+        return NULL;
+    }
+    if (!indicator_rule_maps_valid) {
+        memset(indicator_rule_maps, 0, sizeof(indicator_rule_maps));
+        for (uint8_t i = 0; i < NUM_INDICATOR_RULES; i++) {
+            rgb_matrix_indicator_rule_t rule = rgb_matrix_indicator_rule_get(i);
+            for (uint8_t r = 0; r < MATRIX_ROWS; r++) {
+                for (uint8_t c = 0; c < MATRIX_COLS; c++) {
+                    uint8_t led = g_led_config.matrix_co[r][c];
+                    if (led == NO_LED) {
+                        continue;
+                    }
+                    uint16_t keycode = keycode_at_keymap_location(rule.layer, r, c);
+                    if (keycode >= rule.keycode_min && keycode <= rule.keycode_max) {
+                        indicator_rule_maps[i][led / 8] |= 1 << (led % 8);
+                    }
+                }
+            }
+        }
+        indicator_rule_maps_valid = true;
+    }
+    return indicator_rule_maps[rule_index];
+}
+
+#endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_INDICATOR_RULES)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Combos
+
+#if defined(COMBO_ENABLE) && defined(COMBO_KEY_INDEX_ENABLE)
+
+#    include "process_combo.h"
+
+extern combo_t  key_combos[];
+extern uint16_t COMBO_LEN;
+
+#    ifndef COMBO_KEY_INDEX_MAX_ENTRIES
+#        define COMBO_KEY_INDEX_MAX_ENTRIES 256
+#    endif
+
+#    ifdef COMBO_KEY_INDEX_PRECOMPUTED
+
+// The keymap supplies the sorted index, e.g. built at compile time by the
+// keymap_constexpr.hpp frontend. Combos cannot change at runtime, so
+// invalidation is a no-op. Must match the layout of
+// qmk::combo_key_index_table<COMBO_KEY_INDEX_MAX_ENTRIES>.
+typedef struct combo_key_index_table_t {
+    combo_key_index_entry_t entries[COMBO_KEY_INDEX_MAX_ENTRIES];
+    uint16_t                length;
+    bool                    usable;
+} combo_key_index_table_t;
+
+extern const combo_key_index_table_t combo_key_index_precomputed;
+
+void combo_key_index_invalidate(void) {}
+
+bool combo_key_index_lookup(uint16_t keycode, const combo_key_index_entry_t **first, uint16_t *count) {
+    if (!combo_key_index_precomputed.usable) {
+        return false;
+    }
+
+    // Binary search for the first entry with this keycode
+    uint16_t lo = 0;
+    uint16_t hi = combo_key_index_precomputed.length;
+    while (lo < hi) {
+        uint16_t mid = lo + (hi - lo) / 2;
+        if (combo_key_index_precomputed.entries[mid].keycode < keycode) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    uint16_t n = 0;
+    while (lo + n < combo_key_index_precomputed.length && combo_key_index_precomputed.entries[lo + n].keycode == keycode) {
+        n++;
+    }
+
+    *first = &combo_key_index_precomputed.entries[lo];
+    *count = n;
+    return true;
+}
+
+#    else
+
+static combo_key_index_entry_t combo_key_index[COMBO_KEY_INDEX_MAX_ENTRIES];
+static uint16_t                combo_key_index_length = 0;
+static bool                    combo_key_index_usable = false;
+static bool                    combo_key_index_built  = false;
+
+void combo_key_index_invalidate(void) {
+    combo_key_index_built = false;
+}
+
+static void combo_key_index_rebuild(void) {
+    combo_key_index_length = 0;
+    combo_key_index_usable = true;
+    for (uint16_t combo_index = 0; combo_index < COMBO_LEN; combo_index++) {
+        const uint16_t *keys = key_combos[combo_index].keys;
+        uint16_t        key;
+        for (uint8_t i = 0; (key = pgm_read_word(&keys[i])) != COMBO_END; i++) {
+            if (combo_key_index_length == (COMBO_KEY_INDEX_MAX_ENTRIES)) {
+                // Too many key references for the index -- callers fall back to scanning every combo
+                combo_key_index_usable = false;
+                return;
+            }
+            // Insertion sort keeps entries for the same keycode contiguous, and in combo index order
+            uint16_t pos = combo_key_index_length;
+            while (pos > 0 && combo_key_index[pos - 1].keycode > key) {
+                combo_key_index[pos] = combo_key_index[pos - 1];
+                pos--;
+            }
+            combo_key_index[pos] = (combo_key_index_entry_t){.keycode = key, .combo_index = combo_index};
+            combo_key_index_length++;
+        }
+    }
+}
+
+bool combo_key_index_lookup(uint16_t keycode, const combo_key_index_entry_t **first, uint16_t *count) {
+    if (!combo_key_index_built) {
+        combo_key_index_rebuild();
+        combo_key_index_built = true;
+    }
+    if (!combo_key_index_usable) {
+        return false;
+    }
+
+    // Binary search for the first entry with this keycode
+    uint16_t lo = 0;
+    uint16_t hi = combo_key_index_length;
+    while (lo < hi) {
+        uint16_t mid = lo + (hi - lo) / 2;
+        if (combo_key_index[mid].keycode < keycode) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    uint16_t n = 0;
+    while (lo + n < combo_key_index_length && combo_key_index[lo + n].keycode == keycode) {
+        n++;
+    }
+
+    *first = &combo_key_index[lo];
+    *count = n;
+    return true;
+}
+
+#    endif // COMBO_KEY_INDEX_PRECOMPUTED
+
+#endif // defined(COMBO_ENABLE) && defined(COMBO_KEY_INDEX_ENABLE)
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Encoder mapping
 
@@ -17,6 +17,97 @@ uint16_t keycode_at_keymap_location_raw(uint8_t layer_num, uint8_t row, uint8_t
 // Get the keycode for the keymap location, potentially stored dynamically
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column);
 
+#ifdef KEYMAP_SPARSE_LAYERS
+
+// One non-transparent key of a sparse layer. `KEYMAP_SPARSE_LAYER_COUNT`
+// layers stack above the dense `keymaps` array; the keymap lists only their
+// non-transparent keys in `keymap_sparse_entries`, sorted ascending by
+// (layer, row, col) with absolute layer numbers, and every unlisted location
+// reads as KC_TRNS.
+typedef struct keymap_sparse_entry_t {
+    uint8_t  layer;
+    uint8_t  row;
+    uint8_t  col;
+    uint16_t keycode;
+} keymap_sparse_entry_t;
+
+#endif // KEYMAP_SPARSE_LAYERS
+
+#ifdef LAYER_FALLTHROUGH_CACHE_ENABLE
+
+#    include "action_layer.h"
+
+// Bitmask of layers holding a non-transparent keycode at this location; resolving the
+// active layer for a key is then a single indexed load plus a highest-bit scan.
+layer_state_t keymap_layer_fallthrough_mask(uint8_t row, uint8_t column);
+// Drop the cached masks, e.g. after a dynamic keymap write; rebuilt on next lookup.
+void keymap_layer_fallthrough_invalidate(void);
+
+#endif // LAYER_FALLTHROUGH_CACHE_ENABLE
+
+#ifdef DEBOUNCE_EAGER_KEYMAP_MASK
+
+#    include "matrix.h"
+
+// Bitmask of keys in the row that only ever carry plain, non-modifier keycodes,
+// for feeding the mixed_eager_defer_pk debounce algorithm: those keys can take
+// eager debouncing, while modifiers, mod-taps and layer keys stay deferred.
+matrix_row_t keymap_eager_debounce_mask(uint8_t row);
+// Drop the cached masks, e.g. after a dynamic keymap write; rebuilt on next lookup.
+void keymap_eager_debounce_mask_invalidate(void);
+
+#endif // DEBOUNCE_EAGER_KEYMAP_MASK
+
+#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_LAYER_INDICATOR_MAP)
+
+// Bitmap of LED indices whose key holds a non-transparent keycode on the layer,
+// one bit per LED; NULL for out-of-range layers.
+const uint8_t *keymap_layer_led_map(uint8_t layer_num);
+// Drop the cached bitmaps, e.g. after a dynamic keymap write; rebuilt on next lookup.
+void keymap_layer_led_map_invalidate(void);
+
+#endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_LAYER_INDICATOR_MAP)
+
+#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_INDICATOR_RULES)
+
+#    include "rgb_matrix.h"
+
+// Number of entries in the keymap's rgb_matrix_indicator_rules[] table.
+uint8_t rgb_matrix_indicator_rules_count_raw(void);
+uint8_t rgb_matrix_indicator_rules_count(void);
+
+// The rule itself.
+rgb_matrix_indicator_rule_t rgb_matrix_indicator_rule_get_raw(uint8_t rule_index);
+rgb_matrix_indicator_rule_t rgb_matrix_indicator_rule_get(uint8_t rule_index);
+
+// Bitmap of LED indices the rule's predicate matches, one bit per LED; NULL for out-of-range rules.
+const uint8_t *keymap_indicator_rule_led_map(uint8_t rule_index);
+// Drop the cached bitmaps, e.g. after a dynamic keymap write; rebuilt on next lookup.
+void keymap_indicator_rule_led_map_invalidate(void);
+
+#endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_INDICATOR_RULES)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Combos
+
+#if defined(COMBO_ENABLE) && defined(COMBO_KEY_INDEX_ENABLE)
+
+// One entry of the inverted combo index: a keycode and one combo it participates in.
+typedef struct combo_key_index_entry_t {
+    uint16_t keycode;
+    uint16_t combo_index;
+} combo_key_index_entry_t;
+
+// Looks up the combos a keycode can participate in, so a key event only has to consider those instead of scanning
+// every combo. On success, `first`/`count` describe a contiguous run of entries for the keycode (in combo index
+// order). Returns false if the index could not hold the keymap's combos, in which case the caller should fall back
+// to scanning every combo.
+bool combo_key_index_lookup(uint16_t keycode, const combo_key_index_entry_t **first, uint16_t *count);
+// Drop the index, e.g. after modifying combo key arrays held in RAM; rebuilt on next lookup.
+void combo_key_index_invalidate(void);
+
+#endif // defined(COMBO_ENABLE) && defined(COMBO_KEY_INDEX_ENABLE)
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Encoder mapping
 
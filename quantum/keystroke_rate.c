@@ -0,0 +1,68 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keystroke_rate.h"
+#include "timer.h"
+
+/* The estimate is kept in 8.8 fixed point: the integer part is the 0..255
+ * energy value handed to consumers. Each keypress adds a fixed impulse
+ * (saturating), so sustained typing ramps the value up; decay is exponential
+ * with a configurable half-life and is applied lazily when the value is
+ * read, by folding in however much time has passed since the last fold.
+ * There is no decay task and no per-consumer bookkeeping.
+ *
+ * The defaults roughly match the retired velocikey curve: full scale after
+ * about a hundred rapid keypresses, falling back over tens of seconds. */
+
+#ifndef KEYSTROKE_RATE_IMPULSE
+#    define KEYSTROKE_RATE_IMPULSE ((255 << 8) / 100)
+#endif
+#ifndef KEYSTROKE_RATE_DECAY_HALFLIFE_MS
+#    define KEYSTROKE_RATE_DECAY_HALFLIFE_MS 10000
+#endif
+
+/* Decay is quantized to eighths of a half-life; one step multiplies the
+ * energy by 11/12 (~2^(-1/8)), so eight steps halve it. */
+#define DECAY_STEP_MS (KEYSTROKE_RATE_DECAY_HALFLIFE_MS / 8)
+
+static uint16_t energy      = 0; // 8.8 fixed point
+static uint32_t decay_timer = 0; // last time decay was folded in
+
+static void fold_decay(void) {
+    if (energy == 0) {
+        decay_timer = timer_read32();
+        return;
+    }
+    uint32_t steps = timer_elapsed32(decay_timer) / DECAY_STEP_MS;
+    if (steps == 0) {
+        return;
+    }
+    if (steps >= 8 * 16) { // sixteen half-lives: nothing measurable left
+        energy      = 0;
+        decay_timer = timer_read32();
+        return;
+    }
+    decay_timer += steps * DECAY_STEP_MS;
+    while (steps-- && energy != 0) {
+        uint16_t step = energy / 12;
+        energy -= step ? step : 1;
+    }
+}
+
+void keystroke_rate_pulse(void) {
+    fold_decay();
+    if (energy > (255 << 8) - KEYSTROKE_RATE_IMPULSE) {
+        energy = 255 << 8;
+    } else {
+        energy += KEYSTROKE_RATE_IMPULSE;
+    }
+}
+
+uint8_t keystroke_rate_get(void) {
+    fold_decay();
+    return energy >> 8;
+}
+
+uint8_t keystroke_rate_scale(uint8_t from, uint8_t to) {
+    return from + (int32_t)((int16_t)to - (int16_t)from) * keystroke_rate_get() / 255;
+}
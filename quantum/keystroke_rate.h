@@ -0,0 +1,17 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+/* Shared keystroke-rate estimator. Consumers that want to react to how fast
+ * the user is typing (velocikey, speed-reactive lighting, ...) sample one
+ * common fixed-point energy value instead of each keeping their own counter
+ * and periodic decay task. Feeding costs one saturating add per keypress;
+ * exponential decay is folded into the reads, so an idle board does no
+ * periodic work at all. */
+
+void    keystroke_rate_pulse(void);                     // feed one keypress into the estimator
+uint8_t keystroke_rate_get(void);                       // current typing energy, 0 (idle) .. 255 (flat out)
+uint8_t keystroke_rate_scale(uint8_t from, uint8_t to); // map the current energy linearly onto [from, to]
@@ -0,0 +1,111 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "latency_histogram.h"
+#include "timer.h"
+
+#ifdef RAW_ENABLE
+#    include "raw_hid.h"
+#endif
+
+// Buckets are one millisecond wide; the final bucket absorbs outliers.
+static uint32_t histograms[LATENCY_STAGE_COUNT][LATENCY_HISTOGRAM_BUCKETS];
+
+static uint16_t pending_capture_time;
+static bool     report_pending = false;
+
+static void record(uint8_t stage, uint16_t delta_ms) {
+    if (delta_ms >= LATENCY_HISTOGRAM_BUCKETS) {
+        delta_ms = LATENCY_HISTOGRAM_BUCKETS - 1;
+    }
+    histograms[stage][delta_ms]++;
+}
+
+void latency_histogram_note_event(uint16_t capture_time) {
+    record(LATENCY_STAGE_PROCESS, TIMER_DIFF_16(timer_read(), capture_time));
+    pending_capture_time = capture_time;
+    report_pending       = true;
+}
+
+void latency_histogram_note_report(void) {
+    // Attribute the report to the event that triggered it, once; reports
+    // sent outside event processing (e.g. unregister sweeps) are skipped.
+    if (report_pending) {
+        record(LATENCY_STAGE_REPORT, TIMER_DIFF_16(timer_read(), pending_capture_time));
+        report_pending = false;
+    }
+}
+
+const uint32_t *latency_histogram_get(uint8_t stage) {
+    if (stage >= LATENCY_STAGE_COUNT) {
+        return NULL;
+    }
+    return histograms[stage];
+}
+
+void latency_histogram_reset(void) {
+    memset(histograms, 0, sizeof(histograms));
+}
+
+bool latency_histogram_raw_hid_command(uint8_t *data, uint8_t length) {
+    if (length < 3 || data[0] != LATENCY_HISTOGRAM_HID_COMMAND) {
+        return false;
+    }
+
+    uint8_t stage = data[1];
+    uint8_t chunk = data[2];
+
+    if (stage == 0xFF) {
+        latency_histogram_reset();
+    } else if (stage < LATENCY_STAGE_COUNT) {
+        // Buckets are returned as little-endian uint32, seven per packet
+        // so a chunked response fits the 32-byte raw HID report.
+        uint8_t out = 3;
+        for (uint8_t i = chunk * 7; i < (chunk + 1) * 7 && i < LATENCY_HISTOGRAM_BUCKETS; i++) {
+            if (out + 4 > length) {
+                break;
+            }
+            uint32_t count = histograms[stage][i];
+            data[out++]    = count & 0xFF;
+            data[out++]    = (count >> 8) & 0xFF;
+            data[out++]    = (count >> 16) & 0xFF;
+            data[out++]    = (count >> 24) & 0xFF;
+        }
+        memset(&data[out], 0, length - out);
+    } else {
+        return false;
+    }
+
+#ifdef RAW_ENABLE
+    raw_hid_send(data, length);
+#endif
+    return true;
+}
+
+#if defined(RAW_ENABLE) && !defined(VIA_ENABLE) && !defined(RAW_HID_STREAM_ENABLE)
+#    ifdef EVENT_TRACE_ENABLE
+#        include "event_trace.h"
+#    endif
+#    ifdef TELEMETRY_COUNTERS_ENABLE
+#        include "telemetry_counters.h"
+#    endif
+// Keyboards with their own raw HID protocol override this and forward
+// matching packets to latency_histogram_raw_hid_command() themselves.
+// With RAW_HID_STREAM_ENABLE, raw_hid_stream.c owns the endpoint and
+// forwards histogram queries here instead.
+__attribute__((weak)) void raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (latency_histogram_raw_hid_command(data, length)) {
+        return;
+    }
+#    ifdef EVENT_TRACE_ENABLE
+    if (event_trace_raw_hid_command(data, length)) {
+        return;
+    }
+#    endif
+#    ifdef TELEMETRY_COUNTERS_ENABLE
+    telemetry_counters_raw_hid_command(data, length);
+#    endif
+}
+#endif
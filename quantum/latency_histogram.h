@@ -0,0 +1,57 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * \file
+ *
+ * \brief Hot-path latency instrumentation.
+ *
+ * With `LATENCY_HISTOGRAM_ENABLE = yes`, key events are timestamped at
+ * capture (`MAKE_KEYEVENT`), at the start of `action_exec()`, and at
+ * `host_keyboard_send()`. The deltas are accumulated into fixed-bucket
+ * histograms in RAM (one millisecond per bucket, last bucket catches
+ * everything past the range), cheap enough to leave enabled on production
+ * boards.
+ *
+ * Host access goes over raw HID: a request whose first byte is
+ * `LATENCY_HISTOGRAM_HID_COMMAND` and second byte is the stage id is
+ * answered with the bucket counts, little-endian. Keyboards already using
+ * raw HID (e.g. VIA) forward matching packets to
+ * `latency_histogram_raw_hid_command()`; otherwise the weak
+ * `raw_hid_receive()` provided here answers directly.
+ */
+
+enum latency_histogram_stage {
+    LATENCY_STAGE_PROCESS, // capture -> action_exec() entry
+    LATENCY_STAGE_REPORT,  // capture -> host_keyboard_send()
+    LATENCY_STAGE_COUNT
+};
+
+#ifndef LATENCY_HISTOGRAM_BUCKETS
+#    define LATENCY_HISTOGRAM_BUCKETS 16
+#endif
+
+#ifndef LATENCY_HISTOGRAM_HID_COMMAND
+#    define LATENCY_HISTOGRAM_HID_COMMAND 0x7A
+#endif
+
+/* Called from action_exec() with the event's capture timestamp. */
+void latency_histogram_note_event(uint16_t capture_time);
+
+/* Called from host_keyboard_send(); attributes the report to the most
+ * recently noted event, once. */
+void latency_histogram_note_report(void);
+
+/* Bucket counts for one stage; returns NULL for an invalid stage. */
+const uint32_t *latency_histogram_get(uint8_t stage);
+
+void latency_histogram_reset(void);
+
+/* Handle a raw HID request; returns true (and fills `data` with the
+ * response) if the packet was a histogram command. */
+bool latency_histogram_raw_hid_command(uint8_t *data, uint8_t length);
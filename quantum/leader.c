@@ -7,6 +7,13 @@
 
 #include <string.h>
 
+#ifdef SEQUENCE_DEFERRED_TIMEOUT
+#    ifndef DEFERRED_EXEC_ENABLE
+#        error "SEQUENCE_DEFERRED_TIMEOUT requires DEFERRED_EXEC_ENABLE"
+#    endif
+#    include "deferred_exec.h"
+#endif
+
 #ifndef LEADER_TIMEOUT
 #    define LEADER_TIMEOUT 300
 #endif
@@ -21,6 +28,32 @@ __attribute__((weak)) void leader_start_user(void) {}
 
 __attribute__((weak)) void leader_end_user(void) {}
 
+#ifdef SEQUENCE_DEFERRED_TIMEOUT
+/* The timeout lives as a deferred executor deadline instead of a per-loop
+ * timer poll: it is (re)armed whenever the sequence timer would restart and
+ * cancelled when the sequence ends on its own. */
+static deferred_token leader_timeout_token = INVALID_DEFERRED_TOKEN;
+
+static uint32_t leader_timeout_callback(uint32_t trigger_time, void *cb_arg) {
+    leader_timeout_token = INVALID_DEFERRED_TOKEN;
+    if (leading) {
+        leader_end();
+    }
+    return 0;
+}
+
+static void leader_timeout_arm(uint32_t delay) {
+    if (!extend_deferred_exec(leader_timeout_token, delay)) {
+        leader_timeout_token = defer_exec(delay, leader_timeout_callback, NULL);
+    }
+}
+
+static void leader_timeout_disarm(void) {
+    cancel_deferred_exec(leader_timeout_token);
+    leader_timeout_token = INVALID_DEFERRED_TOKEN;
+}
+#endif
+
 void leader_start(void) {
     if (leading) {
         return;
@@ -30,17 +63,79 @@ void leader_start(void) {
     leader_time          = timer_read();
     leader_sequence_size = 0;
     memset(leader_sequence, 0, sizeof(leader_sequence));
+#if defined(SEQUENCE_DEFERRED_TIMEOUT) && !defined(LEADER_NO_TIMEOUT)
+    // With LEADER_NO_TIMEOUT the clock only starts on the first sequence key.
+    leader_timeout_arm(LEADER_TIMEOUT + 1);
+#endif
+}
+
+#ifdef LEADER_MAP_ENABLE
+// Fires the action of the entry that the sequence buffer matches exactly, if there is one
+static void leader_map_dispatch(void) {
+    for (uint8_t i = 0; leader_map[i].action != NULL; i++) {
+        const uint16_t *sequence = leader_map[i].sequence;
+        bool            match    = true;
+
+        for (uint8_t j = 0; j < ARRAY_SIZE(leader_sequence); j++) {
+            uint16_t expected = j < leader_sequence_size ? leader_sequence[j] : 0;
+
+            if (sequence[j] != expected) {
+                match = false;
+                break;
+            }
+        }
+
+        if (match) {
+            leader_map[i].action();
+            return;
+        }
+    }
 }
 
+void leader_map_update(void) {
+    bool can_continue = false;
+
+    for (uint8_t i = 0; leader_map[i].action != NULL && !can_continue; i++) {
+        const uint16_t *sequence = leader_map[i].sequence;
+        bool            prefix   = true;
+
+        for (uint8_t j = 0; j < leader_sequence_size; j++) {
+            if (sequence[j] != leader_sequence[j]) {
+                prefix = false;
+                break;
+            }
+        }
+
+        // An entry extending beyond the buffer keeps the sequence open
+        if (prefix && leader_sequence_size < ARRAY_SIZE(leader_sequence) && sequence[leader_sequence_size] != 0) {
+            can_continue = true;
+        }
+    }
+
+    if (!can_continue) {
+        // No entry can consume further keys: either the buffer completes an entry, which leader_end() fires right away, or the prefix is dead and the sequence is abandoned
+        leader_end();
+    }
+}
+#endif // LEADER_MAP_ENABLE
+
 void leader_end(void) {
     leading = false;
+#ifdef SEQUENCE_DEFERRED_TIMEOUT
+    leader_timeout_disarm();
+#endif
+#ifdef LEADER_MAP_ENABLE
+    leader_map_dispatch();
+#endif
     leader_end_user();
 }
 
 void leader_task(void) {
+#ifndef SEQUENCE_DEFERRED_TIMEOUT
     if (leader_sequence_active() && leader_sequence_timed_out()) {
         leader_end();
     }
+#endif
 }
 
 bool leader_sequence_active(void) {
@@ -65,15 +160,29 @@ bool leader_sequence_add(uint16_t keycode) {
 }
 
 bool leader_sequence_timed_out(void) {
+    return leader_sequence_timed_out_at(timer_read());
+}
+
+bool leader_sequence_timed_out_at(uint16_t event_time) {
 #if defined(LEADER_NO_TIMEOUT)
-    return leader_sequence_size > 0 && timer_elapsed(leader_time) > LEADER_TIMEOUT;
+    return leader_sequence_size > 0 && TIMER_DIFF_16(event_time, leader_time) > LEADER_TIMEOUT;
 #else
-    return timer_elapsed(leader_time) > LEADER_TIMEOUT;
+    return TIMER_DIFF_16(event_time, leader_time) > LEADER_TIMEOUT;
 #endif
 }
 
 void leader_reset_timer(void) {
-    leader_time = timer_read();
+    leader_reset_timer_at(timer_read());
+}
+
+void leader_reset_timer_at(uint16_t event_time) {
+    leader_time = event_time;
+#ifdef SEQUENCE_DEFERRED_TIMEOUT
+    // The deferred deadline runs on the wall clock -- shorten it by however long the anchoring event
+    // already sat between capture and processing.
+    uint16_t queued = timer_elapsed(event_time);
+    leader_timeout_arm(queued < LEADER_TIMEOUT ? (uint32_t)(LEADER_TIMEOUT + 1 - queued) : 1);
+#endif
 }
 
 bool leader_sequence_is(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5) {
@@ -1,6 +1,8 @@
 // Copyright 2023 QMK
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#pragma once
+
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -56,11 +58,28 @@ bool leader_sequence_add(uint16_t keycode);
  */
 bool leader_sequence_timed_out(void);
 
+/**
+ * Whether the leader sequence had reached the timeout as of the given event timestamp.
+ *
+ * Judging the timeout at the key's capture time instead of its processing time keeps the sequence
+ * window independent of processing backlog.
+ *
+ * \param event_time The `event.time` of the key event being processed.
+ */
+bool leader_sequence_timed_out_at(uint16_t event_time);
+
 /**
  * Reset the leader sequence timer.
  */
 void leader_reset_timer(void);
 
+/**
+ * Reset the leader sequence timer to the given event timestamp.
+ *
+ * \param event_time The `event.time` of the key event being processed.
+ */
+void leader_reset_timer_at(uint16_t event_time);
+
 /**
  * Check the sequence buffer for the given keycode.
  *
@@ -116,4 +135,43 @@ bool leader_sequence_four_keys(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_
  */
 bool leader_sequence_five_keys(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5);
 
+#ifdef LEADER_MAP_ENABLE
+/**
+ * \brief A single leader map entry, pairing a sequence with its action.
+ *
+ * Unused trailing positions in `sequence` must be zero (`KC_NO`).
+ */
+typedef struct leader_map_entry_t {
+    uint16_t sequence[5];
+    void (*action)(void);
+} leader_map_entry_t;
+
+/**
+ * \brief Convenience initializer for a leader map entry.
+ *
+ * Example: `LEADER_SEQUENCE(my_action, KC_A, KC_B)`
+ */
+#    define LEADER_SEQUENCE(fn, ...) \
+        { .sequence = {__VA_ARGS__}, .action = (fn) }
+
+/**
+ * \brief Leader map terminator, must be the last entry.
+ */
+#    define LEADER_MAP_END \
+        { .sequence = {0}, .action = NULL }
+
+/**
+ * The leader map, defined in the keymap. Terminated with `LEADER_MAP_END`.
+ */
+extern const leader_map_entry_t leader_map[];
+
+/**
+ * Match the sequence buffer against the leader map after a key was added.
+ *
+ * Ends the sequence early when no entry can match any longer, which also fires
+ * an entry the buffer completes uniquely, without waiting for the timeout.
+ */
+void leader_map_update(void);
+#endif
+
 /** \} */
@@ -169,6 +169,15 @@ void led_wakeup(void) {
     led_set(host_keyboard_leds());
 }
 
+// Set when the host pushes a new LED report (USB SET_REPORT, split sync,
+// wireless drivers); cleared once led_task() has looked at the state.
+// Starts dirty so the initial state is applied on the first pass.
+static volatile bool led_state_dirty = true;
+
+void led_update_dirty(void) {
+    led_state_dirty = true;
+}
+
 /** \brief set host led state
  *
  * Only sets state if change detected
@@ -177,6 +186,10 @@ void led_task(void) {
     static uint8_t last_led_status = 0;
 
     // update LED
+    if (!led_state_dirty) {
+        return;
+    }
+    led_state_dirty    = false;
     uint8_t led_status = host_keyboard_leds();
     if (last_led_status != led_status) {
         last_led_status            = led_status;
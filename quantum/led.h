@@ -55,6 +55,9 @@ void led_wakeup(void);
 
 void led_task(void);
 
+/* Marks the host LED state as changed; safe to call from ISR context. */
+void led_update_dirty(void);
+
 /* Deprecated callbacks */
 void led_set_user(uint8_t usb_led);
 
@@ -3,7 +3,7 @@ LED_MATRIX_EFFECT(BAND_SPIRAL)
 #    ifdef LED_MATRIX_CUSTOM_EFFECT_IMPLS
 
 static uint8_t BAND_SPIRAL_math(uint8_t val, int16_t dx, int16_t dy, uint8_t dist, uint8_t time) {
-    return scale8(val + dist - time - atan2_8(dy, dx), val);
+    return scale8(val + dist - time - fp_atan2_8(dy, dx), val);
 }
 
 bool BAND_SPIRAL(effect_params_t* params) {
@@ -25,6 +25,11 @@
 #include "led_tables.h"
 
 #include <lib/lib8tion/lib8tion.h>
+#include "fixed_point.h"
+
+#ifdef GAME_MODE_ENABLE
+#    include "game_mode.h"
+#endif
 
 #ifndef LED_MATRIX_CENTER
 const led_point_t k_led_matrix_center = {112, 32};
@@ -158,7 +163,7 @@ void led_matrix_update_pwm_buffers(void) {
 
 void led_matrix_set_value(int index, uint8_t value) {
 #ifdef USE_CIE1931_CURVE
-    value = pgm_read_byte(&CIE1931_CURVE[value]);
+    value = cie1931_curve_read(value);
 #endif
     led_matrix_driver.set_value(index, value);
 }
@@ -169,7 +174,7 @@ void led_matrix_set_value_all(uint8_t value) {
         led_matrix_set_value(i, value);
 #else
 #    ifdef USE_CIE1931_CURVE
-    led_matrix_driver.set_value_all(pgm_read_byte(&CIE1931_CURVE[value]));
+    led_matrix_driver.set_value_all(cie1931_curve_read(value));
 #    else
     led_matrix_driver.set_value_all(value);
 #    endif
@@ -261,10 +266,48 @@ static void led_task_timers(void) {
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 }
 
+#ifdef LED_MATRIX_FRAME_GOVERNOR
+// Best-effort frame pacing, same scheme as the rgb_matrix governor: once a
+// second, compare the measured main-loop scan rate against the configured
+// floor and halve or restore the frame rate one power-of-two step at a time.
+// Decimation raises the scan rate, so restoring waits for twice the floor to
+// keep the loop from hunting. Set the floor comfortably below the board's
+// idle scan rate.
+static uint8_t led_frame_governor_decimation(void) {
+    static uint32_t governor_eval_timer = 0;
+    static uint8_t  decimation          = 1;
+
+#    ifdef GAME_MODE_ENABLE
+    // Game mode pins the governor at its floor: maximum decimation, so
+    // lighting gives up as much loop time as it is allowed to.
+    if (game_mode_is_active()) {
+        return LED_MATRIX_GOVERNOR_MAX_DECIMATION;
+    }
+#    endif
+
+    if (sync_timer_elapsed32(governor_eval_timer) >= 1000) {
+        governor_eval_timer = sync_timer_read32();
+        uint32_t scan_rate  = get_matrix_scan_rate();
+        if (scan_rate != 0) {
+            if (scan_rate < LED_MATRIX_GOVERNOR_SCAN_RATE_FLOOR && decimation < LED_MATRIX_GOVERNOR_MAX_DECIMATION) {
+                decimation <<= 1;
+            } else if (scan_rate >= 2 * LED_MATRIX_GOVERNOR_SCAN_RATE_FLOOR && decimation > 1) {
+                decimation >>= 1;
+            }
+        }
+    }
+    return decimation;
+}
+#endif // LED_MATRIX_FRAME_GOVERNOR
+
 static void led_task_sync(void) {
     eeconfig_flush_led_matrix(false);
     // next task
+#ifdef LED_MATRIX_FRAME_GOVERNOR
+    if (sync_timer_elapsed32(g_led_timer) >= (uint32_t)LED_MATRIX_LED_FLUSH_LIMIT * led_frame_governor_decimation()) led_task_state = STARTING;
+#else
     if (sync_timer_elapsed32(g_led_timer) >= LED_MATRIX_LED_FLUSH_LIMIT) led_task_state = STARTING;
+#endif
 }
 
 static void led_task_start(void) {
@@ -41,6 +41,17 @@
 #    define LED_MATRIX_LED_FLUSH_LIMIT 16
 #endif
 
+#ifdef LED_MATRIX_FRAME_GOVERNOR
+// Main-loop scans per second below which frames start being decimated
+#    ifndef LED_MATRIX_GOVERNOR_SCAN_RATE_FLOOR
+#        define LED_MATRIX_GOVERNOR_SCAN_RATE_FLOOR 1000
+#    endif
+// Upper bound on frame-time multiplication; power of two
+#    ifndef LED_MATRIX_GOVERNOR_MAX_DECIMATION
+#        define LED_MATRIX_GOVERNOR_MAX_DECIMATION 8
+#    endif
+#endif
+
 #ifndef LED_MATRIX_LED_PROCESS_LIMIT
 #    define LED_MATRIX_LED_PROCESS_LIMIT (LED_MATRIX_LED_COUNT + 4) / 5
 #endif
@@ -15,12 +15,41 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "led_tables.h"
 
+// With LED_TABLES_RAM_CACHE the tables are deliberately non-const and
+// word-aligned: the linker places them in .data, the startup code copies them
+// to RAM, and lookups skip the flash wait-states entirely. No init hook is
+// needed. Nothing in the firmware writes to them.
+#ifdef LED_TABLES_RAM_CACHE
+#    define LED_TABLE(decl) __attribute__((aligned(4))) uint8_t decl
+#else
+#    define LED_TABLE(decl) const uint8_t decl PROGMEM
+#endif
+
 // clang-format off
 
 #ifdef USE_CIE1931_CURVE
+#    ifdef CIE1931_CURVE_COMPRESSED
+// Delta-nibble compressed form of the curve below; regenerate with
+//   util/table_compress.py --name CIE1931_CURVE
+// 256 entries compressed to 132 + 8 bytes
+static const uint8_t cie1931_curve_data[132] PROGMEM = {
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x10, 0x00,
+    0x01, 0x0C, 0x10, 0x00, 0x01, 0x10, 0x00, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x11, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x30, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x21, 0x11, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x12, 0x12, 0x21, 0x21, 0x11, 0x12, 0x12,
+    0x22, 0x21, 0x01, 0x7D, 0x21, 0x12, 0x22, 0x21, 0x22, 0x21, 0x22, 0x21, 0x22, 0x22, 0x12, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x23, 0x22, 0x22, 0x32, 0x22, 0x22, 0x23, 0x32, 0x22, 0x23, 0x23, 0x32,
+    0x32, 0x32, 0x32, 0x02,
+};
+static const uint16_t cie1931_curve_offsets[4] PROGMEM = {0, 33, 66, 99};
+
+const compressed_table_t CIE1931_CURVE_TABLE = {cie1931_curve_data, cie1931_curve_offsets, 256};
+#    else
 // Lightness curve using the CIE 1931 lightness formula
 // Generated by the python script provided in http://jared.geek.nz/2013/feb/linear-led-pwm
-const uint8_t CIE1931_CURVE[256] PROGMEM = {
+LED_TABLE(CIE1931_CURVE[256]) = {
     0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,
     2,   2,   2,   3,   3,   3,   3,   3,   3,   3,   3,   4,   4,   4,   4,   4,
     4,   4,   5,   5,   5,   5,   5,   6,   6,   6,   6,   6,   7,   7,   7,   7,
@@ -38,6 +67,78 @@ const uint8_t CIE1931_CURVE[256] PROGMEM = {
   183, 186, 188, 190, 192, 194, 196, 198, 201, 203, 205, 207, 209, 212, 214, 216,
   219, 221, 223, 226, 228, 231, 233, 235, 238, 240, 243, 245, 248, 250, 253, 255
 };
+#    endif
+#endif
+
+#ifdef HSV_TO_RGB_LUT
+// Pure hues at full saturation and value, three bytes per hue, matching the
+// sextant algorithm in color.c; saturation and value are applied at runtime.
+LED_TABLE(HUE_RGB_TABLE[768]) = {
+    255,   0,   0, 255,   6,   0, 255,  12,   0, 255,  18,   0,
+    255,  24,   0, 255,  30,   0, 255,  36,   0, 255,  42,   0,
+    255,  48,   0, 255,  54,   0, 255,  60,   0, 255,  66,   0,
+    255,  72,   0, 255,  78,   0, 255,  84,   0, 255,  90,   0,
+    255,  96,   0, 255, 102,   0, 255, 108,   0, 255, 114,   0,
+    255, 120,   0, 255, 126,   0, 255, 132,   0, 255, 138,   0,
+    255, 144,   0, 255, 150,   0, 255, 156,   0, 255, 162,   0,
+    255, 168,   0, 255, 174,   0, 255, 180,   0, 255, 186,   0,
+    255, 192,   0, 255, 198,   0, 255, 204,   0, 255, 210,   0,
+    255, 216,   0, 255, 222,   0, 255, 228,   0, 255, 234,   0,
+    255, 240,   0, 255, 246,   0, 255, 252,   0, 252, 255,   0,
+    246, 255,   0, 240, 255,   0, 234, 255,   0, 228, 255,   0,
+    222, 255,   0, 216, 255,   0, 210, 255,   0, 204, 255,   0,
+    198, 255,   0, 192, 255,   0, 186, 255,   0, 180, 255,   0,
+    174, 255,   0, 168, 255,   0, 162, 255,   0, 156, 255,   0,
+    150, 255,   0, 144, 255,   0, 138, 255,   0, 132, 255,   0,
+    126, 255,   0, 120, 255,   0, 114, 255,   0, 108, 255,   0,
+    102, 255,   0,  96, 255,   0,  90, 255,   0,  84, 255,   0,
+     78, 255,   0,  72, 255,   0,  66, 255,   0,  60, 255,   0,
+     54, 255,   0,  48, 255,   0,  42, 255,   0,  36, 255,   0,
+     30, 255,   0,  24, 255,   0,  18, 255,   0,  12, 255,   0,
+      6, 255,   0,   0, 255,   0,   0, 255,   6,   0, 255,  12,
+      0, 255,  18,   0, 255,  24,   0, 255,  30,   0, 255,  36,
+      0, 255,  42,   0, 255,  48,   0, 255,  54,   0, 255,  60,
+      0, 255,  66,   0, 255,  72,   0, 255,  78,   0, 255,  84,
+      0, 255,  90,   0, 255,  96,   0, 255, 102,   0, 255, 108,
+      0, 255, 114,   0, 255, 120,   0, 255, 126,   0, 255, 132,
+      0, 255, 138,   0, 255, 144,   0, 255, 150,   0, 255, 156,
+      0, 255, 162,   0, 255, 168,   0, 255, 174,   0, 255, 180,
+      0, 255, 186,   0, 255, 192,   0, 255, 198,   0, 255, 204,
+      0, 255, 210,   0, 255, 216,   0, 255, 222,   0, 255, 228,
+      0, 255, 234,   0, 255, 240,   0, 255, 246,   0, 255, 252,
+      0, 252, 255,   0, 246, 255,   0, 240, 255,   0, 234, 255,
+      0, 228, 255,   0, 222, 255,   0, 216, 255,   0, 210, 255,
+      0, 204, 255,   0, 198, 255,   0, 192, 255,   0, 186, 255,
+      0, 180, 255,   0, 174, 255,   0, 168, 255,   0, 162, 255,
+      0, 156, 255,   0, 150, 255,   0, 144, 255,   0, 138, 255,
+      0, 132, 255,   0, 126, 255,   0, 120, 255,   0, 114, 255,
+      0, 108, 255,   0, 102, 255,   0,  96, 255,   0,  90, 255,
+      0,  84, 255,   0,  78, 255,   0,  72, 255,   0,  66, 255,
+      0,  60, 255,   0,  54, 255,   0,  48, 255,   0,  42, 255,
+      0,  36, 255,   0,  30, 255,   0,  24, 255,   0,  18, 255,
+      0,  12, 255,   0,   6, 255,   0,   0, 255,   6,   0, 255,
+     12,   0, 255,  18,   0, 255,  24,   0, 255,  30,   0, 255,
+     36,   0, 255,  42,   0, 255,  48,   0, 255,  54,   0, 255,
+     60,   0, 255,  66,   0, 255,  72,   0, 255,  78,   0, 255,
+     84,   0, 255,  90,   0, 255,  96,   0, 255, 102,   0, 255,
+    108,   0, 255, 114,   0, 255, 120,   0, 255, 126,   0, 255,
+    132,   0, 255, 138,   0, 255, 144,   0, 255, 150,   0, 255,
+    156,   0, 255, 162,   0, 255, 168,   0, 255, 174,   0, 255,
+    180,   0, 255, 186,   0, 255, 192,   0, 255, 198,   0, 255,
+    204,   0, 255, 210,   0, 255, 216,   0, 255, 222,   0, 255,
+    228,   0, 255, 234,   0, 255, 240,   0, 255, 246,   0, 255,
+    252,   0, 255, 255,   0, 252, 255,   0, 246, 255,   0, 240,
+    255,   0, 234, 255,   0, 228, 255,   0, 222, 255,   0, 216,
+    255,   0, 210, 255,   0, 204, 255,   0, 198, 255,   0, 192,
+    255,   0, 186, 255,   0, 180, 255,   0, 174, 255,   0, 168,
+    255,   0, 162, 255,   0, 156, 255,   0, 150, 255,   0, 144,
+    255,   0, 138, 255,   0, 132, 255,   0, 126, 255,   0, 120,
+    255,   0, 114, 255,   0, 108, 255,   0, 102, 255,   0,  96,
+    255,   0,  90, 255,   0,  84, 255,   0,  78, 255,   0,  72,
+    255,   0,  66, 255,   0,  60, 255,   0,  54, 255,   0,  48,
+    255,   0,  42, 255,   0,  36, 255,   0,  30, 255,   0,  24,
+    255,   0,  18, 255,   0,  12, 255,   0,   6, 255,   0,   0,
+};
 #endif
 
 // clang-format on
@@ -18,6 +18,42 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "progmem.h"
 #include <stdint.h>
 
+// LED_TABLES_RAM_CACHE links the tables below into .data instead of flash:
+// the startup code copies them to RAM, so on parts running with flash
+// wait-states (e.g. STM32F4 at full clock) every lookup is a zero-wait SRAM
+// read. Costs the table sizes in RAM; pointless on AVR, which reads progmem
+// in a single cycle.
+#if defined(LED_TABLES_RAM_CACHE) && defined(__AVR__)
+#    error "LED_TABLES_RAM_CACHE trades RAM for zero-wait-state reads on ARM; AVR gains nothing from it."
+#endif
+
 #ifdef USE_CIE1931_CURVE
+#    ifdef CIE1931_CURVE_COMPRESSED
+#        include "table_compression.h"
+
+extern const compressed_table_t CIE1931_CURVE_TABLE;
+
+#        define cie1931_curve_read(index) compressed_table_read(&CIE1931_CURVE_TABLE, (index))
+#    elif defined(LED_TABLES_RAM_CACHE)
+extern uint8_t CIE1931_CURVE[256];
+
+#        define cie1931_curve_read(index) (CIE1931_CURVE[(index)])
+#    else
 extern const uint8_t CIE1931_CURVE[] PROGMEM;
+
+#        define cie1931_curve_read(index) pgm_read_byte(&CIE1931_CURVE[(index)])
+#    endif
+#endif
+
+#ifdef HSV_TO_RGB_LUT
+// 256 hues at full saturation and value, three bytes (r, g, b) per entry
+#    ifdef LED_TABLES_RAM_CACHE
+extern uint8_t HUE_RGB_TABLE[768];
+
+#        define hue_rgb_table_read(hue, channel) (HUE_RGB_TABLE[(uint16_t)(hue)*3 + (channel)])
+#    else
+extern const uint8_t HUE_RGB_TABLE[768] PROGMEM;
+
+#        define hue_rgb_table_read(hue, channel) pgm_read_byte(&HUE_RGB_TABLE[(uint16_t)(hue)*3 + (channel)])
+#    endif
 #endif
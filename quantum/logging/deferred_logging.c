@@ -0,0 +1,91 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdarg.h>
+
+#include "deferred_logging.h"
+#include "print.h"
+#include "sendchar.h"
+
+#if (DEFERRED_LOGGING_BUFFER_SIZE & (DEFERRED_LOGGING_BUFFER_SIZE - 1)) != 0
+#    error "DEFERRED_LOGGING_BUFFER_SIZE must be a power of two"
+#endif
+#if (DEFERRED_LOGGING_RECORD_COUNT & (DEFERRED_LOGGING_RECORD_COUNT - 1)) != 0
+#    error "DEFERRED_LOGGING_RECORD_COUNT must be a power of two"
+#endif
+
+// Single-producer/single-consumer rings: the producer only advances the
+// head, the drain task only advances the tail, so no locking is needed.
+static uint8_t           char_buf[DEFERRED_LOGGING_BUFFER_SIZE];
+static volatile uint16_t char_head    = 0;
+static volatile uint16_t char_tail    = 0;
+static uint16_t          char_dropped = 0;
+
+typedef struct dlog_record_t {
+    const char * fmt;
+    unsigned int args[3];
+} dlog_record_t;
+
+static dlog_record_t    records[DEFERRED_LOGGING_RECORD_COUNT];
+static volatile uint8_t record_head    = 0;
+static volatile uint8_t record_tail    = 0;
+static uint16_t         record_dropped = 0;
+
+int8_t deferred_logging_sendchar(uint8_t c) {
+    uint16_t head = char_head;
+    if ((uint16_t)(head - char_tail) >= DEFERRED_LOGGING_BUFFER_SIZE) {
+        char_dropped++;
+        return -1;
+    }
+    char_buf[head & (DEFERRED_LOGGING_BUFFER_SIZE - 1)] = c;
+    char_head                                           = head + 1;
+    return 0;
+}
+
+void dlog_record(const char *fmt, uint8_t nargs, ...) {
+    uint8_t head = record_head;
+    if ((uint8_t)(head - record_tail) >= DEFERRED_LOGGING_RECORD_COUNT) {
+        record_dropped++;
+        return;
+    }
+
+    dlog_record_t *record = &records[head & (DEFERRED_LOGGING_RECORD_COUNT - 1)];
+    record->fmt           = fmt;
+
+    va_list ap;
+    va_start(ap, nargs);
+    for (uint8_t i = 0; i < 3; i++) {
+        record->args[i] = i < nargs ? va_arg(ap, unsigned int) : 0;
+    }
+    va_end(ap);
+
+    record_head = head + 1;
+}
+
+void deferred_logging_task(void) {
+    // Format at most one record per call, and only while the character
+    // ring has room for its text; xprintf() lands right back in the ring
+    // through the installed sendchar.
+    if (record_tail != record_head && (uint16_t)(char_head - char_tail) <= DEFERRED_LOGGING_BUFFER_SIZE / 2) {
+        dlog_record_t *record = &records[record_tail & (DEFERRED_LOGGING_RECORD_COUNT - 1)];
+        // Unused trailing arguments are permitted by printf semantics.
+        xprintf(record->fmt, record->args[0], record->args[1], record->args[2]);
+        record_tail++;
+    }
+
+    if ((char_dropped || record_dropped) && char_head == char_tail) {
+        uint16_t chars   = char_dropped;
+        uint16_t entries = record_dropped;
+        char_dropped     = 0;
+        record_dropped   = 0;
+        xprintf("*** console dropped %u bytes, %u records\n", chars, entries);
+    }
+
+    for (uint8_t budget = DEFERRED_LOGGING_DRAIN_CHARS; budget && char_tail != char_head; budget--) {
+        if (sendchar(char_buf[char_tail & (DEFERRED_LOGGING_BUFFER_SIZE - 1)]) < 0) {
+            // Endpoint not ready; leave the rest for the next scan.
+            break;
+        }
+        char_tail++;
+    }
+}
@@ -0,0 +1,65 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "debug.h"
+
+/**
+ * \file
+ *
+ * \brief Deferred console logging.
+ *
+ * `sendchar()` is synchronous: with hid_listen attached each character can
+ * wait on the console endpoint, so a single `dprintf()` in a hot path
+ * wrecks scan timing. With `DEFERRED_LOGGING_ENABLE = yes` console output
+ * is instead written to a lock-free ring buffer and pushed to the endpoint
+ * from `keyboard_task()`, a few characters per scan; the hot path only
+ * pays for formatting. When the buffer overflows, new output is dropped
+ * and a `*** console dropped ...` marker is emitted once it drains.
+ *
+ * For paths where even formatting is too expensive there is `dlog()`: it
+ * stores a fixed-size record (format string pointer plus up to three
+ * integer arguments) and defers the `xprintf()` to drain time. Arguments
+ * are captured at the default-promoted integer width, so `l`-sized
+ * specifiers only work where `long` and `int` match (i.e. not on AVR),
+ * and string arguments must outlive the record (literals are fine).
+ *
+ * Producers are not synchronized against each other: like `sendchar()`
+ * itself, logging is for task context, not interrupts.
+ */
+
+// Ring sizes must be powers of two.
+#ifndef DEFERRED_LOGGING_BUFFER_SIZE
+#    define DEFERRED_LOGGING_BUFFER_SIZE 256
+#endif
+#ifndef DEFERRED_LOGGING_RECORD_COUNT
+#    define DEFERRED_LOGGING_RECORD_COUNT 16
+#endif
+
+// Characters pushed to the endpoint per drain call.
+#ifndef DEFERRED_LOGGING_DRAIN_CHARS
+#    define DEFERRED_LOGGING_DRAIN_CHARS 32
+#endif
+
+/* Ring-buffering sendchar() replacement; installed by keyboard_setup(). */
+int8_t deferred_logging_sendchar(uint8_t c);
+
+/* Formats due records and pushes buffered characters to the endpoint;
+ * called from keyboard_task(). */
+void deferred_logging_task(void);
+
+void dlog_record(const char *fmt, uint8_t nargs, ...);
+
+#define DLOG_NARGS_(_0, _1, _2, _3, N, ...) N
+#define DLOG_NARGS(...) DLOG_NARGS_(dummy, ##__VA_ARGS__, 3, 2, 1, 0)
+
+/* Deferred counterpart of dprintf(): constant-time at the call site, up to
+ * three integer-sized arguments, formatted when the console drains. */
+#define dlog(fmt, ...)                                               \
+    do {                                                             \
+        if (debug_enable) {                                          \
+            dlog_record(fmt, DLOG_NARGS(__VA_ARGS__), ##__VA_ARGS__); \
+        }                                                            \
+    } while (0)
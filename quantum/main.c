@@ -16,6 +16,48 @@
 
 #include "keyboard.h"
 
+#ifdef TICKLESS_IDLE_ENABLE
+#    ifndef PROTOCOL_CHIBIOS
+#        error "TICKLESS_IDLE_ENABLE is currently only supported on ChibiOS boards"
+#    endif
+#    ifndef MATRIX_IDLE_ENABLE
+#        error "TICKLESS_IDLE_ENABLE requires MATRIX_IDLE_ENABLE, since sleeping while the matrix still polls would add scan latency"
+#    endif
+#    include "matrix_idle.h"
+#    include "wait.h"
+#    ifdef DEFERRED_EXEC_ENABLE
+#        include "deferred_exec.h"
+#    endif
+
+#    ifndef TICKLESS_IDLE_MAX_SLEEP_MS
+#        define TICKLESS_IDLE_MAX_SLEEP_MS 10
+#    endif
+
+/* Once the matrix has parked itself behind wake interrupts there is nothing
+ * for the main loop to poll at full rate, so put the thread to sleep until
+ * the next known deadline instead of spinning. The sleep is capped at
+ * TICKLESS_IDLE_MAX_SLEEP_MS so periodic work without a queryable deadline
+ * (RGB frames, OLED refresh, protocol housekeeping) still runs on time.
+ */
+static void main_loop_idle_sleep(void) {
+    if (!matrix_is_idle()) {
+        return;
+    }
+    uint32_t sleep_ms = TICKLESS_IDLE_MAX_SLEEP_MS;
+#    ifdef DEFERRED_EXEC_ENABLE
+    uint32_t next_deferred = deferred_exec_time_until_next();
+    if (next_deferred < sleep_ms) {
+        sleep_ms = next_deferred;
+    }
+#    endif
+    if (sleep_ms > 0) {
+        // On ChibiOS this parks the main thread; the idle thread then
+        // executes WFI until the deadline or any wake interrupt.
+        wait_ms(sleep_ms);
+    }
+}
+#endif // TICKLESS_IDLE_ENABLE
+
 void platform_setup(void);
 
 void protocol_setup(void);
@@ -72,5 +114,9 @@ int main(void) {
 #endif // DEFERRED_EXEC_ENABLE
 
         housekeeping_task();
+
+#ifdef TICKLESS_IDLE_ENABLE
+        main_loop_idle_sleep();
+#endif // TICKLESS_IDLE_ENABLE
     }
 }
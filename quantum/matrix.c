@@ -21,6 +21,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "matrix.h"
 #include "debounce.h"
 #include "quantum.h"
+#ifdef MATRIX_EXPANDER
+#    include "mcp23018.h"
+#endif
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
 #    include "split_common/transactions.h"
@@ -50,6 +53,23 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define MATRIX_INPUT_PRESSED_STATE 0
 #endif
 
+#if defined(MATRIX_PORTWISE_STROBE) && !defined(MATRIX_UNSELECT_DRIVE_HIGH)
+#    error MATRIX_PORTWISE_STROBE requires MATRIX_UNSELECT_DRIVE_HIGH: strobe lines must stay push-pull outputs between scans.
+#endif
+
+#if defined(MATRIX_PRESENCE_CHECK) && defined(DIRECT_PINS)
+#    error MATRIX_PRESENCE_CHECK has no effect with DIRECT_PINS: a direct scan already reads each pin exactly once.
+#endif
+
+#ifdef MATRIX_EXPANDER
+#    ifdef DIRECT_PINS
+#        error MATRIX_EXPANDER requires a strobed COL2ROW matrix, not DIRECT_PINS.
+#    endif
+#    ifdef MATRIX_PRESENCE_CHECK
+#        error MATRIX_PRESENCE_CHECK cannot see keys behind the expander; the all-rows probe only drives MCU pins.
+#    endif
+#endif
+
 #ifdef DIRECT_PINS
 static SPLIT_MUTABLE pin_t direct_pins[ROWS_PER_HAND][MATRIX_COLS] = DIRECT_PINS;
 #elif (DIODE_DIRECTION == ROW2COL) || (DIODE_DIRECTION == COL2ROW)
@@ -65,6 +85,16 @@ static SPLIT_MUTABLE_COL pin_t col_pins[MATRIX_COLS]   = MATRIX_COL_PINS;
 extern matrix_row_t raw_matrix[MATRIX_ROWS]; // raw values
 extern matrix_row_t matrix[MATRIX_ROWS];     // debounced values
 
+#ifdef KEY_EVENT_TIME_US
+// Microsecond timestamp of each strobe in the current scan, indexed by the
+// strobed line (rows for COL2ROW/direct matrices, columns for ROW2COL).
+#    if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
+static uint32_t strobe_time_us[ROWS_PER_HAND];
+#    else
+static uint32_t strobe_time_us[MATRIX_COLS];
+#    endif
+#endif
+
 #ifdef SPLIT_KEYBOARD
 // row offsets for each hand
 extern uint8_t thisHand, thatHand;
@@ -103,6 +133,79 @@ static inline uint8_t readMatrixPin(pin_t pin) {
     }
 }
 
+#ifdef MATRIX_IO_DELAY_ADAPTIVE
+#    ifdef DIRECT_PINS
+#        error MATRIX_IO_DELAY_ADAPTIVE requires a strobed matrix (COL2ROW or ROW2COL)
+#    endif
+#    ifndef MATRIX_IO_DELAY_MARGIN
+#        define MATRIX_IO_DELAY_MARGIN 4
+#    endif
+
+/* The fixed MATRIX_IO_DELAY wait is sized for the slowest plausible board;
+ * the lines on most PCBs recharge much sooner. Instead of guessing, measure
+ * at boot: discharge each input line through its own driver, release it, and
+ * count poll-loop iterations until the pull-up recovers it. The unselect
+ * delay then polls the real pins and returns the moment they all read idle,
+ * bounded by the measured worst case plus margin so a shorted or floating
+ * line cannot stall the scan. Measuring and waiting in iterations of the
+ * same kind of read loop keeps the unit honest across clocks and compilers.
+ */
+#    if (DIODE_DIRECTION == COL2ROW)
+#        define MATRIX_SETTLE_INPUT_PINS col_pins
+#        define MATRIX_SETTLE_INPUT_COUNT MATRIX_COLS
+#    else
+#        define MATRIX_SETTLE_INPUT_PINS row_pins
+#        define MATRIX_SETTLE_INPUT_COUNT ROWS_PER_HAND
+#    endif
+
+static uint16_t matrix_settle_limit = MATRIX_IO_DELAY_MARGIN;
+
+static void matrix_settle_calibrate(void) {
+    uint16_t worst = 0;
+    for (uint8_t i = 0; i < MATRIX_SETTLE_INPUT_COUNT; i++) {
+        pin_t pin = MATRIX_SETTLE_INPUT_PINS[i];
+        if (pin == NO_PIN) continue;
+        uint16_t count = 0;
+        ATOMIC_BLOCK_FORCEON {
+            // Drive the line to its pressed level, exactly the state a
+            // strobed row leaves it in, then release and time the recovery.
+            setPinOutput(pin);
+            if (MATRIX_INPUT_PRESSED_STATE != 0) {
+                writePinHigh(pin);
+            } else {
+                writePinLow(pin);
+            }
+            wait_us(1);
+            setPinInputHigh(pin);
+            while (!readMatrixPin(pin) && count < (UINT16_MAX - MATRIX_IO_DELAY_MARGIN)) {
+                count++;
+            }
+        }
+        if (count > worst) worst = count;
+    }
+    matrix_settle_limit = worst + MATRIX_IO_DELAY_MARGIN;
+}
+
+static inline bool matrix_settle_inputs_idle(void) {
+    for (uint8_t i = 0; i < MATRIX_SETTLE_INPUT_COUNT; i++) {
+        if (!readMatrixPin(MATRIX_SETTLE_INPUT_PINS[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void matrix_output_unselect_delay(uint8_t line, bool key_pressed) {
+    (void)line;
+    (void)key_pressed;
+    for (uint16_t n = 0; n < matrix_settle_limit; n++) {
+        if (matrix_settle_inputs_idle()) {
+            return;
+        }
+    }
+}
+#endif // MATRIX_IO_DELAY_ADAPTIVE
+
 // matrix code
 
 #ifdef DIRECT_PINS
@@ -118,6 +221,94 @@ __attribute__((weak)) void matrix_init_pins(void) {
     }
 }
 
+#    ifdef MATRIX_PORTWISE_READ
+
+#        ifndef MATRIX_PORTWISE_MAX_PORTS
+#            define MATRIX_PORTWISE_MAX_PORTS 4
+#        endif
+
+// Per-key permutation table, mirroring the COL2ROW portwise plan: which
+// port read to consult, which bit of that read carries the switch, and
+// where it lands in the matrix row. Direct-pin boards have no row strobe,
+// so the port set covers the whole matrix rather than one column bank.
+static struct {
+    uint8_t      port_index;
+    port_data_t  port_mask;
+    matrix_row_t row_shifter;
+} direct_lookups[ROWS_PER_HAND][MATRIX_COLS];
+static pin_t   port_reference_pins[MATRIX_PORTWISE_MAX_PORTS];
+static uint8_t port_count = 0;
+
+static void portwise_init(void) {
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+        for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
+            pin_t pin = direct_pins[row][col_index];
+            if (pin == NO_PIN) {
+                direct_lookups[row][col_index].port_mask = 0;
+                continue;
+            }
+            uint8_t port_index = 0;
+            while (port_index < port_count && !samePort(port_reference_pins[port_index], pin)) {
+                port_index++;
+            }
+            if (port_index == port_count) {
+                if (port_count == MATRIX_PORTWISE_MAX_PORTS) {
+                    // Boards spreading switches over more ports should not
+                    // enable this mode; fall back to per-pin reads at runtime.
+                    port_count = 0;
+                    return;
+                }
+                port_reference_pins[port_count++] = pin;
+            }
+            direct_lookups[row][col_index].port_index  = port_index;
+            direct_lookups[row][col_index].port_mask   = pinPortMask(pin);
+            direct_lookups[row][col_index].row_shifter = row_shifter;
+        }
+    }
+}
+
+__attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row) {
+    static bool portwise_ready = false;
+    if (!portwise_ready) {
+        portwise_init();
+        portwise_ready = true;
+    }
+
+    // Start with a clear matrix row
+    matrix_row_t current_row_value = 0;
+
+    if (port_count != 0) {
+        // One load per port instead of one readPin per switch...
+        port_data_t port_values[MATRIX_PORTWISE_MAX_PORTS];
+        for (uint8_t port_index = 0; port_index < port_count; port_index++) {
+            port_values[port_index] = readPinPort(port_reference_pins[port_index]);
+        }
+
+        // ...then permute the captured bits into matrix order
+        for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++) {
+            port_data_t port_mask = direct_lookups[current_row][col_index].port_mask;
+            if (port_mask == 0) continue;
+            bool pin_high = (port_values[direct_lookups[current_row][col_index].port_index] & port_mask) != 0;
+            if (pin_high == (MATRIX_INPUT_PRESSED_STATE != 0)) {
+                current_row_value |= direct_lookups[current_row][col_index].row_shifter;
+            }
+        }
+    } else {
+        // Switches span too many ports; read pin-by-pin as usual.
+        matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+        for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
+            pin_t pin = direct_pins[current_row][col_index];
+            current_row_value |= readMatrixPin(pin) ? 0 : row_shifter;
+        }
+    }
+
+    // Update the matrix
+    current_matrix[current_row] = current_row_value;
+}
+
+#    else
+
 __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row) {
     // Start with a clear matrix row
     matrix_row_t current_row_value = 0;
@@ -132,10 +323,54 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     current_matrix[current_row] = current_row_value;
 }
 
+#    endif // MATRIX_PORTWISE_READ
+
 #elif defined(DIODE_DIRECTION)
 #    if defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS)
 #        if (DIODE_DIRECTION == COL2ROW)
 
+#            ifdef MATRIX_PORTWISE_STROBE
+
+// Strobe plan: the row pins' modes are configured exactly once at init and
+// never change, so selecting a row during a scan is a single masked write
+// to the port's data register instead of a mode switch plus a pin write.
+static port_data_t row_strobe_masks[ROWS_PER_HAND];
+
+static void strobe_plan_init(void) {
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        pin_t pin             = row_pins[row];
+        row_strobe_masks[row] = (pin != NO_PIN) ? pinPortMask(pin) : 0;
+        if (pin != NO_PIN) {
+            setPinOutput_writeHigh(pin);
+        }
+    }
+}
+
+static bool select_row(uint8_t row) {
+    if (row_strobe_masks[row] == 0) {
+        return false;
+    }
+    writePortBitsLow(row_pins[row], row_strobe_masks[row]);
+    return true;
+}
+
+static void unselect_row(uint8_t row) {
+    if (row_strobe_masks[row] != 0) {
+        writePortBitsHigh(row_pins[row], row_strobe_masks[row]);
+    }
+}
+
+__attribute__((weak)) void matrix_init_pins(void) {
+    strobe_plan_init();
+    for (uint8_t x = 0; x < MATRIX_COLS; x++) {
+        if (col_pins[x] != NO_PIN) {
+            setPinInputHigh_atomic(col_pins[x]);
+        }
+    }
+}
+
+#            else
+
 static bool select_row(uint8_t row) {
     pin_t pin = row_pins[row];
     if (pin != NO_PIN) {
@@ -148,11 +383,11 @@ static bool select_row(uint8_t row) {
 static void unselect_row(uint8_t row) {
     pin_t pin = row_pins[row];
     if (pin != NO_PIN) {
-#            ifdef MATRIX_UNSELECT_DRIVE_HIGH
+#                ifdef MATRIX_UNSELECT_DRIVE_HIGH
         setPinOutput_writeHigh(pin);
-#            else
+#                else
         setPinInputHigh_atomic(pin);
-#            endif
+#                endif
     }
 }
 
@@ -171,6 +406,100 @@ __attribute__((weak)) void matrix_init_pins(void) {
     }
 }
 
+#            endif // MATRIX_PORTWISE_STROBE
+
+#            ifdef MATRIX_PORTWISE_READ
+
+#                ifndef MATRIX_PORTWISE_MAX_PORTS
+#                    define MATRIX_PORTWISE_MAX_PORTS 2
+#                endif
+
+// Per-column permutation table: which port read to consult, which bit of
+// that read carries the column, and where it lands in the matrix row.
+static struct {
+    uint8_t      port_index;
+    port_data_t  port_mask;
+    matrix_row_t row_shifter;
+} col_lookups[MATRIX_COLS];
+static pin_t   port_reference_pins[MATRIX_PORTWISE_MAX_PORTS];
+static uint8_t port_count = 0;
+
+static void portwise_init(void) {
+    matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+    for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
+        pin_t pin = col_pins[col_index];
+        if (pin == NO_PIN) {
+            col_lookups[col_index].port_mask = 0;
+            continue;
+        }
+        uint8_t port_index = 0;
+        while (port_index < port_count && !samePort(port_reference_pins[port_index], pin)) {
+            port_index++;
+        }
+        if (port_index == port_count) {
+            if (port_count == MATRIX_PORTWISE_MAX_PORTS) {
+                // Boards spreading columns over more ports should not enable
+                // this mode; fall back to the per-pin read path at runtime.
+                port_count = 0;
+                return;
+            }
+            port_reference_pins[port_count++] = pin;
+        }
+        col_lookups[col_index].port_index  = port_index;
+        col_lookups[col_index].port_mask   = pinPortMask(pin);
+        col_lookups[col_index].row_shifter = row_shifter;
+    }
+}
+
+__attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row) {
+    static bool portwise_ready = false;
+    if (!portwise_ready) {
+        portwise_init();
+        portwise_ready = true;
+    }
+
+    // Start with a clear matrix row
+    matrix_row_t current_row_value = 0;
+
+    if (!select_row(current_row)) { // Select row
+        return;                     // skip NO_PIN row
+    }
+    matrix_output_select_delay();
+
+    if (port_count != 0) {
+        // One load per port instead of one readPin per column...
+        port_data_t port_values[MATRIX_PORTWISE_MAX_PORTS];
+        for (uint8_t port_index = 0; port_index < port_count; port_index++) {
+            port_values[port_index] = readPinPort(port_reference_pins[port_index]);
+        }
+
+        // ...then permute the captured bits into matrix order
+        for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++) {
+            port_data_t port_mask = col_lookups[col_index].port_mask;
+            if (port_mask == 0) continue;
+            bool pin_high = (port_values[col_lookups[col_index].port_index] & port_mask) != 0;
+            if (pin_high == (MATRIX_INPUT_PRESSED_STATE != 0)) {
+                current_row_value |= col_lookups[col_index].row_shifter;
+            }
+        }
+    } else {
+        // Columns span too many ports; read pin-by-pin as usual.
+        matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+        for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
+            current_row_value |= readMatrixPin(col_pins[col_index]) ? 0 : row_shifter;
+        }
+    }
+
+    // Unselect row
+    unselect_row(current_row);
+    matrix_output_unselect_delay(current_row, current_row_value != 0); // wait for all Col signals to go HIGH
+
+    // Update the matrix
+    current_matrix[current_row] = current_row_value;
+}
+
+#            else
+
 __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row) {
     // Start with a clear matrix row
     matrix_row_t current_row_value = 0;
@@ -197,8 +526,154 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     current_matrix[current_row] = current_row_value;
 }
 
+#            endif // MATRIX_PORTWISE_READ
+
+#            ifdef MATRIX_PRESENCE_CHECK
+// Drive every row active at once and take one look at the columns -- the
+// all-rows trick the suspend wake logic uses. Only says whether *any* key is
+// down; the per-row walk still attributes it.
+static bool matrix_presence_detect(void) {
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        select_row(row);
+    }
+    matrix_output_select_delay();
+
+    bool any_key_down = false;
+    for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++) {
+        if (!readMatrixPin(col_pins[col_index])) {
+            any_key_down = true;
+            break;
+        }
+    }
+
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        unselect_row(row);
+    }
+    matrix_output_unselect_delay(0, any_key_down);
+    return any_key_down;
+}
+#            endif // MATRIX_PRESENCE_CHECK
+
+#            ifdef MATRIX_EXPANDER
+
+/* The first MATRIX_EXPANDER_ROWS rows of this hand live on an MCP23018 I/O
+ * expander, wired ErgoDox-style: row lines on port A (driven low one at a
+ * time, idle high), column lines on port B (inputs with pull-ups).  Those
+ * rows' MATRIX_ROW_PINS entries should be NO_PIN; the remaining rows scan
+ * through the normal pin path.
+ *
+ * Each expander row costs one strobe write plus one sequential burst read of
+ * both GPIO ports, with the direction/pull-up configuration written once at
+ * init rather than per scan.  A bus error takes the expander offline (its
+ * rows read as all-up) and a reattach is attempted periodically, so an
+ * unplugged or glitched expander half degrades gracefully instead of
+ * stalling every scan on I2C timeouts.
+ */
+
+#                ifndef MATRIX_EXPANDER_I2C_ADDRESS
+#                    define MATRIX_EXPANDER_I2C_ADDRESS 0x20
+#                endif
+#                ifndef MATRIX_EXPANDER_ROWS
+#                    error MATRIX_EXPANDER_ROWS must state how many rows live on the expander.
+#                endif
+#                if MATRIX_COLS > 8
+#                    error MATRIX_EXPANDER supports at most 8 columns: port B is the only input port.
+#                endif
+
+static bool    matrix_expander_online = false;
+static uint8_t matrix_expander_retry  = 0;
+
+static bool matrix_expander_config(void) {
+    if (!mcp23018_set_config(MATRIX_EXPANDER_I2C_ADDRESS, mcp23018_PORTA, ALL_OUTPUT)) {
+        return false;
+    }
+    if (!mcp23018_set_config(MATRIX_EXPANDER_I2C_ADDRESS, mcp23018_PORTB, ALL_INPUT)) {
+        return false;
+    }
+    return mcp23018_set_output(MATRIX_EXPANDER_I2C_ADDRESS, mcp23018_PORTA, ALL_HIGH);
+}
+
+static void matrix_expander_init(void) {
+    mcp23018_init(MATRIX_EXPANDER_I2C_ADDRESS);
+    matrix_expander_online = matrix_expander_config();
+    if (!matrix_expander_online) {
+        dprintf("matrix expander 0x%02X not responding\n", MATRIX_EXPANDER_I2C_ADDRESS);
+    }
+}
+
+static matrix_row_t matrix_expander_read_row(uint8_t row) {
+    if (!matrix_expander_online) {
+        // Attempt a reattach every 256th read rather than paying an I2C
+        // timeout per row while the expander is absent
+        if (++matrix_expander_retry != 0) {
+            return 0;
+        }
+        matrix_expander_online = matrix_expander_config();
+        if (!matrix_expander_online) {
+            return 0;
+        }
+        dprintf("matrix expander 0x%02X attached\n", MATRIX_EXPANDER_I2C_ADDRESS);
+    }
+
+    uint16_t pins;
+    if (!mcp23018_set_output(MATRIX_EXPANDER_I2C_ADDRESS, mcp23018_PORTA, (uint8_t)~(1 << row)) || !mcp23018_readPins_all(MATRIX_EXPANDER_I2C_ADDRESS, &pins)) {
+        matrix_expander_online = false;
+        matrix_expander_retry  = 0;
+        return 0;
+    }
+
+    // Port B rides in the high byte of the burst read; keys read active-low
+    return (matrix_row_t)(~(pins >> 8) & ((1 << MATRIX_COLS) - 1));
+}
+
+#            endif // MATRIX_EXPANDER
+
 #        elif (DIODE_DIRECTION == ROW2COL)
 
+#            ifdef MATRIX_EXPANDER
+#                error MATRIX_EXPANDER requires a COL2ROW matrix: the expander strobes rows and reads columns.
+#            endif
+
+#            ifdef MATRIX_PORTWISE_STROBE
+
+// Strobe plan: see the COL2ROW variant above; here the columns strobe.
+static port_data_t col_strobe_masks[MATRIX_COLS];
+
+static void strobe_plan_init(void) {
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        pin_t pin             = col_pins[col];
+        col_strobe_masks[col] = (pin != NO_PIN) ? pinPortMask(pin) : 0;
+        if (pin != NO_PIN) {
+            setPinOutput_writeHigh(pin);
+        }
+    }
+}
+
+static bool select_col(uint8_t col) {
+    if (col_strobe_masks[col] == 0) {
+        return false;
+    }
+    writePortBitsLow(col_pins[col], col_strobe_masks[col]);
+    return true;
+}
+
+static void unselect_col(uint8_t col) {
+    if (col_strobe_masks[col] != 0) {
+        writePortBitsHigh(col_pins[col], col_strobe_masks[col]);
+    }
+}
+
+__attribute__((weak)) void matrix_init_pins(void) {
+    strobe_plan_init();
+    for (uint8_t x = 0; x < ROWS_PER_HAND; x++) {
+        if (row_pins[x] != NO_PIN) {
+            setPinInputHigh_atomic(row_pins[x]);
+        }
+    }
+}
+
+#            else
+
 static bool select_col(uint8_t col) {
     pin_t pin = col_pins[col];
     if (pin != NO_PIN) {
@@ -211,11 +686,11 @@ static bool select_col(uint8_t col) {
 static void unselect_col(uint8_t col) {
     pin_t pin = col_pins[col];
     if (pin != NO_PIN) {
-#            ifdef MATRIX_UNSELECT_DRIVE_HIGH
+#                ifdef MATRIX_UNSELECT_DRIVE_HIGH
         setPinOutput_writeHigh(pin);
-#            else
+#                else
         setPinInputHigh_atomic(pin);
-#            endif
+#                endif
     }
 }
 
@@ -234,6 +709,8 @@ __attribute__((weak)) void matrix_init_pins(void) {
     }
 }
 
+#            endif // MATRIX_PORTWISE_STROBE
+
 __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[], uint8_t current_col, matrix_row_t row_shifter) {
     bool key_pressed = false;
 
@@ -261,6 +738,30 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
     matrix_output_unselect_delay(current_col, key_pressed); // wait for all Row signals to go HIGH
 }
 
+#            ifdef MATRIX_PRESENCE_CHECK
+// See the COL2ROW variant above; here all columns strobe and the rows are read.
+static bool matrix_presence_detect(void) {
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        select_col(col);
+    }
+    matrix_output_select_delay();
+
+    bool any_key_down = false;
+    for (uint8_t row_index = 0; row_index < ROWS_PER_HAND; row_index++) {
+        if (!readMatrixPin(row_pins[row_index])) {
+            any_key_down = true;
+            break;
+        }
+    }
+
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        unselect_col(col);
+    }
+    matrix_output_unselect_delay(0, any_key_down);
+    return any_key_down;
+}
+#            endif // MATRIX_PRESENCE_CHECK
+
 #        else
 #            error DIODE_DIRECTION must be one of COL2ROW or ROW2COL!
 #        endif
@@ -302,6 +803,14 @@ void matrix_init(void) {
     // initialize key pins
     matrix_init_pins();
 
+#ifdef MATRIX_EXPANDER
+    matrix_expander_init();
+#endif
+
+#ifdef MATRIX_IO_DELAY_ADAPTIVE
+    matrix_settle_calibrate();
+#endif
+
     // initialize matrix state: all keys off
     memset(matrix, 0, sizeof(matrix));
     memset(raw_matrix, 0, sizeof(raw_matrix));
@@ -317,32 +826,142 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
     transport_master(master_matrix, slave_matrix);
     return true; // Treat the transport as always connected
 }
+
+// Fallback for transports without change reporting: they write the slave rows
+// unconditionally, so every round has to be treated as a potential change.
+__attribute__((weak)) bool transport_slave_matrix_changed(void) {
+    return true;
+}
+#endif
+
+#ifdef MATRIX_HOT_ROWS
+#    ifndef MATRIX_COLD_ROW_INTERVAL
+#        define MATRIX_COLD_ROW_INTERVAL 4
+#    endif
+/* Asymmetric scan rates: strobe lines in the MATRIX_HOT_ROWS mask are
+ * scanned every loop, the rest every MATRIX_COLD_ROW_INTERVAL loops,
+ * staggered by line index so each pass pays for the hot lines plus an even
+ * 1/Nth of the cold ones. Skipped lines replay their previous raw state, so
+ * debounce and everything above it never notice the difference. The mask
+ * indexes the strobed dimension: rows for COL2ROW and direct matrices,
+ * columns for ROW2COL; on splits it is local to each half. */
+static uint8_t matrix_scan_phase = 0;
+
+static inline bool matrix_line_due(uint8_t line) {
+    if ((MATRIX_HOT_ROWS) & ((uint32_t)1 << line)) {
+        return true;
+    }
+    return (uint8_t)(line % MATRIX_COLD_ROW_INTERVAL) == matrix_scan_phase;
+}
+#endif // MATRIX_HOT_ROWS
+
+#ifdef MATRIX_PRESENCE_CHECK
+static bool matrix_presence_can_skip(void) {
+    // A key that read down last scan (or is mid-debounce) forces a full walk
+    // so it gets attributed to its row; the presence probe only says *whether*
+    // anything is down, not where.
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        if (raw_matrix[row]) {
+            return false;
+        }
+    }
+    return !matrix_presence_detect();
+}
 #endif
 
 uint8_t matrix_scan(void) {
+#ifdef MATRIX_PRESENCE_CHECK
+    if (matrix_presence_can_skip()) {
+        // Idle fast path: one all-rows strobe instead of the per-row walk.
+        // Debounce still runs (with no changed rows) so pending release
+        // counters expire, and the usual per-scan housekeeping stays put.
+#    ifdef SPLIT_KEYBOARD
+        bool idle_changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, 0) | matrix_post_scan();
+#    else
+        bool idle_changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, 0);
+        matrix_scan_kb();
+#    endif
+        return (uint8_t)idle_changed;
+    }
+#endif
+
     matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
 
 #if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
     // Set row, read cols
     for (uint8_t current_row = 0; current_row < ROWS_PER_HAND; current_row++) {
+#    ifdef MATRIX_HOT_ROWS
+        if (!matrix_line_due(current_row)) {
+            curr_matrix[current_row] = raw_matrix[current_row];
+            continue;
+        }
+#    endif
+#    ifdef KEY_EVENT_TIME_US
+        strobe_time_us[current_row] = timer_read_us() | 1;
+#    endif
+#    ifdef MATRIX_EXPANDER
+        if (current_row < MATRIX_EXPANDER_ROWS) {
+            curr_matrix[current_row] = matrix_expander_read_row(current_row);
+            continue;
+        }
+#    endif
         matrix_read_cols_on_row(curr_matrix, current_row);
     }
 #elif (DIODE_DIRECTION == ROW2COL)
     // Set col, read rows
     matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
     for (uint8_t current_col = 0; current_col < MATRIX_COLS; current_col++, row_shifter <<= 1) {
+#    ifdef MATRIX_HOT_ROWS
+        if (!matrix_line_due(current_col)) {
+            // carry the column's previous raw bit in every row
+            for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+                curr_matrix[row] |= raw_matrix[row] & row_shifter;
+            }
+            continue;
+        }
+#    endif
+#    ifdef KEY_EVENT_TIME_US
+        strobe_time_us[current_col] = timer_read_us() | 1;
+#    endif
         matrix_read_rows_on_col(curr_matrix, current_col, row_shifter);
     }
 #endif
 
-    bool changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
-    if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
+#ifdef MATRIX_HOT_ROWS
+    matrix_scan_phase = (uint8_t)((matrix_scan_phase + 1) % MATRIX_COLD_ROW_INTERVAL);
+#endif
+
+    matrix_row_mask_t changed_rows = 0;
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        if (raw_matrix[row] != curr_matrix[row]) {
+            raw_matrix[row] = curr_matrix[row];
+            changed_rows |= matrix_row_mask(row);
+        }
+    }
 
 #ifdef SPLIT_KEYBOARD
-    changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed) | matrix_post_scan();
+    bool changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed_rows) | matrix_post_scan();
 #else
-    changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
+    bool changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed_rows);
     matrix_scan_kb();
 #endif
     return (uint8_t)changed;
 }
+
+#ifdef KEY_EVENT_TIME_US
+uint32_t matrix_get_strobe_time_us(uint8_t row, uint8_t col) {
+#    ifdef SPLIT_KEYBOARD
+    if (row < thisHand || row >= thisHand + ROWS_PER_HAND) {
+        return 0; // the other half strobes on its own clock; no local capture
+    }
+    row -= thisHand;
+#    endif
+#    if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
+    (void)col;
+    return strobe_time_us[row];
+#    else
+    (void)row;
+    return strobe_time_us[col];
+#    endif
+}
+#endif
@@ -37,6 +37,17 @@ typedef uint32_t matrix_row_t;
 
 #define MATRIX_ROW_SHIFTER ((matrix_row_t)1)
 
+/* bitmask of matrix rows, used to track which rows changed during a scan */
+typedef uint32_t matrix_row_mask_t;
+
+#define MATRIX_ROW_MASK_ALL (~(matrix_row_mask_t)0)
+
+/* Rows beyond bit 31 share the top bit, degrading gracefully to "some row
+ * in this group changed" rather than ever skipping a changed row. */
+static inline matrix_row_mask_t matrix_row_mask(uint8_t row) {
+    return (matrix_row_mask_t)1 << ((row < 31) ? row : 31);
+}
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -49,6 +60,8 @@ uint8_t matrix_cols(void);
 void matrix_setup(void);
 /* intialize matrix for scaning. */
 void matrix_init(void);
+/* (re)configure the matrix GPIO pins for scanning. (overridable) */
+void matrix_init_pins(void);
 /* scan all key states on matrix */
 uint8_t matrix_scan(void);
 /* whether matrix scanning operations should be executed */
@@ -57,6 +70,11 @@ bool matrix_can_read(void);
 bool matrix_is_on(uint8_t row, uint8_t col);
 /* matrix state on row */
 matrix_row_t matrix_get_row(uint8_t row);
+#ifdef KEY_EVENT_TIME_US
+/* microsecond timestamp of the strobe that last sampled the given key, or 0
+ * when no local capture exists (other split half, custom matrix) */
+uint32_t matrix_get_strobe_time_us(uint8_t row, uint8_t col);
+#endif
 /* print matrix for debug */
 void matrix_print(void);
 /* delay between changing matrix pin state and reading values */
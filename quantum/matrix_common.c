@@ -69,6 +69,16 @@ inline matrix_row_t matrix_get_row(uint8_t row) {
 #endif
 }
 
+#ifdef KEY_EVENT_TIME_US
+// Overridden by the generic matrix implementation; custom matrices without
+// their own capture report "no strobe timestamp available".
+__attribute__((weak)) uint32_t matrix_get_strobe_time_us(uint8_t row, uint8_t col) {
+    (void)row;
+    (void)col;
+    return 0;
+}
+#endif
+
 #if (MATRIX_COLS <= 8)
 #    define print_matrix_header() print("\nr/c 01234567\n")
 #    define print_matrix_row(row) print_bin_reverse8(matrix_get_row(row))
@@ -95,22 +105,22 @@ void matrix_print(void) {
 bool matrix_post_scan(void) {
     bool changed = false;
     if (is_keyboard_master()) {
-        static bool  last_connected              = false;
-        matrix_row_t slave_matrix[ROWS_PER_HAND] = {0};
-        if (transport_master_if_connected(matrix + thisHand, slave_matrix)) {
-            changed = memcmp(matrix + thatHand, slave_matrix, sizeof(slave_matrix)) != 0;
+        static bool last_connected = false;
+        if (transport_master_if_connected(matrix + thisHand, matrix + thatHand)) {
+            // The transport writes fresh slave data straight into the live
+            // rows and reports whether anything actually changed, so no
+            // staging buffer, compare or copy is needed here.
+            changed = transport_slave_matrix_changed();
 
             last_connected = true;
         } else if (last_connected) {
             // reset other half when disconnected
-            memset(slave_matrix, 0, sizeof(slave_matrix));
+            memset(matrix + thatHand, 0, ROWS_PER_HAND * sizeof(matrix_row_t));
             changed = true;
 
             last_connected = false;
         }
 
-        if (changed) memcpy(matrix + thatHand, slave_matrix, sizeof(slave_matrix));
-
         matrix_scan_kb();
     } else {
         transport_slave(matrix + thatHand, matrix + thisHand);
@@ -166,12 +176,14 @@ __attribute__((weak)) void matrix_init(void) {
 }
 
 __attribute__((weak)) uint8_t matrix_scan(void) {
-    bool changed = matrix_scan_custom(raw_matrix);
+    // Custom implementations only report whether anything changed, so be
+    // conservative and treat every row as potentially dirty.
+    matrix_row_mask_t changed_rows = matrix_scan_custom(raw_matrix) ? MATRIX_ROW_MASK_ALL : 0;
 
 #ifdef SPLIT_KEYBOARD
-    changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed) | matrix_post_scan();
+    bool changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed_rows) | matrix_post_scan();
 #else
-    changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
+    bool changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed_rows);
     matrix_scan_kb();
 #endif
 
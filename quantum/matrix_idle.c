@@ -0,0 +1,59 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "matrix_idle.h"
+#include "keyboard.h"
+#include "matrix.h"
+
+static bool          matrix_idle         = false;
+static volatile bool matrix_wake_pending = false;
+
+__attribute__((weak)) bool matrix_idle_wake_enable(void) {
+    return false;
+}
+
+__attribute__((weak)) void matrix_idle_wake_disable(void) {}
+
+bool matrix_is_idle(void) {
+    return matrix_idle;
+}
+
+void matrix_idle_wake(void) {
+    matrix_wake_pending = true;
+}
+
+bool matrix_idle_park(void) {
+    if (matrix_idle) {
+        return true;
+    }
+    matrix_wake_pending = false;
+    if (!matrix_idle_wake_enable()) {
+        return false;
+    }
+    matrix_idle = true;
+    return true;
+}
+
+bool matrix_idle_wake_requested(void) {
+    return matrix_wake_pending;
+}
+
+bool matrix_idle_task(void) {
+    if (matrix_idle) {
+        if (matrix_wake_pending) {
+            matrix_wake_pending = false;
+            matrix_idle_wake_disable();
+            matrix_init_pins();
+            matrix_idle = false;
+            // Scan this iteration to catch the keypress; the resulting
+            // matrix change counts as activity and keeps us awake.
+            return false;
+        }
+        return true;
+    }
+
+    if (last_matrix_activity_elapsed() > MATRIX_IDLE_TIMEOUT) {
+        return matrix_idle_park();
+    }
+    return false;
+}
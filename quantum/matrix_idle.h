@@ -0,0 +1,81 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+
+/**
+ * \file
+ *
+ * \brief Interrupt-driven matrix idle engine.
+ *
+ * After `MATRIX_IDLE_TIMEOUT` milliseconds without matrix activity the scan
+ * loop is parked: the platform/keyboard arms wake interrupts on the matrix
+ * pins via `matrix_idle_wake_enable()` and `matrix_task()` is skipped
+ * entirely until `matrix_idle_wake()` is called from the wake ISR. Polling
+ * resumes at full rate on the first edge, so active-scan latency is
+ * unaffected.
+ */
+
+/* Quiet period before the matrix stops polling, in milliseconds. */
+#ifndef MATRIX_IDLE_TIMEOUT
+#    define MATRIX_IDLE_TIMEOUT 30000
+#endif
+
+/**
+ * \brief Called once per main loop iteration instead of scanning.
+ *
+ * \return true if the matrix is parked and the scan should be skipped.
+ */
+bool matrix_idle_task(void);
+
+/**
+ * \brief Whether the matrix is currently parked.
+ */
+bool matrix_is_idle(void);
+
+/**
+ * \brief Signal matrix activity from a wake interrupt handler.
+ *
+ * Safe to call from interrupt context; scanning resumes on the next main
+ * loop iteration.
+ */
+void matrix_idle_wake(void);
+
+/**
+ * \brief Park the matrix immediately, regardless of the idle timeout.
+ *
+ * Used by the USB suspend path (`SUSPEND_WAKE_INTERRUPT_ENABLE`) to stop
+ * scanning for the duration of the suspend. Unparking happens through the
+ * normal wake path once `matrix_idle_wake()` fires.
+ *
+ * \return false if wake interrupts are unavailable and the matrix must
+ *         keep polling.
+ */
+bool matrix_idle_park(void);
+
+/**
+ * \brief Whether a wake interrupt has fired since the matrix was parked.
+ *
+ * Does not consume the wake; `matrix_idle_task()` still performs the
+ * unpark on the next main loop iteration.
+ */
+bool matrix_idle_wake_requested(void);
+
+/**
+ * \brief Arm wake interrupts on the matrix pins.
+ *
+ * Implemented by the platform or keyboard. Typically this drives all rows
+ * to the selected level and enables pin-change/EXTI events on the columns,
+ * with the ISR calling `matrix_idle_wake()`.
+ *
+ * \return false if wake interrupts are unavailable; the matrix then keeps
+ *         polling and never parks.
+ */
+bool matrix_idle_wake_enable(void);
+
+/**
+ * \brief Disarm wake interrupts and restore the pins for polling.
+ */
+void matrix_idle_wake_disable(void);
@@ -20,6 +20,46 @@ MidiDevice midi_device;
 #define SYS_COMMON_2 0x20
 #define SYS_COMMON_3 0x30
 
+#ifdef MIDI_TX_QUEUE
+#    ifndef MIDI_TX_QUEUE_ENTRIES
+#        define MIDI_TX_QUEUE_ENTRIES 16
+#    endif
+
+static MIDI_EventPacket_t midi_tx_queue[MIDI_TX_QUEUE_ENTRIES];
+static uint8_t            midi_tx_count      = 0;
+static bool               midi_tx_has_noteoff = false;
+
+static bool is_noteoff(const MIDI_EventPacket_t* event) {
+    uint8_t status = event->Data1 & 0xF0;
+    return status == MIDI_NOTEOFF || (status == MIDI_NOTEON && event->Data3 == 0);
+}
+
+void midi_flush_tx(void) {
+    if (midi_tx_count == 0) {
+        return;
+    }
+
+    if (midi_tx_has_noteoff) {
+        // note-offs lead the bundle so releases are never delayed behind new
+        // notes - a late release is far more audible than a late attack
+        MIDI_EventPacket_t ordered[MIDI_TX_QUEUE_ENTRIES];
+        uint8_t            count = 0;
+        for (uint8_t i = 0; i < midi_tx_count; i++) {
+            if (is_noteoff(&midi_tx_queue[i])) ordered[count++] = midi_tx_queue[i];
+        }
+        for (uint8_t i = 0; i < midi_tx_count; i++) {
+            if (!is_noteoff(&midi_tx_queue[i])) ordered[count++] = midi_tx_queue[i];
+        }
+        send_midi_packets(ordered, count);
+    } else {
+        send_midi_packets(midi_tx_queue, midi_tx_count);
+    }
+
+    midi_tx_count       = 0;
+    midi_tx_has_noteoff = false;
+}
+#endif
+
 static void usb_send_func(MidiDevice* device, uint16_t cnt, uint8_t byte0, uint8_t byte1, uint8_t byte2) {
     MIDI_EventPacket_t event;
     event.Data1 = byte0;
@@ -69,7 +109,19 @@ static void usb_send_func(MidiDevice* device, uint16_t cnt, uint8_t byte0, uint8
         }
     }
 
+#ifdef MIDI_TX_QUEUE
+    // bundle everything generated this frame into one endpoint write; the
+    // queue is drained by midi_task(), or here when it fills up mid-frame
+    if (midi_tx_count == MIDI_TX_QUEUE_ENTRIES) {
+        midi_flush_tx();
+    }
+    if (is_noteoff(&event)) {
+        midi_tx_has_noteoff = true;
+    }
+    midi_tx_queue[midi_tx_count++] = event;
+#else
     send_midi_packet(&event);
+#endif
 }
 
 static void usb_get_midi(MidiDevice* device) {
@@ -74,7 +74,7 @@ uint8_t mk_time_to_max = MOUSEKEY_TIME_TO_MAX;
 uint8_t mk_wheel_delay = MOUSEKEY_WHEEL_DELAY / 10;
 /* milliseconds between repeated motion events (0-255) */
 #    ifdef MK_KINETIC_SPEED
-float mk_wheel_interval = 1000.0f / MOUSEKEY_WHEEL_INITIAL_MOVEMENTS;
+uint16_t mk_wheel_interval = 1000 / MOUSEKEY_WHEEL_INITIAL_MOVEMENTS;
 #    else
 uint8_t mk_wheel_interval = MOUSEKEY_WHEEL_INTERVAL;
 #    endif
@@ -190,39 +190,41 @@ const uint16_t mk_decelerated_speed = MOUSEKEY_DECELERATED_SPEED;
 const uint16_t mk_initial_speed     = MOUSEKEY_INITIAL_SPEED;
 
 static uint8_t move_unit(void) {
-    float speed = mk_initial_speed;
+    uint16_t speed = mk_initial_speed;
 
     if (mousekey_accel & ((1 << 0) | (1 << 2))) {
         speed = mousekey_accel & (1 << 2) ? mk_accelerated_speed : mk_decelerated_speed;
     } else if (mousekey_repeat && mouse_timer) {
-        const float time_elapsed = timer_elapsed(mouse_timer) / 50;
-        speed                    = mk_initial_speed + MOUSEKEY_MOVE_DELTA * time_elapsed + MOUSEKEY_MOVE_DELTA * 0.5 * time_elapsed * time_elapsed;
+        // all-integer evaluation of I + A*T + A/2*T^2, in 1/50s ticks
+        const uint32_t time_elapsed = timer_elapsed(mouse_timer) / 50;
+        uint32_t       accel_speed  = mk_initial_speed + MOUSEKEY_MOVE_DELTA * time_elapsed + (MOUSEKEY_MOVE_DELTA * time_elapsed * time_elapsed) / 2;
 
-        speed = speed > mk_base_speed ? mk_base_speed : speed;
+        speed = accel_speed > mk_base_speed ? mk_base_speed : (uint16_t)accel_speed;
     }
 
     /* convert speed to USB mouse speed 1 to 127 */
-    speed = (uint8_t)(speed / (1000.0f / mk_interval));
-    speed = speed < 1 ? 1 : speed;
+    uint16_t unit = ((uint32_t)speed * mk_interval) / 1000;
+    unit          = unit < 1 ? 1 : unit;
 
-    return speed > MOUSEKEY_MOVE_MAX ? MOUSEKEY_MOVE_MAX : speed;
+    return unit > MOUSEKEY_MOVE_MAX ? MOUSEKEY_MOVE_MAX : unit;
 }
 
 static uint8_t wheel_unit(void) {
-    float speed = MOUSEKEY_WHEEL_INITIAL_MOVEMENTS;
+    uint16_t speed = MOUSEKEY_WHEEL_INITIAL_MOVEMENTS;
 
     if (mousekey_accel & ((1 << 0) | (1 << 2))) {
         speed = mousekey_accel & (1 << 2) ? MOUSEKEY_WHEEL_ACCELERATED_MOVEMENTS : MOUSEKEY_WHEEL_DECELERATED_MOVEMENTS;
     } else if (mousekey_wheel_repeat && mouse_timer) {
         if (mk_wheel_interval != MOUSEKEY_WHEEL_BASE_MOVEMENTS) {
-            const float time_elapsed = timer_elapsed(mouse_timer) / 50;
-            speed                    = MOUSEKEY_WHEEL_INITIAL_MOVEMENTS + 1 * time_elapsed + 1 * 0.5 * time_elapsed * time_elapsed;
+            const uint32_t time_elapsed = timer_elapsed(mouse_timer) / 50;
+            uint32_t       accel_speed  = MOUSEKEY_WHEEL_INITIAL_MOVEMENTS + time_elapsed + (time_elapsed * time_elapsed) / 2;
+            speed                       = accel_speed > UINT16_MAX ? UINT16_MAX : (uint16_t)accel_speed;
         }
         speed = speed > MOUSEKEY_WHEEL_BASE_MOVEMENTS ? MOUSEKEY_WHEEL_BASE_MOVEMENTS : speed;
     }
-    mk_wheel_interval = 1000.0f / speed;
+    mk_wheel_interval = speed ? 1000 / speed : UINT16_MAX;
 
-    return (uint8_t)speed > MOUSEKEY_WHEEL_INITIAL_MOVEMENTS ? 2 : 1;
+    return speed > MOUSEKEY_WHEEL_INITIAL_MOVEMENTS ? 2 : 1;
 }
 
 #        endif /* #ifndef MK_KINETIC_SPEED */
@@ -291,6 +293,18 @@ static int8_t calc_inertia(int8_t direction, int8_t velocity) {
 #    endif
 
 void mousekey_task(void) {
+    // fast path: with no gesture in flight there is nothing to repeat,
+    // accelerate or send, so don't burn cycles on every scan
+#    ifdef MOUSEKEY_INERTIA
+    if (!mousekey_frame && !mousekey_x_dir && !mousekey_y_dir && !mousekey_x_inertia && !mousekey_y_inertia && !mouse_report.x && !mouse_report.y && !mouse_report.v && !mouse_report.h) {
+        return;
+    }
+#    else
+    if (!mouse_report.x && !mouse_report.y && !mouse_report.v && !mouse_report.h) {
+        return;
+    }
+#    endif
+
     // report cursor and scroll movement independently
     report_mouse_t tmpmr = mouse_report;
 
@@ -487,6 +501,11 @@ uint16_t        w_offsets[mkspd_COUNT]   = {MK_W_OFFSET_UNMOD, MK_W_OFFSET_0, MK
 uint16_t        w_intervals[mkspd_COUNT] = {MK_W_INTERVAL_UNMOD, MK_W_INTERVAL_0, MK_W_INTERVAL_1, MK_W_INTERVAL_2};
 
 void mousekey_task(void) {
+    // fast path: no movement keys held means nothing to repeat or send
+    if (!mouse_report.x && !mouse_report.y && !mouse_report.v && !mouse_report.h) {
+        return;
+    }
+
     // report cursor and scroll movement independently
     report_mouse_t tmpmr = mouse_report;
     mouse_report.x       = 0;
@@ -16,8 +16,16 @@
 
 #include "os_detection.h"
 
+#include <stdbool.h>
 #include <string.h>
 
+#include "timer.h"
+
+#ifdef OS_DETECTION_EEPROM_ENABLE
+#    include "eeconfig.h"
+#    include "eeprom.h"
+#endif
+
 #ifdef OS_DETECTION_DEBUG_ENABLE
 #    include "eeconfig.h"
 #    include "eeprom.h"
@@ -30,6 +38,10 @@ uint16_t usb_setups[STORED_USB_SETUPS];
 #endif
 
 #ifdef OS_DETECTION_ENABLE
+#    ifndef OS_DETECTION_DEBOUNCE
+#        define OS_DETECTION_DEBOUNCE 250
+#    endif
+
 struct setups_data_t {
     uint8_t      count;
     uint8_t      cnt_02;
@@ -47,6 +59,14 @@ struct setups_data_t setups_data = {
     .detected_os = OS_UNSURE,
 };
 
+// Once enumeration has settled (no setup packet for OS_DETECTION_DEBOUNCE
+// ms), os_detection_task() compiles the verdict into `finalized` and
+// process_wlength() degenerates to a single load-and-branch, keeping the
+// setup-packet path cheap for the string descriptor reads some hosts issue
+// throughout the session.
+static bool     finalized        = false;
+static uint16_t last_packet_time = 0;
+
 // Some collected sequences of wLength can be found in tests.
 void make_guess(void) {
     if (setups_data.count < 3) {
@@ -83,9 +103,13 @@ void make_guess(void) {
 }
 
 void process_wlength(const uint16_t w_length) {
+    if (finalized) {
+        return;
+    }
 #    ifdef OS_DETECTION_DEBUG_ENABLE
     usb_setups[setups_data.count] = w_length;
 #    endif
+    last_packet_time = timer_read();
     setups_data.count++;
     setups_data.last_wlength = w_length;
     if (w_length == 0x2) {
@@ -99,11 +123,38 @@ void process_wlength(const uint16_t w_length) {
 }
 
 os_variant_t detected_host_os(void) {
+#    ifdef OS_DETECTION_EEPROM_ENABLE
+    if (setups_data.count == 0) {
+        // No setup packet yet - serve the last finalized verdict so callers
+        // get a sensible answer from the very first scan after boot.
+        uint8_t stored = eeprom_read_byte(EECONFIG_OS_DETECTION);
+        return stored <= OS_IOS ? (os_variant_t)stored : OS_UNSURE;
+    }
+#    endif
     return setups_data.detected_os;
 }
 
+void os_detection_task(void) {
+    if (finalized || setups_data.count == 0) {
+        return;
+    }
+    if (timer_elapsed(last_packet_time) < OS_DETECTION_DEBOUNCE) {
+        return;
+    }
+    finalized = true;
+#    ifdef OS_DETECTION_EEPROM_ENABLE
+    // Persist a confident verdict only; an unsure one would clobber the
+    // stored answer used for instant availability at boot.
+    if (setups_data.detected_os != OS_UNSURE) {
+        eeprom_update_byte(EECONFIG_OS_DETECTION, (uint8_t)setups_data.detected_os);
+    }
+#    endif
+}
+
 void erase_wlength_data(void) {
     memset(&setups_data, 0, sizeof(setups_data));
+    finalized        = false;
+    last_packet_time = 0;
 }
 #endif // OS_DETECTION_ENABLE
 
@@ -30,6 +30,11 @@ typedef enum {
 void         process_wlength(const uint16_t w_length);
 os_variant_t detected_host_os(void);
 void         erase_wlength_data(void);
+
+// Finalizes the verdict once enumeration has settled (no setup packet for
+// OS_DETECTION_DEBOUNCE ms); after that, process_wlength() is a single
+// load-and-branch. Called from keyboard_task().
+void os_detection_task(void);
 #endif
 
 #ifdef OS_DETECTION_DEBUG_ENABLE
@@ -20,9 +20,13 @@ extern "C" {
 #include "os_detection.h"
 }
 
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+
 class OsDetectionTest : public ::testing::Test {
    protected:
     void SetUp() override {
+        set_time(0);
         erase_wlength_data();
     }
 };
@@ -162,3 +166,26 @@ TEST_F(OsDetectionTest, TestChibiosQuest2) {
 TEST_F(OsDetectionTest, TestVusbQuest2) {
     EXPECT_EQ(check_sequence({0xFF, 0xFF, 0xFF, 0xFE}), OS_LINUX);
 }
+
+TEST_F(OsDetectionTest, TestNotFinalizedWithinDebounce) {
+    EXPECT_EQ(check_sequence({0xFF, 0xFF, 0xFF}), OS_LINUX);
+    os_detection_task();
+    // Enumeration has not settled yet; further packets still update the guess.
+    EXPECT_EQ(check_sequence({0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF}), OS_LINUX);
+}
+
+TEST_F(OsDetectionTest, TestFinalizedVerdictIgnoresLatePackets) {
+    EXPECT_EQ(check_sequence({0x2, 0x24, 0x2, 0x28, 0xFF}), OS_MACOS);
+    advance_time(500);
+    os_detection_task();
+    // Late string descriptor reads must not disturb the finalized verdict.
+    EXPECT_EQ(check_sequence({0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}), OS_MACOS);
+}
+
+TEST_F(OsDetectionTest, TestEraseReopensDetection) {
+    EXPECT_EQ(check_sequence({0x2, 0x24, 0x2, 0x28, 0xFF}), OS_MACOS);
+    advance_time(500);
+    os_detection_task();
+    erase_wlength_data();
+    EXPECT_EQ(check_sequence({0xFF, 0xFF, 0xFF}), OS_LINUX);
+}
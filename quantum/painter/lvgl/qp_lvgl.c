@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "qp_lvgl.h"
+#include "qp_comms.h"
 #include "timer.h"
 #include "deferred_exec.h"
 #include "lvgl.h"
@@ -19,12 +20,45 @@ static lvgl_state_t        lvgl_states[2]    = {0}; // For lv_tick_inc and lv_ta
 painter_device_t selected_display = NULL;
 void *           color_buffer     = NULL;
 
+// Whether the attached display's comms driver can transmit in the background -- if so, LVGL runs double-buffered and
+// flushes are handed off as zero-copy background transfers straight from LVGL's draw buffer.
+static bool background_flush_ok = false;
+static bool flush_in_flight     = false;
+
+// Waits out any background transfer still in flight and releases the bus; LVGL's previous draw buffer is reusable
+// afterwards.
+static void qp_lvgl_sync_flush(void) {
+    if (flush_in_flight) {
+        qp_comms_sync(selected_display);
+        qp_comms_stop(selected_display);
+        flush_in_flight = false;
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter LVGL Integration Internal: qp_lvgl_flush
 
 void qp_lvgl_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
     if (selected_display) {
         uint32_t number_pixels = (area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
+
+        if (background_flush_ok) {
+            struct painter_driver_t *driver = (struct painter_driver_t *)selected_display;
+
+            // The buffer LVGL is handing back may still be on the wire from the previous flush
+            qp_lvgl_sync_flush();
+            qp_viewport(selected_display, area->x1, area->y1, area->x2, area->y2);
+
+            // Hand the draw buffer to the comms driver for background transmission, then report the flush as complete.
+            // LVGL continues rendering into the other draw buffer; the sync above fences reuse of this one.
+            if (qp_comms_start(selected_display)) {
+                qp_comms_send_nonblocking(selected_display, color_p, number_pixels * driver->native_bits_per_pixel / 8);
+                flush_in_flight = true;
+            }
+            lv_disp_flush_ready(disp);
+            return;
+        }
+
         qp_viewport(selected_display, area->x1, area->y1, area->x2, area->y2);
         qp_pixdata(selected_display, (void *)color_p, number_pixels);
         qp_flush(selected_display);
@@ -93,19 +127,24 @@ bool qp_lvgl_attach(painter_device_t device) {
     // Init LVGL
     lv_init();
 
+    // Double-buffer when the comms driver can transmit in the background, so LVGL renders the next area while the
+    // previous one is still on the wire
+    background_flush_ok = qp_comms_supports_nonblocking(device);
+
     // Set up lvgl display buffer
     static lv_disp_draw_buf_t draw_buf;
-    // Allocate a buffer for 1/10 screen size
+    // Allocate a buffer for 1/10 screen size (two of them when flushing in the background)
     const size_t count_required = driver->panel_width * driver->panel_height / 10;
-    color_buffer                = color_buffer ? realloc(color_buffer, sizeof(lv_color_t) * count_required) : malloc(sizeof(lv_color_t) * count_required);
+    const size_t bytes_required = sizeof(lv_color_t) * count_required * (background_flush_ok ? 2 : 1);
+    color_buffer                = color_buffer ? realloc(color_buffer, bytes_required) : malloc(bytes_required);
     if (!color_buffer) {
         qp_dprintf("qp_lvgl_attach: fail (could not set up memory buffer)\n");
         qp_lvgl_detach();
         return false;
     }
-    memset(color_buffer, 0, sizeof(lv_color_t) * count_required);
+    memset(color_buffer, 0, bytes_required);
     // Initialize the display buffer.
-    lv_disp_draw_buf_init(&draw_buf, color_buffer, NULL, count_required);
+    lv_disp_draw_buf_init(&draw_buf, color_buffer, background_flush_ok ? (void *)((lv_color_t *)color_buffer + count_required) : NULL, count_required);
 
     selected_display = device;
 
@@ -134,6 +173,11 @@ void qp_lvgl_detach(void) {
     for (int i = 0; i < 2; ++i) {
         cancel_deferred_exec_advanced(lvgl_executors, 2, lvgl_states[i].defer_token);
     }
+    if (selected_display) {
+        // Don't free the draw buffers while one is still being transmitted
+        qp_lvgl_sync_flush();
+    }
+    background_flush_ok = false;
     if (color_buffer) {
         free(color_buffer);
         color_buffer = NULL;
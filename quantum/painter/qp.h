@@ -56,6 +56,23 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 32
 #endif
 
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_SIZE
+/**
+ * @def This controls the size (in bytes) of the glyph cache used during font rendering. Decoded glyph data and widths
+ *      are kept in RAM, so repeated text only touches the QFF decoder for cold glyphs; least-recently-used glyphs are
+ *      evicted once the budget is exhausted. Defaults to 0, which disables the cache entirely.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_SIZE 0
+#endif
+
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES
+/**
+ * @def This controls the maximum number of glyphs the glyph cache can hold, irrespective of the configured byte
+ *      budget. Only relevant if \ref QUANTUM_PAINTER_GLYPH_CACHE_SIZE is non-zero.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES 32
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
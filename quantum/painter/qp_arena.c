@@ -0,0 +1,46 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "qp_internal.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Init-time arena for painter resources
+//
+// A bump allocator over a single static pool, sized by QUANTUM_PAINTER_ARENA_SIZE. Allocations are made once during
+// device setup (factory functions, qp_init) and are never freed, so there is no free list and no fragmentation --
+// drivers request exactly the bytes their panel geometry needs instead of reserving a compile-time maximum.
+
+#ifdef QUANTUM_PAINTER_ARENA_SIZE
+
+__attribute__((__aligned__(4))) static uint8_t qp_arena[QUANTUM_PAINTER_ARENA_SIZE];
+static uint32_t                                qp_arena_used = 0;
+
+void *qp_internal_arena_alloc(uint32_t size) {
+    // Keep subsequent allocations 4-byte aligned, matching the pixdata buffer
+    size = (size + 3) & ~(uint32_t)3;
+    if (size > (uint32_t)QUANTUM_PAINTER_ARENA_SIZE - qp_arena_used) {
+        qp_dprintf("qp_internal_arena_alloc: fail (requested %d, %d remaining)\n", (int)size, (int)((uint32_t)QUANTUM_PAINTER_ARENA_SIZE - qp_arena_used));
+        return NULL;
+    }
+    void *ptr = &qp_arena[qp_arena_used];
+    qp_arena_used += size;
+    return ptr;
+}
+
+uint32_t qp_internal_arena_remaining(void) {
+    return (uint32_t)QUANTUM_PAINTER_ARENA_SIZE - qp_arena_used;
+}
+
+#else // QUANTUM_PAINTER_ARENA_SIZE
+
+void *qp_internal_arena_alloc(uint32_t size) {
+    (void)size;
+    qp_dprintf("qp_internal_arena_alloc: fail (no arena configured, define QUANTUM_PAINTER_ARENA_SIZE)\n");
+    return NULL;
+}
+
+uint32_t qp_internal_arena_remaining(void) {
+    return 0;
+}
+
+#endif // QUANTUM_PAINTER_ARENA_SIZE
@@ -0,0 +1,89 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "qp.h"
+#include "qp_asset_pack.h"
+
+static const qp_asset_pack_header_t *validated_header(const void *pack_addr) {
+    if (!pack_addr) {
+        return NULL;
+    }
+
+    const qp_asset_pack_header_t *header = (const qp_asset_pack_header_t *)pack_addr;
+    if (header->magic != QP_ASSET_PACK_MAGIC || header->version != QP_ASSET_PACK_VERSION) {
+        return NULL;
+    }
+
+    // The index must fit inside the declared pack size.
+    uint32_t index_end = sizeof(qp_asset_pack_header_t) + ((uint32_t)header->entry_count * sizeof(qp_asset_pack_entry_t));
+    if (index_end > header->total_size) {
+        return NULL;
+    }
+
+    return header;
+}
+
+static const qp_asset_pack_entry_t *pack_index(const qp_asset_pack_header_t *header) {
+    return (const qp_asset_pack_entry_t *)((const uint8_t *)header + sizeof(qp_asset_pack_header_t));
+}
+
+static const void *entry_blob(const qp_asset_pack_header_t *header, const qp_asset_pack_entry_t *entry, uint32_t *length) {
+    // Reject entries pointing outside the pack so a stale or truncated flash region can't hand out wild pointers.
+    if (entry->offset > header->total_size || entry->length > header->total_size - entry->offset) {
+        return NULL;
+    }
+
+    if (length) {
+        *length = entry->length;
+    }
+    return (const uint8_t *)header + entry->offset;
+}
+
+bool qp_asset_pack_validate(const void *pack_addr) {
+    return validated_header(pack_addr) != NULL;
+}
+
+uint16_t qp_asset_pack_count(const void *pack_addr) {
+    const qp_asset_pack_header_t *header = validated_header(pack_addr);
+    return header ? header->entry_count : 0;
+}
+
+const void *qp_asset_pack_get(const void *pack_addr, uint16_t index, uint32_t *length) {
+    const qp_asset_pack_header_t *header = validated_header(pack_addr);
+    if (!header || index >= header->entry_count) {
+        return NULL;
+    }
+
+    return entry_blob(header, &pack_index(header)[index], length);
+}
+
+const void *qp_asset_pack_find(const void *pack_addr, const char *name, uint32_t *length) {
+    const qp_asset_pack_header_t *header = validated_header(pack_addr);
+    if (!header || !name) {
+        return NULL;
+    }
+
+    const qp_asset_pack_entry_t *entries = pack_index(header);
+    for (uint16_t i = 0; i < header->entry_count; ++i) {
+        if (strncmp(entries[i].name, name, QP_ASSET_PACK_NAME_LEN) == 0) {
+            return entry_blob(header, &entries[i], length);
+        }
+    }
+
+    qp_dprintf("qp_asset_pack_find: no asset named \"%s\"\n", name);
+    return NULL;
+}
+
+painter_image_handle_t qp_load_image_pack(const void *pack_addr, const char *name) {
+    uint32_t    length = 0;
+    const void *blob   = qp_asset_pack_find(pack_addr, name, &length);
+    return blob ? qp_load_image_mem(blob) : NULL;
+}
+
+painter_font_handle_t qp_load_font_pack(const void *pack_addr, const char *name) {
+    uint32_t    length = 0;
+    const void *blob   = qp_asset_pack_find(pack_addr, name, &length);
+    return blob ? qp_load_font_mem(blob) : NULL;
+}
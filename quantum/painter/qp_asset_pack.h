@@ -0,0 +1,75 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "qp_internal.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter asset packs
+//
+// An asset pack bundles multiple raw QGF/QFF blobs into one flash region with a lookup index, generated by
+// `qmk painter-make-asset-pack`. Assets are referenced in place -- on platforms where flash is memory-mapped
+// (RP2040 XIP, STM32 internal flash or QSPI) the returned pointers feed straight into
+// qp_load_image_mem()/qp_load_font_mem() with no copies and no decode until draw time. Because
+// the pack is addressed by name rather than by C symbol, the region can be rewritten by an external flashing
+// tool to update artwork without recompiling the firmware, as long as it stays within the reserved area.
+
+// Pack layout (all fields little-endian, blobs 4-byte aligned):
+//   qp_asset_pack_header_t, followed by `entry_count` qp_asset_pack_entry_t records, followed by blob data.
+#define QP_ASSET_PACK_MAGIC 0x4B415051 // "QPAK"
+#define QP_ASSET_PACK_VERSION 0x01
+#define QP_ASSET_PACK_NAME_LEN 16
+
+typedef struct QP_PACKED qp_asset_pack_header_t {
+    uint32_t magic;       // QP_ASSET_PACK_MAGIC
+    uint8_t  version;     // QP_ASSET_PACK_VERSION
+    uint8_t  reserved[3]; // zero
+    uint16_t entry_count; // number of index entries following the header
+    uint16_t reserved2;   // zero
+    uint32_t total_size;  // size of the entire pack, including this header
+} qp_asset_pack_header_t;
+
+typedef struct QP_PACKED qp_asset_pack_entry_t {
+    char     name[QP_ASSET_PACK_NAME_LEN]; // NUL-padded asset name (input file stem)
+    uint32_t offset;                       // byte offset of the blob from the start of the pack
+    uint32_t length;                       // byte length of the blob
+} qp_asset_pack_entry_t;
+
+/**
+ * Validates the pack header at the supplied (memory-mapped) address.
+ *
+ * @param pack_addr[in] the start of the asset pack in addressable flash or RAM
+ * @return true if the magic, version and index bounds check out
+ */
+bool qp_asset_pack_validate(const void *pack_addr);
+
+/**
+ * Number of assets in the pack. Returns 0 if the pack fails validation.
+ */
+uint16_t qp_asset_pack_count(const void *pack_addr);
+
+/**
+ * Looks up an asset blob by index. Returns NULL when out of range, otherwise the in-place blob
+ * pointer, with its length written through `length` when non-NULL.
+ */
+const void *qp_asset_pack_get(const void *pack_addr, uint16_t index, uint32_t *length);
+
+/**
+ * Looks up an asset blob by name. Returns NULL when no entry matches.
+ */
+const void *qp_asset_pack_find(const void *pack_addr, const char *name, uint32_t *length);
+
+/**
+ * Convenience wrapper: looks up a QGF image by name and loads it in place.
+ *
+ * @return the image handle, or NULL if the name is unknown or the blob fails QGF validation
+ */
+painter_image_handle_t qp_load_image_pack(const void *pack_addr, const char *name);
+
+/**
+ * Convenience wrapper: looks up a QFF font by name and loads it in place.
+ *
+ * @return the font handle, or NULL if the name is unknown or the blob fails QFF validation
+ */
+painter_font_handle_t qp_load_font_pack(const void *pack_addr, const char *name);
@@ -46,6 +46,38 @@ uint32_t qp_comms_send(painter_device_t device, const void *data, uint32_t byte_
     return driver->comms_vtable->comms_send(device, data, byte_count);
 }
 
+bool qp_comms_supports_nonblocking(painter_device_t device) {
+    struct painter_driver_t *driver = (struct painter_driver_t *)device;
+    return driver->comms_vtable->comms_send_nonblocking != NULL;
+}
+
+uint32_t qp_comms_send_nonblocking(painter_device_t device, const void *data, uint32_t byte_count) {
+    struct painter_driver_t *driver = (struct painter_driver_t *)device;
+    if (!driver->validate_ok) {
+        qp_dprintf("qp_comms_send_nonblocking: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    // Degrade to the synchronous send if the comms driver has no background support
+    if (!driver->comms_vtable->comms_send_nonblocking) {
+        return driver->comms_vtable->comms_send(device, data, byte_count);
+    }
+
+    return driver->comms_vtable->comms_send_nonblocking(device, data, byte_count);
+}
+
+void qp_comms_sync(painter_device_t device) {
+    struct painter_driver_t *driver = (struct painter_driver_t *)device;
+    if (!driver->validate_ok) {
+        qp_dprintf("qp_comms_sync: fail (validation_ok == false)\n");
+        return;
+    }
+
+    if (driver->comms_vtable->comms_sync) {
+        driver->comms_vtable->comms_sync(device);
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Comms APIs that use a D/C pin
 
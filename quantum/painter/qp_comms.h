@@ -16,6 +16,13 @@ bool     qp_comms_start(painter_device_t device);
 void     qp_comms_stop(painter_device_t device);
 uint32_t qp_comms_send(painter_device_t device, const void* data, uint32_t byte_count);
 
+// Background transfer support. Nonblocking sends may return before the data has hit the wire; the supplied
+// buffer must stay untouched until qp_comms_sync() has returned (or another send has been started, which
+// synchronizes internally). Falls back to the synchronous send if the comms driver has no background support.
+bool     qp_comms_supports_nonblocking(painter_device_t device);
+uint32_t qp_comms_send_nonblocking(painter_device_t device, const void* data, uint32_t byte_count);
+void     qp_comms_sync(painter_device_t device);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Comms APIs that use a D/C pin
 
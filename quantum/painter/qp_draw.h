@@ -80,6 +80,10 @@ struct qp_internal_pixel_output_state {
     painter_device_t device;
     uint32_t         pixel_write_pos;
     uint32_t         max_pixels;
+#ifdef QUANTUM_PAINTER_PIPELINED_TRANSFERS
+    bool    pipelined;   // when set, the pixdata buffer is split into two strips: one being decoded into, one being transmitted
+    uint8_t strip_index; // which half of the pixdata buffer is currently being decoded into
+#endif
 };
 
 bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg);
@@ -88,8 +92,32 @@ struct qp_internal_byte_output_state {
     painter_device_t device;
     uint32_t         byte_write_pos;
     uint32_t         max_bytes;
+#ifdef QUANTUM_PAINTER_PIPELINED_TRANSFERS
+    bool    pipelined;   // when set, the pixdata buffer is split into two strips: one being decoded into, one being transmitted
+    uint8_t strip_index; // which half of the pixdata buffer is currently being decoded into
+#endif
 };
 
 bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg);
 
+// Returns the region of the pixdata buffer the appender should decode into -- the whole buffer in the classic
+// (blocking) configuration, or the strip not currently owned by the in-flight background transfer when pipelined.
+static inline uint8_t* qp_internal_pixel_out_buffer(struct qp_internal_pixel_output_state* state) {
+#ifdef QUANTUM_PAINTER_PIPELINED_TRANSFERS
+    if (state->pipelined) {
+        return qp_internal_global_pixdata_buffer + (state->strip_index * (QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE / 2));
+    }
+#endif
+    return qp_internal_global_pixdata_buffer;
+}
+
+static inline uint8_t* qp_internal_byte_out_buffer(struct qp_internal_byte_output_state* state) {
+#ifdef QUANTUM_PAINTER_PIPELINED_TRANSFERS
+    if (state->pipelined) {
+        return qp_internal_global_pixdata_buffer + (state->strip_index * (QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE / 2));
+    }
+#endif
+    return qp_internal_global_pixdata_buffer;
+}
+
 qp_internal_byte_input_callback qp_internal_prepare_input_state(struct qp_internal_byte_input_state* input_state, painter_compression_t compression);
@@ -129,12 +129,26 @@ bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg
     struct qp_internal_pixel_output_state* state  = (struct qp_internal_pixel_output_state*)cb_arg;
     struct painter_driver_t*               driver = (struct painter_driver_t*)state->device;
 
-    if (!driver->driver_vtable->append_pixels(state->device, qp_internal_global_pixdata_buffer, palette, state->pixel_write_pos++, 1, &index)) {
+    if (!driver->driver_vtable->append_pixels(state->device, qp_internal_pixel_out_buffer(state), palette, state->pixel_write_pos++, 1, &index)) {
         return false;
     }
 
     // If we've hit the transmit limit, send out the entire buffer and reset the write position
     if (state->pixel_write_pos == state->max_pixels) {
+#ifdef QUANTUM_PAINTER_PIPELINED_TRANSFERS
+        if (state->pipelined) {
+            // Hand the full strip to the comms driver for background transmission, and flip over to decoding into the
+            // other strip -- starting the next background transfer synchronizes with this one, keeping it untouched
+            // while it's still in flight.
+            uint32_t byte_count = state->pixel_write_pos * driver->native_bits_per_pixel / 8;
+            if (qp_comms_send_nonblocking(state->device, qp_internal_pixel_out_buffer(state), byte_count) != byte_count) {
+                return false;
+            }
+            state->strip_index ^= 1;
+            state->pixel_write_pos = 0;
+            return true;
+        }
+#endif
         if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
             return false;
         }
@@ -148,12 +162,25 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
     struct qp_internal_byte_output_state* state  = (struct qp_internal_byte_output_state*)cb_arg;
     struct painter_driver_t*              driver = (struct painter_driver_t*)state->device;
 
-    if (!driver->driver_vtable->append_pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos++, byteval)) {
+    if (!driver->driver_vtable->append_pixdata(state->device, qp_internal_byte_out_buffer(state), state->byte_write_pos++, byteval)) {
         return false;
     }
 
     // If we've hit the transmit limit, send out the entire buffer and reset the write position
     if (state->byte_write_pos == state->max_bytes) {
+#ifdef QUANTUM_PAINTER_PIPELINED_TRANSFERS
+        if (state->pipelined) {
+            // Hand the full strip to the comms driver for background transmission, and flip over to decoding into the
+            // other strip -- starting the next background transfer synchronizes with this one, keeping it untouched
+            // while it's still in flight.
+            if (qp_comms_send_nonblocking(state->device, qp_internal_byte_out_buffer(state), state->byte_write_pos) != state->byte_write_pos) {
+                return false;
+            }
+            state->strip_index ^= 1;
+            state->byte_write_pos = 0;
+            return true;
+        }
+#endif
         struct painter_driver_t* driver = (struct painter_driver_t*)state->device;
         if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
             return false;
@@ -267,11 +267,20 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         // Set up the output state
         struct qp_internal_pixel_output_state output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
 
+#ifdef QUANTUM_PAINTER_PIPELINED_TRANSFERS
+        // If the comms driver can transmit in the background, halve the strip so that decoding the next strip
+        // overlaps transmission of the previous one.
+        if (qp_comms_supports_nonblocking(device)) {
+            output_state.pipelined = true;
+            output_state.max_pixels /= 2;
+        }
+#endif
+
         // Decode the pixel data and stream to the display
         ret = qp_internal_decode_palette(device, pixel_count, frame_info->bpp, input_callback, &input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, &output_state);
         // Any leftovers need transmission as well.
         if (ret && output_state.pixel_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.pixel_write_pos);
+            ret &= driver->driver_vtable->pixdata(device, qp_internal_pixel_out_buffer(&output_state), output_state.pixel_write_pos);
         }
     } else if (frame_info->bpp != driver->native_bits_per_pixel) {
         // Prevent stuff like drawing 24bpp images on 16bpp displays
@@ -281,12 +290,21 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         // Set up the output state
         struct qp_internal_byte_output_state output_state = {.device = device, .byte_write_pos = 0, .max_bytes = qp_internal_num_pixels_in_buffer(device) * driver->native_bits_per_pixel / 8};
 
+#ifdef QUANTUM_PAINTER_PIPELINED_TRANSFERS
+        // If the comms driver can transmit in the background, halve the strip so that decoding the next strip
+        // overlaps transmission of the previous one.
+        if (qp_comms_supports_nonblocking(device)) {
+            output_state.pipelined = true;
+            output_state.max_bytes /= 2;
+        }
+#endif
+
         // Stream the raw pixel data to the display
         uint32_t byte_count = pixel_count * frame_info->bpp / 8;
         ret                 = qp_internal_send_bytes(device, byte_count, input_callback, &input_state, qp_internal_byte_appender, &output_state);
         // Any leftovers need transmission as well.
         if (ret && output_state.byte_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
+            ret &= driver->driver_vtable->pixdata(device, qp_internal_byte_out_buffer(&output_state), output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
         }
     }
 
@@ -35,6 +35,99 @@ typedef struct qff_font_handle_t {
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Glyph cache
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
+typedef struct glyph_cache_entry_t {
+    qff_font_handle_t *font; // owning font, or NULL if this slot is free
+    uint32_t           code_point;
+    uint16_t           offset;   // start of the decoded glyph data inside glyph_cache_pool
+    uint16_t           length;   // number of decoded bytes
+    uint16_t           last_use; // LRU stamp, taken from glyph_cache_counter
+    uint8_t            width;
+} glyph_cache_entry_t;
+
+// Decoded glyph data is kept packed at the start of the pool -- evicting an entry shifts any later entries down, so
+// free space is always a single contiguous run at the end.
+static uint8_t             glyph_cache_pool[QUANTUM_PAINTER_GLYPH_CACHE_SIZE];
+static glyph_cache_entry_t glyph_cache_entries[QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES] = {0};
+static uint16_t            glyph_cache_used                                         = 0;
+static uint16_t            glyph_cache_counter                                      = 0;
+
+static glyph_cache_entry_t *qp_glyph_cache_lookup(qff_font_handle_t *qff_font, uint32_t code_point) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        glyph_cache_entry_t *entry = &glyph_cache_entries[i];
+        if (entry->font == qff_font && entry->code_point == code_point) {
+            entry->last_use = ++glyph_cache_counter;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static void qp_glyph_cache_evict(glyph_cache_entry_t *entry) {
+    // Close the hole in the pool, shifting any later entries down
+    uint16_t hole_start = entry->offset;
+    uint16_t hole_len   = entry->length;
+    memmove(&glyph_cache_pool[hole_start], &glyph_cache_pool[hole_start + hole_len], glyph_cache_used - hole_start - hole_len);
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        if (glyph_cache_entries[i].font != NULL && glyph_cache_entries[i].offset > hole_start) {
+            glyph_cache_entries[i].offset -= hole_len;
+        }
+    }
+    glyph_cache_used -= hole_len;
+    entry->font = NULL;
+}
+
+static glyph_cache_entry_t *qp_glyph_cache_insert(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint32_t length) {
+    if (length > QUANTUM_PAINTER_GLYPH_CACHE_SIZE) {
+        // This glyph will never fit, regardless of what gets evicted
+        return NULL;
+    }
+
+    // Evict least-recently-used entries until both a free slot and enough pool space are available
+    while (true) {
+        glyph_cache_entry_t *free_slot = NULL;
+        glyph_cache_entry_t *lru       = NULL;
+        for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+            glyph_cache_entry_t *entry = &glyph_cache_entries[i];
+            if (entry->font == NULL) {
+                free_slot = entry;
+            } else if (lru == NULL || (uint16_t)(glyph_cache_counter - entry->last_use) > (uint16_t)(glyph_cache_counter - lru->last_use)) {
+                lru = entry;
+            }
+        }
+
+        if (free_slot != NULL && glyph_cache_used + length <= QUANTUM_PAINTER_GLYPH_CACHE_SIZE) {
+            free_slot->font       = qff_font;
+            free_slot->code_point = code_point;
+            free_slot->offset     = glyph_cache_used;
+            free_slot->length     = (uint16_t)length;
+            free_slot->last_use   = ++glyph_cache_counter;
+            free_slot->width      = width;
+            glyph_cache_used += length;
+            return free_slot;
+        }
+
+        if (lru == NULL) {
+            return NULL;
+        }
+        qp_glyph_cache_evict(lru);
+    }
+}
+
+static void qp_glyph_cache_invalidate_font(qff_font_handle_t *qff_font) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        if (glyph_cache_entries[i].font == qff_font) {
+            qp_glyph_cache_evict(&glyph_cache_entries[i]);
+        }
+    }
+}
+
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load font from stream
 
@@ -141,6 +234,11 @@ bool qp_close_font(painter_font_handle_t font) {
         return false;
     }
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    // Drop any cached glyphs belonging to this font
+    qp_glyph_cache_invalidate_font(qff_font);
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
 #if QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
     // Nuke the buffer, if required
     if (qff_font->owns_buffer) {
@@ -159,8 +257,9 @@ bool qp_close_font(painter_font_handle_t font) {
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helpers
 
-// Callback to be invoked for each codepoint detected in the UTF8 input string
-typedef bool (*code_point_handler)(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg);
+// Callback to be invoked for each codepoint detected in the UTF8 input string -- cached_glyph_data is non-NULL (with
+// cached_glyph_length bytes of decoded glyph data) if the glyph was found in the glyph cache
+typedef bool (*code_point_handler)(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, const uint8_t *cached_glyph_data, uint16_t cached_glyph_length, void *cb_arg);
 
 // Helper that sets up the palette (if required) and returns the offset in the stream that the data starts
 static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device, qff_font_handle_t *qff_font, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint32_t *data_offset) {
@@ -301,13 +400,27 @@ static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const cha
             return false;
         }
 
-        uint8_t width;
-        if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
-            qp_dprintf("Failed to prepare glyph for rendering.\n");
-            return false;
+        uint8_t        width;
+        const uint8_t *cached_glyph_data   = NULL;
+        uint16_t       cached_glyph_length = 0;
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+        // Cached glyphs skip the glyph table walk and decoder entirely
+        glyph_cache_entry_t *cache_entry = qp_glyph_cache_lookup(qff_font, code_point);
+        if (cache_entry != NULL) {
+            width               = cache_entry->width;
+            cached_glyph_data   = &glyph_cache_pool[cache_entry->offset];
+            cached_glyph_length = cache_entry->length;
+        } else
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+        {
+            if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
+                qp_dprintf("Failed to prepare glyph for rendering.\n");
+                return false;
+            }
         }
 
-        if (!handler(qff_font, code_point, width, qff_font->base.line_height, cb_arg)) {
+        if (!handler(qff_font, code_point, width, qff_font->base.line_height, cached_glyph_data, cached_glyph_length, cb_arg)) {
             qp_dprintf("Failed to execute glyph handler.\n");
             return false;
         }
@@ -324,7 +437,7 @@ struct code_point_iter_calcwidth_state {
 };
 
 // Codepoint handler callback: width calc
-static inline bool qp_font_code_point_handler_calcwidth(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
+static inline bool qp_font_code_point_handler_calcwidth(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, const uint8_t *cached_glyph_data, uint16_t cached_glyph_length, void *cb_arg) {
     struct code_point_iter_calcwidth_state *state = (struct code_point_iter_calcwidth_state *)cb_arg;
 
     // Increment the overall width by this glyph's width
@@ -347,7 +460,7 @@ struct code_point_iter_drawglyph_state {
 };
 
 // Codepoint handler callback: drawing
-static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
+static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, const uint8_t *cached_glyph_data, uint16_t cached_glyph_length, void *cb_arg) {
     struct code_point_iter_drawglyph_state *state  = (struct code_point_iter_drawglyph_state *)cb_arg;
     struct painter_driver_t *               driver = (struct painter_driver_t *)state->device;
 
@@ -363,9 +476,48 @@ static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_f
     // Move the x-position for the next glyph
     state->xpos += width;
 
-    // Decode the pixel data for the glyph
     uint32_t pixel_count = ((uint32_t)width) * height;
-    bool     ret         = qp_internal_decode_palette(state->device, pixel_count, qff_font->bpp, state->input_callback, state->input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, state->output_state);
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    if (cached_glyph_data == NULL) {
+        // Cold glyph -- decompress it into the cache so subsequent draws skip the decoder. If it doesn't fit,
+        // fall through and render directly from the font stream instead.
+        uint8_t              pixels_per_byte = 8 / qff_font->bpp;
+        uint32_t             byte_count      = (pixel_count + pixels_per_byte - 1) / pixels_per_byte;
+        glyph_cache_entry_t *cache_entry     = qp_glyph_cache_insert(qff_font, code_point, width, byte_count);
+        if (cache_entry != NULL) {
+            for (uint32_t i = 0; i < byte_count; ++i) {
+                int16_t byteval = state->input_callback(state->input_state);
+                if (byteval < 0) {
+                    qp_glyph_cache_evict(cache_entry);
+                    return false;
+                }
+                glyph_cache_pool[cache_entry->offset + i] = (uint8_t)byteval;
+            }
+            cached_glyph_data   = &glyph_cache_pool[cache_entry->offset];
+            cached_glyph_length = cache_entry->length;
+        }
+    }
+
+    if (cached_glyph_data != NULL) {
+        // Render from the decoded cache bytes
+        qp_memory_stream_t                  cache_stream      = qp_make_memory_stream((void *)cached_glyph_data, cached_glyph_length);
+        struct qp_internal_byte_input_state cache_input_state = {.device = state->device, .src_stream = (qp_stream_t *)&cache_stream};
+        qp_internal_byte_input_callback     cache_callback    = qp_internal_prepare_input_state(&cache_input_state, IMAGE_UNCOMPRESSED);
+
+        bool ret = qp_internal_decode_palette(state->device, pixel_count, qff_font->bpp, cache_callback, &cache_input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, state->output_state);
+
+        // Any leftovers need transmission as well.
+        if (ret && state->output_state->pixel_write_pos > 0) {
+            ret &= driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->output_state->pixel_write_pos);
+        }
+
+        return ret;
+    }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
+    // Decode the pixel data for the glyph
+    bool ret = qp_internal_decode_palette(state->device, pixel_count, qff_font->bpp, state->input_callback, state->input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, state->output_state);
 
     // Any leftovers need transmission as well.
     if (ret && state->output_state->pixel_write_pos > 0) {
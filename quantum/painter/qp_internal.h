@@ -26,6 +26,17 @@
         } while (0)
 #endif
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Init-time arena for painter resources
+
+// Allocates from the static pool sized by QUANTUM_PAINTER_ARENA_SIZE. Allocations are 4-byte aligned and are never
+// freed -- intended for exactly-sized framebuffers and scratch areas requested during device setup. Returns NULL if
+// the pool is exhausted, or on all invocations if QUANTUM_PAINTER_ARENA_SIZE is not defined.
+void *qp_internal_arena_alloc(uint32_t size);
+
+// The number of bytes still available in the arena.
+uint32_t qp_internal_arena_remaining(void);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Specific internal definitions
 
@@ -38,12 +38,19 @@ typedef bool (*painter_driver_comms_init_func)(painter_device_t device);
 typedef bool (*painter_driver_comms_start_func)(painter_device_t device);
 typedef void (*painter_driver_comms_stop_func)(painter_device_t device);
 typedef uint32_t (*painter_driver_comms_send_func)(painter_device_t device, const void *data, uint32_t byte_count);
+typedef void (*painter_driver_comms_sync_func)(painter_device_t device);
 
 struct painter_comms_vtable_t {
     painter_driver_comms_init_func  comms_init;
     painter_driver_comms_start_func comms_start;
     painter_driver_comms_stop_func  comms_stop;
     painter_driver_comms_send_func  comms_send;
+
+    // Optional background transfer support -- may be NULL when the comms driver can only send synchronously.
+    // A nonblocking send may return before the data has hit the wire; the supplied buffer must stay untouched
+    // until comms_sync has been invoked (or another send has been started, which synchronizes internally).
+    painter_driver_comms_send_func comms_send_nonblocking;
+    painter_driver_comms_sync_func comms_sync;
 };
 
 typedef void (*painter_driver_comms_send_command_func)(painter_device_t device, uint8_t cmd);
@@ -22,6 +22,9 @@
 #ifdef MOUSEKEY_ENABLE
 #    include "mousekey.h"
 #endif
+#ifdef POINTING_DEVICE_TRANSFORM_ENABLE
+#    include "pointing_device_transform.h"
+#endif
 
 #if (defined(POINTING_DEVICE_ROTATION_90) + defined(POINTING_DEVICE_ROTATION_180) + defined(POINTING_DEVICE_ROTATION_270)) > 1
 #    error More than one rotation selected.  This is not supported.
@@ -153,6 +156,10 @@ __attribute__((weak)) void pointing_device_init(void) {
 #endif
     }
 
+#ifdef POINTING_DEVICE_TRANSFORM_ENABLE
+    pointing_device_transform_init();
+#endif
+
     pointing_device_init_kb();
     pointing_device_init_user();
 }
@@ -228,9 +235,31 @@ __attribute__((weak)) void pointing_device_task(void) {
     };
 #endif
 
+#ifdef POINTING_DEVICE_REPORT_ACCUMULATION
+#    if defined(SPLIT_POINTING_ENABLE)
+#        error POINTING_DEVICE_REPORT_ACCUMULATION not supported when sharing the pointing device report between sides.
+#    endif
+#    if !(POINTING_DEVICE_TASK_THROTTLE_MS > 0)
+#        error POINTING_DEVICE_REPORT_ACCUMULATION requires POINTING_DEVICE_TASK_THROTTLE_MS to be set.
+#    endif
+    static report_mouse_t accumulated_report = {};
+#endif
+
 #if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
     static uint32_t last_exec = 0;
     if (timer_elapsed32(last_exec) < POINTING_DEVICE_TASK_THROTTLE_MS) {
+#    ifdef POINTING_DEVICE_REPORT_ACCUMULATION
+        // Keep acquiring at the native scan rate while sends are throttled -- motion is accumulated with
+        // saturation and folded into the next transmitted report, so fast flicks aren't truncated.
+#        ifdef POINTING_DEVICE_MOTION_PIN
+#            ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
+        if (!readPin(POINTING_DEVICE_MOTION_PIN))
+#            else
+        if (readPin(POINTING_DEVICE_MOTION_PIN))
+#            endif
+#        endif
+        accumulated_report = pointing_device_combine_reports(accumulated_report, pointing_device_driver.get_report((report_mouse_t){0}));
+#    endif
         return;
     }
     last_exec = timer_read32();
@@ -263,6 +292,12 @@ __attribute__((weak)) void pointing_device_task(void) {
     local_mouse_report = pointing_device_driver.get_report(local_mouse_report);
 #endif // defined(SPLIT_POINTING_ENABLE)
 
+#ifdef POINTING_DEVICE_REPORT_ACCUMULATION
+    // Fold in any motion accumulated while sends were throttled
+    local_mouse_report = pointing_device_combine_reports(local_mouse_report, accumulated_report);
+    memset(&accumulated_report, 0, sizeof(accumulated_report));
+#endif
+
     // allow kb to intercept and modify report
 #if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
     if (is_keyboard_left()) {
@@ -274,7 +309,12 @@ __attribute__((weak)) void pointing_device_task(void) {
     }
     local_mouse_report = is_keyboard_left() ? pointing_device_task_combined_kb(local_mouse_report, shared_mouse_report) : pointing_device_task_combined_kb(shared_mouse_report, local_mouse_report);
 #else
+#    ifdef POINTING_DEVICE_TRANSFORM_ENABLE
+    // Rotation/inversion defines are fused into the transform pipeline
+    local_mouse_report = pointing_device_transform_apply(local_mouse_report);
+#    else
     local_mouse_report = pointing_device_adjust_by_defines(local_mouse_report);
+#    endif
     local_mouse_report = pointing_device_task_kb(local_mouse_report);
 #endif
     // automatic mouse layer function
@@ -360,6 +400,7 @@ void pointing_device_set_cpi_on_side(bool left, uint16_t cpi) {
         shared_cpi = cpi;
     }
 }
+#endif // defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
 
 /**
  * @brief clamps int16_t to int8_t
@@ -397,7 +438,7 @@ static inline mouse_xy_report_t pointing_device_xy_clamp(clamp_range_t value) {
  *
  * Combines 2 report_mouse_t structs, clamping movement values to int8_t and ignores report_id then returns the resulting report_mouse_t struct.
  *
- * NOTE: Only available when using SPLIT_POINTING_ENABLE and POINTING_DEVICE_COMBINED
+ * Also used to fold accumulated motion into the outgoing report when POINTING_DEVICE_REPORT_ACCUMULATION is enabled.
  *
  * @param[in] left_report left report_mouse_t
  * @param[in] right_report right report_mouse_t
@@ -412,6 +453,7 @@ report_mouse_t pointing_device_combine_reports(report_mouse_t left_report, repor
     return left_report;
 }
 
+#if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
 /**
  * @brief Adjust mouse report by any optional right pointing configuration defines
  *
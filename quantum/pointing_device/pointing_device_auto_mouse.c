@@ -19,6 +19,13 @@
 
 #    include "pointing_device_auto_mouse.h"
 
+#    ifdef AUTO_MOUSE_DEFERRED_TIMEOUT
+#        ifndef DEFERRED_EXEC_ENABLE
+#            error "AUTO_MOUSE_DEFERRED_TIMEOUT requires DEFERRED_EXEC_ENABLE"
+#        endif
+#        include "deferred_exec.h"
+#    endif
+
 /* local data structure for tracking auto mouse */
 static auto_mouse_context_t auto_mouse_context = {.config.layer = (uint8_t)AUTO_MOUSE_DEFAULT_LAYER};
 
@@ -26,6 +33,74 @@ static auto_mouse_context_t auto_mouse_context = {.config.layer = (uint8_t)AUTO_
 static bool is_mouse_record(uint16_t keycode, keyrecord_t* record);
 static void auto_mouse_reset(void);
 
+#    ifdef AUTO_MOUSE_KEYCLASS_CACHE
+/* Mouse-key classification of the target layer's keycodes, computed once by
+ * running each distinct keycode through the is_mouse_record() stack and
+ * memoized as a sorted keycode list plus result bitmap. Keycodes not present
+ * on the target layer fall back to the normal call. Assumes the kb/user
+ * callbacks classify by keycode alone; rebuilt when the target layer or the
+ * dynamic keymap changes. */
+static uint16_t keyclass_keycodes[MATRIX_ROWS * MATRIX_COLS];
+static uint8_t  keyclass_bits[(MATRIX_ROWS * MATRIX_COLS + 7) / 8];
+static uint16_t keyclass_count = 0;
+static bool     keyclass_valid = false;
+
+void auto_mouse_keyclass_cache_invalidate(void) {
+    keyclass_valid = false;
+}
+
+static void keyclass_cache_build(void) {
+    keyclass_count = 0;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint16_t keycode = keymap_key_to_keycode(auto_mouse_context.config.layer, (keypos_t){.row = row, .col = col});
+            /* sorted insert, skipping duplicates */
+            uint16_t pos = 0;
+            while (pos < keyclass_count && keyclass_keycodes[pos] < keycode) {
+                pos++;
+            }
+            if (pos < keyclass_count && keyclass_keycodes[pos] == keycode) {
+                continue;
+            }
+            memmove(&keyclass_keycodes[pos + 1], &keyclass_keycodes[pos], (keyclass_count - pos) * sizeof(uint16_t));
+            keyclass_keycodes[pos] = keycode;
+            keyclass_count++;
+        }
+    }
+    for (uint16_t i = 0; i < keyclass_count; i++) {
+        keyrecord_t record = {.event = MAKE_KEYEVENT(0, 0, true)};
+        if (is_mouse_record(keyclass_keycodes[i], &record)) {
+            keyclass_bits[i >> 3] |= 1 << (i & 7);
+        } else {
+            keyclass_bits[i >> 3] &= ~(1 << (i & 7));
+        }
+    }
+    keyclass_valid = true;
+}
+#    endif
+
+/* classify a keyrecord as mouse key, consulting the cache when possible */
+static bool is_mouse_record_cached(uint16_t keycode, keyrecord_t* record) {
+#    ifdef AUTO_MOUSE_KEYCLASS_CACHE
+    if (!keyclass_valid) {
+        keyclass_cache_build();
+    }
+    uint16_t lo = 0, hi = keyclass_count;
+    while (lo < hi) {
+        uint16_t mid = (lo + hi) / 2;
+        if (keyclass_keycodes[mid] < keycode) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo < keyclass_count && keyclass_keycodes[lo] == keycode) {
+        return keyclass_bits[lo >> 3] & (1 << (lo & 7));
+    }
+#    endif
+    return is_mouse_record(keycode, record);
+}
+
 /* check for target layer deactivation overrides */
 static inline bool layer_hold_check(void) {
     return get_auto_mouse_toggle() ||
@@ -112,6 +187,9 @@ void set_auto_mouse_layer(uint8_t layer) {
     if (auto_mouse_context.config.layer == layer) return;
     auto_mouse_context.config.layer = layer;
     auto_mouse_reset();
+#    ifdef AUTO_MOUSE_KEYCLASS_CACHE
+    auto_mouse_keyclass_cache_invalidate();
+#    endif
 }
 
 /**
@@ -179,6 +257,28 @@ __attribute__((weak)) bool auto_mouse_activation(report_mouse_t mouse_report) {
  *
  * @param[in] mouse_report report_mouse_t
  */
+#    ifdef AUTO_MOUSE_DEFERRED_TIMEOUT
+static deferred_token auto_mouse_off_token = INVALID_DEFERRED_TOKEN;
+
+/* deferred deadline replacing the per-cycle timeout comparison */
+static uint32_t auto_mouse_off_callback(uint32_t trigger_time, void* cb_arg) {
+    auto_mouse_off_token = INVALID_DEFERRED_TOKEN;
+    if (!is_auto_mouse_active() && layer_state_is((AUTO_MOUSE_TARGET_LAYER))) {
+        layer_off((AUTO_MOUSE_TARGET_LAYER));
+        auto_mouse_context.timer.active = 0;
+    }
+    return 0;
+}
+
+static void auto_mouse_deadline_push(void) {
+    if (auto_mouse_off_token == INVALID_DEFERRED_TOKEN) {
+        auto_mouse_off_token = defer_exec(AUTO_MOUSE_TIME, auto_mouse_off_callback, NULL);
+    } else {
+        extend_deferred_exec(auto_mouse_off_token, AUTO_MOUSE_TIME);
+    }
+}
+#    endif
+
 void pointing_device_task_auto_mouse(report_mouse_t mouse_report) {
     // skip if disabled, delay timer running, or debounce
     if (!(AUTO_MOUSE_ENABLED) || timer_elapsed(auto_mouse_context.timer.active) <= AUTO_MOUSE_DEBOUNCE || timer_elapsed(auto_mouse_context.timer.delay) <= AUTO_MOUSE_DELAY) {
@@ -192,10 +292,16 @@ void pointing_device_task_auto_mouse(report_mouse_t mouse_report) {
         if (!layer_state_is((AUTO_MOUSE_TARGET_LAYER))) {
             layer_on((AUTO_MOUSE_TARGET_LAYER));
         }
+#    ifdef AUTO_MOUSE_DEFERRED_TIMEOUT
+        auto_mouse_deadline_push();
+    }
+    // deactivation is handled by the deferred deadline
+#    else
     } else if (layer_state_is((AUTO_MOUSE_TARGET_LAYER)) && timer_elapsed(auto_mouse_context.timer.active) > AUTO_MOUSE_TIME) {
         layer_off((AUTO_MOUSE_TARGET_LAYER));
         auto_mouse_context.timer.active = 0;
     }
+#    endif
 }
 
 /**
@@ -330,7 +436,7 @@ bool process_auto_mouse(uint16_t keycode, keyrecord_t* record) {
             // skip on no event
             if (IS_NOEVENT(record->event)) break;
             // check if keyrecord is mousekey
-            if (is_mouse_record(keycode, record)) {
+            if (is_mouse_record_cached(keycode, record)) {
                 auto_mouse_keyevent(record->event.pressed);
             } else if (!is_auto_mouse_active()) {
                 // all non-mousekey presses restart delay timer and reset status
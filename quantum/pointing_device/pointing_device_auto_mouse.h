@@ -78,6 +78,10 @@ bool get_auto_mouse_toggle(void);            // get toggle mouse layer flag valu
 bool is_mouse_record_kb(uint16_t keycode, keyrecord_t* record);
 bool is_mouse_record_user(uint16_t keycode, keyrecord_t* record);
 
+#ifdef AUTO_MOUSE_KEYCLASS_CACHE
+void auto_mouse_keyclass_cache_invalidate(void); // drop the memoized keycode classification, e.g. after a keymap change
+#endif
+
 /* ----------Core functions (only used in custom pointing devices or key processing)------------------------- */
 void pointing_device_task_auto_mouse(report_mouse_t mouse_report); // add to pointing_device_task_*
 bool process_auto_mouse(uint16_t keycode, keyrecord_t* record);    // add to process_record_*
@@ -107,7 +107,7 @@ void cirque_pinnacle_enable_cursor_glide(bool enable) {
     cursor_glide_enable = enable;
 }
 
-void cirque_pinnacle_configure_cursor_glide(float trigger_px) {
+void cirque_pinnacle_configure_cursor_glide(uint16_t trigger_px) {
     glide.config.trigger_px = trigger_px;
 }
 #    endif
@@ -326,8 +326,12 @@ static uint16_t pmw33xx_get_cpi_wrapper(void) {
 }
 
 report_mouse_t pmw33xx_get_report(report_mouse_t mouse_report) {
-    pmw33xx_report_t report    = pmw33xx_read_burst(0);
-    static bool      in_motion = false;
+#    ifdef PMW33XX_MOTION_PIN
+    pmw33xx_report_t report = pmw33xx_read_burst_accumulated(0);
+#    else
+    pmw33xx_report_t report = pmw33xx_read_burst(0);
+#    endif
+    static bool in_motion = false;
 
     if (report.motion.b.is_lifted) {
         return mouse_report;
@@ -109,7 +109,7 @@ cursor_glide_t cursor_glide_start(cursor_glide_context_t* glide) {
 
     status->timer   = timer_read();
     status->counter = 0;
-    status->v0      = (status->dx0 == 0 && status->dy0 == 0) ? 0.0 : sqrt32(((int32_t)status->dx0 * 256 * status->dx0 * 256) + ((int32_t)status->dy0 * 256 * status->dy0 * 256)); // skip trigonometry if not needed, calculate distance in Q8
+    status->v0      = (status->dx0 == 0 && status->dy0 == 0) ? 0 : sqrt32(((int32_t)status->dx0 * 256 * status->dx0 * 256) + ((int32_t)status->dy0 * 256 * status->dy0 * 256)); // skip trigonometry if not needed, calculate distance in Q8
     status->x       = 0;
     status->y       = 0;
     status->z       = 0;
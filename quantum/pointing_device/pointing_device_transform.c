@@ -0,0 +1,143 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef POINTING_DEVICE_TRANSFORM_ENABLE
+
+#    include "pointing_device_transform.h"
+#    include "pointing_device.h"
+#    include <string.h>
+
+#    if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
+#        error POINTING_DEVICE_TRANSFORM_ENABLE not supported when combining two pointing devices.
+#    endif
+
+#    ifndef POINTING_DEVICE_TRANSFORM_MAX_SEGMENTS
+#        define POINTING_DEVICE_TRANSFORM_MAX_SEGMENTS 4
+#    endif
+
+// Curves are fusion barriers: every run of curve-less stages collapses into
+// one matrix at init, so the compiled pipeline holds at most one segment per
+// curve plus a trailing matrix-only segment.
+static pointing_device_transform_stage_t compiled_segments[POINTING_DEVICE_TRANSFORM_MAX_SEGMENTS];
+static uint8_t                           compiled_segment_count = 0;
+
+static const int16_t identity_matrix[2][2] = {{POINTING_DEVICE_TRANSFORM_UNIT, 0}, {0, POINTING_DEVICE_TRANSFORM_UNIT}};
+
+__attribute__((weak)) const pointing_device_transform_stage_t *pointing_device_transform_stages(uint8_t *count) {
+    *count = 0;
+    return NULL;
+}
+
+/**
+ * @brief Multiplies Q8.8 matrix b into a, so that a becomes the combined transform "a then b"
+ *
+ * @param a[in,out] accumulated matrix, updated in place
+ * @param b[in] matrix of the stage applied after a
+ */
+static void transform_matrix_fuse(int16_t a[2][2], const int16_t b[2][2]) {
+    int16_t fused[2][2];
+    for (uint8_t row = 0; row < 2; row++) {
+        for (uint8_t col = 0; col < 2; col++) {
+            fused[row][col] = (int16_t)(((int32_t)b[row][0] * a[0][col] + (int32_t)b[row][1] * a[1][col]) >> 8);
+        }
+    }
+    memcpy(a, fused, sizeof(fused));
+}
+
+static void transform_emit_segment(const int16_t matrix[2][2], pointing_device_transform_curve_t curve) {
+    if (compiled_segment_count >= POINTING_DEVICE_TRANSFORM_MAX_SEGMENTS) {
+        return;
+    }
+    memcpy(compiled_segments[compiled_segment_count].m, matrix, sizeof(identity_matrix));
+    compiled_segments[compiled_segment_count].curve = curve;
+    compiled_segment_count++;
+}
+
+/**
+ * @brief Fuses the configured stages into the compiled pipeline
+ *
+ * Seeds the first matrix from the rotation/inversion defines, then multiplies
+ * each curve-less stage into it; a stage with a curve closes the current
+ * segment. The per-report cost is one matrix (and curve, if any) per segment
+ * regardless of how many stages were declared.
+ */
+void pointing_device_transform_init(void) {
+    int16_t fused[2][2];
+    memcpy(fused, identity_matrix, sizeof(fused));
+
+    // Fold the common configuration defines into the first matrix
+#    if defined(POINTING_DEVICE_ROTATION_90)
+    const int16_t rotation[2][2] = {{0, POINTING_DEVICE_TRANSFORM_UNIT}, {-POINTING_DEVICE_TRANSFORM_UNIT, 0}};
+    transform_matrix_fuse(fused, rotation);
+#    elif defined(POINTING_DEVICE_ROTATION_180)
+    const int16_t rotation[2][2] = {{-POINTING_DEVICE_TRANSFORM_UNIT, 0}, {0, -POINTING_DEVICE_TRANSFORM_UNIT}};
+    transform_matrix_fuse(fused, rotation);
+#    elif defined(POINTING_DEVICE_ROTATION_270)
+    const int16_t rotation[2][2] = {{0, -POINTING_DEVICE_TRANSFORM_UNIT}, {POINTING_DEVICE_TRANSFORM_UNIT, 0}};
+    transform_matrix_fuse(fused, rotation);
+#    endif
+#    if defined(POINTING_DEVICE_INVERT_X)
+    fused[0][0] = -fused[0][0];
+    fused[0][1] = -fused[0][1];
+#    endif
+#    if defined(POINTING_DEVICE_INVERT_Y)
+    fused[1][0] = -fused[1][0];
+    fused[1][1] = -fused[1][1];
+#    endif
+
+    compiled_segment_count = 0;
+
+    uint8_t                                  stage_count = 0;
+    const pointing_device_transform_stage_t *stages      = pointing_device_transform_stages(&stage_count);
+    for (uint8_t i = 0; i < stage_count; i++) {
+        transform_matrix_fuse(fused, stages[i].m);
+        if (stages[i].curve != NULL) {
+            transform_emit_segment(fused, stages[i].curve);
+            memcpy(fused, identity_matrix, sizeof(fused));
+        }
+    }
+    if (memcmp(fused, identity_matrix, sizeof(fused)) != 0 || compiled_segment_count == 0) {
+        transform_emit_segment(fused, NULL);
+    }
+}
+
+static inline mouse_xy_report_t transform_xy_clamp(int32_t value) {
+    if (value < XY_REPORT_MIN) {
+        return XY_REPORT_MIN;
+    } else if (value > XY_REPORT_MAX) {
+        return XY_REPORT_MAX;
+    } else {
+        return value;
+    }
+}
+
+/**
+ * @brief Runs the compiled pipeline over the report's X/Y motion
+ *
+ * Replaces pointing_device_adjust_by_defines() in pointing_device_task() when
+ * the transform pipeline is enabled; the defines are already fused in.
+ *
+ * @param mouse_report[in] takes a report_mouse_t to be transformed
+ * @return report_mouse_t with transformed values
+ */
+report_mouse_t pointing_device_transform_apply(report_mouse_t mouse_report) {
+    mouse_xy_report_t x = mouse_report.x;
+    mouse_xy_report_t y = mouse_report.y;
+    for (uint8_t i = 0; i < compiled_segment_count; i++) {
+        const pointing_device_transform_stage_t *segment = &compiled_segments[i];
+
+        mouse_xy_report_t mx = transform_xy_clamp(((int32_t)segment->m[0][0] * x + (int32_t)segment->m[0][1] * y) >> 8);
+        mouse_xy_report_t my = transform_xy_clamp(((int32_t)segment->m[1][0] * x + (int32_t)segment->m[1][1] * y) >> 8);
+        if (segment->curve != NULL) {
+            mx = segment->curve(mx);
+            my = segment->curve(my);
+        }
+        x = mx;
+        y = my;
+    }
+    mouse_report.x = x;
+    mouse_report.y = y;
+    return mouse_report;
+}
+
+#endif // POINTING_DEVICE_TRANSFORM_ENABLE
@@ -0,0 +1,56 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "report.h"
+
+/**
+ * \file
+ *
+ * \defgroup pointing_device_transform Pointing Device Transform Pipeline
+ *
+ * Declarative per-report motion transform chain, enabled with
+ * `POINTING_DEVICE_TRANSFORM_ENABLE`. The pipeline is an ordered list of
+ * stages, each a signed Q8.8 fixed-point 2x2 matrix with an optional per-axis
+ * curve. At init consecutive curve-less matrices are multiplied together, so
+ * stacking rotation, drag-scroll scaling and inversion costs one fused matrix
+ * per report instead of a branch-and-negate cascade. The rotation/inversion
+ * configuration defines are folded into the first matrix automatically.
+ * \{
+ */
+
+/** One Q8.8 unit, i.e. a matrix coefficient of 1.0. */
+#define POINTING_DEVICE_TRANSFORM_UNIT 256
+
+/** Converts a floating point constant to a Q8.8 matrix coefficient. */
+#define POINTING_DEVICE_TRANSFORM_Q(f) ((int16_t)((f)*POINTING_DEVICE_TRANSFORM_UNIT))
+
+/** \brief Per-axis response curve, e.g. acceleration. Applied after the stage's matrix. */
+typedef mouse_xy_report_t (*pointing_device_transform_curve_t)(mouse_xy_report_t value);
+
+/** \brief One stage of the transform pipeline. */
+typedef struct {
+    int16_t                           m[2][2]; /**< Row-major 2x2 matrix in Q8.8: x' = m[0][0]*x + m[0][1]*y. */
+    pointing_device_transform_curve_t curve;   /**< Optional curve, `NULL` for none. */
+} pointing_device_transform_stage_t;
+
+/**
+ * \brief Returns the keymap's transform stages, applied in array order.
+ *
+ * Override in the keymap to define the pipeline; the default returns no
+ * stages, leaving only the rotation/inversion defines in effect.
+ *
+ * \param[out] count Number of stages in the returned array.
+ * \return Pointer to the stage array, may be `NULL` when `*count` is zero.
+ */
+const pointing_device_transform_stage_t *pointing_device_transform_stages(uint8_t *count);
+
+/** \brief Fuses the configured stages into the compiled pipeline. Called by `pointing_device_init()`. */
+void pointing_device_transform_init(void);
+
+/** \brief Runs the compiled pipeline over the report's X/Y motion. */
+report_mouse_t pointing_device_transform_apply(report_mouse_t mouse_report);
+
+/** \} */
@@ -0,0 +1,138 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "power_telemetry.h"
+#include "analog.h"
+#include "debug.h"
+#include "print.h"
+#include "timer.h"
+#ifdef TASK_ACCOUNTING_ENABLE
+#    include "task_accounting.h"
+#endif
+
+#ifndef POWER_TELEMETRY_VBAT_PIN
+#    error POWER_TELEMETRY_VBAT_PIN must be defined to use power telemetry.
+#endif
+
+// EWMA weight for the smoothed voltage: new samples count 1/2^shift.
+#ifndef POWER_TELEMETRY_EWMA_SHIFT
+#    define POWER_TELEMETRY_EWMA_SHIFT 2
+#endif
+
+// analogReadPin() returns 10-bit counts on every platform ADC driver.
+#define POWER_TELEMETRY_ADC_MAX 1023
+
+static power_telemetry_sample_t history[POWER_TELEMETRY_HISTORY];
+static uint8_t                  history_head = 0; // next slot to write
+
+static uint16_t vbat_ewma_mv  = 0; // scaled by 2^POWER_TELEMETRY_EWMA_SHIFT
+static uint16_t vbat_min_mv   = UINT16_MAX;
+static uint16_t current_raw   = 0;
+static bool     suspend_noted = false;
+
+static uint16_t read_vbat_mv(void) {
+    uint32_t raw = analogReadPin(POWER_TELEMETRY_VBAT_PIN);
+    return (uint16_t)(raw * POWER_TELEMETRY_VREF_MV * POWER_TELEMETRY_VBAT_DIVIDER / POWER_TELEMETRY_ADC_MAX);
+}
+
+void power_telemetry_sample_now(uint8_t flags) {
+    power_telemetry_sample_t *sample = &history[history_head];
+    history_head                     = (history_head + 1) % POWER_TELEMETRY_HISTORY;
+
+    sample->timestamp = timer_read32();
+    sample->vbat_mv   = read_vbat_mv();
+#ifdef POWER_TELEMETRY_CURRENT_SENSE_PIN
+    current_raw = analogReadPin(POWER_TELEMETRY_CURRENT_SENSE_PIN);
+#endif
+    sample->current_raw = current_raw;
+
+    // Snapshot the CPU accounting so each power number carries the load
+    // that produced it.
+    sample->load_ticks    = 0;
+    sample->dominant_task = 0xFF;
+#ifdef TASK_ACCOUNTING_ENABLE
+    uint32_t dominant_ticks = 0;
+    for (uint8_t id = 0; id < TASK_ACCT_COUNT; id++) {
+        uint32_t avg = task_accounting_get_avg(id);
+        sample->load_ticks += avg;
+        if (avg > dominant_ticks) {
+            dominant_ticks        = avg;
+            sample->dominant_task = id;
+        }
+    }
+#endif
+    sample->flags    = flags;
+    sample->reserved = 0;
+
+    if (vbat_ewma_mv == 0) {
+        vbat_ewma_mv = sample->vbat_mv << POWER_TELEMETRY_EWMA_SHIFT;
+    } else {
+        vbat_ewma_mv += sample->vbat_mv - (vbat_ewma_mv >> POWER_TELEMETRY_EWMA_SHIFT);
+    }
+    if (sample->vbat_mv < vbat_min_mv) {
+        vbat_min_mv = sample->vbat_mv;
+    }
+}
+
+uint16_t power_telemetry_get_vbat_mv(void) {
+    return vbat_ewma_mv >> POWER_TELEMETRY_EWMA_SHIFT;
+}
+
+uint16_t power_telemetry_get_vbat_min_mv(void) {
+    return vbat_min_mv == UINT16_MAX ? 0 : vbat_min_mv;
+}
+
+uint16_t power_telemetry_get_current_raw(void) {
+    return current_raw;
+}
+
+void power_telemetry_dump(void) {
+    xprintf("power telemetry (mV, min %u):\n", power_telemetry_get_vbat_min_mv());
+    for (uint8_t i = 0; i < POWER_TELEMETRY_HISTORY; i++) {
+        const power_telemetry_sample_t *sample = &history[(history_head + i) % POWER_TELEMETRY_HISTORY];
+        if (sample->timestamp == 0) {
+            continue; // slot never written
+        }
+        xprintf("  %9lu vbat %4u isense %4u load %7lu task %u%s\n", sample->timestamp, sample->vbat_mv, sample->current_raw, sample->load_ticks, sample->dominant_task, (sample->flags & POWER_TELEMETRY_FLAG_SUSPEND) ? " [suspend]" : (sample->flags & POWER_TELEMETRY_FLAG_WAKEUP) ? " [wakeup]" : "");
+    }
+}
+
+void power_telemetry_task(void) {
+    static uint32_t last_sample = 0;
+    static uint32_t last_dump   = 0;
+    if (timer_elapsed32(last_sample) >= POWER_TELEMETRY_SAMPLE_INTERVAL_MS) {
+        last_sample = timer_read32();
+        power_telemetry_sample_now(0);
+    }
+    if (debug_enable && timer_elapsed32(last_dump) >= (uint32_t)POWER_TELEMETRY_SAMPLE_INTERVAL_MS * POWER_TELEMETRY_HISTORY) {
+        last_dump = timer_read32();
+        power_telemetry_dump();
+    }
+}
+
+void power_telemetry_suspend_power_down(void) {
+    // suspend_power_down() is called in a loop while suspended; only the
+    // first entry is a state change worth a sample.
+    if (!suspend_noted) {
+        suspend_noted = true;
+        power_telemetry_sample_now(POWER_TELEMETRY_FLAG_SUSPEND);
+    }
+}
+
+void power_telemetry_suspend_wakeup_init(void) {
+    suspend_noted = false;
+    power_telemetry_sample_now(POWER_TELEMETRY_FLAG_WAKEUP);
+}
+
+void power_telemetry_read_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    for (uint16_t i = 0; i < size; i++) {
+        uint16_t pos = offset + i;
+        uint8_t  idx = pos / sizeof(power_telemetry_sample_t);
+        if (idx >= POWER_TELEMETRY_HISTORY) {
+            data[i] = 0x00;
+            continue;
+        }
+        const uint8_t *sample = (const uint8_t *)&history[(history_head + idx) % POWER_TELEMETRY_HISTORY];
+        data[i]               = sample[pos % sizeof(power_telemetry_sample_t)];
+    }
+}
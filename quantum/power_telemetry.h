@@ -0,0 +1,91 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * \file
+ *
+ * \brief Battery/power telemetry with load-correlated sampling.
+ *
+ * With `POWER_TELEMETRY_ENABLE = yes`, the battery voltage (and, when a
+ * sense pin is configured, the current-sense output) is sampled through the
+ * ADC every `POWER_TELEMETRY_SAMPLE_INTERVAL_MS` milliseconds. Each sample
+ * also records the task accounting load at that moment when
+ * `TASK_ACCOUNTING_ENABLE` is on, so drain can be attributed to the
+ * subsystem that was busy — which of RGB/OLED/scan-rate dominates — instead
+ * of guessed at. Samples entering and leaving suspend are flagged, making
+ * the suspend floor visible next to the active numbers.
+ *
+ * The history ring is dumped to the console while debug is enabled, and
+ * with `RAW_HID_STREAM_ENABLE` it is readable in bulk as a stream channel:
+ * `POWER_TELEMETRY_HISTORY` little-endian samples, oldest first.
+ */
+
+#ifndef POWER_TELEMETRY_SAMPLE_INTERVAL_MS
+#    define POWER_TELEMETRY_SAMPLE_INTERVAL_MS 250
+#endif
+
+// Number of samples kept in the history ring.
+#ifndef POWER_TELEMETRY_HISTORY
+#    define POWER_TELEMETRY_HISTORY 16
+#endif
+
+// ADC reference in millivolts, and the factor the external divider scales
+// VBAT down by (e.g. 2 for a half divider).
+#ifndef POWER_TELEMETRY_VREF_MV
+#    define POWER_TELEMETRY_VREF_MV 3300
+#endif
+#ifndef POWER_TELEMETRY_VBAT_DIVIDER
+#    define POWER_TELEMETRY_VBAT_DIVIDER 1
+#endif
+
+enum power_telemetry_sample_flags {
+    POWER_TELEMETRY_FLAG_SUSPEND = 1 << 0, // taken on suspend entry
+    POWER_TELEMETRY_FLAG_WAKEUP  = 1 << 1, // taken on wakeup
+};
+
+typedef struct power_telemetry_sample_t {
+    uint32_t timestamp;     // milliseconds since boot
+    uint16_t vbat_mv;       // divider-corrected battery voltage
+    uint16_t current_raw;   // raw ADC counts, 0 without a sense pin
+    uint32_t load_ticks;    // sum of task accounting averages at sample time
+    uint8_t  dominant_task; // task_accounting_id with the largest average
+    uint8_t  flags;         // power_telemetry_sample_flags
+    uint16_t reserved;
+} power_telemetry_sample_t;
+
+#ifdef POWER_TELEMETRY_ENABLE
+
+/* Periodic sampling and debug dump; called from keyboard_task(). */
+void power_telemetry_task(void);
+
+/* Records a sample immediately, e.g. around a feature being toggled. */
+void power_telemetry_sample_now(uint8_t flags);
+
+/* Smoothed battery voltage and the lowest voltage seen since boot. */
+uint16_t power_telemetry_get_vbat_mv(void);
+uint16_t power_telemetry_get_vbat_min_mv(void);
+
+/* Most recent raw current-sense reading. */
+uint16_t power_telemetry_get_current_raw(void);
+
+/* Prints the history ring to the console. */
+void power_telemetry_dump(void);
+
+/* Suspend entry/exit samples; called from the quantum suspend hooks. */
+void power_telemetry_suspend_power_down(void);
+void power_telemetry_suspend_wakeup_init(void);
+
+/* Flattened little-endian history for the raw HID stream channel. */
+void power_telemetry_read_buffer(uint16_t offset, uint16_t size, uint8_t *data);
+
+#else
+
+#    define power_telemetry_task()
+#    define power_telemetry_suspend_power_down()
+#    define power_telemetry_suspend_wakeup_init()
+
+#endif
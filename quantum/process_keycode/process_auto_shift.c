@@ -18,6 +18,7 @@
 
 #    include <stdbool.h>
 #    include "process_auto_shift.h"
+#    include "keycode_class.h"
 
 #    ifndef AUTO_SHIFT_DISABLED_AT_STARTUP
 #        define AUTO_SHIFT_STARTUP_STATE true /* enabled */
@@ -67,17 +68,21 @@ __attribute__((weak)) bool get_custom_auto_shifted_key(uint16_t keycode, keyreco
 
 /** \brief Called on physical press, returns whether is Auto Shift key */
 __attribute__((weak)) bool get_auto_shifted_key(uint16_t keycode, keyrecord_t *record) {
-    switch (keycode) {
+    // The class flags cover the same sets as the AUTO_SHIFT_ALPHA,
+    // AUTO_SHIFT_NUMERIC and AUTO_SHIFT_SPECIAL case ranges, resolved with
+    // one table load instead of a compare chain per event.
+    uint8_t enabled_classes = 0;
 #    ifndef NO_AUTO_SHIFT_ALPHA
-        case AUTO_SHIFT_ALPHA:
+    enabled_classes |= KC_CLASS_ALPHA;
 #    endif
 #    ifndef NO_AUTO_SHIFT_NUMERIC
-        case AUTO_SHIFT_NUMERIC:
+    enabled_classes |= KC_CLASS_NUMERIC;
 #    endif
 #    ifndef NO_AUTO_SHIFT_SPECIAL
-        case AUTO_SHIFT_SPECIAL:
+    enabled_classes |= KC_CLASS_SPECIAL;
 #    endif
-            return true;
+    if (keycode_class(keycode) & enabled_classes) {
+        return true;
     }
     return get_custom_auto_shifted_key(keycode, record);
 }
@@ -17,6 +17,121 @@
 static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
 static uint8_t typo_buffer_size                    = 1;
 
+#ifdef AUTOCORRECT_EXTERNAL_FLASH_ENABLE
+#    include "flash_spi.h"
+
+#    ifndef AUTOCORRECT_FLASH_ADDR
+#        define AUTOCORRECT_FLASH_ADDR 0
+#    endif
+// Bytes of the trie pinned in RAM. The root node and the first levels below it live at the start of the
+// image, so the common no-match case resolves entirely from this prefix without touching the bus.
+#    ifndef AUTOCORRECT_FLASH_PIN_BYTES
+#        define AUTOCORRECT_FLASH_PIN_BYTES 256
+#    endif
+// Deeper nodes are fetched through a small direct-mapped block cache; a trie walk touches a handful of
+// adjacent bytes per node, so even a few blocks absorb nearly all repeat reads within a word.
+#    ifndef AUTOCORRECT_FLASH_BLOCK_SIZE
+#        define AUTOCORRECT_FLASH_BLOCK_SIZE 64
+#    endif
+#    ifndef AUTOCORRECT_FLASH_CACHE_BLOCKS
+#        define AUTOCORRECT_FLASH_CACHE_BLOCKS 8
+#    endif
+
+// Image layout at AUTOCORRECT_FLASH_ADDR: 'A', 'C', dictionary size (uint16_t LE), trie data. The trie
+// bytes are exactly what `qmk generate-autocorrect-data` emits into autocorrect_data[]; child links are
+// 16-bit, which caps the image at 64k but removes the firmware-flash cap entirely.
+#    define AUTOCORRECT_FLASH_HEADER_SIZE 4
+
+static uint8_t  autocorrect_flash_pinned[AUTOCORRECT_FLASH_PIN_BYTES];
+static uint8_t  autocorrect_flash_cache[AUTOCORRECT_FLASH_CACHE_BLOCKS][AUTOCORRECT_FLASH_BLOCK_SIZE];
+static uint16_t autocorrect_flash_cache_tag[AUTOCORRECT_FLASH_CACHE_BLOCKS];
+static uint16_t autocorrect_flash_dict_size = 0;
+static bool     autocorrect_flash_usable    = false;
+static bool     autocorrect_flash_probed    = false;
+
+static void autocorrect_flash_probe(void) {
+    flash_init();
+
+    uint8_t header[AUTOCORRECT_FLASH_HEADER_SIZE];
+    if (flash_read_block(AUTOCORRECT_FLASH_ADDR, header, sizeof(header)) != FLASH_STATUS_SUCCESS) {
+        return;
+    }
+    if (header[0] != 'A' || header[1] != 'C') {
+        return;
+    }
+    autocorrect_flash_dict_size = header[2] | (header[3] << 8);
+    if (autocorrect_flash_dict_size == 0 || autocorrect_flash_dict_size == 0xFFFF) {
+        return;
+    }
+
+    uint16_t pin_bytes = autocorrect_flash_dict_size < AUTOCORRECT_FLASH_PIN_BYTES ? autocorrect_flash_dict_size : AUTOCORRECT_FLASH_PIN_BYTES;
+    if (flash_read_block(AUTOCORRECT_FLASH_ADDR + AUTOCORRECT_FLASH_HEADER_SIZE, autocorrect_flash_pinned, pin_bytes) != FLASH_STATUS_SUCCESS) {
+        return;
+    }
+    memset(autocorrect_flash_cache_tag, 0xFF, sizeof(autocorrect_flash_cache_tag));
+    autocorrect_flash_usable = true;
+}
+
+static uint8_t autocorrect_data_read(uint16_t offset) {
+    if (!autocorrect_flash_usable) {
+        // No valid image in external flash -- fall back to the compiled-in dictionary.
+        return pgm_read_byte(autocorrect_data + offset);
+    }
+    if (offset < AUTOCORRECT_FLASH_PIN_BYTES) {
+        return autocorrect_flash_pinned[offset];
+    }
+    uint16_t block = offset / AUTOCORRECT_FLASH_BLOCK_SIZE;
+    uint8_t  slot  = block % AUTOCORRECT_FLASH_CACHE_BLOCKS;
+    if (autocorrect_flash_cache_tag[slot] != block) {
+        if (flash_read_block(AUTOCORRECT_FLASH_ADDR + AUTOCORRECT_FLASH_HEADER_SIZE + (uint32_t)block * AUTOCORRECT_FLASH_BLOCK_SIZE, autocorrect_flash_cache[slot], AUTOCORRECT_FLASH_BLOCK_SIZE) != FLASH_STATUS_SUCCESS) {
+            return 0;
+        }
+        autocorrect_flash_cache_tag[slot] = block;
+    }
+    return autocorrect_flash_cache[slot][offset % AUTOCORRECT_FLASH_BLOCK_SIZE];
+}
+
+static uint16_t autocorrect_data_size(void) {
+    return autocorrect_flash_usable ? autocorrect_flash_dict_size : DICTIONARY_SIZE;
+}
+#else
+static inline uint8_t autocorrect_data_read(uint16_t offset) {
+    return pgm_read_byte(autocorrect_data + offset);
+}
+
+static inline uint16_t autocorrect_data_size(void) {
+    return DICTIONARY_SIZE;
+}
+#endif // AUTOCORRECT_EXTERNAL_FLASH_ENABLE
+
+#ifdef AUTOCORRECT_ROOT_INDEX_ENABLE
+/*
+    The trie stores typos reversed, so every keypress starts a fresh walk at the root with the newest key. The root
+    is by far the widest node in the trie -- typically one child per alphabet letter -- making its linear sibling
+    scan the dominant per-keypress cost. Since keycodes in the trie fit in 6 bits, a 64-entry jump table resolves
+    the first transition with a single indexed load. Deeper nodes have small branching and are left as-is.
+*/
+static uint16_t autocorrect_root_index[64];
+static bool     autocorrect_root_index_usable = false;
+static bool     autocorrect_root_index_built  = false;
+
+static void autocorrect_build_root_index(void) {
+    uint8_t code = autocorrect_data_read(0);
+    if (!(code & 64)) {
+        // Root with a single child (tiny dictionary) -- not worth indexing, use the normal walk
+        autocorrect_root_index_usable = false;
+        return;
+    }
+
+    uint16_t state = 0;
+    for (code &= 63; code; code = autocorrect_data_read(state)) {
+        autocorrect_root_index[code & 63] = autocorrect_data_read(state + 1) | autocorrect_data_read(state + 2) << 8;
+        state += 3;
+    }
+    autocorrect_root_index_usable = true;
+}
+#endif // AUTOCORRECT_ROOT_INDEX_ENABLE
+
 /**
  * @brief function for querying the enabled state of autocorrect
  *
@@ -254,42 +369,81 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
         return true;
     }
 
+#ifdef AUTOCORRECT_EXTERNAL_FLASH_ENABLE
+    if (!autocorrect_flash_probed) {
+        autocorrect_flash_probe();
+        autocorrect_flash_probed = true;
+    }
+#endif
+#ifdef AUTOCORRECT_ROOT_INDEX_ENABLE
+    if (!autocorrect_root_index_built) {
+        autocorrect_build_root_index();
+        autocorrect_root_index_built = true;
+    }
+#endif
+
     // Check for typo in buffer using a trie stored in `autocorrect_data`.
     uint16_t state = 0;
-    uint8_t  code  = pgm_read_byte(autocorrect_data + state);
+    uint8_t  code  = autocorrect_data_read(state);
     for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
         uint8_t const key_i = typo_buffer[i];
 
+#ifdef AUTOCORRECT_ROOT_INDEX_ENABLE
+        if (i == typo_buffer_size - 1 && autocorrect_root_index_usable) { // Resolve the root transition through the jump table.
+            state = autocorrect_root_index[key_i & 63];
+            if (!state) {
+                return true;
+            }
+        } else
+#endif
         if (code & 64) { // Check for match in node with multiple children.
             code &= 63;
-            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
+            for (; code != key_i; code = autocorrect_data_read(state += 3)) {
                 if (!code) return true;
             }
             // Follow link to child node.
-            state = (pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8);
+            state = (autocorrect_data_read(state + 1) | autocorrect_data_read(state + 2) << 8);
             // Check for match in node with single child.
         } else if (code != key_i) {
             return true;
-        } else if (!(code = pgm_read_byte(autocorrect_data + (++state)))) {
+        } else if (!(code = autocorrect_data_read(++state))) {
             ++state;
         }
 
         // Stop if `state` becomes an invalid index. This should not normally
         // happen, it is a safeguard in case of a bug, data corruption, etc.
-        if (state >= DICTIONARY_SIZE) {
+        if (state >= autocorrect_data_size()) {
             return true;
         }
 
-        code = pgm_read_byte(autocorrect_data + state);
+        code = autocorrect_data_read(state);
 
         if (code & 128) { // A typo was found! Apply autocorrect.
             const uint8_t backspaces = (code & 63) + !record->event.pressed;
+#ifdef AUTOCORRECT_EXTERNAL_FLASH_ENABLE
+            // The correction string has to be staged in RAM -- there is no streaming send from external flash.
+            char correction[32];
+            for (uint8_t j = 0; j < sizeof(correction); ++j) {
+                correction[j] = (char)autocorrect_data_read(state + 1 + j);
+                if (correction[j] == '\0') {
+                    break;
+                }
+            }
+            correction[sizeof(correction) - 1] = '\0';
+            if (apply_autocorrect(backspaces, correction)) {
+                for (uint8_t i = 0; i < backspaces; ++i) {
+                    tap_code(KC_BSPC);
+                }
+                send_string(correction);
+            }
+#else
             if (apply_autocorrect(backspaces, (char const *)(autocorrect_data + state + 1))) {
                 for (uint8_t i = 0; i < backspaces; ++i) {
                     tap_code(KC_BSPC);
                 }
                 send_string_P((char const *)(autocorrect_data + state + 1));
             }
+#endif // AUTOCORRECT_EXTERNAL_FLASH_ENABLE
 
             if (keycode == KC_SPC) {
                 typo_buffer[0]   = KC_SPC;
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "process_caps_word.h"
+#include "keycode_class.h"
 
 bool process_caps_word(uint16_t keycode, keyrecord_t* record) {
     if (keycode == QK_CAPS_WORD_TOGGLE) {
@@ -173,21 +174,15 @@ bool process_caps_word(uint16_t keycode, keyrecord_t* record) {
 }
 
 __attribute__((weak)) bool caps_word_press_user(uint16_t keycode) {
-    switch (keycode) {
-        // Keycodes that continue Caps Word, with shift applied.
-        case KC_A ... KC_Z:
-        case KC_MINS:
-            add_weak_mods(MOD_BIT(KC_LSFT)); // Apply shift to next key.
-            return true;
-
-        // Keycodes that continue Caps Word, without shifting.
-        case KC_1 ... KC_0:
-        case KC_BSPC:
-        case KC_DEL:
-        case KC_UNDS:
-            return true;
+    const uint8_t classes = keycode_class(keycode);
 
-        default:
-            return false; // Deactivate Caps Word.
+    // Keycodes that continue Caps Word, with shift applied.
+    if ((classes & KC_CLASS_ALPHA) || keycode == KC_MINS) {
+        add_weak_mods(MOD_BIT(KC_LSFT)); // Apply shift to next key.
+        return true;
     }
+
+    // Keycodes that continue Caps Word, without shifting; anything else
+    // deactivates it.
+    return (classes & (KC_CLASS_NUMERIC | KC_CLASS_EDIT)) || keycode == KC_UNDS;
 }
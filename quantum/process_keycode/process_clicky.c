@@ -25,8 +25,21 @@
 float clicky_freq = AUDIO_CLICKY_FREQ_DEFAULT;
 float clicky_rand = AUDIO_CLICKY_FREQ_RANDOMNESS;
 
+#    ifdef AUDIO_CLICKY_PCM
+#        if !defined(AUDIO_DRIVER_DAC)
+#            error "AUDIO_CLICKY_PCM requires the dac_additive audio driver"
+#        endif
+// Playback stride through the pre-rendered click sample, Q8; tracks
+// clicky_freq so the per-keypress path only applies the randomness.
+static uint16_t clicky_stride_q8 = 1 << 8;
+
+static void clicky_update_stride(void) {
+    clicky_stride_q8 = (uint16_t)(256.0f * clicky_freq / AUDIO_CLICKY_FREQ_DEFAULT);
+}
+#    else
 // the first "note" is an intentional delay; the 2nd and 3rd notes are the "clicky"
 float clicky_song[][2] = {{AUDIO_CLICKY_FREQ_MIN, AUDIO_CLICKY_DELAY_DURATION}, {AUDIO_CLICKY_FREQ_DEFAULT, 3}, {AUDIO_CLICKY_FREQ_DEFAULT, 1}}; // 3 and 1 --> durations
+#    endif
 
 extern audio_config_t audio_config;
 
@@ -39,9 +52,17 @@ void clicky_play(void) {
 #    ifndef NO_MUSIC_MODE
     if (music_activated || midi_activated || !audio_config.enable) return;
 #    endif // !NO_MUSIC_MODE
+#    ifdef AUDIO_CLICKY_PCM
+    // the sample is pre-rendered, so a click is one jittered pointer arm in
+    // the driver instead of a song played through the synth voice setup
+    uint16_t stride = clicky_stride_q8;
+    stride += (uint16_t)((float)stride * clicky_rand * (((float)rand()) / ((float)(RAND_MAX))));
+    audio_driver_click(stride);
+#    else
     clicky_song[1][0] = 2.0f * clicky_freq * (1.0f + clicky_rand * (((float)rand()) / ((float)(RAND_MAX))));
     clicky_song[2][0] = clicky_freq * (1.0f + clicky_rand * (((float)rand()) / ((float)(RAND_MAX))));
     PLAY_SONG(clicky_song);
+#    endif
 }
 
 void clicky_freq_up(void) {
@@ -49,6 +70,9 @@ void clicky_freq_up(void) {
     if (new_freq < AUDIO_CLICKY_FREQ_MAX) {
         clicky_freq = new_freq;
     }
+#    ifdef AUDIO_CLICKY_PCM
+    clicky_update_stride();
+#    endif
 }
 
 void clicky_freq_down(void) {
@@ -56,10 +80,16 @@ void clicky_freq_down(void) {
     if (new_freq > AUDIO_CLICKY_FREQ_MIN) {
         clicky_freq = new_freq;
     }
+#    ifdef AUDIO_CLICKY_PCM
+    clicky_update_stride();
+#    endif
 }
 
 void clicky_freq_reset(void) {
     clicky_freq = AUDIO_CLICKY_FREQ_DEFAULT;
+#    ifdef AUDIO_CLICKY_PCM
+    clicky_update_stride();
+#    endif
 }
 
 void clicky_toggle(void) {
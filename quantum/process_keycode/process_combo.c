@@ -18,6 +18,26 @@
 #include "process_combo.h"
 #include "action_tapping.h"
 #include "action.h"
+#ifdef COMBO_KEY_INDEX_ENABLE
+#    include "keymap_introspection.h"
+#endif
+#ifdef SEQUENCE_DEFERRED_TIMEOUT
+#    ifndef DEFERRED_EXEC_ENABLE
+#        error "SEQUENCE_DEFERRED_TIMEOUT requires DEFERRED_EXEC_ENABLE"
+#    endif
+#    include "deferred_exec.h"
+#endif
+
+/* Settlement points report to the event trace so a dump shows when each
+ * combo fired or expired. */
+#ifdef EVENT_TRACE_ENABLE
+#    include "event_trace.h"
+#    define COMBO_TRACE_DECISION(decision) event_trace_note_decision(decision)
+#else
+#    define COMBO_TRACE_DECISION(decision) \
+        do {                               \
+        } while (0)
+#endif
 
 #ifdef COMBO_COUNT
 __attribute__((weak)) combo_t key_combos[COMBO_COUNT];
@@ -27,6 +47,8 @@ extern combo_t  key_combos[];
 extern uint16_t COMBO_LEN;
 #endif
 
+uint16_t g_combo_term = COMBO_TERM;
+
 __attribute__((weak)) void process_combo_event(uint16_t combo_index, bool pressed) {}
 
 #ifndef COMBO_ONLY_FROM_LAYER
@@ -49,7 +71,7 @@ __attribute__((weak)) bool get_combo_must_tap(uint16_t index, combo_t *combo) {
 
 #ifdef COMBO_TERM_PER_COMBO
 __attribute__((weak)) uint16_t get_combo_term(uint16_t index, combo_t *combo) {
-    return COMBO_TERM;
+    return g_combo_term;
 }
 #endif
 
@@ -73,6 +95,35 @@ __attribute__((weak)) bool combo_should_trigger(uint16_t combo_index, combo_t *c
 
 #ifndef COMBO_NO_TIMER
 static uint16_t timer = 0;
+#    ifdef KEY_EVENT_TIME_US
+// Microsecond shadow of `timer`, anchored to the first key's strobe capture so
+// the combo term is not quantized to the matrix scan period. `timer` (also
+// capture-anchored) remains the active/inactive flag.
+static uint32_t timer_us = 0;
+// Elapsed term is judged at the incoming event's capture timestamp, not at processing time, so a
+// backlog between scan and processing cannot turn an in-term press into an expired one.
+#        define COMBO_TERM_ELAPSED(term, ev) (TIMER_DIFF_32((ev).time_us, timer_us) > 1000UL * (term))
+#    else
+#        define COMBO_TERM_ELAPSED(term, ev) (TIMER_DIFF_16((ev).time, timer) > (term))
+#    endif
+/* Absolute expiry of the pending combo window, recomputed whenever combo keys
+ * are buffered. combo_task() compares the clock against this single value per
+ * scan instead of re-deriving the deadline from `longest_term` every time. */
+#    ifdef KEY_EVENT_TIME_US
+static uint32_t deadline_us = 0;
+#        define COMBO_DEADLINE_UPDATE() (deadline_us = timer_us + 1000UL * longest_term + 1)
+#        define COMBO_DEADLINE_EXPIRED() timer_expired32(timer_read_us(), deadline_us)
+#    else
+static uint16_t deadline = 0;
+#        define COMBO_DEADLINE_UPDATE() (deadline = timer + longest_term + 1)
+#        define COMBO_DEADLINE_EXPIRED() timer_expired(timer_read(), deadline)
+#    endif
+#    ifdef SEQUENCE_DEFERRED_TIMEOUT
+/* (Re)arms a deferred executor deadline for the pending combo window, so the
+ * expiry fires from deferred_exec_task() instead of combo_task() polling the
+ * clock every scan. Defined below combo_task(), next to the expiry logic. */
+static void combo_deadline_arm(void);
+#    endif
 #endif
 static bool     b_combo_enable = true; // defaults to enabled
 static uint16_t longest_term   = 0;
@@ -148,7 +199,7 @@ static inline void release_combo(uint16_t combo_index, combo_t *combo) {
             .keycode = combo->keycode,
         };
 #ifndef NO_ACTION_TAPPING
-        action_tapping_process(record);
+        action_tapping_process(&record);
 #else
         process_record(&record);
 #endif
@@ -188,7 +239,7 @@ static inline uint16_t _get_combo_term(uint16_t combo_index, combo_t *combo) {
     return get_combo_term(combo_index, combo);
 #endif
 
-    return COMBO_TERM;
+    return g_combo_term;
 }
 
 void clear_combos(void) {
@@ -227,7 +278,7 @@ static inline void dump_key_buffer(void) {
             process_combo_event(qrecord->combo_index, true);
         } else {
 #ifndef NO_ACTION_TAPPING
-            action_tapping_process(*record);
+            action_tapping_process(record);
 #else
             process_record(record);
 #endif
@@ -337,6 +388,7 @@ void apply_combo(uint16_t combo_index, combo_t *combo) {
 
             qrecord->combo_index = combo_index;
             ACTIVATE_COMBO(combo);
+            COMBO_TRACE_DECISION(EVENT_TRACE_DECISION_COMBO_FIRED);
 
             break;
         } else {
@@ -446,8 +498,9 @@ static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *
 
 #ifndef COMBO_NO_TIMER
             /* Don't buffer this combo if its combo term has passed. */
-            if (timer && timer_elapsed(timer) > time) {
+            if (timer && COMBO_TERM_ELAPSED(time, record->event)) {
                 DISABLE_COMBO(combo);
+                COMBO_TRACE_DECISION(EVENT_TRACE_DECISION_COMBO_EXPIRED);
                 return true;
             } else
 #endif
@@ -563,21 +616,52 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < COMBO_LEN; ++idx) {
-        combo_t *combo = &key_combos[idx];
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_KEY_INDEX_ENABLE
+    const combo_key_index_entry_t *candidates;
+    uint16_t                       candidate_count;
+    if (combo_key_index_lookup(keycode, &candidates, &candidate_count)) {
+        /* Only combos containing this keycode can react to the event -- combos not in the candidate list would
+         * bail out of process_single_combo() without side effects anyway. */
+        for (uint16_t i = 0; i < candidate_count; ++i) {
+            const uint16_t idx = candidates[i].combo_index;
+            if (i > 0 && candidates[i - 1].combo_index == idx) {
+                // a keycode repeated within one combo yields adjacent duplicate entries
+                continue;
+            }
+            is_combo_key |= process_single_combo(&key_combos[idx], keycode, record, idx);
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < COMBO_LEN; ++idx) {
+            combo_t *combo = &key_combos[idx];
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+            no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
 #ifndef COMBO_NO_TIMER
 #    ifdef COMBO_STRICT_TIMER
         if (!timer) {
-            // timer is set only on the first key
-            timer = timer_read();
+            // timer is set only on the first key; anchored at the key's capture timestamp (never zero,
+            // see MAKE_KEYEVENT), so the combo window does not shift with processing backlog
+            timer = record->event.time;
+#        ifdef KEY_EVENT_TIME_US
+            timer_us = record->event.time_us;
+#        endif
         }
 #    else
-        timer = timer_read();
+        timer = record->event.time;
+#        ifdef KEY_EVENT_TIME_US
+        timer_us = record->event.time_us;
+#        endif
+#    endif
+        // `longest_term` can only have grown during this event; refresh the
+        // cached deadline even when the strict timer was already running.
+        COMBO_DEADLINE_UPDATE();
+#    ifdef SEQUENCE_DEFERRED_TIMEOUT
+        combo_deadline_arm();
 #    endif
 #endif
 
@@ -604,26 +688,68 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     return !is_combo_key;
 }
 
+#ifndef COMBO_NO_TIMER
+static void combo_deadline_expire(void) {
+    if (combo_buffer_read != combo_buffer_write) {
+        apply_combos();
+        longest_term = 0;
+        timer        = 0;
+    } else {
+        dump_key_buffer();
+        timer = 0;
+        clear_combos();
+    }
+}
+#endif
+
 void combo_task(void) {
     if (!b_combo_enable) {
         return;
     }
 
-#ifndef COMBO_NO_TIMER
-    if (timer && timer_elapsed(timer) > longest_term) {
-        if (combo_buffer_read != combo_buffer_write) {
-            apply_combos();
-            longest_term = 0;
-            timer        = 0;
-        } else {
-            dump_key_buffer();
-            timer = 0;
-            clear_combos();
-        }
+#if !defined(COMBO_NO_TIMER) && !defined(SEQUENCE_DEFERRED_TIMEOUT)
+    if (timer && COMBO_DEADLINE_EXPIRED()) {
+        combo_deadline_expire();
     }
 #endif
 }
 
+#if !defined(COMBO_NO_TIMER) && defined(SEQUENCE_DEFERRED_TIMEOUT)
+static deferred_token combo_timeout_token = INVALID_DEFERRED_TOKEN;
+
+static uint32_t combo_deadline_callback(uint32_t trigger_time, void *cb_arg) {
+    // A stale deadline is harmless: the window may have been resolved by a
+    // non-combo key or combo_disable() since this was armed, in which case
+    // `timer` is already clear and the slot is simply released.
+    if (!b_combo_enable || !timer) {
+        combo_timeout_token = INVALID_DEFERRED_TOKEN;
+        return 0;
+    }
+    if (!COMBO_DEADLINE_EXPIRED()) {
+        // Rounding to whole milliseconds can land the callback just short of
+        // the microsecond deadline; tick over the remainder.
+        return 1;
+    }
+    combo_deadline_expire();
+    combo_timeout_token = INVALID_DEFERRED_TOKEN;
+    return 0;
+}
+
+static void combo_deadline_arm(void) {
+    uint32_t delay_ms;
+#    ifdef KEY_EVENT_TIME_US
+    int32_t remaining_us = (int32_t)TIMER_DIFF_32(deadline_us, timer_read_us());
+    delay_ms             = remaining_us <= 0 ? 1 : ((uint32_t)remaining_us + 999) / 1000;
+#    else
+    int16_t remaining_ms = (int16_t)(deadline - timer_read());
+    delay_ms             = remaining_ms <= 0 ? 1 : (uint32_t)remaining_ms;
+#    endif
+    if (!extend_deferred_exec(combo_timeout_token, delay_ms)) {
+        combo_timeout_token = defer_exec(delay_ms, combo_deadline_callback, NULL);
+    }
+}
+#endif
+
 void combo_enable(void) {
     b_combo_enable = true;
 }
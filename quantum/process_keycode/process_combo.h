@@ -68,6 +68,8 @@ typedef struct {
 #    define COMBO_HOLD_TERM TAPPING_TERM
 #endif
 
+extern uint16_t g_combo_term;
+
 /* check if keycode is only modifiers */
 #define KEYCODE_IS_MOD(code) (IS_MODIFIER_KEYCODE(code) || (IS_QK_MODS(code) && !QK_MODS_GET_BASIC_KEYCODE(code)))
 
@@ -49,6 +49,49 @@ __attribute__((weak)) bool dynamic_macro_valid_key_user(uint16_t keycode, keyrec
     return true;
 }
 
+#ifdef DYNAMIC_MACRO_ASYNC_PLAY
+#    ifndef DEFERRED_EXEC_ENABLE
+#        error "DYNAMIC_MACRO_ASYNC_PLAY requires DEFERRED_EXEC_ENABLE"
+#    endif
+
+#    include "deferred_exec.h"
+
+/* How long to wait between two replayed events, in milliseconds. */
+#    ifndef DYNAMIC_MACRO_PLAY_INTERVAL_MS
+#        ifdef DYNAMIC_MACRO_DELAY
+#            define DYNAMIC_MACRO_PLAY_INTERVAL_MS (DYNAMIC_MACRO_DELAY)
+#        else
+#            define DYNAMIC_MACRO_PLAY_INTERVAL_MS 5
+#        endif
+#    endif
+
+/* Asynchronous replay streams the macro out one event per deferred
+ * executor invocation instead of blocking the scan loop for the whole
+ * macro, so the keyboard keeps scanning, debouncing and housekeeping
+ * while a long macro plays.
+ */
+static keyrecord_t *  async_play_pointer   = NULL;
+static keyrecord_t *  async_play_end       = NULL;
+static int8_t         async_play_direction = 0;
+static layer_state_t  async_play_saved_layer_state;
+static deferred_token async_play_token = INVALID_DEFERRED_TOKEN;
+
+static uint32_t dynamic_macro_play_callback(uint32_t trigger_time, void *cb_arg) {
+    process_record(async_play_pointer);
+    async_play_pointer += async_play_direction;
+
+    if (async_play_pointer == async_play_end) {
+        clear_keyboard();
+        layer_state_set(async_play_saved_layer_state);
+        async_play_token = INVALID_DEFERRED_TOKEN;
+        dynamic_macro_play_user(async_play_direction);
+        return 0;
+    }
+
+    return DYNAMIC_MACRO_PLAY_INTERVAL_MS;
+}
+#endif // DYNAMIC_MACRO_ASYNC_PLAY
+
 /* Convenience macros used for retrieving the debug info. All of them
  * need a `direction` variable accessible at the call site.
  */
@@ -82,11 +125,32 @@ void dynamic_macro_record_start(keyrecord_t **macro_pointer, keyrecord_t *macro_
 void dynamic_macro_play(keyrecord_t *macro_buffer, keyrecord_t *macro_end, int8_t direction) {
     dprintf("dynamic macro: slot %d playback\n", DYNAMIC_MACRO_CURRENT_SLOT());
 
+#ifdef DYNAMIC_MACRO_ASYNC_PLAY
+    if (async_play_token != INVALID_DEFERRED_TOKEN) {
+        dprintln("dynamic macro: ignoring play, playback in progress");
+        return;
+    }
+#endif
+
     layer_state_t saved_layer_state = layer_state;
 
     clear_keyboard();
     layer_clear();
 
+#ifdef DYNAMIC_MACRO_ASYNC_PLAY
+    if (macro_buffer != macro_end) {
+        async_play_pointer           = macro_buffer;
+        async_play_end               = macro_end;
+        async_play_direction         = direction;
+        async_play_saved_layer_state = saved_layer_state;
+        async_play_token             = defer_exec(DYNAMIC_MACRO_PLAY_INTERVAL_MS, dynamic_macro_play_callback, NULL);
+        if (async_play_token != INVALID_DEFERRED_TOKEN) {
+            return;
+        }
+        /* No deferred executor slot was free: fall back to the synchronous replay. */
+    }
+#endif
+
     while (macro_buffer != macro_end) {
         process_record(macro_buffer);
         macro_buffer += direction;
@@ -162,6 +226,24 @@ void dynamic_macro_record_end(keyrecord_t *macro_buffer, keyrecord_t *macro_poin
  *   }
  */
 bool process_dynamic_macro(uint16_t keycode, keyrecord_t *record) {
+#ifdef DYNAMIC_MACRO_ASYNC_PLAY
+    /* While a replay is streaming out, the macro control keys are
+     * inert: recording would capture the replayed events interleaved
+     * with the user's typing, and a second playback cannot share the
+     * single replay cursor.
+     */
+    if (async_play_token != INVALID_DEFERRED_TOKEN) {
+        switch (keycode) {
+            case QK_DYNAMIC_MACRO_RECORD_START_1:
+            case QK_DYNAMIC_MACRO_RECORD_START_2:
+            case QK_DYNAMIC_MACRO_RECORD_STOP:
+            case QK_DYNAMIC_MACRO_PLAY_1:
+            case QK_DYNAMIC_MACRO_PLAY_2:
+                return false;
+        }
+    }
+#endif
+
     /* Both macros use the same buffer but read/write on different
      * ends of it.
      *
@@ -84,6 +84,36 @@ static bool enabled = true;
 // Public variables
 __attribute__((weak)) const key_override_t **key_overrides = NULL;
 
+#ifdef KEY_OVERRIDE_TRIGGER_FILTER_ENABLE
+// Summary of the registered overrides, used to reject events that cannot possibly activate any override without walking the whole list. The list is fixed at link time, so the summary is built once, on first use.
+static uint64_t      trigger_filter        = 0;     // Bloom filter over the trigger keycodes, two bits per trigger
+static layer_state_t filter_layers_union   = 0;     // Union of all override layer masks
+static bool          filter_any_mod_free   = false; // Some override activates with no modifiers down
+static bool          filter_any_no_trigger = false; // Some override has no trigger key (KC_NO)
+static bool          filter_built          = false;
+
+static uint64_t trigger_filter_bits(uint16_t keycode) {
+    return ((uint64_t)1 << (keycode & 63)) | ((uint64_t)1 << (((keycode >> 6) ^ (keycode * 13)) & 63));
+}
+
+static void build_trigger_filter(void) {
+    for (uint8_t i = 0; key_overrides[i] != NULL; i++) {
+        const key_override_t *const override = key_overrides[i];
+
+        if (override->trigger == KC_NO) {
+            filter_any_no_trigger = true;
+        } else {
+            trigger_filter |= trigger_filter_bits(override->trigger);
+        }
+        if (override->trigger_mods == 0) {
+            filter_any_mod_free = true;
+        }
+        filter_layers_union |= override->layers;
+    }
+    filter_built = true;
+}
+#endif // KEY_OVERRIDE_TRIGGER_FILTER_ENABLE
+
 // Forward decls
 static const key_override_t *clear_active_override(const bool allow_reregister);
 
@@ -249,6 +279,40 @@ static bool try_activating_override(const uint16_t keycode, const uint8_t layer,
         return true;
     }
 
+#ifdef KEY_OVERRIDE_TRIGGER_FILTER_ENABLE
+    if (!filter_built) {
+        build_trigger_filter();
+    }
+
+    // Most events cannot activate any override at all; the summary rejects them without touching the list. Every check here is conservative: a pass only means some override _might_ match.
+    if ((filter_layers_union & ((layer_state_t)1 << layer)) == 0) {
+        *activated = false;
+        return true;
+    }
+
+    if (active_mods == 0 && !filter_any_mod_free) {
+        *activated = false;
+        return true;
+    }
+
+    if (!filter_any_no_trigger) {
+        const uint64_t key_bits   = trigger_filter_bits(keycode);
+        bool           maybe_hits = (trigger_filter & key_bits) == key_bits;
+
+        // A modifier event can also activate an override whose trigger is the last non-mod key that went down
+        if (!maybe_hits && is_mod && last_key_down != 0) {
+            const uint64_t last_key_bits = trigger_filter_bits(last_key_down);
+
+            maybe_hits = (trigger_filter & last_key_bits) == last_key_bits;
+        }
+
+        if (!maybe_hits) {
+            *activated = false;
+            return true;
+        }
+    }
+#endif // KEY_OVERRIDE_TRIGGER_FILTER_ENABLE
+
     for (uint8_t i = 0;; i++) {
         const key_override_t *const override = key_overrides[i];
 
@@ -19,7 +19,9 @@
 
 bool process_leader(uint16_t keycode, keyrecord_t *record) {
     if (record->event.pressed) {
-        if (leader_sequence_active() && !leader_sequence_timed_out()) {
+        // Timeout and timer-reset decisions use the event's capture timestamp, so the sequence window
+        // does not stretch or shrink with whatever backlog sat between matrix scan and processing.
+        if (leader_sequence_active() && !leader_sequence_timed_out_at(record->event.time)) {
 #ifndef LEADER_KEY_STRICT_KEY_PROCESSING
             if (IS_QK_MOD_TAP(keycode)) {
                 keycode = QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
@@ -35,12 +37,22 @@ bool process_leader(uint16_t keycode, keyrecord_t *record) {
             }
 
 #ifdef LEADER_PER_KEY_TIMING
-            leader_reset_timer();
+            leader_reset_timer_at(record->event.time);
+#endif
+
+#ifdef LEADER_MAP_ENABLE
+            // May end the sequence early: a uniquely completed entry fires immediately, a dead prefix is abandoned
+            leader_map_update();
 #endif
 
             return false;
         } else if (keycode == QK_LEADER) {
             leader_start();
+#ifndef LEADER_NO_TIMEOUT
+            // Re-anchor at the leader key's capture time; with LEADER_NO_TIMEOUT the clock only starts
+            // on the first sequence key.
+            leader_reset_timer_at(record->event.time);
+#endif
         }
     }
 
@@ -252,6 +252,11 @@ bool process_midi(uint16_t keycode, keyrecord_t *record) {
 
 void midi_task(void) {
     midi_device_process(&midi_device);
+#    ifdef MIDI_TX_QUEUE
+    // everything queued since the last pass - including this frame's key
+    // events - goes out as one bundle
+    midi_flush_tx();
+#    endif
 #    ifdef MIDI_ADVANCED
     if (timer_elapsed(midi_modulation_timer) < midi_config.modulation_interval) return;
     midi_modulation_timer = timer_read();
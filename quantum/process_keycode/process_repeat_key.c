@@ -0,0 +1,173 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "process_repeat_key.h"
+#include "keycode_class.h"
+#include "quantum_keycodes.h"
+#include "action_util.h"
+#include "progmem.h"
+#include "util.h"
+
+static uint16_t last_keycode = KC_NO;
+static uint8_t  last_mods    = 0;
+// Set while a replayed record runs through process_record(), so the replay
+// is not itself remembered (or replayed again).
+static bool replaying = false;
+
+uint16_t get_last_keycode(void) {
+    return last_keycode;
+}
+
+uint8_t get_last_mods(void) {
+    return last_mods;
+}
+
+void set_last_keycode(uint16_t keycode) {
+    last_keycode = keycode;
+}
+
+void set_last_mods(uint8_t mods) {
+    last_mods = mods;
+}
+
+__attribute__((weak)) bool remember_last_key_user(uint16_t keycode, keyrecord_t *record, uint8_t *remembered_mods) {
+    return true;
+}
+
+__attribute__((weak)) uint16_t get_alt_repeat_key_keycode_user(uint16_t keycode, uint8_t mods) {
+    return KC_TRNS;
+}
+
+// Built-in Alternate Repeat pairs; each entry reverses in both directions.
+static const uint8_t alt_repeat_pairs[][2] PROGMEM = {
+    {KC_LEFT, KC_RIGHT},
+    {KC_UP, KC_DOWN},
+    {KC_HOME, KC_END},
+    {KC_PAGE_UP, KC_PAGE_DOWN},
+    {KC_BACKSPACE, KC_DELETE},
+    {KC_LEFT_BRACKET, KC_RIGHT_BRACKET},
+};
+
+uint16_t get_alt_repeat_key_keycode(void) {
+    const uint16_t alt = get_alt_repeat_key_keycode_user(last_keycode, last_mods);
+    if (alt != KC_TRNS) {
+        return alt;
+    }
+    if (IS_QK_BASIC(last_keycode)) {
+        for (uint8_t i = 0; i < ARRAY_SIZE(alt_repeat_pairs); i++) {
+            if (pgm_read_byte(&alt_repeat_pairs[i][0]) == last_keycode) {
+                return pgm_read_byte(&alt_repeat_pairs[i][1]);
+            }
+            if (pgm_read_byte(&alt_repeat_pairs[i][1]) == last_keycode) {
+                return pgm_read_byte(&alt_repeat_pairs[i][0]);
+            }
+        }
+    }
+    return KC_NO;
+}
+
+// Run `keycode` through process_record() at the invoking key's position.
+// The record carries the keycode directly, the same way combos inject
+// events, so the whole processing chain sees an ordinary key.
+static void repeat_key_replay(uint16_t keycode, const keyevent_t *event) {
+    static keyrecord_t record;
+    replaying = true;
+    record = (keyrecord_t){
+        .event   = *event,
+        .keycode = keycode,
+#ifndef NO_ACTION_TAPPING
+        // Replays resolve tap-hold keycodes to their tap action.
+        .tap.count = 1,
+#endif
+    };
+    if (event->pressed) {
+        register_weak_mods(last_mods);
+    }
+    process_record(&record);
+    if (!event->pressed) {
+        unregister_weak_mods(last_mods);
+    }
+    replaying = false;
+}
+
+void repeat_key_invoke(const keyevent_t *event) {
+    if (replaying || last_keycode == KC_NO) {
+        return;
+    }
+    repeat_key_replay(last_keycode, event);
+}
+
+void alt_repeat_key_invoke(const keyevent_t *event) {
+    // The alternate is resolved on press and kept until release, in case the
+    // remembered key changes in between.
+    static uint16_t registered_keycode = KC_NO;
+    if (replaying) {
+        return;
+    }
+    if (event->pressed) {
+        registered_keycode = get_alt_repeat_key_keycode();
+    }
+    if (registered_keycode == KC_NO) {
+        return;
+    }
+    repeat_key_replay(registered_keycode, event);
+    if (!event->pressed) {
+        registered_keycode = KC_NO;
+    }
+}
+
+// Whether this key becomes the remembered key. Layer switches and one-shots
+// pass through untouched, held tap-holds act as modifiers or layers, and
+// plain modifier keys are skipped with one classifier lookup; everything
+// they modify is captured through the mods instead.
+static bool repeat_key_should_remember(uint16_t keycode, keyrecord_t *record) {
+    switch (keycode) {
+#ifndef NO_ACTION_LAYER
+        case QK_TO ... QK_TO_MAX:
+        case QK_MOMENTARY ... QK_MOMENTARY_MAX:
+        case QK_DEF_LAYER ... QK_DEF_LAYER_MAX:
+        case QK_TOGGLE_LAYER ... QK_TOGGLE_LAYER_MAX:
+        case QK_LAYER_TAP_TOGGLE ... QK_LAYER_TAP_TOGGLE_MAX:
+        case QK_LAYER_MOD ... QK_LAYER_MOD_MAX:
+#endif
+#ifndef NO_ACTION_ONESHOT
+        case QK_ONE_SHOT_LAYER ... QK_ONE_SHOT_LAYER_MAX:
+        case QK_ONE_SHOT_MOD ... QK_ONE_SHOT_MOD_MAX:
+#endif
+            return false;
+#ifndef NO_ACTION_TAPPING
+        case QK_MOD_TAP ... QK_MOD_TAP_MAX:
+#    ifndef NO_ACTION_LAYER
+        case QK_LAYER_TAP ... QK_LAYER_TAP_MAX:
+#    endif
+            if (record->tap.count == 0) {
+                return false;
+            }
+            break;
+#endif
+    }
+    return !(keycode_class(keycode) & KC_CLASS_MODIFIER);
+}
+
+bool process_repeat_key(uint16_t keycode, keyrecord_t *record) {
+    switch (keycode) {
+        case QK_REPEAT_KEY:
+            repeat_key_invoke(&record->event);
+            return false;
+        case QK_ALT_REPEAT_KEY:
+            alt_repeat_key_invoke(&record->event);
+            return false;
+    }
+
+    if (record->event.pressed && !replaying && repeat_key_should_remember(keycode, record)) {
+        uint8_t remembered_mods = get_mods() | get_weak_mods();
+#ifndef NO_ACTION_ONESHOT
+        remembered_mods |= get_oneshot_mods();
+#endif
+        if (remember_last_key_user(keycode, record, &remembered_mods)) {
+            last_keycode = keycode;
+            last_mods    = remembered_mods;
+        }
+    }
+    return true;
+}
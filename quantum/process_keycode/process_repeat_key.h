@@ -0,0 +1,36 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "action.h"
+
+bool process_repeat_key(uint16_t keycode, keyrecord_t *record);
+
+// Keycode and modifiers the Repeat Key will replay; KC_NO if nothing has
+// been remembered yet.
+uint16_t get_last_keycode(void);
+uint8_t  get_last_mods(void);
+
+// Override what the Repeat Key will replay, e.g. from a macro.
+void set_last_keycode(uint16_t keycode);
+void set_last_mods(uint8_t mods);
+
+// Keycode the Alternate Repeat Key would produce for the remembered key, or
+// KC_NO if there is none.
+uint16_t get_alt_repeat_key_keycode(void);
+
+// Generate a press or release of the remembered key (or its alternate).
+// Called for both edges of QK_REP / QK_AREP, and usable from macros.
+void repeat_key_invoke(const keyevent_t *event);
+void alt_repeat_key_invoke(const keyevent_t *event);
+
+// Callback deciding whether a key is remembered; return false to skip it.
+// `remembered_mods` can be modified to change the mods that will be replayed.
+bool remember_last_key_user(uint16_t keycode, keyrecord_t *record, uint8_t *remembered_mods);
+
+// Callback defining the Alternate Repeat Key for a given remembered key.
+// Return KC_TRNS to fall back on the built-in pairs, KC_NO for "none".
+uint16_t get_alt_repeat_key_keycode_user(uint16_t keycode, uint8_t mods);
@@ -47,15 +47,64 @@ static inline void steno_clear_chord(void) {
     memset(chord, 0, sizeof(chord));
 }
 
+#ifdef STENO_PACKET_BUFFER_ENABLE
+#    ifndef VIRTSER_ENABLE
+#        error "STENO_PACKET_BUFFER_ENABLE requires VIRTSER_ENABLE"
+#    endif
+#    ifndef STENO_PACKET_BUFFER_SIZE
+#        define STENO_PACKET_BUFFER_SIZE 8
+#    endif
+// One finished protocol packet waiting to be handed to the host.
+// TX Bolt packets carry a trailing null byte, hence the extra byte
+// on top of the longest possible stroke.
+typedef struct steno_packet_t {
+    uint8_t length;
+    uint8_t data[MAX_STROKE_SIZE + 1];
+} steno_packet_t;
+
+static steno_packet_t packet_buffer[STENO_PACKET_BUFFER_SIZE] = {{0}};
+static uint8_t        packet_buffer_head                      = 0;
+static uint8_t        packet_buffer_tail                      = 0;
+#endif // STENO_PACKET_BUFFER_ENABLE
+
+#ifdef VIRTSER_ENABLE
+static void steno_send_packet(const uint8_t *data, uint8_t length) {
+#    ifdef STENO_PACKET_BUFFER_ENABLE
+    const uint8_t next = (uint8_t)((packet_buffer_tail + 1) % STENO_PACKET_BUFFER_SIZE);
+    if (next == packet_buffer_head) {
+        // The host has been stalled for a whole buffer's worth of strokes;
+        // dropping the newest stroke is the least damaging option left.
+        return;
+    }
+    memcpy(packet_buffer[packet_buffer_tail].data, data, length);
+    packet_buffer[packet_buffer_tail].length = length;
+    packet_buffer_tail                       = next;
+#    else
+    virtser_send_buffer(data, length);
+#    endif
+}
+#endif // VIRTSER_ENABLE
+
+#ifdef STENO_PACKET_BUFFER_ENABLE
+void steno_task(void) {
+    // Drain at most one packet per invocation so that a stalled host
+    // transfer never blocks the scan loop for more than a single packet.
+    if (packet_buffer_head != packet_buffer_tail) {
+        virtser_send_buffer(packet_buffer[packet_buffer_head].data, packet_buffer[packet_buffer_head].length);
+        packet_buffer_head = (uint8_t)((packet_buffer_head + 1) % STENO_PACKET_BUFFER_SIZE);
+    }
+}
+#endif // STENO_PACKET_BUFFER_ENABLE
+
 #ifdef STENO_ENABLE_GEMINI
 
 #    ifdef VIRTSER_ENABLE
 void send_steno_chord_gemini(void) {
     // Set MSB to 1 to indicate the start of packet
     chord[0] |= 0x80;
-    for (uint8_t i = 0; i < GEMINI_STROKE_SIZE; ++i) {
-        virtser_send(chord[i]);
-    }
+    // `chord` already is the complete fixed-size packet, so it can be
+    // handed to the host as a single transfer.
+    steno_send_packet(chord, GEMINI_STROKE_SIZE);
 }
 #    else
 #        pragma message "VIRTSER_ENABLE = yes is required for Gemini PR to work properly out of the box!"
@@ -93,18 +142,21 @@ static const uint8_t boltmap[64] PROGMEM = {TXB_NUL, TXB_NUM, TXB_NUM, TXB_NUM,
 
 #    ifdef VIRTSER_ENABLE
 static void send_steno_chord_bolt(void) {
+    uint8_t packet[BOLT_STROKE_SIZE + 1];
+    uint8_t length = 0;
     for (uint8_t i = 0; i < BOLT_STROKE_SIZE; ++i) {
         // TX Bolt uses variable length packets where each byte corresponds to a bit array of certain keys.
         // If a user chorded the keys of the first group with keys of the last group, for example, there
         // would be bytes of 0x00 in `chord` for the middle groups which we mustn't send.
         if (chord[i]) {
-            virtser_send(chord[i]);
+            packet[length++] = chord[i];
         }
     }
     // Sending a null packet is not always necessary, but it is simpler and more reliable
     // to unconditionally send it every time instead of keeping track of more states and
     // creating more branches in the execution of the program.
-    virtser_send(0);
+    packet[length++] = 0;
+    steno_send_packet(packet, length);
 }
 #    else
 #        pragma message "VIRTSER_ENABLE = yes is required for TX Bolt to work properly out of the box!"
@@ -33,6 +33,9 @@ typedef enum {
 } steno_mode_t;
 
 bool process_steno(uint16_t keycode, keyrecord_t *record);
+#ifdef STENO_PACKET_BUFFER_ENABLE
+void steno_task(void);
+#endif // STENO_PACKET_BUFFER_ENABLE
 #ifdef STENO_ENABLE_ALL
 void steno_init(void);
 void steno_set_mode(steno_mode_t mode);
@@ -17,6 +17,34 @@
 
 static uint16_t active_td;
 static uint16_t last_tap_time;
+// Tapping term of the active dance, captured at press time so the periodic
+// task compares against a cached value instead of re-resolving the per-key
+// term on every tick. Also lets per-key tapping term functions see the real
+// keyrecord rather than an empty one.
+static uint16_t active_td_term;
+
+#ifdef SEQUENCE_DEFERRED_TIMEOUT
+#    ifndef DEFERRED_EXEC_ENABLE
+#        error "SEQUENCE_DEFERRED_TIMEOUT requires DEFERRED_EXEC_ENABLE"
+#    endif
+
+// The tapping term deadline is armed on each tap instead of being polled by
+// tap_dance_task() every scan loop iteration.
+static deferred_token td_timeout_token = INVALID_DEFERRED_TOKEN;
+
+static uint32_t tap_dance_timeout_callback(uint32_t trigger_time, void *cb_arg);
+
+static void tap_dance_timeout_arm(void) {
+    if (!extend_deferred_exec(td_timeout_token, active_td_term + 1)) {
+        td_timeout_token = defer_exec(active_td_term + 1, tap_dance_timeout_callback, NULL);
+    }
+}
+
+static void tap_dance_timeout_disarm(void) {
+    cancel_deferred_exec(td_timeout_token);
+    td_timeout_token = INVALID_DEFERRED_TOKEN;
+}
+#endif
 
 void tap_dance_pair_on_each_tap(tap_dance_state_t *state, void *user_data) {
     tap_dance_pair_t *pair = (tap_dance_pair_t *)user_data;
@@ -109,6 +137,9 @@ static inline void process_tap_dance_action_on_dance_finished(tap_dance_action_t
         _process_tap_dance_action_fn(&action->state, action->user_data, action->fn.on_dance_finished);
     }
     active_td = 0;
+#ifdef SEQUENCE_DEFERRED_TIMEOUT
+    tap_dance_timeout_disarm();
+#endif
     if (!action->state.pressed) {
         // There will not be a key release event, so reset now.
         process_tap_dance_action_on_reset(action);
@@ -150,6 +181,14 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
                 last_tap_time = timer_read();
                 process_tap_dance_action_on_each_tap(action);
                 active_td = action->state.finished ? 0 : keycode;
+                if (active_td) {
+                    active_td_term = GET_TAPPING_TERM(keycode, record);
+#ifdef SEQUENCE_DEFERRED_TIMEOUT
+                    tap_dance_timeout_arm();
+                } else {
+                    tap_dance_timeout_disarm();
+#endif
+                }
             } else {
                 if (action->state.finished) {
                     process_tap_dance_action_on_reset(action);
@@ -162,18 +201,36 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
     return true;
 }
 
+#ifdef SEQUENCE_DEFERRED_TIMEOUT
+static uint32_t tap_dance_timeout_callback(uint32_t trigger_time, void *cb_arg) {
+    td_timeout_token = INVALID_DEFERRED_TOKEN;
+    if (active_td) {
+        tap_dance_action_t *action = &tap_dance_actions[TD_INDEX(active_td)];
+        if (!action->state.interrupted) {
+            process_tap_dance_action_on_dance_finished(action);
+        }
+    }
+    return 0;
+}
+
+void tap_dance_task(void) {}
+#else
 void tap_dance_task(void) {
     tap_dance_action_t *action;
 
-    if (!active_td || timer_elapsed(last_tap_time) <= GET_TAPPING_TERM(active_td, &(keyrecord_t){})) return;
+    if (!active_td || timer_elapsed(last_tap_time) <= active_td_term) return;
 
     action = &tap_dance_actions[TD_INDEX(active_td)];
     if (!action->state.interrupted) {
         process_tap_dance_action_on_dance_finished(action);
     }
 }
+#endif
 
 void reset_tap_dance(tap_dance_state_t *state) {
     active_td = 0;
+#ifdef SEQUENCE_DEFERRED_TIMEOUT
+    tap_dance_timeout_disarm();
+#endif
     process_tap_dance_action_on_reset((tap_dance_action_t *)state);
 }
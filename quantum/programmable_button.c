@@ -17,10 +17,22 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "programmable_button.h"
 #include "host.h"
+#include "timer.h"
+
+// Minimum spacing between reports. Button bits OR-accumulate while a send
+// is throttled, so a press-and-release inside one interval is still
+// reported pressed once, with the release following in the next report.
+#ifndef PROGRAMMABLE_BUTTON_TASK_THROTTLE_MS
+#    define PROGRAMMABLE_BUTTON_TASK_THROTTLE_MS 1
+#endif
 
 #define REPORT_BIT(index) (((uint32_t)1) << (index - 1))
 
 static uint32_t programmable_button_report = 0;
+static uint32_t accumulated_report         = 0;
+static uint32_t last_sent_report           = 0;
+static bool     report_pending             = false;
+static uint32_t last_send_time             = 0;
 
 void programmable_button_clear(void) {
     programmable_button_report = 0;
@@ -50,7 +62,26 @@ bool programmable_button_is_on(uint8_t index) {
 }
 
 void programmable_button_flush(void) {
-    host_programmable_button_send(programmable_button_report);
+    accumulated_report |= programmable_button_report;
+    report_pending = true;
+    programmable_button_task();
+}
+
+void programmable_button_task(void) {
+    if (!report_pending || timer_elapsed32(last_send_time) < PROGRAMMABLE_BUTTON_TASK_THROTTLE_MS) {
+        return;
+    }
+
+    uint32_t report = programmable_button_report | accumulated_report;
+    if (report != last_sent_report) {
+        host_programmable_button_send(report);
+        last_sent_report = report;
+        last_send_time   = timer_read32();
+    }
+    // Drop bits released inside the interval; if any were ORed in, keep the
+    // send pending so the release goes out in the next report.
+    accumulated_report = programmable_button_report;
+    report_pending     = report != programmable_button_report;
 }
 
 uint32_t programmable_button_get_report(void) {
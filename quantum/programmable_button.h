@@ -73,6 +73,7 @@ bool programmable_button_is_on(uint8_t index);
  * \brief Send the programmable button report to the host.
  */
 void programmable_button_flush(void);
+void programmable_button_task(void);
 
 /**
  * \brief Get the programmable button report.
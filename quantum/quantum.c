@@ -36,6 +36,18 @@
 #    include "haptic.h"
 #endif
 
+#ifdef POWER_TELEMETRY_ENABLE
+#    include "power_telemetry.h"
+#endif
+
+#ifdef TELEMETRY_COUNTERS_ENABLE
+#    include "telemetry_counters.h"
+#endif
+
+#ifdef EEPROM_DRIVER
+#    include "eeprom_driver.h"
+#endif
+
 #ifdef AUDIO_ENABLE
 #    ifndef GOODBYE_SONG
 #        define GOODBYE_SONG SONG(GOODBYE_SOUND)
@@ -154,6 +166,14 @@ void shutdown_quantum(void) {
 #ifdef HAPTIC_ENABLE
     haptic_shutdown();
 #endif
+#ifdef TELEMETRY_COUNTERS_ENABLE
+    // Final checkpoint so the session's counters survive the reboot
+    telemetry_counters_checkpoint();
+#endif
+#if defined(EEPROM_DRIVER) && defined(EEPROM_WRITE_CACHE)
+    // Make sure coalesced writes have hit the EEPROM before the MCU goes away
+    eeprom_driver_flush();
+#endif
 }
 
 void reset_keyboard(void) {
@@ -168,7 +188,7 @@ void soft_reset_keyboard(void) {
 
 /* Convert record into usable keycode via the contained event. */
 uint16_t get_record_keycode(keyrecord_t *record, bool update_layer_cache) {
-#ifdef COMBO_ENABLE
+#if defined(COMBO_ENABLE) || defined(REPEAT_KEY_ENABLE)
     if (record->keycode) {
         return record->keycode;
     }
@@ -202,6 +222,13 @@ uint16_t get_event_keycode(keyevent_t event, bool update_layer_cache) {
 
 /* Get keycode, and then process pre tapping functionality */
 bool pre_process_record_quantum(keyrecord_t *record) {
+#ifdef GAME_MODE_ENABLE
+    // Game mode: combos never see new events; anything already buffered
+    // still dumps through combo_task() when its term expires.
+    if (game_mode_is_active()) {
+        return true;
+    }
+#endif
     if (!(
 #ifdef COMBO_ENABLE
             process_combo(get_record_keycode(record, true), record) &&
@@ -218,6 +245,22 @@ void post_process_record_quantum(keyrecord_t *record) {
     post_process_record_kb(keycode, record);
 }
 
+/* Most handlers in the process_record chain act only on their own keycode
+ * range and pass everything else through untouched; gate those inline so a
+ * plain keycode costs one comparison instead of a function call. Handlers
+ * that must observe every event (combos, leader, caps word, dynamic macro,
+ * ...) remain unconditional, and relative order is unchanged throughout. */
+#define PROCESS_IF_RANGE(fn, first, last) ((keycode) < (first) || (keycode) > (last) || fn(keycode, record))
+#define PROCESS_IF_KEYCODE(fn, kc) ((keycode) != (kc) || fn(keycode, record))
+
+/* Game mode lifts whole typing-feature groups out of the chain with a single
+ * flag test prefixed to the group; the handlers inside never see the event. */
+#ifdef GAME_MODE_ENABLE
+#    define SKIP_IF_GAME_MODE game_mode_is_active() ||
+#else
+#    define SKIP_IF_GAME_MODE
+#endif
+
 /* Core keycode function, hands off handling to other functions,
     then processes internal quantum keycodes, and then processes
     ACTIONs.                                                      */
@@ -233,13 +276,19 @@ bool process_record_quantum(keyrecord_t *record) {
     // }
 
 #if defined(SECURE_ENABLE)
-    if (!preprocess_secure(keycode, record)) {
+    // secure_is_unlocking() is a single load, so the locked/unlocked fast
+    // path never pays for the preprocess call.
+    if (secure_is_unlocking() && !preprocess_secure(keycode, record)) {
         return false;
     }
 #endif
 
 #ifdef TAP_DANCE_ENABLE
+#    ifdef GAME_MODE_ENABLE
+    if (!game_mode_is_active() && preprocess_tap_dance(keycode, record)) {
+#    else
     if (preprocess_tap_dance(keycode, record)) {
+#    endif
         // The tap dance might have updated the layer state, therefore the
         // result of the keycode lookup might change.
         keycode = get_record_keycode(record, true);
@@ -281,70 +330,78 @@ bool process_record_quantum(keyrecord_t *record) {
 #endif
             process_record_kb(keycode, record) &&
 #if defined(SECURE_ENABLE)
-            process_secure(keycode, record) &&
+            PROCESS_IF_RANGE(process_secure, QK_SECURE_LOCK, QK_SECURE_REQUEST) &&
 #endif
 #if defined(SEQUENCER_ENABLE)
-            process_sequencer(keycode, record) &&
+            PROCESS_IF_RANGE(process_sequencer, QK_SEQUENCER, QK_SEQUENCER_MAX) &&
 #endif
 #if defined(MIDI_ENABLE) && defined(MIDI_ADVANCED)
-            process_midi(keycode, record) &&
+            PROCESS_IF_RANGE(process_midi, QK_MIDI, QK_MIDI_MAX) &&
 #endif
 #ifdef AUDIO_ENABLE
-            process_audio(keycode, record) &&
+            PROCESS_IF_RANGE(process_audio, QK_AUDIO, QK_AUDIO_MAX) &&
 #endif
 #if defined(BACKLIGHT_ENABLE) || defined(LED_MATRIX_ENABLE)
-            process_backlight(keycode, record) &&
+            PROCESS_IF_RANGE(process_backlight, QK_LIGHTING, QK_LIGHTING_MAX) &&
 #endif
 #ifdef STENO_ENABLE
-            process_steno(keycode, record) &&
+            PROCESS_IF_RANGE(process_steno, QK_STENO, QK_STENO_MAX) &&
 #endif
 #if (defined(AUDIO_ENABLE) || (defined(MIDI_ENABLE) && defined(MIDI_BASIC))) && !defined(NO_MUSIC_MODE)
             process_music(keycode, record) &&
 #endif
+            // Typing-feature group, lifted whole by game mode
+            (SKIP_IF_GAME_MODE (true
 #ifdef KEY_OVERRIDE_ENABLE
-            process_key_override(keycode, record) &&
+                                && process_key_override(keycode, record)
 #endif
 #ifdef TAP_DANCE_ENABLE
-            process_tap_dance(keycode, record) &&
+                                && process_tap_dance(keycode, record)
 #endif
 #ifdef CAPS_WORD_ENABLE
-            process_caps_word(keycode, record) &&
+                                && process_caps_word(keycode, record)
 #endif
 #if defined(UNICODE_COMMON_ENABLE)
-            process_unicode_common(keycode, record) &&
+                                && process_unicode_common(keycode, record)
 #endif
 #ifdef LEADER_ENABLE
-            process_leader(keycode, record) &&
+                                && process_leader(keycode, record)
 #endif
 #ifdef AUTO_SHIFT_ENABLE
-            process_auto_shift(keycode, record) &&
+                                && process_auto_shift(keycode, record)
 #endif
+                                )) &&
 #ifdef DYNAMIC_TAPPING_TERM_ENABLE
-            process_dynamic_tapping_term(keycode, record) &&
+            PROCESS_IF_RANGE(process_dynamic_tapping_term, QK_DYNAMIC_TAPPING_TERM_PRINT, QK_DYNAMIC_TAPPING_TERM_DOWN) &&
 #endif
 #ifdef SPACE_CADET_ENABLE
-            process_space_cadet(keycode, record) &&
+            // Observer: resets its "last pressed" state on every other key.
+            (SKIP_IF_GAME_MODE process_space_cadet(keycode, record)) &&
 #endif
 #ifdef MAGIC_KEYCODE_ENABLE
-            process_magic(keycode, record) &&
+            PROCESS_IF_RANGE(process_magic, QK_MAGIC, QK_MAGIC_MAX) &&
 #endif
 #ifdef GRAVE_ESC_ENABLE
-            process_grave_esc(keycode, record) &&
+            PROCESS_IF_KEYCODE(process_grave_esc, QK_GRAVE_ESCAPE) &&
 #endif
 #if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
-            process_rgb(keycode, record) &&
+            PROCESS_IF_RANGE(process_rgb, QK_LIGHTING, QK_LIGHTING_MAX) &&
 #endif
 #ifdef JOYSTICK_ENABLE
-            process_joystick(keycode, record) &&
+            PROCESS_IF_RANGE(process_joystick, QK_JOYSTICK, QK_JOYSTICK_MAX) &&
 #endif
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
-            process_programmable_button(keycode, record) &&
+            PROCESS_IF_RANGE(process_programmable_button, QK_PROGRAMMABLE_BUTTON, QK_PROGRAMMABLE_BUTTON_MAX) &&
 #endif
 #ifdef AUTOCORRECT_ENABLE
-            process_autocorrect(keycode, record) &&
+            (SKIP_IF_GAME_MODE process_autocorrect(keycode, record)) &&
 #endif
 #ifdef TRI_LAYER_ENABLE
-            process_tri_layer(keycode, record) &&
+            PROCESS_IF_RANGE(process_tri_layer, QK_TRI_LAYER_LOWER, QK_TRI_LAYER_UPPER) &&
+#endif
+#ifdef REPEAT_KEY_ENABLE
+            // Observer: records the last key so QK_REP/QK_AREP can replay it.
+            process_repeat_key(keycode, record) &&
 #endif
             true)) {
         return false;
@@ -383,6 +440,17 @@ bool process_record_quantum(keyrecord_t *record) {
                 velocikey_toggle();
                 return false;
 #endif
+#ifdef GAME_MODE_ENABLE
+            case QK_GAME_MODE_ON:
+                game_mode_on();
+                return false;
+            case QK_GAME_MODE_OFF:
+                game_mode_off();
+                return false;
+            case QK_GAME_MODE_TOGGLE:
+                game_mode_toggle();
+                return false;
+#endif
 #ifdef BLUETOOTH_ENABLE
             case QK_OUTPUT_AUTO:
                 set_output(OUTPUT_AUTO);
@@ -455,6 +523,10 @@ __attribute__((weak)) void startup_user(void) {}
 __attribute__((weak)) void shutdown_user(void) {}
 
 void suspend_power_down_quantum(void) {
+#ifdef POWER_TELEMETRY_ENABLE
+    // Record the voltage/load at the moment the suspend floor begins.
+    power_telemetry_suspend_power_down();
+#endif
     suspend_power_down_kb();
 #ifndef NO_SUSPEND_POWER_DOWN
 // Turn off backlight
@@ -502,7 +574,27 @@ void suspend_power_down_quantum(void) {
 #endif
 }
 
+static bool suspend_wakeup_restore_pending = false;
+
 __attribute__((weak)) void suspend_wakeup_init_quantum(void) {
+    // The host may have lost the pre-suspend report state, so the next
+    // report of each type must go out even if its bytes are unchanged.
+    report_cache_clear();
+#ifdef POWER_TELEMETRY_ENABLE
+    power_telemetry_suspend_wakeup_init();
+#endif
+    // Defer the driver restore to the main loop: this function may run from
+    // interrupt context on some protocols, and everything below is cosmetic,
+    // so the first post-wake keystrokes shouldn't wait behind it.
+    suspend_wakeup_restore_pending = true;
+}
+
+void suspend_wakeup_task(void) {
+    if (!suspend_wakeup_restore_pending) {
+        return;
+    }
+    suspend_wakeup_restore_pending = false;
+
 // Turn on backlight
 #ifdef BACKLIGHT_ENABLE
     backlight_init();
@@ -246,6 +246,14 @@ extern layer_state_t layer_state;
 #    include "process_tri_layer.h"
 #endif
 
+#ifdef REPEAT_KEY_ENABLE
+#    include "process_repeat_key.h"
+#endif
+
+#ifdef GAME_MODE_ENABLE
+#    include "game_mode.h"
+#endif
+
 void set_single_persistent_default_layer(uint8_t default_layer);
 
 #define IS_LAYER_ON(layer) layer_state_is(layer)
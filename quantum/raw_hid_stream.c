@@ -0,0 +1,309 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "raw_hid_stream.h"
+#include "raw_hid.h"
+#include "report.h"
+
+#ifdef DYNAMIC_KEYMAP_ENABLE
+#    include "dynamic_keymap.h"
+#endif
+#ifdef EEPROM_TRANSIENT_SNAPSHOT
+#    include "eeprom_transient.h"
+#endif
+#ifdef LATENCY_HISTOGRAM_ENABLE
+#    include "latency_histogram.h"
+#endif
+#ifdef EVENT_TRACE_ENABLE
+#    include "event_trace.h"
+#endif
+#ifdef TELEMETRY_COUNTERS_ENABLE
+#    include "telemetry_counters.h"
+#endif
+#ifdef POWER_TELEMETRY_ENABLE
+#    include "power_telemetry.h"
+#endif
+#ifdef TASK_ACCOUNTING_ENABLE
+#    include "task_accounting.h"
+#endif
+#ifdef SPLIT_TRANSACTION_STATS_ENABLE
+#    include "transaction_stats.h"
+#endif
+#ifdef TUNABLES_ENABLE
+#    include "tunables.h"
+#endif
+
+// Only one transfer is in flight at a time; raw HID is a single endpoint
+// pair, so there is nothing to interleave with.
+static struct {
+    raw_hid_stream_channel_t channel;
+    bool                     active;
+    bool                     writing;
+    uint16_t                 offset;        // next byte to transfer
+    uint16_t                 end;           // one past the last byte
+    uint8_t                  payload;       // bytes per data packet (report size - 4)
+    uint8_t                  next_seq;      // next sequence number to send/accept
+    uint8_t                  window_seq;    // sequence number at the window start
+    uint16_t                 window_offset; // offset at the window start
+    uint8_t                  window_left;   // write packets left before an ack is due
+} stream;
+
+#ifdef LATENCY_HISTOGRAM_ENABLE
+// Presents the histograms as one flat buffer: stage-major, four bytes per
+// bucket, little-endian, matching the chunked query in latency_histogram.c.
+static void latency_histogram_read_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    for (uint16_t i = 0; i < size; i++) {
+        uint16_t        pos     = offset + i;
+        const uint32_t *buckets = latency_histogram_get(pos / (LATENCY_HISTOGRAM_BUCKETS * 4));
+        if (buckets == NULL) {
+            data[i] = 0x00;
+            continue;
+        }
+        uint16_t within = pos % (LATENCY_HISTOGRAM_BUCKETS * 4);
+        data[i]         = (buckets[within / 4] >> (8 * (within % 4))) & 0xFF;
+    }
+}
+#endif
+
+__attribute__((weak)) bool raw_hid_stream_channel_kb(uint8_t channel_id, raw_hid_stream_channel_t *channel) {
+    return false;
+}
+
+static bool stream_channel_lookup(uint8_t channel_id, raw_hid_stream_channel_t *channel) {
+    switch (channel_id) {
+#ifdef DYNAMIC_KEYMAP_ENABLE
+        case id_raw_hid_stream_channel_dynamic_keymap:
+            channel->read  = dynamic_keymap_get_buffer;
+            channel->write = dynamic_keymap_set_buffer;
+            return true;
+        case id_raw_hid_stream_channel_dynamic_keymap_macro:
+            channel->read  = dynamic_keymap_macro_get_buffer;
+            channel->write = dynamic_keymap_macro_set_buffer;
+            return true;
+#endif
+#ifdef LATENCY_HISTOGRAM_ENABLE
+        case id_raw_hid_stream_channel_latency_histogram:
+            channel->read  = latency_histogram_read_buffer;
+            channel->write = NULL;
+            return true;
+#endif
+#ifdef TASK_ACCOUNTING_ENABLE
+        case id_raw_hid_stream_channel_task_accounting:
+            channel->read  = task_accounting_read_buffer;
+            channel->write = NULL;
+            return true;
+#endif
+        case id_raw_hid_stream_channel_report_cache:
+            channel->read  = report_cache_read_buffer;
+            channel->write = NULL;
+            return true;
+#ifdef SPLIT_TRANSACTION_STATS_ENABLE
+        case id_raw_hid_stream_channel_split_txn_stats:
+            channel->read  = split_transaction_stats_read_buffer;
+            channel->write = NULL;
+            return true;
+#endif
+#ifdef TUNABLES_ENABLE
+        case id_raw_hid_stream_channel_tunables:
+            channel->read  = tunables_read_buffer;
+            channel->write = tunables_write_buffer;
+            return true;
+#endif
+#ifdef POWER_TELEMETRY_ENABLE
+        case id_raw_hid_stream_channel_power_telemetry:
+            channel->read  = power_telemetry_read_buffer;
+            channel->write = NULL;
+            return true;
+#endif
+#ifdef EEPROM_TRANSIENT_SNAPSHOT
+        case id_raw_hid_stream_channel_transient_eeprom:
+            channel->read  = eeprom_transient_read_buffer;
+            channel->write = eeprom_transient_write_buffer;
+            return true;
+#endif
+    }
+    return raw_hid_stream_channel_kb(channel_id, channel);
+}
+
+// Acks reuse the request buffer: [ command, ack, status, next_seq, remaining ]
+static void stream_send_ack(uint8_t *data, uint8_t length, uint8_t status) {
+    uint16_t remaining = stream.active ? stream.end - stream.offset : 0;
+
+    data[1] = id_raw_hid_stream_ack;
+    data[2] = status;
+    data[3] = stream.next_seq;
+    data[4] = remaining >> 8;
+    data[5] = remaining & 0xFF;
+    memset(&data[6], 0, length - 6);
+    raw_hid_send(data, length);
+}
+
+// Streams up to RAW_HID_STREAM_WINDOW data packets, then leaves the
+// transfer waiting for the host's ack. The window start is remembered so
+// a mismatched ack can rewind to any packet boundary within it.
+static void stream_send_read_window(uint8_t *data, uint8_t length) {
+    stream.window_seq    = stream.next_seq;
+    stream.window_offset = stream.offset;
+
+    for (uint8_t i = 0; i < RAW_HID_STREAM_WINDOW && stream.offset < stream.end; i++) {
+        uint16_t chunk = stream.end - stream.offset;
+        if (chunk > stream.payload) {
+            chunk = stream.payload;
+        }
+        data[1] = id_raw_hid_stream_data;
+        data[2] = stream.next_seq;
+        data[3] = (uint8_t)chunk;
+        memset(&data[4], 0, length - 4);
+        stream.channel.read(stream.offset, chunk, &data[4]);
+        raw_hid_send(data, length);
+        stream.offset += chunk;
+        stream.next_seq++;
+    }
+}
+
+// [ command, open_read/open_write, channel, offset, length ]
+static void stream_handle_open(uint8_t *data, uint8_t length) {
+    uint8_t  channel_id      = data[2];
+    uint16_t transfer_offset = (data[3] << 8) | data[4];
+    uint16_t transfer_length = (data[5] << 8) | data[6];
+    bool     writing         = data[1] == id_raw_hid_stream_open_write;
+
+    stream.active = false;
+    if (transfer_length == 0 || (uint32_t)transfer_offset + transfer_length > UINT16_MAX || !stream_channel_lookup(channel_id, &stream.channel) || (writing && stream.channel.write == NULL)) {
+        stream_send_ack(data, length, id_raw_hid_stream_err);
+        return;
+    }
+
+    stream.active        = true;
+    stream.writing       = writing;
+    stream.offset        = transfer_offset;
+    stream.end           = transfer_offset + transfer_length;
+    stream.payload       = length - 4;
+    stream.next_seq      = 0;
+    stream.window_seq    = 0;
+    stream.window_offset = transfer_offset;
+    stream.window_left   = RAW_HID_STREAM_WINDOW;
+
+    stream_send_ack(data, length, id_raw_hid_stream_ok);
+    if (!writing) {
+        stream_send_read_window(data, length);
+    }
+}
+
+// Host ack during a read: [ command, ack, seq ], where seq is the next
+// sequence number the host expects. Matching our own next sequence means
+// the window arrived intact; anything else rewinds and retransmits.
+static void stream_handle_ack(uint8_t *data, uint8_t length) {
+    if (!stream.active || stream.writing) {
+        stream_send_ack(data, length, id_raw_hid_stream_err);
+        return;
+    }
+
+    uint8_t seq = data[2];
+    if (seq == stream.next_seq) {
+        if (stream.offset == stream.end) {
+            stream.active = false;
+            stream_send_ack(data, length, id_raw_hid_stream_ok);
+            return;
+        }
+    } else {
+        uint8_t delta = (uint8_t)(seq - stream.window_seq);
+        if (delta > (uint8_t)(stream.next_seq - stream.window_seq)) {
+            stream_send_ack(data, length, id_raw_hid_stream_err);
+            return;
+        }
+        // All packets before the rewind point carried a full payload, so
+        // the offset at any boundary inside the window is exact.
+        stream.offset   = stream.window_offset + (uint16_t)delta * stream.payload;
+        stream.next_seq = seq;
+    }
+    stream_send_read_window(data, length);
+}
+
+// Host data packet during a write: [ command, data, seq, size, payload ]
+static void stream_handle_data(uint8_t *data, uint8_t length) {
+    if (!stream.active || !stream.writing) {
+        stream_send_ack(data, length, id_raw_hid_stream_err);
+        return;
+    }
+
+    uint8_t seq = data[2];
+    if (seq != stream.next_seq) {
+        // Dropped or reordered packet: the ack's sequence number tells the
+        // host where to resume; everything past it is discarded.
+        stream.window_left = RAW_HID_STREAM_WINDOW;
+        stream_send_ack(data, length, id_raw_hid_stream_ok);
+        return;
+    }
+
+    uint16_t chunk = data[3];
+    if (chunk == 0 || chunk > stream.payload || chunk > stream.end - stream.offset) {
+        stream.active = false;
+        stream_send_ack(data, length, id_raw_hid_stream_err);
+        return;
+    }
+
+    stream.channel.write(stream.offset, chunk, &data[4]);
+    stream.offset += chunk;
+    stream.next_seq++;
+
+    if (stream.offset == stream.end) {
+        stream.active = false;
+        stream_send_ack(data, length, id_raw_hid_stream_ok);
+    } else if (--stream.window_left == 0) {
+        stream.window_left = RAW_HID_STREAM_WINDOW;
+        stream_send_ack(data, length, id_raw_hid_stream_ok);
+    }
+}
+
+bool raw_hid_stream_command(uint8_t *data, uint8_t length) {
+    if (length < 8 || data[0] != RAW_HID_STREAM_HID_COMMAND) {
+        return false;
+    }
+
+    switch (data[1]) {
+        case id_raw_hid_stream_open_read:
+        case id_raw_hid_stream_open_write:
+            stream_handle_open(data, length);
+            break;
+        case id_raw_hid_stream_data:
+            stream_handle_data(data, length);
+            break;
+        case id_raw_hid_stream_ack:
+            stream_handle_ack(data, length);
+            break;
+        case id_raw_hid_stream_abort:
+            stream.active = false;
+            stream_send_ack(data, length, id_raw_hid_stream_ok);
+            break;
+        default:
+            stream_send_ack(data, length, id_raw_hid_stream_err);
+            break;
+    }
+    return true;
+}
+
+#if defined(RAW_ENABLE) && !defined(VIA_ENABLE)
+// Keyboards with their own raw HID protocol override this and forward
+// matching packets to raw_hid_stream_command() themselves.
+__attribute__((weak)) void raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (raw_hid_stream_command(data, length)) {
+        return;
+    }
+#    ifdef LATENCY_HISTOGRAM_ENABLE
+    if (latency_histogram_raw_hid_command(data, length)) {
+        return;
+    }
+#    endif
+#    ifdef EVENT_TRACE_ENABLE
+    if (event_trace_raw_hid_command(data, length)) {
+        return;
+    }
+#    endif
+#    ifdef TELEMETRY_COUNTERS_ENABLE
+    telemetry_counters_raw_hid_command(data, length);
+#    endif
+}
+#endif
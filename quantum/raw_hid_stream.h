@@ -0,0 +1,83 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * \file
+ *
+ * \brief Multi-packet bulk transfers over raw HID.
+ *
+ * Raw HID is lock-step: one 32-byte request, one 32-byte response. Reading
+ * a full dynamic keymap that way costs hundreds of round trips, each paying
+ * the interrupt endpoint's polling interval. With `RAW_HID_STREAM_ENABLE =
+ * yes` this module layers sequence-numbered, windowed transfers on top:
+ * the host opens a transfer against a channel, and the device streams (or
+ * accepts) a window of data packets before synchronizing on an ack. A
+ * mismatched sequence number in the ack rewinds the transfer to the last
+ * packet both sides agree on, so a dropped report costs one window, not
+ * the whole transfer.
+ *
+ * All packets start with `RAW_HID_STREAM_HID_COMMAND` followed by a
+ * subcommand byte; multi-byte fields are big-endian, matching the VIA
+ * protocol. Keyboards already dispatching raw HID themselves (e.g. VIA)
+ * forward packets to `raw_hid_stream_command()`; otherwise the weak
+ * `raw_hid_receive()` provided here handles them directly.
+ */
+
+#ifndef RAW_HID_STREAM_HID_COMMAND
+#    define RAW_HID_STREAM_HID_COMMAND 0x7B
+#endif
+
+// Data packets carry a 4-byte header; the rest of the report is payload,
+// so each packet moves `RAW_EPSIZE - 4` bytes (28 on LUFA/ChibiOS/V-USB).
+
+// Packets per window before the transfer waits for an ack.
+#ifndef RAW_HID_STREAM_WINDOW
+#    define RAW_HID_STREAM_WINDOW 8
+#endif
+
+enum raw_hid_stream_subcommand {
+    id_raw_hid_stream_abort      = 0x00,
+    id_raw_hid_stream_open_read  = 0x01,
+    id_raw_hid_stream_open_write = 0x02,
+    id_raw_hid_stream_data       = 0x03,
+    id_raw_hid_stream_ack        = 0x04,
+};
+
+enum raw_hid_stream_status {
+    id_raw_hid_stream_ok  = 0x00,
+    id_raw_hid_stream_err = 0x01,
+};
+
+enum raw_hid_stream_channel_id {
+    id_raw_hid_stream_channel_dynamic_keymap       = 0x01,
+    id_raw_hid_stream_channel_dynamic_keymap_macro = 0x02,
+    id_raw_hid_stream_channel_latency_histogram    = 0x03,
+    id_raw_hid_stream_channel_task_accounting      = 0x04,
+    id_raw_hid_stream_channel_report_cache         = 0x05,
+    id_raw_hid_stream_channel_split_txn_stats      = 0x06,
+    id_raw_hid_stream_channel_tunables             = 0x07,
+    id_raw_hid_stream_channel_power_telemetry      = 0x08,
+    id_raw_hid_stream_channel_transient_eeprom     = 0x09,
+};
+
+/* Channel accessors use the same signature as the dynamic keymap buffer
+ * API; out-of-range reads return zeroes and out-of-range writes are
+ * ignored, so the callbacks own their bounds. `write` is NULL for
+ * read-only channels. */
+typedef struct raw_hid_stream_channel_t {
+    void (*read)(uint16_t offset, uint16_t size, uint8_t *data);
+    void (*write)(uint16_t offset, uint16_t size, uint8_t *data);
+} raw_hid_stream_channel_t;
+
+/* Resolve keyboard-specific channel ids; return true and fill `channel`
+ * to claim one. Built-in channels are resolved first. */
+bool raw_hid_stream_channel_kb(uint8_t channel_id, raw_hid_stream_channel_t *channel);
+
+/* Handle a raw HID packet; returns true (after sending any responses) if
+ * the packet belongs to the streaming protocol. */
+bool raw_hid_stream_command(uint8_t *data, uint8_t length);
@@ -4,7 +4,7 @@ RGB_MATRIX_EFFECT(CYCLE_OUT_IN_DUAL)
 
 static HSV CYCLE_OUT_IN_DUAL_math(HSV hsv, int16_t dx, int16_t dy, uint8_t time) {
     dx           = (k_rgb_matrix_center.x / 2) - abs8(dx);
-    uint8_t dist = sqrt16(dx * dx + dy * dy);
+    uint8_t dist = fp_dist8(dx, dy);
     hsv.h        = 3 * dist + time;
     return hsv;
 }
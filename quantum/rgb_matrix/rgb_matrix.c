@@ -23,6 +23,16 @@
 #include <math.h>
 
 #include <lib/lib8tion/lib8tion.h>
+#include "fixed_point.h"
+
+#ifdef GAME_MODE_ENABLE
+#    include "game_mode.h"
+#endif
+
+#if defined(RGB_MATRIX_LAYER_INDICATOR_MAP) || defined(RGB_MATRIX_INDICATOR_RULES)
+#    include "action_layer.h"
+#    include "keymap_introspection.h"
+#endif
 
 #ifndef RGB_MATRIX_CENTER
 const led_point_t k_rgb_matrix_center = {112, 32};
@@ -64,6 +74,43 @@ __attribute__((weak)) RGB rgb_matrix_hsv_to_rgb(HSV hsv) {
 #    define RGB_MATRIX_MAXIMUM_BRIGHTNESS UINT8_MAX
 #endif
 
+#ifdef RGB_MATRIX_CURRENT_LIMIT_ENABLE
+#    include "analog.h"
+#    include "timer.h"
+#    ifndef RGB_MATRIX_VBUS_SENSE_PIN
+#        error RGB_MATRIX_VBUS_SENSE_PIN must be defined to use rgb_matrix current limiting.
+#    endif
+// analogReadPin() returns 10-bit counts on every platform ADC driver.
+#    define RGB_MATRIX_VBUS_ADC_MAX 1023
+#    ifndef RGB_MATRIX_VBUS_VREF_MV
+#        define RGB_MATRIX_VBUS_VREF_MV 3300
+#    endif
+// External divider ratio bringing VBUS into the ADC range (5V / 2 = 2.5V).
+#    ifndef RGB_MATRIX_VBUS_DIVIDER
+#        define RGB_MATRIX_VBUS_DIVIDER 2
+#    endif
+// Below this the port is sagging and brightness is shed quickly.
+#    ifndef RGB_MATRIX_VBUS_SAG_MV
+#        define RGB_MATRIX_VBUS_SAG_MV 4550
+#    endif
+// Above this the port has headroom and brightness creeps back up.
+#    ifndef RGB_MATRIX_VBUS_RECOVER_MV
+#        define RGB_MATRIX_VBUS_RECOVER_MV 4750
+#    endif
+#    ifndef RGB_MATRIX_CURRENT_LIMIT_INTERVAL_MS
+#        define RGB_MATRIX_CURRENT_LIMIT_INTERVAL_MS 100
+#    endif
+#    ifndef RGB_MATRIX_CURRENT_LIMIT_STEP_DOWN
+#        define RGB_MATRIX_CURRENT_LIMIT_STEP_DOWN 8
+#    endif
+#    ifndef RGB_MATRIX_CURRENT_LIMIT_STEP_UP
+#        define RGB_MATRIX_CURRENT_LIMIT_STEP_UP 1
+#    endif
+#    ifndef RGB_MATRIX_CURRENT_LIMIT_MIN_SCALE
+#        define RGB_MATRIX_CURRENT_LIMIT_MIN_SCALE 64
+#    endif
+#endif
+
 #if !defined(RGB_MATRIX_HUE_STEP)
 #    define RGB_MATRIX_HUE_STEP 8
 #endif
@@ -106,14 +153,27 @@ __attribute__((weak)) RGB rgb_matrix_hsv_to_rgb(HSV hsv) {
 #endif
 
 // globals
-rgb_config_t rgb_matrix_config; // TODO: would like to prefix this with g_ for global consistancy, do this in another pr
-uint32_t     g_rgb_timer;
+rgb_config_t      rgb_matrix_config; // TODO: would like to prefix this with g_ for global consistancy, do this in another pr
+uint32_t          g_rgb_timer;
+rgb_frame_state_t g_rgb_frame_state;
+uint16_t          g_rgb_flush_limit = RGB_MATRIX_LED_FLUSH_LIMIT;
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #endif // RGB_MATRIX_FRAMEBUFFER_EFFECTS
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#ifdef RGB_MATRIX_DISTANCE_CACHE
+// Distances from each remembered hit to every LED, filled once per keypress
+// so the reactive splash runners do a table lookup per LED instead of
+// redoing the distance math every frame for every live hit. The rows mirror
+// the hit slots of g_last_hit_tracker; g_center_distance covers the fixed
+// k_rgb_matrix_center used by the dx/dy/dist runner.
+#    ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+uint8_t g_hit_distance[LED_HITS_TO_REMEMBER][RGB_MATRIX_LED_COUNT];
+#    endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+uint8_t g_center_distance[RGB_MATRIX_LED_COUNT];
+#endif // RGB_MATRIX_DISTANCE_CACHE
 
 // internals
 static bool            suspend_state     = false;
@@ -124,11 +184,18 @@ static rgb_task_states rgb_task_state    = SYNCING;
 #if RGB_MATRIX_TIMEOUT > 0
 static uint32_t rgb_anykey_timer;
 #endif // RGB_MATRIX_TIMEOUT > 0
+#ifdef RGB_MATRIX_CURRENT_LIMIT_ENABLE
+static uint8_t  rgb_current_scale      = UINT8_MAX;
+static uint32_t rgb_current_limit_time = 0;
+#endif // RGB_MATRIX_CURRENT_LIMIT_ENABLE
 
 // double buffers
 static uint32_t rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 static last_hit_t last_hit_buffer;
+#    ifdef RGB_MATRIX_DISTANCE_CACHE
+static uint8_t hit_distance_buffer[LED_HITS_TO_REMEMBER][RGB_MATRIX_LED_COUNT];
+#    endif // RGB_MATRIX_DISTANCE_CACHE
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
 // split rgb matrix
@@ -192,7 +259,11 @@ void rgb_matrix_update_pwm_buffers(void) {
 }
 
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+#ifdef RGB_MATRIX_CURRENT_LIMIT_ENABLE
+    rgb_matrix_driver.set_color(index, scale8(red, rgb_current_scale), scale8(green, rgb_current_scale), scale8(blue, rgb_current_scale));
+#else
     rgb_matrix_driver.set_color(index, red, green, blue);
+#endif
 }
 
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
@@ -200,7 +271,11 @@ void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
     for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++)
         rgb_matrix_set_color(i, red, green, blue);
 #else
+#    ifdef RGB_MATRIX_CURRENT_LIMIT_ENABLE
+    rgb_matrix_driver.set_color_all(scale8(red, rgb_current_scale), scale8(green, rgb_current_scale), scale8(blue, rgb_current_scale));
+#    else
     rgb_matrix_driver.set_color_all(red, green, blue);
+#    endif
 #endif
 }
 
@@ -230,6 +305,9 @@ void process_rgb_matrix(uint8_t row, uint8_t col, bool pressed) {
         memcpy(&last_hit_buffer.y[0], &last_hit_buffer.y[led_count], LED_HITS_TO_REMEMBER - led_count);
         memcpy(&last_hit_buffer.tick[0], &last_hit_buffer.tick[led_count], (LED_HITS_TO_REMEMBER - led_count) * 2); // 16 bit
         memcpy(&last_hit_buffer.index[0], &last_hit_buffer.index[led_count], LED_HITS_TO_REMEMBER - led_count);
+#    ifdef RGB_MATRIX_DISTANCE_CACHE
+        memcpy(&hit_distance_buffer[0], &hit_distance_buffer[led_count], (LED_HITS_TO_REMEMBER - led_count) * RGB_MATRIX_LED_COUNT);
+#    endif // RGB_MATRIX_DISTANCE_CACHE
         last_hit_buffer.count = LED_HITS_TO_REMEMBER - led_count;
     }
 
@@ -239,6 +317,13 @@ void process_rgb_matrix(uint8_t row, uint8_t col, bool pressed) {
         last_hit_buffer.y[index]     = g_led_config.point[led[i]].y;
         last_hit_buffer.index[index] = led[i];
         last_hit_buffer.tick[index]  = 0;
+#    ifdef RGB_MATRIX_DISTANCE_CACHE
+        for (uint8_t led_i = 0; led_i < RGB_MATRIX_LED_COUNT; led_i++) {
+            int16_t dx                         = g_led_config.point[led_i].x - last_hit_buffer.x[index];
+            int16_t dy                         = g_led_config.point[led_i].y - last_hit_buffer.y[index];
+            hit_distance_buffer[index][led_i]  = fp_dist8(dx, dy);
+        }
+#    endif // RGB_MATRIX_DISTANCE_CACHE
         last_hit_buffer.count++;
     }
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
@@ -316,20 +401,106 @@ static void rgb_task_timers(void) {
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 }
 
+#ifdef RGB_MATRIX_FRAME_GOVERNOR
+// Best-effort frame pacing: once a second, compare the measured main-loop
+// scan rate against the configured floor and halve or restore the frame
+// rate one power-of-two step at a time. Decimation raises the scan rate,
+// so restoring waits for twice the floor to keep the loop from hunting.
+// Set the floor comfortably below the board's idle scan rate.
+static uint8_t rgb_frame_governor_decimation(void) {
+    static uint32_t governor_eval_timer = 0;
+    static uint8_t  decimation          = 1;
+
+#    ifdef GAME_MODE_ENABLE
+    // Game mode pins the governor at its floor: maximum decimation, so
+    // lighting gives up as much loop time as it is allowed to.
+    if (game_mode_is_active()) {
+        return RGB_MATRIX_GOVERNOR_MAX_DECIMATION;
+    }
+#    endif
+
+    if (sync_timer_elapsed32(governor_eval_timer) >= 1000) {
+        governor_eval_timer = sync_timer_read32();
+        uint32_t scan_rate  = get_matrix_scan_rate();
+        if (scan_rate != 0) {
+            if (scan_rate < RGB_MATRIX_GOVERNOR_SCAN_RATE_FLOOR && decimation < RGB_MATRIX_GOVERNOR_MAX_DECIMATION) {
+                decimation <<= 1;
+            } else if (scan_rate >= 2 * RGB_MATRIX_GOVERNOR_SCAN_RATE_FLOOR && decimation > 1) {
+                decimation >>= 1;
+            }
+        }
+    }
+    return decimation;
+}
+#endif // RGB_MATRIX_FRAME_GOVERNOR
+
 static void rgb_task_sync(void) {
     eeconfig_flush_rgb_matrix(false);
     // next task
-    if (sync_timer_elapsed32(g_rgb_timer) >= RGB_MATRIX_LED_FLUSH_LIMIT) rgb_task_state = STARTING;
+#ifdef RGB_MATRIX_FRAME_GOVERNOR
+    if (sync_timer_elapsed32(g_rgb_timer) >= (uint32_t)g_rgb_flush_limit * rgb_frame_governor_decimation()) rgb_task_state = STARTING;
+#else
+    if (sync_timer_elapsed32(g_rgb_timer) >= g_rgb_flush_limit) rgb_task_state = STARTING;
+#endif
+}
+
+#ifdef RGB_MATRIX_CURRENT_LIMIT_ENABLE
+uint8_t rgb_matrix_get_current_scale(void) {
+    return rgb_current_scale;
 }
 
+/* Closed-loop current management: sample VBUS droop through the ADC and steer
+ * the global output scale. The loop sheds brightness quickly while the port
+ * sags and creeps back up while there is headroom, so a board can run at full
+ * brightness on a good port instead of being capped for the worst one. Runs
+ * at a frame boundary so a single frame never mixes two scale factors. */
+static void rgb_matrix_current_limit_step(void) {
+    if (timer_elapsed32(rgb_current_limit_time) < RGB_MATRIX_CURRENT_LIMIT_INTERVAL_MS) {
+        return;
+    }
+    rgb_current_limit_time = timer_read32();
+
+    uint16_t vbus_mv = (uint16_t)((uint32_t)analogReadPin(RGB_MATRIX_VBUS_SENSE_PIN) * RGB_MATRIX_VBUS_VREF_MV * RGB_MATRIX_VBUS_DIVIDER / RGB_MATRIX_VBUS_ADC_MAX);
+    if (vbus_mv < RGB_MATRIX_VBUS_SAG_MV) {
+        if (rgb_current_scale > RGB_MATRIX_CURRENT_LIMIT_MIN_SCALE + RGB_MATRIX_CURRENT_LIMIT_STEP_DOWN) {
+            rgb_current_scale -= RGB_MATRIX_CURRENT_LIMIT_STEP_DOWN;
+        } else {
+            rgb_current_scale = RGB_MATRIX_CURRENT_LIMIT_MIN_SCALE;
+        }
+    } else if (vbus_mv > RGB_MATRIX_VBUS_RECOVER_MV) {
+        if (rgb_current_scale < UINT8_MAX - RGB_MATRIX_CURRENT_LIMIT_STEP_UP) {
+            rgb_current_scale += RGB_MATRIX_CURRENT_LIMIT_STEP_UP;
+        } else {
+            rgb_current_scale = UINT8_MAX;
+        }
+    }
+}
+#endif // RGB_MATRIX_CURRENT_LIMIT_ENABLE
+
 static void rgb_task_start(void) {
     // reset iter
     rgb_effect_params.iter = 0;
 
+#ifdef RGB_MATRIX_CURRENT_LIMIT_ENABLE
+    rgb_matrix_current_limit_step();
+#endif
+
+    // snapshot shared state so the whole frame renders from one coherent view
+    g_rgb_frame_state.layer_state         = layer_state;
+    g_rgb_frame_state.default_layer_state = default_layer_state;
+    g_rgb_frame_state.host_leds           = host_keyboard_led_state();
+    g_rgb_frame_state.mods                = get_mods();
+#ifdef WPM_ENABLE
+    g_rgb_frame_state.wpm = get_current_wpm();
+#endif
+
     // update double buffers
     g_rgb_timer = rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker = last_hit_buffer;
+#    ifdef RGB_MATRIX_DISTANCE_CACHE
+    memcpy(g_hit_distance, hit_distance_buffer, sizeof(g_hit_distance));
+#    endif // RGB_MATRIX_DISTANCE_CACHE
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
     // next task
@@ -441,6 +612,97 @@ void rgb_matrix_task(void) {
     }
 }
 
+#ifdef RGB_MATRIX_LAYER_INDICATOR_MAP
+static const uint8_t *layer_indicator_map   = NULL;
+static RGB            layer_indicator_rgb   = {0};
+static bool           layer_indicator_dirty = true;
+
+void rgb_matrix_layer_indicators_invalidate(void) {
+    layer_indicator_dirty = true;
+}
+
+__attribute__((weak)) bool rgb_matrix_layer_indicator_color(uint8_t layer, HSV *hsv) {
+    return false;
+}
+
+// The active layer's bitmap and color are recomputed only when a layer
+// change (or an explicit invalidate) marks them dirty; per frame this is
+// a bit test per LED instead of a keymap lookup per LED.
+static void rgb_matrix_layer_indicators_render(uint8_t led_min, uint8_t led_max) {
+    if (layer_indicator_dirty) {
+        uint8_t layer       = get_highest_layer(g_rgb_frame_state.layer_state | g_rgb_frame_state.default_layer_state);
+        HSV     hsv         = {0, 0, 0};
+        layer_indicator_map = rgb_matrix_layer_indicator_color(layer, &hsv) ? keymap_layer_led_map(layer) : NULL;
+        if (hsv.v > rgb_matrix_get_val()) {
+            hsv.v = rgb_matrix_get_val();
+        }
+        layer_indicator_rgb   = rgb_matrix_hsv_to_rgb(hsv);
+        layer_indicator_dirty = false;
+    }
+    if (layer_indicator_map == NULL) {
+        return;
+    }
+    for (uint8_t i = led_min; i < led_max; i++) {
+        if (layer_indicator_map[i / 8] & (1 << (i % 8))) {
+            rgb_matrix_set_color(i, layer_indicator_rgb.r, layer_indicator_rgb.g, layer_indicator_rgb.b);
+        }
+    }
+}
+#endif
+
+#ifdef RGB_MATRIX_INDICATOR_RULES
+#    ifndef RGB_MATRIX_INDICATOR_RULES_MAX_ACTIVE
+#        define RGB_MATRIX_INDICATOR_RULES_MAX_ACTIVE 8
+#    endif
+
+static struct {
+    const uint8_t *map;
+    RGB            rgb;
+} indicator_active_rules[RGB_MATRIX_INDICATOR_RULES_MAX_ACTIVE];
+static uint8_t indicator_active_rule_count = 0;
+static bool    indicator_rules_dirty       = true;
+
+void rgb_matrix_indicator_rules_invalidate(void) {
+    indicator_rules_dirty = true;
+}
+
+// Which rules apply -- and their resolved colors -- is recomputed only when a
+// layer change or keymap write marks the set dirty; per frame each active
+// rule costs a bit test per LED against its precomputed bitmap.
+static void rgb_matrix_indicator_rules_render(uint8_t led_min, uint8_t led_max) {
+    if (indicator_rules_dirty) {
+        layer_state_t active        = g_rgb_frame_state.layer_state | g_rgb_frame_state.default_layer_state;
+        indicator_active_rule_count = 0;
+        for (uint8_t i = 0; i < rgb_matrix_indicator_rules_count() && indicator_active_rule_count < RGB_MATRIX_INDICATOR_RULES_MAX_ACTIVE; i++) {
+            rgb_matrix_indicator_rule_t rule = rgb_matrix_indicator_rule_get(i);
+            if (!(active & ((layer_state_t)1 << rule.layer))) {
+                continue;
+            }
+            HSV hsv = rule.hsv;
+            if (hsv.v > rgb_matrix_get_val()) {
+                hsv.v = rgb_matrix_get_val();
+            }
+            indicator_active_rules[indicator_active_rule_count].map = keymap_indicator_rule_led_map(i);
+            indicator_active_rules[indicator_active_rule_count].rgb = rgb_matrix_hsv_to_rgb(hsv);
+            indicator_active_rule_count++;
+        }
+        indicator_rules_dirty = false;
+    }
+    for (uint8_t n = 0; n < indicator_active_rule_count; n++) {
+        const uint8_t *map = indicator_active_rules[n].map;
+        if (map == NULL) {
+            continue;
+        }
+        RGB rgb = indicator_active_rules[n].rgb;
+        for (uint8_t i = led_min; i < led_max; i++) {
+            if (map[i / 8] & (1 << (i % 8))) {
+                rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
+            }
+        }
+    }
+}
+#endif // RGB_MATRIX_INDICATOR_RULES
+
 void rgb_matrix_indicators(void) {
     rgb_matrix_indicators_kb();
 }
@@ -466,6 +728,12 @@ void rgb_matrix_indicators_advanced(effect_params_t *params) {
 #else
     uint8_t min = 0;
     uint8_t max = RGB_MATRIX_LED_COUNT;
+#endif
+#ifdef RGB_MATRIX_LAYER_INDICATOR_MAP
+    rgb_matrix_layer_indicators_render(min, max);
+#endif
+#ifdef RGB_MATRIX_INDICATOR_RULES
+    rgb_matrix_indicator_rules_render(min, max);
 #endif
     rgb_matrix_indicators_advanced_kb(min, max);
 }
@@ -493,6 +761,14 @@ void rgb_matrix_init(void) {
     }
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
+#ifdef RGB_MATRIX_DISTANCE_CACHE
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        int16_t dx            = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy            = g_led_config.point[i].y - k_rgb_matrix_center.y;
+        g_center_distance[i]  = fp_dist8(dx, dy);
+    }
+#endif // RGB_MATRIX_DISTANCE_CACHE
+
     if (!eeconfig_is_enabled()) {
         dprintf("rgb_matrix_init_drivers eeconfig is not enabled.\n");
         eeconfig_init();
@@ -46,6 +46,17 @@
 #    define RGB_MATRIX_LED_FLUSH_LIMIT 16
 #endif
 
+#ifdef RGB_MATRIX_FRAME_GOVERNOR
+// Main-loop scans per second below which frames start being decimated
+#    ifndef RGB_MATRIX_GOVERNOR_SCAN_RATE_FLOOR
+#        define RGB_MATRIX_GOVERNOR_SCAN_RATE_FLOOR 1000
+#    endif
+// Upper bound on frame-time multiplication; power of two
+#    ifndef RGB_MATRIX_GOVERNOR_MAX_DECIMATION
+#        define RGB_MATRIX_GOVERNOR_MAX_DECIMATION 8
+#    endif
+#endif
+
 #ifndef RGB_MATRIX_LED_PROCESS_LIMIT
 #    define RGB_MATRIX_LED_PROCESS_LIMIT (RGB_MATRIX_LED_COUNT + 4) / 5
 #endif
@@ -136,6 +147,40 @@ void rgb_matrix_indicators_advanced(effect_params_t *params);
 bool rgb_matrix_indicators_advanced_kb(uint8_t led_min, uint8_t led_max);
 bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max);
 
+#ifdef RGB_MATRIX_LAYER_INDICATOR_MAP
+// Return true and fill `hsv` to light the layer's mapped keys in that color;
+// queried once per layer change, not per frame.
+bool rgb_matrix_layer_indicator_color(uint8_t layer, HSV *hsv);
+// Re-evaluate the indicator overlay, e.g. after changing what the color
+// callback would return; layer changes trigger this automatically.
+void rgb_matrix_layer_indicators_invalidate(void);
+#endif
+
+#ifdef RGB_MATRIX_INDICATOR_RULES
+// One declarative indicator rule: while `layer` is active, the LEDs whose key
+// maps to a keycode within [keycode_min, keycode_max] on that layer are
+// painted with `hsv`. The keymap defines the rules in an
+// rgb_matrix_indicator_rules[] table; they are applied in table order, so
+// later rules win on overlapping LEDs.
+typedef struct rgb_matrix_indicator_rule_t {
+    uint8_t  layer;
+    uint16_t keycode_min;
+    uint16_t keycode_max;
+    HSV      hsv;
+} rgb_matrix_indicator_rule_t;
+
+// Any key assigned a non-transparent keycode on the layer
+#    define RGB_MATRIX_INDICATOR_LAYER(layer_, h_, s_, v_) \
+        { .layer = (layer_), .keycode_min = KC_TRNS + 1, .keycode_max = UINT16_MAX, .hsv = {(h_), (s_), (v_)} }
+// Keys whose keycode on the layer falls within [min_, max_]
+#    define RGB_MATRIX_INDICATOR_RANGE(layer_, min_, max_, h_, s_, v_) \
+        { .layer = (layer_), .keycode_min = (min_), .keycode_max = (max_), .hsv = {(h_), (s_), (v_)} }
+
+// Re-evaluate which rules are active and their colors; layer changes and
+// dynamic keymap writes trigger this automatically.
+void rgb_matrix_indicator_rules_invalidate(void);
+#endif
+
 void rgb_matrix_init(void);
 
 void rgb_matrix_reload_from_eeprom(void);
@@ -184,6 +229,11 @@ void        rgb_matrix_decrease_speed_noeeprom(void);
 led_flags_t rgb_matrix_get_flags(void);
 void        rgb_matrix_set_flags(led_flags_t flags);
 void        rgb_matrix_set_flags_noeeprom(led_flags_t flags);
+#ifdef RGB_MATRIX_CURRENT_LIMIT_ENABLE
+// Current global output scale applied by the VBUS current limiter; 255 means
+// the supply has full headroom and no brightness is being shed.
+uint8_t rgb_matrix_get_current_scale(void);
+#endif
 
 #ifndef RGBLIGHT_ENABLE
 #    define eeconfig_update_rgblight_current eeconfig_update_rgb_matrix
@@ -257,10 +307,34 @@ extern const rgb_matrix_driver_t rgb_matrix_driver;
 extern rgb_config_t rgb_matrix_config;
 
 extern uint32_t     g_rgb_timer;
+extern uint16_t     g_rgb_flush_limit;
 extern led_config_t g_led_config;
+
+// Shared state captured once per frame in rgb_task_start(). Effects and
+// indicator callbacks should read this instead of the live globals, so the
+// whole frame renders from one coherent view however many iterations it takes
+// - and so the render stage stays race-free when it runs off the main thread.
+typedef struct {
+    layer_state_t layer_state;
+    layer_state_t default_layer_state;
+    led_t         host_leds; // host keyboard LED state (caps lock etc.)
+    uint8_t       mods;
+#ifdef WPM_ENABLE
+    uint8_t wpm;
+#endif
+} rgb_frame_state_t;
+
+extern rgb_frame_state_t g_rgb_frame_state;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 extern last_hit_t g_last_hit_tracker;
 #endif
+#ifdef RGB_MATRIX_DISTANCE_CACHE
+// Precomputed distances, maintained per keypress / at init; see rgb_matrix.c
+#    ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+extern uint8_t g_hit_distance[LED_HITS_TO_REMEMBER][RGB_MATRIX_LED_COUNT];
+#    endif
+extern uint8_t g_center_distance[RGB_MATRIX_LED_COUNT];
+#endif
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
 #endif
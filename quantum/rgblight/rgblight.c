@@ -945,6 +945,19 @@ void rgblight_set(void) {
     for (uint8_t i = 0; i < num_leds; i++) {
         convert_rgb_to_rgbw(&start_led[i]);
     }
+#    endif
+#    ifdef RGBLIGHT_SKIP_UNCHANGED_FLUSH
+    // Animation ticks frequently recompute an identical frame (paused
+    // effects, static colors, slow gradients between steps); comparing
+    // against the last flushed frame is far cheaper than pushing it out
+    // over ws2812/I2C again.
+    static LED_TYPE last_flushed[RGBLED_NUM];
+    static uint8_t  last_num_leds = 0;
+    if (num_leds == last_num_leds && memcmp(start_led, last_flushed, num_leds * sizeof(LED_TYPE)) == 0) {
+        return;
+    }
+    memcpy(last_flushed, start_led, num_leds * sizeof(LED_TYPE));
+    last_num_leds = num_leds;
 #    endif
     rgblight_call_driver(start_led, num_leds);
 }
@@ -1052,80 +1065,93 @@ static void rgblight_effect_dummy(animation_status_t *anim) {
 
 void rgblight_task(void) {
     if (rgblight_status.timer_enabled) {
-        effect_func_t effect_func   = rgblight_effect_dummy;
-        uint16_t      interval_time = 2000; // dummy interval
-        uint8_t       delta         = rgblight_config.mode - rgblight_status.base_mode;
-        animation_status.delta      = delta;
+        // The effect function and step interval only depend on the mode, so
+        // they are re-resolved when it changes; the steady-state cost of a
+        // task call between animation steps is a single timer compare.
+        static effect_func_t effect_func   = rgblight_effect_dummy;
+        static uint16_t      interval_time = 2000; // dummy interval
+        static uint8_t       resolved_mode = 0;
 
-        // static light mode, do nothing here
-        if (1 == 0) { // dummy
+        if (animation_status.restart) {
+            animation_status.restart    = false;
+            animation_status.last_timer = sync_timer_read();
+            animation_status.pos16      = 0; // restart signal to local each effect
+            resolved_mode               = 0; // force effect re-resolution
         }
+
+        if (rgblight_config.mode != resolved_mode) {
+            resolved_mode          = rgblight_config.mode;
+            effect_func            = rgblight_effect_dummy;
+            interval_time          = 2000; // dummy interval
+            uint8_t delta          = rgblight_config.mode - rgblight_status.base_mode;
+            animation_status.delta = delta;
+
+            // static light mode, do nothing here
+            if (1 == 0) { // dummy
+            }
 #    ifdef RGBLIGHT_EFFECT_BREATHING
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_BREATHING) {
-            // breathing mode
-            interval_time = get_interval_time(&RGBLED_BREATHING_INTERVALS[delta], 1, 100);
-            effect_func   = rgblight_effect_breathing;
-        }
+            else if (rgblight_status.base_mode == RGBLIGHT_MODE_BREATHING) {
+                // breathing mode
+                interval_time = get_interval_time(&RGBLED_BREATHING_INTERVALS[delta], 1, 100);
+                effect_func   = rgblight_effect_breathing;
+            }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_RAINBOW_MOOD
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_RAINBOW_MOOD) {
-            // rainbow mood mode
-            interval_time = get_interval_time(&RGBLED_RAINBOW_MOOD_INTERVALS[delta], 5, 100);
-            effect_func   = rgblight_effect_rainbow_mood;
-        }
+            else if (rgblight_status.base_mode == RGBLIGHT_MODE_RAINBOW_MOOD) {
+                // rainbow mood mode
+                interval_time = get_interval_time(&RGBLED_RAINBOW_MOOD_INTERVALS[delta], 5, 100);
+                effect_func   = rgblight_effect_rainbow_mood;
+            }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_RAINBOW_SWIRL
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_RAINBOW_SWIRL) {
-            // rainbow swirl mode
-            interval_time = get_interval_time(&RGBLED_RAINBOW_SWIRL_INTERVALS[delta / 2], 1, 100);
-            effect_func   = rgblight_effect_rainbow_swirl;
-        }
+            else if (rgblight_status.base_mode == RGBLIGHT_MODE_RAINBOW_SWIRL) {
+                // rainbow swirl mode
+                interval_time = get_interval_time(&RGBLED_RAINBOW_SWIRL_INTERVALS[delta / 2], 1, 100);
+                effect_func   = rgblight_effect_rainbow_swirl;
+            }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_SNAKE
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_SNAKE) {
-            // snake mode
-            interval_time = get_interval_time(&RGBLED_SNAKE_INTERVALS[delta / 2], 1, 200);
-            effect_func   = rgblight_effect_snake;
-        }
+            else if (rgblight_status.base_mode == RGBLIGHT_MODE_SNAKE) {
+                // snake mode
+                interval_time = get_interval_time(&RGBLED_SNAKE_INTERVALS[delta / 2], 1, 200);
+                effect_func   = rgblight_effect_snake;
+            }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_KNIGHT
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_KNIGHT) {
-            // knight mode
-            interval_time = get_interval_time(&RGBLED_KNIGHT_INTERVALS[delta], 5, 100);
-            effect_func   = rgblight_effect_knight;
-        }
+            else if (rgblight_status.base_mode == RGBLIGHT_MODE_KNIGHT) {
+                // knight mode
+                interval_time = get_interval_time(&RGBLED_KNIGHT_INTERVALS[delta], 5, 100);
+                effect_func   = rgblight_effect_knight;
+            }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_CHRISTMAS
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_CHRISTMAS) {
-            // christmas mode
-            interval_time = RGBLIGHT_EFFECT_CHRISTMAS_INTERVAL;
-            effect_func   = (effect_func_t)rgblight_effect_christmas;
-        }
+            else if (rgblight_status.base_mode == RGBLIGHT_MODE_CHRISTMAS) {
+                // christmas mode
+                interval_time = RGBLIGHT_EFFECT_CHRISTMAS_INTERVAL;
+                effect_func   = (effect_func_t)rgblight_effect_christmas;
+            }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_RGB_TEST
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_RGB_TEST) {
-            // RGB test mode
-            interval_time = pgm_read_word(&RGBLED_RGBTEST_INTERVALS[0]);
-            effect_func   = (effect_func_t)rgblight_effect_rgbtest;
-        }
+            else if (rgblight_status.base_mode == RGBLIGHT_MODE_RGB_TEST) {
+                // RGB test mode
+                interval_time = pgm_read_word(&RGBLED_RGBTEST_INTERVALS[0]);
+                effect_func   = (effect_func_t)rgblight_effect_rgbtest;
+            }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_ALTERNATING
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_ALTERNATING) {
-            interval_time = 500;
-            effect_func   = (effect_func_t)rgblight_effect_alternating;
-        }
+            else if (rgblight_status.base_mode == RGBLIGHT_MODE_ALTERNATING) {
+                interval_time = 500;
+                effect_func   = (effect_func_t)rgblight_effect_alternating;
+            }
 #    endif
 #    ifdef RGBLIGHT_EFFECT_TWINKLE
-        else if (rgblight_status.base_mode == RGBLIGHT_MODE_TWINKLE) {
-            interval_time = get_interval_time(&RGBLED_TWINKLE_INTERVALS[delta % 3], 5, 30);
-            effect_func   = (effect_func_t)rgblight_effect_twinkle;
-        }
+            else if (rgblight_status.base_mode == RGBLIGHT_MODE_TWINKLE) {
+                interval_time = get_interval_time(&RGBLED_TWINKLE_INTERVALS[delta % 3], 5, 30);
+                effect_func   = (effect_func_t)rgblight_effect_twinkle;
+            }
 #    endif
-        if (animation_status.restart) {
-            animation_status.restart    = false;
-            animation_status.last_timer = sync_timer_read();
-            animation_status.pos16      = 0; // restart signal to local each effect
         }
+
         uint16_t now = sync_timer_read();
         if (timer_expired(now, animation_status.last_timer)) {
 #    if defined(RGBLIGHT_SPLIT) && !defined(RGBLIGHT_SPLIT_NO_ANIMATION_SYNC)
@@ -1203,8 +1229,15 @@ static uint8_t breathe_calc(uint8_t pos) {
 __attribute__((weak)) const uint8_t RGBLED_BREATHING_INTERVALS[] PROGMEM = {30, 20, 10, 5};
 
 void rgblight_effect_breathing(animation_status_t *anim) {
-    uint8_t val = breathe_calc(anim->pos);
-    rgblight_sethsv_noeeprom_old(rgblight_config.hue, rgblight_config.sat, val);
+    static uint8_t last_val = 0;
+    uint8_t        val      = breathe_calc(anim->pos);
+
+    // With a coarse breathe table successive positions often land on the
+    // same entry; skip the full strip update when the value is unchanged.
+    if (val != last_val || anim->pos == 0) {
+        rgblight_sethsv_noeeprom_old(rgblight_config.hue, rgblight_config.sat, val);
+        last_val = val;
+    }
     anim->pos = (anim->pos + 1);
 }
 #endif
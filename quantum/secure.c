@@ -20,9 +20,30 @@
         }
 #endif
 
-static secure_status_t secure_status = SECURE_LOCKED;
-static uint32_t        unlock_time   = 0;
-static uint32_t        idle_time     = 0;
+// Failed unlock attempts tolerated before requests are refused for
+// SECURE_UNLOCK_LOCKOUT_TIMEOUT ms; 0 disables the limit
+#ifndef SECURE_UNLOCK_ATTEMPT_LIMIT
+#    define SECURE_UNLOCK_ATTEMPT_LIMIT 5
+#endif
+
+#ifndef SECURE_UNLOCK_LOCKOUT_TIMEOUT
+#    define SECURE_UNLOCK_LOCKOUT_TIMEOUT 30000
+#endif
+
+secure_status_t secure_status = SECURE_LOCKED;
+static uint32_t unlock_time   = 0;
+static uint32_t idle_time     = 0;
+
+#if SECURE_UNLOCK_ATTEMPT_LIMIT != 0
+static uint8_t  failed_attempts = 0;
+static uint32_t lockout_time    = 0;
+
+static bool secure_is_locked_out(void) {
+    return failed_attempts >= SECURE_UNLOCK_ATTEMPT_LIMIT;
+}
+#else
+#    define secure_is_locked_out() false
+#endif
 
 static void secure_hook(secure_status_t secure_status) {
     secure_hook_quantum(secure_status);
@@ -41,11 +62,14 @@ void secure_lock(void) {
 void secure_unlock(void) {
     secure_status = SECURE_UNLOCKED;
     idle_time     = timer_read32();
+#if SECURE_UNLOCK_ATTEMPT_LIMIT != 0
+    failed_attempts = 0;
+#endif
     secure_hook(secure_status);
 }
 
 void secure_request_unlock(void) {
-    if (secure_status == SECURE_LOCKED) {
+    if (secure_status == SECURE_LOCKED && !secure_is_locked_out()) {
         secure_status = SECURE_PENDING;
         unlock_time   = timer_read32();
     }
@@ -63,7 +87,11 @@ void secure_keypress_event(uint8_t row, uint8_t col) {
     static const uint8_t sequence_len  = ARRAY_SIZE(sequence);
 
     static uint8_t offset = 0;
-    if ((sequence[offset][0] == row) && (sequence[offset][1] == col)) {
+    // Branch-free compare of the expected position, so match and mismatch
+    // take the same time and the comparison itself leaks nothing about which
+    // coordinate was wrong.
+    uint8_t diff = (uint8_t)(sequence[offset][0] ^ row) | (uint8_t)(sequence[offset][1] ^ col);
+    if (diff == 0) {
         offset++;
         if (offset == sequence_len) {
             offset = 0;
@@ -71,11 +99,23 @@ void secure_keypress_event(uint8_t row, uint8_t col) {
         }
     } else {
         offset = 0;
+#if SECURE_UNLOCK_ATTEMPT_LIMIT != 0
+        if (!secure_is_locked_out() && ++failed_attempts >= SECURE_UNLOCK_ATTEMPT_LIMIT) {
+            lockout_time = timer_read32();
+        }
+#endif
         secure_lock();
     }
 }
 
 void secure_task(void) {
+#if SECURE_UNLOCK_ATTEMPT_LIMIT != 0
+    // expire the failed-attempt lockout
+    if (secure_is_locked_out() && timer_elapsed32(lockout_time) >= SECURE_UNLOCK_LOCKOUT_TIMEOUT) {
+        failed_attempts = 0;
+    }
+#endif
+
 #if SECURE_UNLOCK_TIMEOUT != 0
     // handle unlock timeout
     if (secure_status == SECURE_PENDING) {
@@ -20,21 +20,28 @@ typedef enum {
     SECURE_UNLOCKED,
 } secure_status_t;
 
+/** \brief Current secure state - read only, change it via the functions below
+ *
+ * Exposed so the state helpers compile to a single load on the per-event hot
+ * path instead of a function call
+ */
+extern secure_status_t secure_status;
+
 /** \brief Query current secure state
  */
 secure_status_t secure_get_status(void);
 
 /** \brief Helper to check if unlocking is currently locked
  */
-#define secure_is_locked() (secure_get_status() == SECURE_LOCKED)
+#define secure_is_locked() (secure_status == SECURE_LOCKED)
 
 /** \brief Helper to check if unlocking is currently in progress
  */
-#define secure_is_unlocking() (secure_get_status() == SECURE_PENDING)
+#define secure_is_unlocking() (secure_status == SECURE_PENDING)
 
 /** \brief Helper to check if unlocking is currently unlocked
  */
-#define secure_is_unlocked() (secure_get_status() == SECURE_UNLOCKED)
+#define secure_is_unlocked() (secure_status == SECURE_UNLOCKED)
 
 /** \brief Lock down the device
  */
@@ -24,6 +24,10 @@
 #include "action.h"
 #include "wait.h"
 
+#ifdef DEFERRED_EXEC_ENABLE
+#    include "deferred_exec.h"
+#endif
+
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
 #    include "audio.h"
 #    ifndef BELL_SOUND
@@ -326,3 +330,207 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
     }
 }
 #endif
+
+#ifdef DEFERRED_EXEC_ENABLE
+/* Deferred string transmitter. The string is walked by a deferred executor
+ * callback which performs exactly one report transition (one key or modifier
+ * press or release) per invocation and reschedules itself, so even long
+ * strings never block the scan loop. Only one string can be in flight.
+ */
+typedef enum {
+    SS_PHASE_FETCH, // consume the next character and decide what to send
+    SS_PHASE_SHIFT_DOWN,
+    SS_PHASE_ALTGR_DOWN,
+    SS_PHASE_KEY_DOWN,
+    SS_PHASE_KEY_UP,
+    SS_PHASE_ALTGR_UP,
+    SS_PHASE_SHIFT_UP,
+    SS_PHASE_DEAD_DOWN,
+    SS_PHASE_DEAD_UP,
+    SS_PHASE_CHAR_DONE, // apply the inter-character interval
+} send_string_phase_t;
+
+static const char *        ss_string;
+static uint8_t             ss_interval;
+static send_string_phase_t ss_phase;
+static uint8_t             ss_keycode;
+static bool                ss_shifted;
+static bool                ss_altgred;
+static bool                ss_dead;
+static deferred_token      ss_token = INVALID_DEFERRED_TOKEN;
+#    if defined(__AVR__)
+static bool ss_progmem;
+#    endif
+
+static char ss_read_byte(void) {
+#    if defined(__AVR__)
+    if (ss_progmem) {
+        return pgm_read_byte(ss_string);
+    }
+#    endif
+    return *ss_string;
+}
+
+static uint32_t send_string_deferred_callback(uint32_t trigger_time, void *cb_arg) {
+    while (true) {
+        switch (ss_phase) {
+            case SS_PHASE_FETCH: {
+                char ascii_code = ss_read_byte();
+                if (!ascii_code) {
+                    ss_token = INVALID_DEFERRED_TOKEN;
+                    return 0;
+                }
+                if (ascii_code == SS_QMK_PREFIX) {
+                    ++ss_string;
+                    ascii_code = ss_read_byte();
+                    if (ascii_code == SS_TAP_CODE || ascii_code == SS_DOWN_CODE || ascii_code == SS_UP_CODE) {
+                        ++ss_string;
+                        ss_keycode = ss_read_byte();
+                        ++ss_string;
+                        if (ascii_code == SS_DOWN_CODE) {
+                            register_code(ss_keycode);
+                            ss_phase = SS_PHASE_CHAR_DONE;
+                            return 1;
+                        }
+                        if (ascii_code == SS_UP_CODE) {
+                            unregister_code(ss_keycode);
+                            ss_phase = SS_PHASE_CHAR_DONE;
+                            return 1;
+                        }
+                        // tap
+                        ss_shifted = ss_altgred = ss_dead = false;
+                        ss_phase                          = SS_PHASE_KEY_DOWN;
+                        continue;
+                    } else if (ascii_code == SS_DELAY_CODE) {
+                        uint32_t ms = 0;
+                        ++ss_string;
+                        ascii_code = ss_read_byte();
+                        while (isdigit(ascii_code)) {
+                            ms *= 10;
+                            ms += ascii_code - '0';
+                            ++ss_string;
+                            ascii_code = ss_read_byte();
+                        }
+                        ss_phase = SS_PHASE_CHAR_DONE;
+                        if (ms) {
+                            return ms;
+                        }
+                        continue;
+                    }
+                    ++ss_string;
+                    continue;
+                }
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+                if (ascii_code == '\a') { // BEL
+                    PLAY_SONG(bell_song);
+                    ++ss_string;
+                    ss_phase = SS_PHASE_CHAR_DONE;
+                    continue;
+                }
+#    endif
+                ss_keycode = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+                ss_shifted = PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code);
+                ss_altgred = PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code);
+                ss_dead    = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
+                ++ss_string;
+                ss_phase = SS_PHASE_SHIFT_DOWN;
+                continue;
+            }
+            case SS_PHASE_SHIFT_DOWN:
+                ss_phase = SS_PHASE_ALTGR_DOWN;
+                if (ss_shifted) {
+                    register_code(KC_LEFT_SHIFT);
+                    return 1;
+                }
+                continue;
+            case SS_PHASE_ALTGR_DOWN:
+                ss_phase = SS_PHASE_KEY_DOWN;
+                if (ss_altgred) {
+                    register_code(KC_RIGHT_ALT);
+                    return 1;
+                }
+                continue;
+            case SS_PHASE_KEY_DOWN:
+                ss_phase = SS_PHASE_KEY_UP;
+                register_code(ss_keycode);
+                return 1;
+            case SS_PHASE_KEY_UP:
+                ss_phase = SS_PHASE_ALTGR_UP;
+                unregister_code(ss_keycode);
+                return 1;
+            case SS_PHASE_ALTGR_UP:
+                ss_phase = SS_PHASE_SHIFT_UP;
+                if (ss_altgred) {
+                    unregister_code(KC_RIGHT_ALT);
+                    return 1;
+                }
+                continue;
+            case SS_PHASE_SHIFT_UP:
+                ss_phase = SS_PHASE_DEAD_DOWN;
+                if (ss_shifted) {
+                    unregister_code(KC_LEFT_SHIFT);
+                    return 1;
+                }
+                continue;
+            case SS_PHASE_DEAD_DOWN:
+                ss_phase = SS_PHASE_DEAD_UP;
+                if (ss_dead) {
+                    register_code(KC_SPACE);
+                    return 1;
+                }
+                continue;
+            case SS_PHASE_DEAD_UP:
+                ss_phase = SS_PHASE_CHAR_DONE;
+                if (ss_dead) {
+                    unregister_code(KC_SPACE);
+                    return 1;
+                }
+                continue;
+            case SS_PHASE_CHAR_DONE:
+                ss_phase = SS_PHASE_FETCH;
+                if (ss_interval) {
+                    return ss_interval;
+                }
+                continue;
+        }
+    }
+}
+
+static bool send_string_deferred_start(const char *string, uint8_t interval, bool progmem) {
+    if (ss_token != INVALID_DEFERRED_TOKEN) {
+        return false;
+    }
+    ss_string   = string;
+    ss_interval = interval;
+    ss_phase    = SS_PHASE_FETCH;
+#    if defined(__AVR__)
+    ss_progmem = progmem;
+#    else
+    (void)progmem;
+#    endif
+    ss_token = defer_exec(1, send_string_deferred_callback, NULL);
+    return ss_token != INVALID_DEFERRED_TOKEN;
+}
+
+bool send_string_deferred(const char *string) {
+    return send_string_with_delay_deferred(string, 0);
+}
+
+bool send_string_with_delay_deferred(const char *string, uint8_t interval) {
+    return send_string_deferred_start(string, interval, false);
+}
+
+bool send_string_deferred_in_progress(void) {
+    return ss_token != INVALID_DEFERRED_TOKEN;
+}
+
+#    if defined(__AVR__)
+bool send_string_deferred_P(const char *string) {
+    return send_string_with_delay_deferred_P(string, 0);
+}
+
+bool send_string_with_delay_deferred_P(const char *string, uint8_t interval) {
+    return send_string_deferred_start(string, interval, true);
+}
+#    endif
+#endif
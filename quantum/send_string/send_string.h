@@ -21,6 +21,7 @@
  * \{
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "progmem.h"
@@ -135,6 +136,72 @@ void send_string_with_delay_P(const char *string, uint8_t interval);
 #    define send_string_with_delay_P(string, interval) send_string_with_delay(string, interval)
 #endif
 
+#if defined(DEFERRED_EXEC_ENABLE) || defined(__DOXYGEN__)
+/**
+ * \brief Type out a string of ASCII characters in the background.
+ *
+ * The string is walked by a deferred executor which sends one key or modifier
+ * transition per millisecond, so the scan loop is never blocked. The string
+ * must remain valid until transmission finishes. Only one deferred string can
+ * be in flight at a time.
+ *
+ * \param string The string to type out.
+ *
+ * \return `true` if transmission was started, `false` if another string is still being sent.
+ */
+bool send_string_deferred(const char *string);
+
+/**
+ * \brief Type out a string of ASCII characters in the background, with a delay between each character.
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ *
+ * \return `true` if transmission was started, `false` if another string is still being sent.
+ */
+bool send_string_with_delay_deferred(const char *string, uint8_t interval);
+
+/**
+ * \brief Whether a deferred string is currently being typed out.
+ */
+bool send_string_deferred_in_progress(void);
+
+#    if defined(__AVR__) || defined(__DOXYGEN__)
+/**
+ * \brief Type out a PROGMEM string of ASCII characters in the background.
+ *
+ * On ARM devices, this function is simply an alias for send_string_deferred(string).
+ *
+ * \param string The string to type out.
+ *
+ * \return `true` if transmission was started, `false` if another string is still being sent.
+ */
+bool send_string_deferred_P(const char *string);
+
+/**
+ * \brief Type out a PROGMEM string of ASCII characters in the background, with a delay between each character.
+ *
+ * On ARM devices, this function is simply an alias for send_string_with_delay_deferred(string, interval).
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ *
+ * \return `true` if transmission was started, `false` if another string is still being sent.
+ */
+bool send_string_with_delay_deferred_P(const char *string, uint8_t interval);
+#    else
+#        define send_string_deferred_P(string) send_string_deferred(string)
+#        define send_string_with_delay_deferred_P(string, interval) send_string_with_delay_deferred(string, interval)
+#    endif
+
+/**
+ * \brief Shortcut macro for send_string_deferred_P(PSTR(string)).
+ *
+ * On ARM devices, this define evaluates to send_string_deferred(string).
+ */
+#    define SEND_STRING_DEFERRED(string) send_string_deferred_P(PSTR(string))
+#endif
+
 /**
  * \brief Shortcut macro for send_string_with_delay_P(PSTR(string), 0).
  *
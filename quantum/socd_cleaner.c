@@ -0,0 +1,79 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "socd_cleaner.h"
+
+static matrix_row_t socd_mask[MATRIX_ROWS];
+static bool         cleaning_enabled = true;
+
+// Per-pair press history; last_b tracks which side was pressed more recently
+// for SOCD_RESOLUTION_LAST.
+static struct {
+    bool prev_a : 1;
+    bool prev_b : 1;
+    bool last_b : 1;
+} pair_state[SOCD_PAIR_COUNT];
+
+static bool read_raw(uint8_t row, uint8_t col) {
+    return (matrix_get_row(row) >> col) & 1;
+}
+
+static void suppress(uint8_t row, uint8_t col) {
+    socd_mask[row] |= (matrix_row_t)1 << col;
+}
+
+void socd_update(void) {
+    memset(socd_mask, 0, sizeof(socd_mask));
+
+    for (uint8_t i = 0; i < SOCD_PAIR_COUNT; i++) {
+        const socd_pair_t *pair = &socd_pairs[i];
+
+        const bool a = read_raw(pair->row_a, pair->col_a);
+        const bool b = read_raw(pair->row_b, pair->col_b);
+
+        // History updates on every pass, even while disabled, so re-enabling
+        // arbitrates correctly against keys that are already held.
+        if (a && !pair_state[i].prev_a) pair_state[i].last_b = false;
+        if (b && !pair_state[i].prev_b) pair_state[i].last_b = true;
+        pair_state[i].prev_a = a;
+        pair_state[i].prev_b = b;
+
+        if (!(a && b) || !cleaning_enabled) {
+            continue;
+        }
+
+        switch (pair->resolution) {
+            case SOCD_RESOLUTION_LAST:
+                if (pair_state[i].last_b) {
+                    suppress(pair->row_a, pair->col_a);
+                } else {
+                    suppress(pair->row_b, pair->col_b);
+                }
+                break;
+            case SOCD_RESOLUTION_NEUTRAL:
+                suppress(pair->row_a, pair->col_a);
+                suppress(pair->row_b, pair->col_b);
+                break;
+            case SOCD_RESOLUTION_A:
+                suppress(pair->row_b, pair->col_b);
+                break;
+            case SOCD_RESOLUTION_B:
+                suppress(pair->row_a, pair->col_a);
+                break;
+        }
+    }
+}
+
+matrix_row_t socd_apply_row(uint8_t row, matrix_row_t row_value) {
+    return row_value & ~socd_mask[row];
+}
+
+void socd_cleaner_enable(bool enable) {
+    cleaning_enabled = enable;
+}
+
+bool socd_cleaner_enabled(void) {
+    return cleaning_enabled;
+}
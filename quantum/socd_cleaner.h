@@ -0,0 +1,83 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "matrix.h"
+
+/**
+ * \file
+ *
+ * \brief Matrix-level SOCD (simultaneous opposing cardinal direction) cleaning.
+ *
+ * Arbitrates configured key pairs directly on the debounced matrix rows,
+ * before events are generated: the losing key of a held pair is masked out
+ * of the row, so the rest of the firmware - keymaps, layers, any process
+ * chain feature - simply sees it released. Cleaning costs a few bitmask
+ * operations per scan pass and nothing per event.
+ *
+ * Pairs are electrical matrix positions, defined in the keymap:
+ *
+ *     #define SOCD_PAIR_COUNT 2            // config.h
+ *
+ *     const socd_pair_t socd_pairs[SOCD_PAIR_COUNT] = {
+ *         SOCD_PAIR(2, 1, 2, 3, SOCD_RESOLUTION_LAST),    // A / D
+ *         SOCD_PAIR(1, 2, 2, 2, SOCD_RESOLUTION_NEUTRAL), // W / S
+ *     };
+ *
+ * When both keys of a pair rise in the same scan pass, the second listed
+ * key counts as the more recent press.
+ */
+
+#ifdef SOCD_CLEANER_ENABLE
+
+#    ifndef SOCD_PAIR_COUNT
+#        error "SOCD_CLEANER_ENABLE requires SOCD_PAIR_COUNT to be defined in config.h"
+#    endif
+
+typedef enum {
+    SOCD_RESOLUTION_LAST,    // most recent press wins; the earlier key reasserts on release
+    SOCD_RESOLUTION_NEUTRAL, // both held cancels both
+    SOCD_RESOLUTION_A,       // the first listed key always wins
+    SOCD_RESOLUTION_B,       // the second listed key always wins
+} socd_resolution_t;
+
+typedef struct {
+    uint8_t row_a;
+    uint8_t col_a;
+    uint8_t row_b;
+    uint8_t col_b;
+    uint8_t resolution;
+} socd_pair_t;
+
+#    define SOCD_PAIR(ra, ca, rb, cb, res) \
+        { (ra), (ca), (rb), (cb), (res) }
+
+extern const socd_pair_t socd_pairs[SOCD_PAIR_COUNT];
+
+/** \brief Re-arbitrate all pairs against the freshly scanned matrix.
+ *
+ * Called from matrix_task() once per scan pass, after the scan and before
+ * the row diff.
+ */
+void socd_update(void);
+
+/** \brief Mask the losing keys of held pairs out of one matrix row. */
+matrix_row_t socd_apply_row(uint8_t row, matrix_row_t row_value);
+
+/** \brief Runtime toggle; cleaning starts enabled.
+ *
+ * Suppressed keys release cleanly on the next scan pass after disabling.
+ */
+void socd_cleaner_enable(bool enable);
+bool socd_cleaner_enabled(void);
+
+#else
+
+#    define socd_update()
+#    define socd_apply_row(row, row_value) (row_value)
+
+#endif
@@ -26,6 +26,11 @@
 #    include "eeconfig.h"
 #endif
 
+#ifdef SPLIT_ROLE_CACHE
+#    include "eeconfig.h"
+#    include "eeprom.h"
+#endif
+
 #if defined(RGBLIGHT_ENABLE) && defined(RGBLED_SPLIT)
 #    include "rgblight.h"
 #endif
@@ -55,10 +60,20 @@ static uint8_t connection_errors = 0;
 
 volatile bool isLeftHand = true;
 
-#if defined(SPLIT_USB_DETECT)
+#if defined(SPLIT_ROLE_MASTER) || defined(SPLIT_ROLE_SLAVE)
+// Role fixed at build time (SPLIT_ROLE=master/slave): is_keyboard_master() is a
+// constant from keyboard.h, so the runtime negotiation below is compiled out.
+#    define SPLIT_ROLE_FIXED
+#    ifdef SPLIT_ROLE_CACHE
+#        error SPLIT_ROLE_CACHE has no effect when the role is fixed at build time via SPLIT_ROLE.
+#    endif
+#endif
+
+#ifndef SPLIT_ROLE_FIXED
+#    if defined(SPLIT_USB_DETECT)
 _Static_assert((SPLIT_USB_TIMEOUT / SPLIT_USB_TIMEOUT_POLL) <= UINT16_MAX, "Please lower SPLIT_USB_TIMEOUT and/or increase SPLIT_USB_TIMEOUT_POLL.");
-static bool usbIsActive(void) {
-    for (uint16_t i = 0; i < (SPLIT_USB_TIMEOUT / SPLIT_USB_TIMEOUT_POLL); i++) {
+static bool usbIsActiveFor(uint16_t timeout) {
+    for (uint16_t i = 0; i < (timeout / SPLIT_USB_TIMEOUT_POLL); i++) {
         // This will return true if a USB connection has been established
         if (usb_connected_state()) {
             return true;
@@ -67,11 +82,47 @@ static bool usbIsActive(void) {
     }
     return false;
 }
-#else
+static bool usbIsActive(void) {
+    return usbIsActiveFor(SPLIT_USB_TIMEOUT);
+}
+#    else
 static inline bool usbIsActive(void) {
     return usb_vbus_state();
 }
-#endif
+#    endif
+
+#    ifdef SPLIT_ROLE_CACHE
+#        if !defined(SPLIT_USB_DETECT)
+#            error "SPLIT_ROLE_CACHE requires SPLIT_USB_DETECT; VBUS detection already resolves the role instantly."
+#        endif
+#        ifndef SPLIT_ROLE_CACHE_TIMEOUT
+#            define SPLIT_ROLE_CACHE_TIMEOUT 500
+#        endif
+_Static_assert(SPLIT_ROLE_CACHE_TIMEOUT < SPLIT_USB_TIMEOUT, "SPLIT_ROLE_CACHE_TIMEOUT should be below SPLIT_USB_TIMEOUT, or the cache saves nothing.");
+
+/* The negotiated role is remembered in the spare bits of the eeconfig
+ * handedness byte (the handedness value itself only uses bit 0), so a half
+ * that was a slave last boot does not sit out the full SPLIT_USB_TIMEOUT
+ * before it starts scanning - it only grants USB a short grace period. A
+ * cached master keeps the full wait, which returns as soon as the host
+ * enumerates. Whenever the outcome differs from the cache, the full
+ * negotiation result is written back, so a swapped cable costs one boot. */
+#        define ROLE_CACHE_SHIFT 1
+#        define ROLE_CACHE_MASK (0x3 << ROLE_CACHE_SHIFT)
+#        define ROLE_CACHE_MASTER (0x1 << ROLE_CACHE_SHIFT)
+#        define ROLE_CACHE_SLAVE (0x2 << ROLE_CACHE_SHIFT)
+
+static uint8_t read_cached_role(void) {
+    return eeprom_read_byte(EECONFIG_HANDEDNESS) & ROLE_CACHE_MASK;
+}
+
+static void write_cached_role(bool master) {
+    uint8_t value = eeprom_read_byte(EECONFIG_HANDEDNESS);
+    value         = (value & ~ROLE_CACHE_MASK) | (master ? ROLE_CACHE_MASTER : ROLE_CACHE_SLAVE);
+    eeprom_update_byte(EECONFIG_HANDEDNESS, value);
+}
+#    endif // SPLIT_ROLE_CACHE
+#endif     // !SPLIT_ROLE_FIXED
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
 #    if !defined(SPLIT_WATCHDOG_TIMEOUT)
@@ -153,12 +204,24 @@ __attribute__((weak)) bool is_keyboard_left(void) {
     return is_keyboard_master();
 }
 
+#ifndef SPLIT_ROLE_FIXED
 __attribute__((weak)) bool is_keyboard_master(void) {
     static enum { UNKNOWN, MASTER, SLAVE } usbstate = UNKNOWN;
 
     // only check once, as this is called often
     if (usbstate == UNKNOWN) {
+#ifdef SPLIT_ROLE_CACHE
+        if (read_cached_role() == ROLE_CACHE_SLAVE) {
+            // Fast path: last boot ended as slave, so don't wait out the full
+            // detection timeout before this half starts scanning.
+            usbstate = usbIsActiveFor(SPLIT_ROLE_CACHE_TIMEOUT) ? MASTER : SLAVE;
+        } else {
+            usbstate = usbIsActive() ? MASTER : SLAVE;
+        }
+        write_cached_role(usbstate == MASTER);
+#else
         usbstate = usbIsActive() ? MASTER : SLAVE;
+#endif
 
         // Avoid NO_USB_STARTUP_CHECK - Disable USB as the previous checks seem to enable it somehow
         if (usbstate == SLAVE) {
@@ -168,9 +231,14 @@ __attribute__((weak)) bool is_keyboard_master(void) {
 
     return (usbstate == MASTER);
 }
+#endif // !SPLIT_ROLE_FIXED
 
 // this code runs before the keyboard is fully initialized
 void split_pre_init(void) {
+#ifdef SPLIT_ROLE_SLAVE
+    // The runtime role probe used to do this on its first query
+    usb_disconnect();
+#endif
 #if defined(SPLIT_HAND_PIN)
     setPinInput(SPLIT_HAND_PIN);
     wait_us(100);
@@ -228,6 +296,27 @@ bool is_transport_connected(void) {
     return connection_errors < SPLIT_MAX_CONNECTION_ERRORS;
 }
 
+#ifdef SPLIT_SLAVE_TASK_SCHEDULER
+bool split_slave_task_gate(split_slave_task_t task) {
+    // The master is pinned by USB polling anyway and gains nothing from
+    // deferring work, so only the slave half is scheduled.
+    if (is_keyboard_master()) {
+        return true;
+    }
+
+    static uint8_t current_task = SPLIT_SLAVE_TASK_COUNT - 1;
+    static uint8_t last_query   = SPLIT_SLAVE_TASK_COUNT;
+    // The gates are queried in ascending task order, so a non-increasing task
+    // id marks the start of a new scan loop iteration and advances the
+    // rotation by one slot.
+    if ((uint8_t)task <= last_query) {
+        current_task = (current_task + 1) % SPLIT_SLAVE_TASK_COUNT;
+    }
+    last_query = (uint8_t)task;
+    return (split_slave_task_t)current_task == task;
+}
+#endif // SPLIT_SLAVE_TASK_SCHEDULER
+
 bool transport_master_if_connected(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
 #if SPLIT_MAX_CONNECTION_ERRORS > 0 && SPLIT_CONNECTION_CHECK_TIMEOUT > 0
     // Throttle transaction attempts if target doesn't seem to be connected
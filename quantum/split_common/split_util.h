@@ -17,4 +17,30 @@ bool is_transport_connected(void);
 
 void split_watchdog_update(bool done);
 void split_watchdog_task(void);
-bool split_watchdog_check(void);
\ No newline at end of file
+bool split_watchdog_check(void);
+
+#ifdef SPLIT_SLAVE_TASK_SCHEDULER
+// Cosmetic tasks that are round-robin scheduled on the slave half, so that a
+// single scan loop iteration never runs more than one of them between two
+// transport service windows. Only enabled features occupy a slot.
+typedef enum split_slave_task_t {
+#    ifdef RGBLIGHT_ENABLE
+    SPLIT_SLAVE_TASK_RGBLIGHT,
+#    endif // RGBLIGHT_ENABLE
+#    ifdef LED_MATRIX_ENABLE
+    SPLIT_SLAVE_TASK_LED_MATRIX,
+#    endif // LED_MATRIX_ENABLE
+#    ifdef RGB_MATRIX_ENABLE
+    SPLIT_SLAVE_TASK_RGB_MATRIX,
+#    endif // RGB_MATRIX_ENABLE
+#    ifdef OLED_ENABLE
+    SPLIT_SLAVE_TASK_OLED,
+#    endif // OLED_ENABLE
+#    ifdef ST7565_ENABLE
+    SPLIT_SLAVE_TASK_ST7565,
+#    endif // ST7565_ENABLE
+    SPLIT_SLAVE_TASK_COUNT
+} split_slave_task_t;
+
+bool split_slave_task_gate(split_slave_task_t task);
+#endif // SPLIT_SLAVE_TASK_SCHEDULER
\ No newline at end of file
@@ -21,6 +21,10 @@ enum serial_transaction_id {
     I2C_EXECUTE_CALLBACK,
 #endif // USE_I2C
 
+#ifdef SPLIT_DELTA_SYNC
+    GET_SYNC_EPOCHS,
+#endif // SPLIT_DELTA_SYNC
+
     GET_SLAVE_MATRIX_CHECKSUM,
     GET_SLAVE_MATRIX_DATA,
 
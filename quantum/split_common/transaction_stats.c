@@ -0,0 +1,82 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "transaction_stats.h"
+#include "transaction_id_define.h"
+#include "benchmark.h"
+#include "print.h"
+
+// rtt_avg is stored scaled by 2^SPLIT_TRANSACTION_STATS_EWMA_SHIFT and
+// descaled on read, mirroring the task accounting module.
+static split_transaction_stats_t stats[NUM_TOTAL_TRANSACTIONS];
+
+void split_transaction_stats_record(int8_t transaction_id, uint32_t ticks, uint16_t bytes, bool okay) {
+    if (transaction_id < 0 || transaction_id >= NUM_TOTAL_TRANSACTIONS) {
+        return;
+    }
+
+    split_transaction_stats_t *entry = &stats[transaction_id];
+    entry->rtt_avg += ticks - (entry->rtt_avg >> SPLIT_TRANSACTION_STATS_EWMA_SHIFT);
+    if (ticks > entry->rtt_max) {
+        entry->rtt_max = ticks;
+    }
+    entry->bytes += bytes;
+    if (entry->executes < UINT16_MAX) {
+        entry->executes++;
+    }
+    if (!okay && entry->failures < UINT16_MAX) {
+        entry->failures++;
+    }
+}
+
+const split_transaction_stats_t *split_transaction_stats_get(int8_t transaction_id) {
+    if (transaction_id < 0 || transaction_id >= NUM_TOTAL_TRANSACTIONS) {
+        return NULL;
+    }
+    return &stats[transaction_id];
+}
+
+void split_transaction_stats_reset(void) {
+    for (uint8_t i = 0; i < NUM_TOTAL_TRANSACTIONS; i++) {
+        stats[i] = (split_transaction_stats_t){0};
+    }
+}
+
+void split_transaction_stats_dump(void) {
+    xprintf("split transaction stats (avg/max ticks, bytes, exec/fail):\n");
+    for (uint8_t i = 0; i < NUM_TOTAL_TRANSACTIONS; i++) {
+        if (stats[i].executes == 0) {
+            continue;
+        }
+        xprintf("%2u: %8lu/%8lu %8lu %5u/%u\n", i, (unsigned long)(stats[i].rtt_avg >> SPLIT_TRANSACTION_STATS_EWMA_SHIFT), (unsigned long)stats[i].rtt_max, (unsigned long)stats[i].bytes, stats[i].executes, stats[i].failures);
+    }
+}
+
+void split_transaction_stats_read_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    // One 16-byte record per transaction id, fields little-endian:
+    // [rtt_avg u32, rtt_max u32, bytes u32, executes u16, failures u16]
+    for (uint16_t i = 0; i < size; i++) {
+        uint16_t pos = offset + i;
+        uint8_t  id  = pos / 16;
+        if (id >= NUM_TOTAL_TRANSACTIONS) {
+            data[i] = 0x00;
+            continue;
+        }
+
+        uint8_t  within = pos % 16;
+        uint32_t word;
+        if (within < 4) {
+            word = stats[id].rtt_avg >> SPLIT_TRANSACTION_STATS_EWMA_SHIFT;
+        } else if (within < 8) {
+            word = stats[id].rtt_max;
+        } else if (within < 12) {
+            word = stats[id].bytes;
+        } else if (within < 14) {
+            word = stats[id].executes;
+        } else {
+            word = stats[id].failures;
+        }
+        uint8_t byte = (within < 12) ? (within % 4) : (within % 2);
+        data[i]      = (word >> (8 * byte)) & 0xFF;
+    }
+}
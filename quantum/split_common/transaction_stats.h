@@ -0,0 +1,66 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * \file
+ *
+ * \brief Per-transaction-ID statistics for the split transport.
+ *
+ * With `SPLIT_TRANSACTION_STATS_ENABLE = yes` every
+ * transport_execute_transaction() call is timed with the benchmark
+ * module's cycle counter and recorded against its transaction id:
+ * a smoothed (EWMA) and maximum round-trip time, total payload bytes
+ * moved, execution count and failure count. Failures include every
+ * attempt consumed by transaction_handler_master()'s retry loop, so a
+ * flaky link shows up as a high failure-to-execute ratio on the
+ * affected ids.
+ *
+ * The table can be dumped to the console with
+ * split_transaction_stats_dump(), and with `RAW_HID_STREAM_ENABLE` it
+ * is readable in bulk as a stream channel: one little-endian
+ * `[rtt_avg u32, rtt_max u32, bytes u32, executes u16, failures u16]`
+ * record per transaction id, in id order.
+ *
+ * Enabling this feature pulls in `BENCHMARK_ENABLE` for its calibrated
+ * cycle counter.
+ */
+
+typedef struct split_transaction_stats_t {
+    uint32_t rtt_avg; // EWMA, benchmark ticks
+    uint32_t rtt_max; // benchmark ticks
+    uint32_t bytes;   // total payload bytes moved
+    uint16_t executes;
+    uint16_t failures;
+} split_transaction_stats_t;
+
+// EWMA weight: new samples count 1/2^shift against the running average.
+#ifndef SPLIT_TRANSACTION_STATS_EWMA_SHIFT
+#    define SPLIT_TRANSACTION_STATS_EWMA_SHIFT 3
+#endif
+
+#ifdef SPLIT_TRANSACTION_STATS_ENABLE
+
+/* Record one executed transaction; called from the transport layer. */
+void split_transaction_stats_record(int8_t transaction_id, uint32_t ticks, uint16_t bytes, bool okay);
+
+/* Stats for one transaction id, or NULL if the id is out of range. */
+const split_transaction_stats_t *split_transaction_stats_get(int8_t transaction_id);
+
+void split_transaction_stats_reset(void);
+
+/* Prints the whole table to the console. */
+void split_transaction_stats_dump(void);
+
+/* Flattened little-endian table for the raw HID stream channel. */
+void split_transaction_stats_read_buffer(uint16_t offset, uint16_t size, uint8_t *data);
+
+#else
+
+#    define split_transaction_stats_record(transaction_id, ticks, bytes, okay)
+
+#endif
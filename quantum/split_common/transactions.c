@@ -26,6 +26,9 @@
 #include "transaction_id_define.h"
 #include "split_util.h"
 #include "synchronization_util.h"
+#ifdef TELEMETRY_COUNTERS_ENABLE
+#    include "telemetry_counters.h"
+#endif
 
 #define SYNC_TIMER_OFFSET 2
 
@@ -33,6 +36,31 @@
 #    define FORCED_SYNC_THROTTLE_MS 100
 #endif // FORCED_SYNC_THROTTLE_MS
 
+#ifdef SPLIT_SYNC_INTERVALS
+// Per-transaction-id override of the forced sync interval; 0 falls back to
+// FORCED_SYNC_THROTTLE_MS. Lets e.g. RGB/WPM sync run slower and matrix
+// sync faster without recompiling.
+static uint16_t sync_intervals[NUM_TOTAL_TRANSACTIONS];
+
+uint16_t split_sync_interval_get(int8_t transaction_id) {
+    if (transaction_id < 0 || transaction_id >= NUM_TOTAL_TRANSACTIONS || sync_intervals[transaction_id] == 0) {
+        return FORCED_SYNC_THROTTLE_MS;
+    }
+    return sync_intervals[transaction_id];
+}
+
+void split_sync_interval_set(int8_t transaction_id, uint16_t interval_ms) {
+    if (transaction_id < 0 || transaction_id >= NUM_TOTAL_TRANSACTIONS) {
+        return;
+    }
+    sync_intervals[transaction_id] = interval_ms;
+}
+
+#    define forced_sync_interval(id) split_sync_interval_get(id)
+#else
+#    define forced_sync_interval(id) (FORCED_SYNC_THROTTLE_MS)
+#endif // SPLIT_SYNC_INTERVALS
+
 #define sizeof_member(type, member) sizeof(((type *)NULL)->member)
 
 #define trans_initiator2target_initializer_cb(member, cb) \
@@ -59,6 +87,10 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
     int num_retries = is_transport_connected() ? 10 : 1;
     for (int iter = 1; iter <= num_retries; ++iter) {
         if (iter > 1) {
+#ifdef TELEMETRY_COUNTERS_ENABLE
+            // Each extra attempt means the previous one failed on the wire
+            telemetry_counters_note_split_retry();
+#endif
             for (int i = 0; i < iter * iter; ++i) {
                 wait_us(10);
             }
@@ -102,16 +134,22 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
         split_shared_memory_unlock();                         \
     } while (0)
 
-inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t trans_id_retrieve, uint32_t *last_update, void *destination, const void *equiv_shmem, size_t length) {
+// When `changed` is non-NULL it is set on a fresh validated read, and
+// `destination` is left untouched when nothing new was read - the caller is
+// expected to consume `destination` only when a change was flagged.
+inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t trans_id_retrieve, uint32_t *last_update, void *destination, const void *equiv_shmem, size_t length, bool *changed) {
     uint8_t curr_checksum;
     bool    okay = transport_read(trans_id_checksum, &curr_checksum, sizeof(curr_checksum));
-    if (okay && (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || curr_checksum != crc8(equiv_shmem, length))) {
+    if (okay && (timer_elapsed32(*last_update) >= forced_sync_interval(trans_id_retrieve) || curr_checksum != crc8(equiv_shmem, length))) {
         okay &= transport_read(trans_id_retrieve, destination, length);
         okay &= curr_checksum == crc8(equiv_shmem, length);
         if (okay) {
             *last_update = timer_read32();
+            if (changed) {
+                *changed = true;
+            }
         }
-    } else {
+    } else if (!changed) {
         memcpy(destination, equiv_shmem, length);
     }
     return okay;
@@ -119,7 +157,7 @@ inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t tr
 
 inline static bool send_if_condition(int8_t trans_id, uint32_t *last_update, bool condition, void *source, size_t length) {
     bool okay = true;
-    if (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || condition) {
+    if (timer_elapsed32(*last_update) >= forced_sync_interval(trans_id) || condition) {
         okay &= transport_write(trans_id, source, length);
         if (okay) {
             *last_update = timer_read32();
@@ -133,27 +171,99 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
     return send_if_condition(trans_id, last_update, (memcmp(source, equiv_shmem, length) != 0), source, length);
 }
 
+////////////////////////////////////////////////////
+// Sync epochs
+
+#ifdef SPLIT_DELTA_SYNC
+
+// Freshest slave-side epochs, fetched once per scan before any of the polled
+// transactions run.
+static split_sync_epochs_t remote_epochs;
+
+inline static void bump_sync_epoch(split_sync_epoch_t *epoch, uint8_t checksum) {
+    epoch->generation++;
+    epoch->checksum = checksum;
+}
+
+// `changed` carries the same contract as in read_if_checksum_mismatch above.
+inline static bool read_if_epoch_mismatch(int8_t trans_id_retrieve, const split_sync_epoch_t *epoch, uint8_t *last_generation, uint32_t *last_update, void *destination, const void *equiv_shmem, size_t length, bool *changed) {
+    bool okay = true;
+    if (timer_elapsed32(*last_update) >= forced_sync_interval(trans_id_retrieve) || epoch->generation != *last_generation) {
+        okay &= transport_read(trans_id_retrieve, destination, length);
+        okay &= epoch->checksum == crc8(equiv_shmem, length);
+        if (okay) {
+            *last_generation = epoch->generation;
+            *last_update     = timer_read32();
+            if (changed) {
+                *changed = true;
+            }
+        }
+    } else if (!changed) {
+        memcpy(destination, equiv_shmem, length);
+    }
+    return okay;
+}
+
+static bool sync_epochs_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    return transport_read(GET_SYNC_EPOCHS, &remote_epochs, sizeof(remote_epochs));
+}
+
+// The slave side has nothing to do here - the epochs are bumped by the
+// individual slave handlers whenever their field actually changed.
+
+#    define TRANSACTIONS_SYNC_EPOCHS_MASTER() TRANSACTION_HANDLER_MASTER(sync_epochs)
+#    define TRANSACTIONS_SYNC_EPOCHS_REGISTRATIONS [GET_SYNC_EPOCHS] = trans_target2initiator_initializer(sync_epochs),
+
+#else // SPLIT_DELTA_SYNC
+
+#    define TRANSACTIONS_SYNC_EPOCHS_MASTER()
+#    define TRANSACTIONS_SYNC_EPOCHS_REGISTRATIONS
+
+#endif // SPLIT_DELTA_SYNC
+
 ////////////////////////////////////////////////////
 // Slave matrix
 
-static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t     last_update                    = 0;
-    static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
-    matrix_row_t        temp_matrix[(MATRIX_ROWS) / 2];       // holding area while we test whether or not checksum is correct
+static bool slave_matrix_changed = false;
 
-    bool okay = read_if_checksum_mismatch(GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA, &last_update, temp_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
-    if (okay) {
-        // Checksum matches the received data, save as the last matrix state
-        memcpy(last_matrix, temp_matrix, sizeof(temp_matrix));
+bool transport_slave_matrix_changed(void) {
+    bool changed         = slave_matrix_changed;
+    slave_matrix_changed = false;
+    return changed;
+}
+
+static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint32_t last_update = 0;
+    matrix_row_t    temp_matrix[(MATRIX_ROWS) / 2]; // holding area while we test whether or not checksum is correct
+    bool            changed = false;
+
+#ifdef SPLIT_DELTA_SYNC
+    static uint8_t last_generation = 0;
+    bool           okay            = read_if_epoch_mismatch(GET_SLAVE_MATRIX_DATA, &remote_epochs.smatrix, &last_generation, &last_update, temp_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix), &changed);
+#else
+    bool okay = read_if_checksum_mismatch(GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA, &last_update, temp_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix), &changed);
+#endif
+    if (okay && changed) {
+        // Fresh validated data: write it straight into the live slave-half
+        // rows the caller passed in. When nothing was read those rows already
+        // hold the last-known-good state, so no copy or compare is needed.
+        memcpy(slave_matrix, temp_matrix, sizeof(temp_matrix));
+        slave_matrix_changed = true;
     }
-    // Copy out the last-known-good matrix state to the slave matrix
-    memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
     return okay;
 }
 
 static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+#ifdef SPLIT_DELTA_SYNC
+    if (memcmp(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix)) == 0) {
+        return;
+    }
+#endif
     memcpy(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix));
     split_shmem->smatrix.checksum = crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+#ifdef SPLIT_DELTA_SYNC
+    bump_sync_epoch(&split_shmem->sync_epochs.smatrix, split_shmem->smatrix.checksum);
+#endif
 }
 
 // clang-format off
@@ -200,7 +310,12 @@ static bool encoder_handlers_master(matrix_row_t master_matrix[], matrix_row_t s
     static uint32_t last_update = 0;
     uint8_t         temp_state[NUM_ENCODERS_MAX_PER_SIDE];
 
-    bool okay = read_if_checksum_mismatch(GET_ENCODERS_CHECKSUM, GET_ENCODERS_DATA, &last_update, temp_state, split_shmem->encoders.state, sizeof(temp_state));
+#    ifdef SPLIT_DELTA_SYNC
+    static uint8_t last_generation = 0;
+    bool           okay            = read_if_epoch_mismatch(GET_ENCODERS_DATA, &remote_epochs.encoders, &last_generation, &last_update, temp_state, split_shmem->encoders.state, sizeof(temp_state), NULL);
+#    else
+    bool okay = read_if_checksum_mismatch(GET_ENCODERS_CHECKSUM, GET_ENCODERS_DATA, &last_update, temp_state, split_shmem->encoders.state, sizeof(temp_state), NULL);
+#    endif
     if (okay) encoder_update_raw(temp_state);
     return okay;
 }
@@ -208,10 +323,18 @@ static bool encoder_handlers_master(matrix_row_t master_matrix[], matrix_row_t s
 static void encoder_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     uint8_t encoder_state[NUM_ENCODERS_MAX_PER_SIDE];
     encoder_state_raw(encoder_state);
+#    ifdef SPLIT_DELTA_SYNC
+    if (memcmp(split_shmem->encoders.state, encoder_state, sizeof(encoder_state)) == 0) {
+        return;
+    }
+#    endif
     // Always prepare the encoder state for read.
     memcpy(split_shmem->encoders.state, encoder_state, sizeof(encoder_state));
     // Now update the checksum given that the encoders has been written to
     split_shmem->encoders.checksum = crc8(encoder_state, sizeof(encoder_state));
+#    ifdef SPLIT_DELTA_SYNC
+    bump_sync_epoch(&split_shmem->sync_epochs.encoders, split_shmem->encoders.checksum);
+#    endif
 }
 
 // clang-format off
@@ -235,15 +358,36 @@ static void encoder_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sl
 
 #ifndef DISABLE_SYNC_TIMER
 
+// The slave drift-corrects between updates (see sync_timer.c), so the
+// timestamp only needs to go out often enough to keep the drift estimate
+// fresh, not every forced-sync interval. The first few updates after
+// link-up go out at a faster cadence to converge the slave's drift
+// estimate before dropping to the steady-state interval.
+#    ifndef SYNC_TIMER_UPDATE_INTERVAL_MS
+#        define SYNC_TIMER_UPDATE_INTERVAL_MS 5000
+#    endif
+#    ifndef SYNC_TIMER_WARMUP_UPDATES
+#        define SYNC_TIMER_WARMUP_UPDATES 8
+#    endif
+#    ifndef SYNC_TIMER_WARMUP_INTERVAL_MS
+#        define SYNC_TIMER_WARMUP_INTERVAL_MS 500
+#    endif
+
 static bool sync_timer_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update = 0;
+    static uint32_t last_update  = 0;
+    static uint8_t  updates_sent = 0;
+
+    const uint32_t interval = updates_sent < SYNC_TIMER_WARMUP_UPDATES ? SYNC_TIMER_WARMUP_INTERVAL_MS : SYNC_TIMER_UPDATE_INTERVAL_MS;
 
     bool okay = true;
-    if (timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS) {
+    if (timer_elapsed32(last_update) >= interval) {
         uint32_t sync_timer = sync_timer_read32() + SYNC_TIMER_OFFSET;
         okay &= transport_write(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer));
         if (okay) {
             last_update = timer_read32();
+            if (updates_sent < SYNC_TIMER_WARMUP_UPDATES) {
+                updates_sent++;
+            }
         }
     }
     return okay;
@@ -341,7 +485,7 @@ static void led_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 
 static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t   last_update    = 0;
-    bool              mods_need_sync = timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS;
+    bool              mods_need_sync = timer_elapsed32(last_update) >= forced_sync_interval(PUT_MODS);
     split_mods_sync_t new_mods;
     new_mods.real_mods = get_mods();
     if (!mods_need_sync && new_mods.real_mods != split_shmem->mods.real_mods) {
@@ -653,7 +797,12 @@ static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t
     static uint16_t last_cpi    = 0;
     report_mouse_t  temp_state;
     uint16_t        temp_cpi;
-    bool            okay = read_if_checksum_mismatch(GET_POINTING_CHECKSUM, GET_POINTING_DATA, &last_update, &temp_state, &split_shmem->pointing.report, sizeof(temp_state));
+#    ifdef SPLIT_DELTA_SYNC
+    static uint8_t last_generation = 0;
+    bool           okay            = read_if_epoch_mismatch(GET_POINTING_DATA, &remote_epochs.pointing, &last_generation, &last_update, &temp_state, &split_shmem->pointing.report, sizeof(temp_state), NULL);
+#    else
+    bool            okay = read_if_checksum_mismatch(GET_POINTING_CHECKSUM, GET_POINTING_DATA, &last_update, &temp_state, &split_shmem->pointing.report, sizeof(temp_state), NULL);
+#    endif
     if (okay) pointing_device_set_shared_report(temp_state);
     temp_cpi = pointing_device_get_shared_cpi();
     if (temp_cpi && last_cpi != temp_cpi) {
@@ -702,6 +851,11 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
     pointing.checksum = crc8(&pointing.report, sizeof(report_mouse_t));
 
     split_shared_memory_lock();
+#    ifdef SPLIT_DELTA_SYNC
+    if (memcmp(&split_shmem->pointing.report, &pointing.report, sizeof(pointing.report)) != 0) {
+        bump_sync_epoch(&split_shmem->sync_epochs.pointing, pointing.checksum);
+    }
+#    endif
     memcpy(&split_shmem->pointing, &pointing, sizeof(split_slave_pointing_sync_t));
     split_shared_memory_unlock();
 }
@@ -801,6 +955,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 #endif // USE_I2C
 
     // clang-format off
+    TRANSACTIONS_SYNC_EPOCHS_REGISTRATIONS
     TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS
     TRANSACTIONS_MASTER_MATRIX_REGISTRATIONS
     TRANSACTIONS_ENCODERS_REGISTRATIONS
@@ -829,6 +984,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 };
 
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    TRANSACTIONS_SYNC_EPOCHS_MASTER();
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
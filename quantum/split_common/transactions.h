@@ -47,6 +47,13 @@ void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[
 
 void transaction_register_rpc(int8_t transaction_id, slave_callback_t callback);
 
+#ifdef SPLIT_SYNC_INTERVALS
+// Per-transaction-id override of the forced sync interval on the master;
+// an interval of 0 restores the FORCED_SYNC_THROTTLE_MS default.
+uint16_t split_sync_interval_get(int8_t transaction_id);
+void     split_sync_interval_set(int8_t transaction_id, uint16_t interval_ms);
+#endif // SPLIT_SYNC_INTERVALS
+
 bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
 
 #define transaction_rpc_send(transaction_id, initiator2target_buffer_size, initiator2target_buffer) transaction_rpc_exec(transaction_id, initiator2target_buffer_size, initiator2target_buffer, 0, NULL)
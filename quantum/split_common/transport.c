@@ -21,6 +21,12 @@
 #include "transport.h"
 #include "transaction_id_define.h"
 #include "atomic_util.h"
+#include "synchronization_util.h"
+#include "transaction_stats.h"
+
+#ifdef SPLIT_TRANSACTION_STATS_ENABLE
+#    include "benchmark.h"
+#endif
 
 #ifdef USE_I2C
 
@@ -59,7 +65,7 @@ i2c_status_t transport_trigger_callback(int8_t id) {
     return i2c_writeReg(SLAVE_I2C_ADDRESS, trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size, SLAVE_I2C_TIMEOUT);
 }
 
-bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+static bool transport_execute_transaction_impl(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
     i2c_status_t              status;
     split_transaction_desc_t *trans = &split_transaction_table[id];
     if (initiator2target_length > 0) {
@@ -86,6 +92,43 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
     return true;
 }
 
+#elif defined(SPLIT_LINK_DRIVER)
+
+static split_shared_memory_t shared_memory;
+split_shared_memory_t *const split_shmem = &shared_memory;
+
+void transport_master_init(void) {
+    split_link_driver.master_init();
+}
+void transport_slave_init(void) {
+    split_link_driver.slave_init();
+}
+
+static bool transport_execute_transaction_impl(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    if (initiator2target_length > 0) {
+        size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
+        // Link drivers may snapshot the shared memory from a background
+        // thread, so buffer accesses have to hold the lock.
+        split_shared_memory_lock();
+        memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, len);
+        split_shared_memory_unlock();
+    }
+
+    if (!split_link_driver.transaction(id)) {
+        return false;
+    }
+
+    if (target2initiator_length > 0) {
+        size_t len = trans->target2initiator_buffer_size < target2initiator_length ? trans->target2initiator_buffer_size : target2initiator_length;
+        split_shared_memory_lock();
+        memcpy(target2initiator_buf, split_trans_target2initiator_buffer(trans), len);
+        split_shared_memory_unlock();
+    }
+
+    return true;
+}
+
 #else // USE_I2C
 
 #    include "serial.h"
@@ -100,11 +143,15 @@ void transport_slave_init(void) {
     soft_serial_target_init();
 }
 
-bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+static bool transport_execute_transaction_impl(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
     split_transaction_desc_t *trans = &split_transaction_table[id];
     if (initiator2target_length > 0) {
         size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
+        // Streaming serial transports snapshot the shared memory from a
+        // background thread, so buffer accesses have to hold the lock.
+        split_shared_memory_lock();
         memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, len);
+        split_shared_memory_unlock();
     }
 
     if (!soft_serial_transaction(id)) {
@@ -113,7 +160,9 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 
     if (target2initiator_length > 0) {
         size_t len = trans->target2initiator_buffer_size < target2initiator_length ? trans->target2initiator_buffer_size : target2initiator_length;
+        split_shared_memory_lock();
         memcpy(target2initiator_buf, split_trans_target2initiator_buffer(trans), len);
+        split_shared_memory_unlock();
     }
 
     return true;
@@ -121,6 +170,17 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 
 #endif // USE_I2C
 
+bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+#ifdef SPLIT_TRANSACTION_STATS_ENABLE
+    uint32_t start = benchmark_timestamp();
+    bool     okay  = transport_execute_transaction_impl(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+    split_transaction_stats_record(id, benchmark_timestamp() - start, initiator2target_length + target2initiator_length, okay);
+    return okay;
+#else
+    return transport_execute_transaction_impl(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+#endif
+}
+
 bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     return transactions_master(master_matrix, slave_matrix);
 }
@@ -38,6 +38,10 @@ void transport_slave_init(void);
 bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 
+// whether the last transport_master round wrote fresh data into the slave
+// matrix rows; reading clears the flag
+bool transport_slave_matrix_changed(void);
+
 bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length);
 
 #ifdef ENCODER_ENABLE
@@ -57,6 +61,25 @@ typedef struct _split_slave_matrix_sync_t {
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
 } split_slave_matrix_sync_t;
 
+#ifdef SPLIT_DELTA_SYNC
+typedef struct _split_sync_epoch_t {
+    uint8_t generation;
+    uint8_t checksum;
+} split_sync_epoch_t;
+
+// One epoch per polled field, so that the master can detect all changes with a
+// single compact read instead of one checksum round trip per field.
+typedef struct _split_sync_epochs_t {
+    split_sync_epoch_t smatrix;
+#    ifdef ENCODER_ENABLE
+    split_sync_epoch_t encoders;
+#    endif // ENCODER_ENABLE
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    split_sync_epoch_t pointing;
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+} split_sync_epochs_t;
+#endif // SPLIT_DELTA_SYNC
+
 #ifdef SPLIT_TRANSPORT_MIRROR
 typedef struct _split_master_matrix_sync_t {
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
@@ -140,6 +163,10 @@ typedef struct _split_shared_memory_t {
 
     split_slave_matrix_sync_t smatrix;
 
+#ifdef SPLIT_DELTA_SYNC
+    split_sync_epochs_t sync_epochs;
+#endif // SPLIT_DELTA_SYNC
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     split_master_matrix_sync_t mmatrix;
 #endif // SPLIT_TRANSPORT_MIRROR
@@ -212,3 +239,21 @@ typedef struct _split_shared_memory_t {
 } split_shared_memory_t;
 
 extern split_shared_memory_t *const split_shmem;
+
+#ifdef SPLIT_LINK_DRIVER
+/* Board-supplied link driver (`SPLIT_TRANSPORT = driver`): the shared memory
+ * layout, transaction table and sync logic above stay in place, and only the
+ * physical link is delegated. `transaction` moves the buffers of the given
+ * transaction id between the halves (initiator-to-target before the slave
+ * callback runs, target-to-initiator after) and returns false on a link
+ * error. Drivers backed by a background thread must take
+ * split_shared_memory_lock() around shared memory accesses, as the serial
+ * transports do. */
+typedef struct split_link_driver_t {
+    void (*master_init)(void);
+    void (*slave_init)(void);
+    bool (*transaction)(int8_t id);
+} split_link_driver_t;
+
+extern const split_link_driver_t split_link_driver;
+#endif // SPLIT_LINK_DRIVER
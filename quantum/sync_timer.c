@@ -27,15 +27,77 @@ SOFTWARE.
 #include "keyboard.h"
 
 #if defined(SPLIT_KEYBOARD) && !defined(DISABLE_SYNC_TIMER)
-volatile int32_t sync_timer_ms;
+/* The slave's clock is steered, not just snapped: successive master
+ * timestamps feed an estimate of the relative drift between the halves'
+ * crystals, and reads extrapolate along that rate. Between updates the
+ * clocks then diverge by the drift estimate's error rather than the full
+ * crystal mismatch, which is what allows the sync packet to be sent at
+ * SYNC_TIMER_UPDATE_INTERVAL_MS instead of every forced-sync throttle.
+ *
+ * The loop is a two-gain PLL: the phase error also feeds the offset with
+ * gain 1/2 rather than replacing it outright, so per-packet transport
+ * latency jitter is halved instead of stepping the clock. Only a phase
+ * error beyond SYNC_TIMER_SNAP_THRESHOLD_MS - a reconnect, a master
+ * reboot - snaps the offset. */
+
+// Drift is kept in ms per 2^20 ms, i.e. roughly parts per million.
+#    define SYNC_TIMER_DRIFT_SHIFT 20
+// Crystals are within a few hundred ppm of each other; anything larger is
+// measurement noise from transport latency jitter.
+#    define SYNC_TIMER_DRIFT_LIMIT (1L << 12)
+// Phase error beyond which the clock snaps instead of slewing.
+#    ifndef SYNC_TIMER_SNAP_THRESHOLD_MS
+#        define SYNC_TIMER_SNAP_THRESHOLD_MS 50
+#    endif
+// Minimum baseline for a drift measurement. Timestamps are whole
+// milliseconds, so over a short interval the quantization error alone
+// reads as thousands of ppm; below this, updates correct phase only.
+#    define SYNC_TIMER_DRIFT_MIN_ELAPSED_MS 1000
+
+static volatile int32_t  sync_offset_ms;  // master time minus local time at last update
+static volatile uint32_t sync_local_last; // local timer at last update
+static volatile int32_t  sync_drift;      // filtered drift estimate
+static volatile bool     sync_valid;
 
 void sync_timer_init(void) {
-    sync_timer_ms = 0;
+    sync_offset_ms  = 0;
+    sync_local_last = 0;
+    sync_drift      = 0;
+    sync_valid      = false;
+}
+
+static int32_t sync_timer_offset(uint32_t local) {
+    return sync_offset_ms + (int32_t)(((int64_t)sync_drift * (int32_t)(local - sync_local_last)) >> SYNC_TIMER_DRIFT_SHIFT);
 }
 
 void sync_timer_update(uint32_t time) {
     if (is_keyboard_master()) return;
-    sync_timer_ms = time - timer_read32();
+    uint32_t local      = timer_read32();
+    int32_t  raw_offset = (int32_t)(time - local);
+    int32_t  predicted  = sync_timer_offset(local);
+    int32_t  error      = raw_offset - predicted;
+    if (sync_valid && error <= SYNC_TIMER_SNAP_THRESHOLD_MS && error >= -SYNC_TIMER_SNAP_THRESHOLD_MS) {
+        int32_t elapsed = (int32_t)(local - sync_local_last);
+        if (elapsed >= SYNC_TIMER_DRIFT_MIN_ELAPSED_MS) {
+            /* Phase error between the steered clock and the master's
+             * timestamp; fold it into the drift estimate (EWMA, gain 1/4)
+             * so the residual shrinks instead of repeating every update. */
+            int32_t measured = sync_drift + (int32_t)(((int64_t)error << SYNC_TIMER_DRIFT_SHIFT) / elapsed);
+            if (measured > SYNC_TIMER_DRIFT_LIMIT) measured = SYNC_TIMER_DRIFT_LIMIT;
+            if (measured < -SYNC_TIMER_DRIFT_LIMIT) measured = -SYNC_TIMER_DRIFT_LIMIT;
+            sync_drift += (measured - sync_drift) >> 2;
+        }
+        /* Rebase the offset to the new epoch along the steered clock and
+         * apply only half the phase error, so a single jittery packet moves
+         * the clock by at most error/2 rather than the full transport
+         * latency excursion. */
+        sync_offset_ms = predicted + (error / 2);
+    } else {
+        // First update, or a phase jump (reconnect, master reboot): snap.
+        sync_offset_ms = raw_offset;
+    }
+    sync_local_last = local;
+    sync_valid      = true;
 }
 
 uint16_t sync_timer_read(void) {
@@ -45,7 +107,8 @@ uint16_t sync_timer_read(void) {
 
 uint32_t sync_timer_read32(void) {
     if (is_keyboard_master()) return timer_read32();
-    return sync_timer_ms + timer_read32();
+    uint32_t local = timer_read32();
+    return (uint32_t)(local + sync_timer_offset(local));
 }
 
 uint16_t sync_timer_elapsed(uint16_t last) {
@@ -0,0 +1,52 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "table_compression.h"
+
+uint8_t compressed_table_read(const compressed_table_t *table, uint16_t index) {
+    static const compressed_table_t *cached_table = NULL;
+    static uint16_t                  cached_block = 0;
+    static uint8_t                   cache[TABLE_COMPRESSION_BLOCK_SIZE];
+
+    if (index >= table->length) {
+        return 0;
+    }
+
+    uint16_t block = index / TABLE_COMPRESSION_BLOCK_SIZE;
+    if (table != cached_table || block != cached_block) {
+        const uint8_t *stream = table->data + pgm_read_word(&table->block_offsets[block]);
+        uint16_t       first  = block * TABLE_COMPRESSION_BLOCK_SIZE;
+        uint8_t        count  = (table->length - first < TABLE_COMPRESSION_BLOCK_SIZE) ? (uint8_t)(table->length - first) : TABLE_COMPRESSION_BLOCK_SIZE;
+
+        uint8_t value = pgm_read_byte(stream++);
+        cache[0]      = value;
+
+        // Unpack the delta nibble stream, low nibble first; nibble 15 adds
+        // 15 and continues into the next nibble.
+        uint8_t packed    = 0;
+        bool    high_half = false;
+        for (uint8_t i = 1; i < count; i++) {
+            uint8_t delta = 0;
+            uint8_t nibble;
+            do {
+                if (high_half) {
+                    nibble = packed >> 4;
+                } else {
+                    packed = pgm_read_byte(stream++);
+                    nibble = packed & 0x0F;
+                }
+                high_half = !high_half;
+                delta += nibble;
+            } while (nibble == 0x0F);
+            value += delta;
+            cache[i] = value;
+        }
+
+        cached_table = table;
+        cached_block = block;
+    }
+    return cache[index % TABLE_COMPRESSION_BLOCK_SIZE];
+}
@@ -0,0 +1,38 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+#include "progmem.h"
+
+/**
+ * \file
+ *
+ * \brief Flash-resident compressed lookup tables.
+ *
+ * Monotonic uint8 tables (lightness curves, effect ramps, ...) compress
+ * well as deltas: each block of `TABLE_COMPRESSION_BLOCK_SIZE` entries is
+ * stored as one absolute anchor byte followed by packed 4-bit deltas,
+ * with nibble 15 acting as a continuation for larger steps. A 256-entry
+ * curve typically shrinks to a little over half its size.
+ *
+ * compressed_table_read() decompresses on demand through a single
+ * block-sized RAM cache, so sequential and locality-friendly access
+ * patterns (brightness ramps, animation sweeps) pay the decode cost once
+ * per block. Tables are generated offline with `util/table_compress.py`.
+ */
+
+#ifndef TABLE_COMPRESSION_BLOCK_SIZE
+#    define TABLE_COMPRESSION_BLOCK_SIZE 64
+#endif
+
+typedef struct compressed_table_t {
+    const uint8_t * data;          // PROGMEM: concatenated per-block delta streams
+    const uint16_t *block_offsets; // PROGMEM: offset of each block inside `data`
+    uint16_t        length;        // number of entries in the original table
+} compressed_table_t;
+
+/* Entry at `index`, or 0 when out of range. */
+uint8_t compressed_table_read(const compressed_table_t *table, uint16_t index);
@@ -0,0 +1,98 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "task_accounting.h"
+#include "benchmark.h"
+#include "debug.h"
+#include "print.h"
+#include "timer.h"
+
+typedef struct task_accounting_entry_t {
+    uint32_t ewma; // scaled by 2^TASK_ACCOUNTING_EWMA_SHIFT
+    uint32_t max;
+} task_accounting_entry_t;
+
+static task_accounting_entry_t entries[TASK_ACCT_COUNT];
+static uint32_t                begin_stamp;
+
+static const char *task_accounting_names[TASK_ACCT_COUNT] = {
+    [TASK_ACCT_MATRIX]          = "matrix",
+    [TASK_ACCT_QUANTUM]         = "quantum",
+    [TASK_ACCT_RGBLIGHT]        = "rgblight",
+    [TASK_ACCT_LED_MATRIX]      = "led_matrix",
+    [TASK_ACCT_RGB_MATRIX]      = "rgb_matrix",
+    [TASK_ACCT_ENCODER]         = "encoder",
+    [TASK_ACCT_OLED]            = "oled",
+    [TASK_ACCT_ST7565]          = "st7565",
+    [TASK_ACCT_MOUSEKEY]        = "mousekey",
+    [TASK_ACCT_POINTING_DEVICE] = "pointing_device",
+    [TASK_ACCT_MIDI]            = "midi",
+    [TASK_ACCT_JOYSTICK]        = "joystick",
+    [TASK_ACCT_BLUETOOTH]       = "bluetooth",
+    [TASK_ACCT_RADIO]           = "radio",
+};
+
+void task_accounting_begin(uint8_t id) {
+    (void)id; // tasks don't nest; one running sample is enough
+    begin_stamp = benchmark_timestamp();
+}
+
+void task_accounting_end(uint8_t id) {
+    uint32_t delta = benchmark_timestamp() - begin_stamp;
+    if (id >= TASK_ACCT_COUNT) {
+        return;
+    }
+
+    task_accounting_entry_t *entry = &entries[id];
+    entry->ewma += delta - (entry->ewma >> TASK_ACCOUNTING_EWMA_SHIFT);
+    if (delta > entry->max) {
+        entry->max = delta;
+    }
+}
+
+uint32_t task_accounting_get_avg(uint8_t id) {
+    return id < TASK_ACCT_COUNT ? entries[id].ewma >> TASK_ACCOUNTING_EWMA_SHIFT : 0;
+}
+
+uint32_t task_accounting_get_max(uint8_t id) {
+    return id < TASK_ACCT_COUNT ? entries[id].max : 0;
+}
+
+void task_accounting_reset(void) {
+    for (uint8_t i = 0; i < TASK_ACCT_COUNT; i++) {
+        entries[i].ewma = 0;
+        entries[i].max  = 0;
+    }
+}
+
+void task_accounting_dump(void) {
+    xprintf("task accounting (ticks, %lu/s):\n", benchmark_ticks_per_sec());
+    for (uint8_t i = 0; i < TASK_ACCT_COUNT; i++) {
+        if (entries[i].max == 0) {
+            continue; // never ran; feature likely not enabled
+        }
+        xprintf("  %-16s avg %9lu max %9lu\n", task_accounting_names[i], task_accounting_get_avg(i), entries[i].max);
+    }
+}
+
+void task_accounting_task(void) {
+    static uint32_t last_dump = 0;
+    if (debug_enable && timer_elapsed32(last_dump) >= TASK_ACCOUNTING_DUMP_INTERVAL) {
+        last_dump = timer_read32();
+        task_accounting_dump();
+    }
+}
+
+void task_accounting_read_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    for (uint16_t i = 0; i < size; i++) {
+        uint16_t pos = offset + i;
+        uint8_t  id  = pos / 8;
+        if (id >= TASK_ACCT_COUNT) {
+            data[i] = 0x00;
+            continue;
+        }
+        uint8_t  within = pos % 8;
+        uint32_t value  = within < 4 ? task_accounting_get_avg(id) : entries[id].max;
+        data[i]         = (value >> (8 * (within % 4))) & 0xFF;
+    }
+}
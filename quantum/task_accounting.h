@@ -0,0 +1,80 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * \file
+ *
+ * \brief Per-subsystem CPU accounting for keyboard_task().
+ *
+ * With `TASK_ACCOUNTING_ENABLE = yes`, keyboard_task() samples the
+ * benchmark module's cycle counter around each subsystem task it calls
+ * and maintains a smoothed average (EWMA) and maximum per subsystem, so
+ * a tanking scan rate can be attributed without bisecting features.
+ *
+ * The table is dumped to the console every `TASK_ACCOUNTING_DUMP_INTERVAL`
+ * milliseconds while debug is enabled (alongside the scan rate print), or
+ * on demand with `task_accounting_dump()`. With `RAW_HID_STREAM_ENABLE`
+ * it is also readable in bulk as a stream channel: one little-endian
+ * `[avg, max]` pair of uint32 ticks per subsystem, in enum order.
+ *
+ * Enabling this feature pulls in `BENCHMARK_ENABLE` for its calibrated
+ * cycle counter.
+ */
+
+enum task_accounting_id {
+    TASK_ACCT_MATRIX, // includes debounce and key event processing
+    TASK_ACCT_QUANTUM,
+    TASK_ACCT_RGBLIGHT,
+    TASK_ACCT_LED_MATRIX,
+    TASK_ACCT_RGB_MATRIX,
+    TASK_ACCT_ENCODER,
+    TASK_ACCT_OLED,
+    TASK_ACCT_ST7565,
+    TASK_ACCT_MOUSEKEY,
+    TASK_ACCT_POINTING_DEVICE,
+    TASK_ACCT_MIDI,
+    TASK_ACCT_JOYSTICK,
+    TASK_ACCT_BLUETOOTH,
+    TASK_ACCT_RADIO,
+    TASK_ACCT_COUNT
+};
+
+#ifndef TASK_ACCOUNTING_DUMP_INTERVAL
+#    define TASK_ACCOUNTING_DUMP_INTERVAL 5000
+#endif
+
+// EWMA weight: new samples count 1/2^shift against the running average.
+#ifndef TASK_ACCOUNTING_EWMA_SHIFT
+#    define TASK_ACCOUNTING_EWMA_SHIFT 3
+#endif
+
+#ifdef TASK_ACCOUNTING_ENABLE
+
+void task_accounting_begin(uint8_t id);
+void task_accounting_end(uint8_t id);
+
+/* Smoothed/maximum observed ticks for one subsystem. */
+uint32_t task_accounting_get_avg(uint8_t id);
+uint32_t task_accounting_get_max(uint8_t id);
+void     task_accounting_reset(void);
+
+/* Prints the whole table to the console. */
+void task_accounting_dump(void);
+
+/* Periodic debug dump; called from keyboard_task(). */
+void task_accounting_task(void);
+
+/* Flattened little-endian table for the raw HID stream channel. */
+void task_accounting_read_buffer(uint16_t offset, uint16_t size, uint8_t *data);
+
+#else
+
+#    define task_accounting_begin(id)
+#    define task_accounting_end(id)
+#    define task_accounting_task()
+
+#endif
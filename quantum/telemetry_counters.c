@@ -0,0 +1,150 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include <stddef.h>
+
+#include "telemetry_counters.h"
+#include "eeconfig.h"
+#include "eeprom.h"
+#include "timer.h"
+#include "crc.h"
+
+#ifdef RAW_ENABLE
+#    include "raw_hid.h"
+#endif
+
+// eeconfig.h reserves the slot ring with a hard-coded slot size so it does
+// not have to pull in this header; keep the struct in sync with it.
+_Static_assert(sizeof(telemetry_counters_t) == EECONFIG_TELEMETRY_COUNTERS_SLOT_SIZE, "telemetry_counters_t no longer matches the eeconfig slot size");
+
+static telemetry_counters_t counters;
+static uint8_t              next_slot            = 0;
+static uint16_t             scan_residual        = 0; // scans not yet folded into scan_count_k
+static uint32_t             minute_mark          = 0; // when the last uptime minute was credited
+static uint32_t             last_checkpoint_time = 0;
+
+static uint8_t *slot_address(uint8_t slot) {
+    return EECONFIG_TELEMETRY_COUNTERS + (uint16_t)slot * sizeof(telemetry_counters_t);
+}
+
+static bool slot_read(uint8_t slot, telemetry_counters_t *out) {
+    eeprom_read_block(out, slot_address(slot), sizeof(*out));
+    // Erased EEPROM reads as all-ones, which fails both checks
+    return out->sequence != UINT32_MAX && out->crc == crc8(out, offsetof(telemetry_counters_t, crc));
+}
+
+void telemetry_counters_init(void) {
+    telemetry_counters_t slot_data;
+    bool                 found = false;
+
+    for (uint8_t slot = 0; slot < TELEMETRY_COUNTERS_SLOTS; slot++) {
+        if (slot_read(slot, &slot_data) && (!found || slot_data.sequence > counters.sequence)) {
+            counters  = slot_data;
+            next_slot = (slot + 1) % TELEMETRY_COUNTERS_SLOTS;
+            found     = true;
+        }
+    }
+    if (!found) {
+        memset(&counters, 0, sizeof(counters));
+    }
+    last_checkpoint_time = timer_read32();
+}
+
+void telemetry_counters_checkpoint(void) {
+    counters.sequence++;
+    counters.crc = crc8(&counters, offsetof(telemetry_counters_t, crc));
+    eeprom_update_block(&counters, slot_address(next_slot), sizeof(counters));
+    next_slot            = (next_slot + 1) % TELEMETRY_COUNTERS_SLOTS;
+    last_checkpoint_time = timer_read32();
+}
+
+void telemetry_counters_reset(void) {
+    uint32_t sequence = counters.sequence;
+    memset(&counters, 0, sizeof(counters));
+    counters.sequence = sequence;
+    scan_residual     = 0;
+    telemetry_counters_checkpoint();
+}
+
+void telemetry_counters_task(void) {
+    static uint32_t last_pass_time = 0;
+
+    const uint32_t now = timer_read32();
+    if (last_pass_time != 0) {
+        const uint32_t delta = now - last_pass_time;
+        if (delta > counters.max_loop_ms) {
+            counters.max_loop_ms = delta > UINT16_MAX ? UINT16_MAX : delta;
+        }
+    }
+    last_pass_time = now;
+
+    if (++scan_residual == 1024) {
+        counters.scan_count_k++;
+        scan_residual = 0;
+    }
+
+    while (now - minute_mark >= 60000) {
+        minute_mark += 60000;
+        counters.uptime_minutes++;
+    }
+
+    if (now - last_checkpoint_time >= TELEMETRY_COUNTERS_CHECKPOINT_MS) {
+        telemetry_counters_checkpoint();
+    }
+}
+
+void telemetry_counters_note_debounce_event(void) {
+    counters.debounce_events++;
+}
+
+void telemetry_counters_note_split_retry(void) {
+    counters.split_retries++;
+}
+
+void telemetry_counters_note_i2c_error(void) {
+    counters.i2c_errors++;
+}
+
+const telemetry_counters_t *telemetry_counters_get(void) {
+    return &counters;
+}
+
+bool telemetry_counters_raw_hid_command(uint8_t *data, uint8_t length) {
+    if (length < 2 || data[0] != TELEMETRY_COUNTERS_HID_COMMAND) {
+        return false;
+    }
+
+    switch (data[1]) {
+        case 0x00: // read the live counters
+            break;
+        case 0x01: // checkpoint now, then read
+            telemetry_counters_checkpoint();
+            break;
+        case 0xFF: // zero the counters
+            telemetry_counters_reset();
+            break;
+        default:
+            return false;
+    }
+
+    if (length >= 2 + sizeof(telemetry_counters_t)) {
+        memcpy(&data[2], &counters, sizeof(telemetry_counters_t));
+        memset(&data[2 + sizeof(telemetry_counters_t)], 0, length - 2 - sizeof(telemetry_counters_t));
+    }
+
+#ifdef RAW_ENABLE
+    raw_hid_send(data, length);
+#endif
+    return true;
+}
+
+#if defined(RAW_ENABLE) && !defined(VIA_ENABLE) && !defined(RAW_HID_STREAM_ENABLE) && !defined(LATENCY_HISTOGRAM_ENABLE) && !defined(EVENT_TRACE_ENABLE)
+// Keyboards with their own raw HID protocol override this and forward
+// matching packets to telemetry_counters_raw_hid_command() themselves. When
+// the latency histogram, event trace, VIA, or the raw HID stream owns the
+// endpoint, its dispatch forwards telemetry queries here instead.
+__attribute__((weak)) void raw_hid_receive(uint8_t *data, uint8_t length) {
+    telemetry_counters_raw_hid_command(data, length);
+}
+#endif
@@ -0,0 +1,75 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * \file
+ *
+ * \brief Cumulative profiling counters persisted across reboots.
+ *
+ * With `TELEMETRY_COUNTERS_ENABLE = yes`, a small set of lifetime counters
+ * (matrix scans, post-debounce key events, split link retries, I2C errors,
+ * worst main loop pass) accumulates in RAM and is checkpointed to EEPROM
+ * every `TELEMETRY_COUNTERS_CHECKPOINT_MS` (hourly by default) and on clean
+ * shutdown. Checkpoints rotate through `TELEMETRY_COUNTERS_SLOTS`
+ * CRC8-validated slots, so no single EEPROM cell takes every write and a
+ * checkpoint interrupted by power loss falls back to the previous one.
+ *
+ * Host access goes over raw HID with the same conventions as the latency
+ * histogram: a request whose first byte is `TELEMETRY_COUNTERS_HID_COMMAND`
+ * is answered in place with the live counter snapshot. Fleet tooling polls
+ * this to spot boards that are degrading -- chattering switches, retrying
+ * split links -- before their users notice.
+ */
+
+#ifndef TELEMETRY_COUNTERS_CHECKPOINT_MS
+#    define TELEMETRY_COUNTERS_CHECKPOINT_MS 3600000UL
+#endif
+
+#ifndef TELEMETRY_COUNTERS_HID_COMMAND
+#    define TELEMETRY_COUNTERS_HID_COMMAND 0x7D
+#endif
+
+// One checkpoint slot. Serialized verbatim (little-endian) both into EEPROM
+// and into HID response packets, so layout changes are protocol changes.
+typedef struct telemetry_counters_t {
+    uint32_t sequence;        // checkpoint sequence number; the newest valid slot wins at boot
+    uint32_t uptime_minutes;  // cumulative powered-on time
+    uint32_t scan_count_k;    // matrix scans, in units of 1024
+    uint32_t debounce_events; // post-debounce key state changes
+    uint32_t split_retries;   // transaction_handler_master retry attempts
+    uint32_t i2c_errors;      // failed I2C transactions
+    uint16_t max_loop_ms;     // worst observed main loop pass, in milliseconds
+    uint8_t  reserved;
+    uint8_t  crc;             // crc8 over the preceding bytes
+} telemetry_counters_t;
+
+/* Load the newest valid checkpoint slot; called from keyboard_init(). */
+void telemetry_counters_init(void);
+
+/* Per-pass bookkeeping: scan count, loop-time maximum, uptime, and the
+ * periodic checkpoint. Called once per keyboard_task() pass. */
+void telemetry_counters_task(void);
+
+/* Write the live counters to the next checkpoint slot; also called from
+ * shutdown_quantum() so a clean reboot loses nothing. */
+void telemetry_counters_checkpoint(void);
+
+/* Zero all counters and checkpoint immediately. The sequence number keeps
+ * counting so the reset outranks the older slots. */
+void telemetry_counters_reset(void);
+
+void telemetry_counters_note_debounce_event(void);
+void telemetry_counters_note_split_retry(void);
+void telemetry_counters_note_i2c_error(void);
+
+/* Live counter snapshot; the crc field is only meaningful in EEPROM form. */
+const telemetry_counters_t *telemetry_counters_get(void);
+
+/* Handle a raw HID request; returns true (and fills `data` with the
+ * response) if the packet was a telemetry command. */
+bool telemetry_counters_raw_hid_command(uint8_t *data, uint8_t length);
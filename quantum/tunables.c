@@ -0,0 +1,200 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stddef.h>
+
+#include "tunables.h"
+#include "eeconfig.h"
+#include "eeprom.h"
+#include "util.h"
+
+#if defined(DYNAMIC_TAPPING_TERM_ENABLE) && !defined(NO_ACTION_TAPPING)
+#    include "action_tapping.h"
+#endif
+#ifdef COMBO_ENABLE
+#    include "process_combo.h"
+#endif
+#ifdef RGB_MATRIX_ENABLE
+#    include "rgb_matrix.h"
+#endif
+
+static const tunable_t tunables[] = {
+#if defined(DYNAMIC_TAPPING_TERM_ENABLE) && !defined(NO_ACTION_TAPPING)
+    {TUNABLE_TAPPING_TERM, 20, 1000, TAPPING_TERM, &g_tapping_term, NULL},
+#endif
+#ifdef COMBO_ENABLE
+    {TUNABLE_COMBO_TERM, 5, 500, COMBO_TERM, &g_combo_term, NULL},
+#endif
+#ifdef RGB_MATRIX_ENABLE
+    {TUNABLE_RGB_MATRIX_FLUSH_LIMIT, 1, 250, RGB_MATRIX_LED_FLUSH_LIMIT, &g_rgb_flush_limit, NULL},
+#endif
+};
+
+__attribute__((weak)) const tunable_t *tunables_kb(uint8_t *count) {
+    *count = 0;
+    return NULL;
+}
+
+static uint8_t tunables_count(void) {
+    uint8_t kb_count;
+    tunables_kb(&kb_count);
+    return ARRAY_SIZE(tunables) + kb_count;
+}
+
+static const tunable_t *tunable_at(uint8_t index) {
+    const uint8_t builtin_count = ARRAY_SIZE(tunables);
+    if (index < builtin_count) {
+        return &tunables[index];
+    }
+    uint8_t          kb_count;
+    const tunable_t *kb_table = tunables_kb(&kb_count);
+    if (index - builtin_count < kb_count) {
+        return &kb_table[index - builtin_count];
+    }
+    return NULL;
+}
+
+static const tunable_t *tunable_find(uint8_t id, uint8_t *index) {
+    for (uint8_t i = 0; i < tunables_count(); i++) {
+        const tunable_t *entry = tunable_at(i);
+        if (entry->id == id) {
+            if (index) *index = i;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static uint16_t tunable_clamp(const tunable_t *entry, uint16_t value) {
+    if (value < entry->min) return entry->min;
+    if (value > entry->max) return entry->max;
+    return value;
+}
+
+// Changes whenever the compiled-in entry set changes, invalidating any
+// values persisted by a firmware with a different set.
+static uint8_t tunables_version(void) {
+    uint8_t version = 0x5A ^ tunables_count();
+    for (uint8_t i = 0; i < tunables_count(); i++) {
+        version ^= tunable_at(i)->id;
+    }
+    return version;
+}
+
+static void tunable_persist(uint8_t index, uint16_t value) {
+    if (index < EECONFIG_TUNABLES_MAX_ENTRIES) {
+        eeprom_update_word((uint16_t *)(EECONFIG_TUNABLES + 1 + 2 * index), value);
+    }
+}
+
+void tunables_init(void) {
+    if (eeprom_read_byte(EECONFIG_TUNABLES) != tunables_version()) {
+        tunables_reset();
+        eeprom_update_byte(EECONFIG_TUNABLES, tunables_version());
+        return;
+    }
+    for (uint8_t i = 0; i < tunables_count(); i++) {
+        const tunable_t *entry = tunable_at(i);
+        if (i < EECONFIG_TUNABLES_MAX_ENTRIES) {
+            *entry->value = tunable_clamp(entry, eeprom_read_word((uint16_t *)(EECONFIG_TUNABLES + 1 + 2 * i)));
+        }
+        if (entry->apply) entry->apply();
+    }
+}
+
+uint16_t tunable_get(uint8_t id) {
+    const tunable_t *entry = tunable_find(id, NULL);
+    return entry ? *entry->value : 0;
+}
+
+bool tunable_set(uint8_t id, uint16_t value) {
+    uint8_t          index;
+    const tunable_t *entry = tunable_find(id, &index);
+    if (!entry) {
+        return false;
+    }
+    *entry->value = tunable_clamp(entry, value);
+    if (entry->apply) entry->apply();
+    tunable_persist(index, *entry->value);
+    return true;
+}
+
+void tunables_reset(void) {
+    for (uint8_t i = 0; i < tunables_count(); i++) {
+        const tunable_t *entry = tunable_at(i);
+        *entry->value          = entry->def;
+        if (entry->apply) entry->apply();
+        tunable_persist(i, entry->def);
+    }
+}
+
+/* Blob layout (big-endian fields, matching the stream protocol):
+ *   [0]            version
+ *   [1]            entry count
+ *   [2 + 10*i ...] per-entry records: id, 0, min, max, default, value
+ */
+void tunables_read_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    for (uint16_t i = 0; i < size; i++) {
+        uint16_t pos = offset + i;
+        uint8_t  out = 0;
+        if (pos == 0) {
+            out = tunables_version();
+        } else if (pos == 1) {
+            out = tunables_count();
+        } else {
+            const tunable_t *entry = tunable_at((pos - 2) / 10);
+            if (entry != NULL) {
+                uint16_t field;
+                switch ((pos - 2) % 10) {
+                    case 0:
+                        field = (uint16_t)entry->id << 8;
+                        break;
+                    case 1:
+                        field = 0;
+                        break;
+                    case 2:
+                    case 3:
+                        field = entry->min;
+                        break;
+                    case 4:
+                    case 5:
+                        field = entry->max;
+                        break;
+                    case 6:
+                    case 7:
+                        field = entry->def;
+                        break;
+                    default:
+                        field = *entry->value;
+                        break;
+                }
+                out = ((pos - 2) % 2) ? (uint8_t)field : (uint8_t)(field >> 8);
+            }
+        }
+        data[i] = out;
+    }
+}
+
+void tunables_write_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    // Only the value field of each record is writable; the high byte is
+    // staged until its low byte arrives, so a value never half-applies
+    // even when a write is split across packets.
+    static uint8_t staged_index = UINT8_MAX;
+    static uint8_t staged_high  = 0;
+    for (uint16_t i = 0; i < size; i++) {
+        uint16_t pos = offset + i;
+        if (pos < 2) continue;
+        uint8_t index = (pos - 2) / 10;
+        uint8_t field = (pos - 2) % 10;
+        if (field == 8) {
+            staged_index = index;
+            staged_high  = data[i];
+        } else if (field == 9 && staged_index == index) {
+            const tunable_t *entry = tunable_at(index);
+            if (entry != NULL) {
+                tunable_set(entry->id, ((uint16_t)staged_high << 8) | data[i]);
+            }
+            staged_index = UINT8_MAX;
+        }
+    }
+}
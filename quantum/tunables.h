@@ -0,0 +1,62 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * \file
+ *
+ * \brief Runtime registry for performance-relevant parameters.
+ *
+ * Tuning a timing constant normally costs a rebuild-flash-test cycle per
+ * step. With `TUNABLES_ENABLE = yes`, parameters that have runtime storage
+ * are collected in a registry with bounds and defaults, adjustable over the
+ * raw HID stream channel and persisted in eeconfig, so values like the
+ * tapping term can be A/B tested live.
+ *
+ * The wire layout of the stream channel is a 2-byte header
+ * `[version, count]` followed by one 10-byte little-endian record per
+ * entry: `[id, 0, min, max, default, value]`. Only the value field is
+ * writable; out-of-bounds writes are clamped. The version byte changes
+ * whenever the compiled-in entry set changes, which also discards any
+ * previously persisted values.
+ */
+
+enum tunable_id {
+    TUNABLE_TAPPING_TERM           = 0x01,
+    TUNABLE_COMBO_TERM             = 0x02,
+    TUNABLE_RGB_MATRIX_FLUSH_LIMIT = 0x03,
+    // 0x80 and up are reserved for keyboard-level entries
+    TUNABLE_KB_RANGE_START = 0x80,
+};
+
+typedef struct {
+    uint8_t   id;
+    uint16_t  min;
+    uint16_t  max;
+    uint16_t  def;
+    uint16_t *value; // live storage in the owning subsystem
+    void (*apply)(void); // optional, called after *value changes
+} tunable_t;
+
+/** \brief Additional keyboard-level entries; return the table, set *count. */
+const tunable_t *tunables_kb(uint8_t *count);
+
+/** \brief Load persisted values, or store defaults if the entry set changed. */
+void tunables_init(void);
+
+/** \brief Current value, or 0 for an unknown id. */
+uint16_t tunable_get(uint8_t id);
+
+/** \brief Clamp to the entry's bounds, apply and persist; false for an unknown id. */
+bool tunable_set(uint8_t id, uint16_t value);
+
+/** \brief Restore every entry to its compiled-in default. */
+void tunables_reset(void);
+
+/* Raw HID stream channel accessors. */
+void tunables_read_buffer(uint16_t offset, uint16_t size, uint8_t *data);
+void tunables_write_buffer(uint16_t offset, uint16_t size, uint8_t *data);
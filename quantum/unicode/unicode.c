@@ -30,6 +30,10 @@
 #    include "audio.h"
 #endif
 
+#if defined(OS_DETECTION_ENABLE) && defined(UNICODE_INPUT_MODE_OS_DETECT)
+#    include "os_detection.h"
+#endif
+
 #if defined(UNICODE_ENABLE) + defined(UNICODEMAP_ENABLE) + defined(UCIS_ENABLE) > 1
 #    error "Cannot enable more than one Unicode method (UNICODE, UNICODEMAP, UCIS) at the same time"
 #endif
@@ -61,6 +65,14 @@
 #    define UNICODE_TYPE_DELAY 10
 #endif
 
+// Pace Unicode input by sending this many duplicate keyboard reports instead
+// of waiting UNICODE_TYPE_DELAY ms. Reports are delivered in order, one per
+// USB poll interval, so the pause scales with the host's actual report rate
+// rather than a fixed wall-clock worst case. 0 keeps the wait_ms() behavior.
+#ifndef UNICODE_TYPE_PACE_REPORTS
+#    define UNICODE_TYPE_PACE_REPORTS 0
+#endif
+
 unicode_config_t unicode_config;
 uint8_t          unicode_saved_mods;
 led_t            unicode_saved_led_state;
@@ -202,6 +214,62 @@ void persist_unicode_input_mode(void) {
     eeprom_update_byte(EECONFIG_UNICODEMODE, unicode_config.input_mode);
 }
 
+#if defined(OS_DETECTION_ENABLE) && defined(UNICODE_INPUT_MODE_OS_DETECT)
+/** \brief Maps a detected host OS to the input mode that works there out of the box
+ *
+ * Weakly defined, can be overridden to e.g. prefer UNICODE_MODE_WINDOWS over WinCompose
+ */
+__attribute__((weak)) uint8_t unicode_input_mode_for_os(os_variant_t os) {
+    switch (os) {
+        case OS_MACOS:
+        case OS_IOS:
+            return UNICODE_MODE_MACOS;
+        case OS_LINUX:
+            return UNICODE_MODE_LINUX;
+        case OS_WINDOWS:
+            return UNICODE_MODE_WINCOMPOSE;
+        default:
+            return unicode_config.input_mode;
+    }
+}
+
+// Switch to the input mode matching the detected host OS, once a detection result is available. The detected mode is deliberately not persisted -- the same keyboard may be plugged into a different host next time.
+static void unicode_input_mode_os_detect(void) {
+    static bool detection_applied = false;
+
+    if (detection_applied) {
+        return;
+    }
+
+    os_variant_t os = detected_host_os();
+    if (os == OS_UNSURE) {
+        return;
+    }
+
+    uint8_t mode = unicode_input_mode_for_os(os);
+    if (mode != unicode_config.input_mode) {
+        unicode_config.input_mode = mode;
+        unicode_input_mode_set_kb(mode);
+        dprintf("Unicode input mode set from detected OS: %u\n", unicode_config.input_mode);
+    }
+    detection_applied = true;
+}
+#else
+#    define unicode_input_mode_os_detect()
+#endif
+
+// Give the host's input method time to process the start sequence before the
+// hex digits arrive, either as duplicate reports or as a fixed delay.
+static void unicode_pace(void) {
+#if UNICODE_TYPE_PACE_REPORTS > 0
+    for (uint8_t i = 0; i < (UNICODE_TYPE_PACE_REPORTS); i++) {
+        send_keyboard_report();
+    }
+#else
+    wait_ms(UNICODE_TYPE_DELAY);
+#endif
+}
+
 __attribute__((weak)) void unicode_input_start(void) {
     unicode_saved_led_state = host_keyboard_led_state();
 
@@ -230,7 +298,7 @@ __attribute__((weak)) void unicode_input_start(void) {
                 tap_code(KC_NUM_LOCK);
             }
             register_code(KC_LEFT_ALT);
-            wait_ms(UNICODE_TYPE_DELAY);
+            unicode_pace();
             tap_code(KC_KP_PLUS);
             break;
         case UNICODE_MODE_WINCOMPOSE:
@@ -245,7 +313,7 @@ __attribute__((weak)) void unicode_input_start(void) {
             break;
     }
 
-    wait_ms(UNICODE_TYPE_DELAY);
+    unicode_pace();
 }
 
 __attribute__((weak)) void unicode_input_finish(void) {
@@ -351,13 +419,7 @@ void register_hex32(uint32_t hex) {
     }
 }
 
-void register_unicode(uint32_t code_point) {
-    if (code_point > 0x10FFFF || (code_point > 0xFFFF && unicode_config.input_mode == UNICODE_MODE_WINDOWS)) {
-        // Code point out of range, do nothing
-        return;
-    }
-
-    unicode_input_start();
+static void register_unicode_hex(uint32_t code_point) {
     if (code_point > 0xFFFF && unicode_config.input_mode == UNICODE_MODE_MACOS) {
         // Convert code point to UTF-16 surrogate pair on macOS
         code_point -= 0x10000;
@@ -367,6 +429,18 @@ void register_unicode(uint32_t code_point) {
     } else {
         register_hex32(code_point);
     }
+}
+
+void register_unicode(uint32_t code_point) {
+    if (code_point > 0x10FFFF || (code_point > 0xFFFF && unicode_config.input_mode == UNICODE_MODE_WINDOWS)) {
+        // Code point out of range, do nothing
+        return;
+    }
+
+    unicode_input_mode_os_detect();
+
+    unicode_input_start();
+    register_unicode_hex(code_point);
     unicode_input_finish();
 }
 
@@ -375,6 +449,56 @@ void send_unicode_string(const char *str) {
         return;
     }
 
+    unicode_input_mode_os_detect();
+
+    // The macOS hex input method reads every code point as a fixed number of four-digit groups, so a whole string can share a single input session: hold the Unicode key once and stream all digits back-to-back, instead of paying the input start/finish delays for every character. The surrogate-pair path above already relies on this grouping behavior.
+    if (unicode_config.input_mode == UNICODE_MODE_MACOS) {
+        unicode_input_start();
+        while (*str) {
+            int32_t code_point = 0;
+            str                = decode_utf8(str, &code_point);
+
+            if (code_point >= 0 && code_point <= 0x10FFFF) {
+                register_unicode_hex(code_point);
+            }
+        }
+        unicode_input_finish();
+        return;
+    }
+
+    // Linux (IBus) and WinCompose need a separate input sequence per code
+    // point, but the surrounding state juggling does not: save and clear the
+    // mods once, and on Linux release Caps Lock once, around the whole
+    // string. The per-character unicode_input_start() calls then find mods
+    // already clear and Caps Lock already off, so each character costs only
+    // its start key, hex digits and terminator.
+    if (unicode_config.input_mode == UNICODE_MODE_LINUX || unicode_config.input_mode == UNICODE_MODE_WINCOMPOSE) {
+        led_t saved_led_state = host_keyboard_led_state();
+        // As in unicode_input_start(): Caps Lock has to go before the mods
+        // are touched, or the shifted case of UNICODE_KEY_LNX misfires.
+        if (unicode_config.input_mode == UNICODE_MODE_LINUX && saved_led_state.caps_lock) {
+            tap_code(KC_CAPS_LOCK);
+        }
+        uint8_t saved_mods = get_mods();
+        clear_mods();
+        clear_weak_mods();
+
+        while (*str) {
+            int32_t code_point = 0;
+            str                = decode_utf8(str, &code_point);
+
+            if (code_point >= 0) {
+                register_unicode(code_point);
+            }
+        }
+
+        set_mods(saved_mods);
+        if (unicode_config.input_mode == UNICODE_MODE_LINUX && saved_led_state.caps_lock) {
+            tap_code(KC_CAPS_LOCK);
+        }
+        return;
+    }
+
     while (*str) {
         int32_t code_point = 0;
         str                = decode_utf8(str, &code_point);
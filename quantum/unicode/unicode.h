@@ -49,6 +49,11 @@ void    persist_unicode_input_mode(void);
 void unicode_input_mode_set_user(uint8_t input_mode);
 void unicode_input_mode_set_kb(uint8_t input_mode);
 
+#if defined(OS_DETECTION_ENABLE) && defined(UNICODE_INPUT_MODE_OS_DETECT)
+#    include "os_detection.h"
+uint8_t unicode_input_mode_for_os(os_variant_t os);
+#endif
+
 void unicode_input_start(void);
 void unicode_input_finish(void);
 void unicode_input_cancel(void);
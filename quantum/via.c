@@ -25,6 +25,18 @@
 #include "quantum.h"
 
 #include "via.h"
+#ifdef LATENCY_HISTOGRAM_ENABLE
+#    include "latency_histogram.h"
+#endif
+#ifdef RAW_HID_STREAM_ENABLE
+#    include "raw_hid_stream.h"
+#endif
+#ifdef RADIO_ENABLE
+#    include "radio.h"
+#endif
+#ifdef EVENT_TRACE_ENABLE
+#    include "event_trace.h"
+#endif
 
 #include "raw_hid.h"
 #include "dynamic_keymap.h"
@@ -253,6 +265,37 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
         return;
     }
 
+#ifdef LATENCY_HISTOGRAM_ENABLE
+    // Latency histogram queries share the raw HID endpoint; they are fully
+    // handled (including the raw_hid_send()) when the command id matches.
+    if (latency_histogram_raw_hid_command(data, length)) {
+        return;
+    }
+#endif
+
+#ifdef RADIO_ENABLE
+    // Radio link-quality queries follow the same convention.
+    if (radio_raw_hid_command(data, length)) {
+        return;
+    }
+#endif
+
+#ifdef EVENT_TRACE_ENABLE
+    // Event trace dumps follow the same convention (and check the secure
+    // unlock themselves).
+    if (event_trace_raw_hid_command(data, length)) {
+        return;
+    }
+#endif
+
+#ifdef RAW_HID_STREAM_ENABLE
+    // Likewise for bulk streaming transfers; all responses (including any
+    // data packets) are sent before this returns.
+    if (raw_hid_stream_command(data, length)) {
+        return;
+    }
+#endif
+
     switch (*command_id) {
         case id_get_protocol_version: {
             command_data[0] = VIA_PROTOCOL_VERSION >> 8;
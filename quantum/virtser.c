@@ -0,0 +1,56 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "virtser.h"
+
+/* Transmit staging for the virtual serial port.
+ *
+ * virtser_send() and virtser_send_buffer() hand bytes to the endpoint
+ * immediately, one USB transfer per call, so chatty senders move the
+ * bus in mostly-empty packets. virtser_write() instead stages bytes in
+ * a ring buffer and virtser_flush() - run once per pass of the protocol
+ * main loop, from virtser_task() - coalesces everything queued during
+ * that pass into full CDC-sized packets plus one trailing remainder.
+ *
+ * Both ends of the ring run in the main loop context (like the steno
+ * packet buffer), so no locking is needed.
+ */
+
+#ifndef VIRTSER_TX_BUFFER_SIZE
+#    define VIRTSER_TX_BUFFER_SIZE 256
+#endif
+
+// Matches CDC_EPSIZE in usb_descriptor.h; a flush hands the endpoint
+// packets of exactly this size until less than one remains queued.
+#ifndef VIRTSER_PACKET_SIZE
+#    define VIRTSER_PACKET_SIZE 16
+#endif
+
+static uint8_t  tx_buffer[VIRTSER_TX_BUFFER_SIZE];
+static uint16_t tx_head = 0; // next slot to stage into
+static uint16_t tx_tail = 0; // next byte to send
+
+uint16_t virtser_write(const uint8_t *data, uint16_t length) {
+    uint16_t accepted = 0;
+    while (accepted < length) {
+        uint16_t next = (uint16_t)((tx_head + 1) % VIRTSER_TX_BUFFER_SIZE);
+        if (next == tx_tail) {
+            break; // ring full - never block, report what was taken
+        }
+        tx_buffer[tx_head] = data[accepted++];
+        tx_head            = next;
+    }
+    return accepted;
+}
+
+void virtser_flush(void) {
+    uint8_t packet[VIRTSER_PACKET_SIZE];
+    while (tx_head != tx_tail) {
+        uint8_t count = 0;
+        while (count < VIRTSER_PACKET_SIZE && tx_head != tx_tail) {
+            packet[count++] = tx_buffer[tx_tail];
+            tx_tail         = (uint16_t)((tx_tail + 1) % VIRTSER_TX_BUFFER_SIZE);
+        }
+        virtser_send_buffer(packet, count);
+    }
+}
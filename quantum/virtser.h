@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stdint.h>
+
 void virtser_init(void);
 
 /* Define this function in your code to process incoming bytes */
@@ -7,3 +9,13 @@ void virtser_recv(const uint8_t ch);
 
 /* Call this to send a character over the Virtual Serial Device */
 void virtser_send(const uint8_t byte);
+
+/* Call this to send a whole buffer over the Virtual Serial Device in a single transfer */
+void virtser_send_buffer(const uint8_t *data, uint8_t length);
+
+/* Queue bytes for transmission without blocking; returns how many were accepted.
+ * Queued bytes leave as full CDC-sized packets on the next virtser_flush(). */
+uint16_t virtser_write(const uint8_t *data, uint16_t length);
+
+/* Drain the transmit queue; called once per main loop pass by virtser_task() */
+void virtser_flush(void);
@@ -0,0 +1,32 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "deferred_exec_mocks.hpp"
+
+deferred_token MockDeferredExec::mock_defer_exec(std::uint32_t delay_ms, deferred_exec_callback cb, void* cb_arg) {
+    ++defer_count;
+    if (active || delay_ms == 0 || cb == nullptr) {
+        return INVALID_DEFERRED_TOKEN;
+    }
+    callback     = cb;
+    callback_arg = cb_arg;
+    delay        = delay_ms;
+    active       = true;
+    return (deferred_token)1;
+}
+
+bool MockDeferredExec::mock_cancel_deferred_exec(deferred_token token) {
+    ++cancel_count;
+    if (token == INVALID_DEFERRED_TOKEN || !active) {
+        return false;
+    }
+    active = false;
+    return true;
+}
+
+extern "C" deferred_token defer_exec(uint32_t delay_ms, deferred_exec_callback callback, void* cb_arg) {
+    return MockDeferredExec::Instance().mock_defer_exec(delay_ms, callback, cb_arg);
+}
+
+extern "C" bool cancel_deferred_exec(deferred_token token) {
+    return MockDeferredExec::Instance().mock_cancel_deferred_exec(token);
+}
@@ -0,0 +1,79 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+#include <cstdint>
+
+extern "C" {
+#include "deferred_exec.h"
+};
+
+// Single-slot mock of the deferred executor -- wear leveling only ever has one pass in flight.
+class MockDeferredExec {
+   private:
+    MockDeferredExec() {
+        reset_instance();
+    }
+
+    deferred_exec_callback callback;
+    void*                  callback_arg;
+    std::uint32_t          delay;
+    bool                   active;
+    std::uint64_t          defer_count;
+    std::uint64_t          cancel_count;
+
+   public:
+    static MockDeferredExec& Instance() {
+        static MockDeferredExec instance;
+        return instance;
+    }
+
+    void reset_instance() {
+        callback     = nullptr;
+        callback_arg = nullptr;
+        delay        = 0;
+        active       = false;
+        defer_count  = 0;
+        cancel_count = 0;
+    }
+
+    bool pending() const {
+        return active;
+    }
+    std::uint32_t current_delay() const {
+        return delay;
+    }
+    std::uint64_t defer_invoke_count() const {
+        return defer_count;
+    }
+    std::uint64_t cancel_invoke_count() const {
+        return cancel_count;
+    }
+
+    // Runs the pending callback once, emulating the deferred executor firing. Returns whether a callback remains scheduled.
+    bool run_pending() {
+        if (!active) {
+            return false;
+        }
+        std::uint32_t next = callback(0, callback_arg);
+        if (next == 0) {
+            active = false;
+        } else {
+            delay = next;
+        }
+        return active;
+    }
+
+    // Runs the pending callback until it stops rescheduling itself. Returns the number of invocations.
+    std::uint64_t run_to_completion(std::uint64_t max_invocations = 1000) {
+        std::uint64_t n = 0;
+        while (active && n < max_invocations) {
+            run_pending();
+            ++n;
+        }
+        return n;
+    }
+
+    // Mocked APIs
+    deferred_token mock_defer_exec(std::uint32_t delay_ms, deferred_exec_callback cb, void* cb_arg);
+    bool           mock_cancel_deferred_exec(deferred_token token);
+};
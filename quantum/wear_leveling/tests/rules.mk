@@ -54,6 +54,22 @@ wear_leveling_4byte_SRC := \
 wear_leveling_4byte_INC := \
 	$(wear_leveling_common_INC)
 
+wear_leveling_background_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=48 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=16 \
+	-DWEAR_LEVELING_BACKGROUND_CONSOLIDATION \
+	-DWEAR_LEVELING_CONSOLIDATION_SLICE_BYTES=4 \
+	-DDEFERRED_EXEC_ENABLE
+wear_leveling_background_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/deferred_exec_mocks.cpp \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_background.cpp
+wear_leveling_background_INC := \
+	$(wear_leveling_common_INC) \
+	$(QUANTUM_PATH)
+
 wear_leveling_8byte_DEFS := \
 	$(wear_leveling_common_DEFS) \
 	-DBACKING_STORE_WRITE_SIZE=8 \
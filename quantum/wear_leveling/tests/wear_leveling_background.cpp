@@ -0,0 +1,119 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+#include "deferred_exec_mocks.hpp"
+
+// Test configuration: logical=16, backing=48, so the write log spans 24 bytes and the 75% high-water
+// mark sits at write address 24+18=42. With a 4-byte slice the 16-byte consolidated area takes 4 slices.
+
+class WearLevelingBackground : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        MockDeferredExec::Instance().reset_instance();
+    }
+
+    // Each 1-byte write below address 64 becomes one 2-byte optimized log entry
+    void write_n_bytes(std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            std::uint8_t val = (std::uint8_t)(0x10 + i);
+            EXPECT_EQ(wear_leveling_write((uint32_t)i, &val, sizeof(val)), WEAR_LEVELING_SUCCESS) << "Write operation should have succeeded";
+        }
+    }
+};
+
+/**
+ * This test verifies that a background pass is scheduled only once the write log crosses the high-water mark.
+ */
+TEST_F(WearLevelingBackground, HighWater_SchedulesPass) {
+    auto& exec = MockDeferredExec::Instance();
+
+    // 8 entries => write address 40, still below the high-water mark of 42
+    write_n_bytes(8);
+    EXPECT_FALSE(exec.pending()) << "No pass should be scheduled below the high-water mark";
+
+    // 9th entry => write address 42, at the high-water mark
+    std::uint8_t val = 0x42;
+    EXPECT_EQ(wear_leveling_write(8, &val, sizeof(val)), WEAR_LEVELING_SUCCESS) << "Write operation should have succeeded";
+    EXPECT_TRUE(exec.pending()) << "A pass should be scheduled at the high-water mark";
+    EXPECT_EQ(exec.current_delay(), (uint32_t)WEAR_LEVELING_CONSOLIDATION_DELAY_MS) << "Pass should start after the configured delay";
+
+    // Further writes must not double-schedule
+    std::uint64_t defer_count = exec.defer_invoke_count();
+    val                       = 0x43;
+    EXPECT_EQ(wear_leveling_write(9, &val, sizeof(val)), WEAR_LEVELING_SUCCESS) << "Write operation should have succeeded";
+    EXPECT_EQ(exec.defer_invoke_count(), defer_count) << "A pass should only be scheduled once";
+}
+
+/**
+ * This test verifies that the sliced pass consolidates correctly: one erase slice, four data slices, one
+ * finalize slice, and a checksum that survives re-initialization.
+ */
+TEST_F(WearLevelingBackground, SlicedPass_ConsolidatesWithValidChecksum) {
+    auto& inst = MockBackingStore::Instance();
+    auto& exec = MockDeferredExec::Instance();
+
+    write_n_bytes(9);
+    ASSERT_TRUE(exec.pending()) << "A pass should be scheduled at the high-water mark";
+
+    std::uint64_t erase_count = inst.erase_invoke_count();
+    EXPECT_EQ(exec.run_to_completion(), 6) << "Pass should take 1 erase + 4 data slices + 1 finalize";
+    EXPECT_EQ(inst.erase_invoke_count(), erase_count + 1) << "Erase should have been invoked once";
+    EXPECT_FALSE(exec.pending()) << "Pass should not reschedule itself after completion";
+
+    // The consolidated area and checksum must be coherent across a power cycle
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    for (std::uint32_t i = 0; i < 9; ++i) {
+        std::uint8_t val = 0;
+        EXPECT_EQ(wear_leveling_read(i, &val, sizeof(val)), WEAR_LEVELING_SUCCESS) << "Failed to read";
+        EXPECT_EQ(val, 0x10 + i) << "Invalid readback";
+    }
+}
+
+/**
+ * This test verifies that a write landing mid-pass -- after its slice of the consolidated area has already
+ * been written -- is replayed into the fresh write log and survives re-initialization.
+ */
+TEST_F(WearLevelingBackground, WriteDuringPass_ReplayedIntoLog) {
+    auto& inst = MockBackingStore::Instance();
+    auto& exec = MockDeferredExec::Instance();
+
+    write_n_bytes(9);
+    ASSERT_TRUE(exec.pending()) << "A pass should be scheduled at the high-water mark";
+
+    // Run the erase slice and the first data slice, which covers logical addresses 0..3
+    exec.run_pending();
+    exec.run_pending();
+
+    // A write into the already-consolidated slice cannot touch the backing store mid-pass
+    std::uint64_t write_count = inst.write_invoke_count();
+    std::uint8_t  val         = 0x77;
+    EXPECT_EQ(wear_leveling_write(0x01, &val, sizeof(val)), WEAR_LEVELING_SUCCESS) << "Write operation should have succeeded";
+    EXPECT_EQ(inst.write_invoke_count(), write_count) << "Mid-pass writes should only touch the cache";
+
+    exec.run_to_completion();
+
+    // The replayed log entry must bring the value back after a power cycle
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    val = 0;
+    EXPECT_EQ(wear_leveling_read(0x01, &val, sizeof(val)), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_EQ(val, 0x77) << "Mid-pass write was not replayed into the log";
+}
+
+/**
+ * This test verifies that an erase cancels an in-flight pass.
+ */
+TEST_F(WearLevelingBackground, Erase_CancelsPass) {
+    auto& exec = MockDeferredExec::Instance();
+
+    write_n_bytes(9);
+    ASSERT_TRUE(exec.pending()) << "A pass should be scheduled at the high-water mark";
+
+    std::uint64_t cancel_count = exec.cancel_invoke_count();
+    EXPECT_EQ(wear_leveling_erase(), WEAR_LEVELING_SUCCESS) << "Erase returned incorrect status";
+    EXPECT_EQ(exec.cancel_invoke_count(), cancel_count + 1) << "Erase should have cancelled the pass";
+    EXPECT_FALSE(exec.pending()) << "No pass should remain scheduled after an erase";
+}
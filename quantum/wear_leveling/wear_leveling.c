@@ -205,6 +205,243 @@ static void wear_leveling_clear_cache(void) {
     wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
 }
 
+#ifdef WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+
+#    include "deferred_exec.h"
+
+#    ifndef DEFERRED_EXEC_ENABLE
+#        error WEAR_LEVELING_BACKGROUND_CONSOLIDATION requires deferred execution -- set DEFERRED_EXEC_ENABLE = yes in rules.mk
+#    endif
+
+/*
+    Background consolidation:
+
+        Consolidation erases the whole backing store and rewrites it from the
+        cache -- performed synchronously when the write log fills, this stalls
+        the main loop for the duration of the erase plus the bulk write. With
+        background consolidation enabled, a pass is instead scheduled through
+        the deferred executor once the write log crosses a high-water mark, and
+        the rewrite of the consolidated area is split into bounded-size slices,
+        one per deferred callback. The synchronous path remains as the backstop
+        for a log that manages to fill before the pass completes.
+
+        While a pass is in flight the write log does not exist yet, so any
+        incoming writes are kept in the cache and their address ranges recorded;
+        they are replayed into the fresh write log when the pass finishes. Note
+        that the consolidated area cannot be re-written once a slice has been
+        issued -- flash requires an erase first -- which is why the replay goes
+        through the log instead.
+
+        The erase itself is a single slice, as the backing store API performs
+        whole-area erasure in one operation; the high-water trigger means it
+        runs between write bursts rather than in the middle of one.
+*/
+
+#    ifndef WEAR_LEVELING_CONSOLIDATION_HIGH_WATER_PERCENT
+#        define WEAR_LEVELING_CONSOLIDATION_HIGH_WATER_PERCENT 75
+#    endif
+
+#    ifndef WEAR_LEVELING_CONSOLIDATION_DELAY_MS
+#        define WEAR_LEVELING_CONSOLIDATION_DELAY_MS 100
+#    endif
+
+#    ifndef WEAR_LEVELING_CONSOLIDATION_INTERVAL_MS
+#        define WEAR_LEVELING_CONSOLIDATION_INTERVAL_MS 5
+#    endif
+
+#    ifndef WEAR_LEVELING_CONSOLIDATION_SLICE_BYTES
+#        define WEAR_LEVELING_CONSOLIDATION_SLICE_BYTES 256
+#    endif
+
+#    ifndef WEAR_LEVELING_CONSOLIDATION_PENDING_RANGES
+#        define WEAR_LEVELING_CONSOLIDATION_PENDING_RANGES 8
+#    endif
+
+_Static_assert((WEAR_LEVELING_CONSOLIDATION_SLICE_BYTES) % BACKING_STORE_WRITE_SIZE == 0, "Slice size must be a multiple of write size");
+
+#    define WEAR_LEVELING_CONSOLIDATION_HIGH_WATER_ADDRESS (((WEAR_LEVELING_LOGICAL_SIZE) + 8) + ((uint32_t)((WEAR_LEVELING_BACKING_SIZE) - (WEAR_LEVELING_LOGICAL_SIZE)-8) * (WEAR_LEVELING_CONSOLIDATION_HIGH_WATER_PERCENT) / 100))
+
+static wear_leveling_status_t wear_leveling_consolidate_force(void);
+static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const void *value, size_t length);
+
+typedef enum consolidation_phase_t {
+    CONSOLIDATION_IDLE, // no pass in flight (a scheduled-but-not-started pass leaves the log usable)
+    CONSOLIDATION_ERASE,
+    CONSOLIDATION_WRITE_DATA,
+    CONSOLIDATION_FINALIZE,
+} consolidation_phase_t;
+
+/**
+ * Background consolidation state.
+ */
+static struct {
+    consolidation_phase_t phase;
+    uint32_t              write_offset; // item offset into the consolidated area for the next slice
+    uint64_t              hash;         // running FNV1a_64 of the data as actually written
+    deferred_token        token;
+    struct {
+        uint32_t address;
+        uint32_t length;
+    } pending[WEAR_LEVELING_CONSOLIDATION_PENDING_RANGES];
+    uint8_t pending_count;
+} consolidation = {.phase = CONSOLIDATION_IDLE, .token = INVALID_DEFERRED_TOKEN};
+
+/**
+ * Cancels any in-flight background consolidation pass.
+ */
+static void wear_leveling_consolidation_reset(void) {
+    if (consolidation.token != INVALID_DEFERRED_TOKEN) {
+        cancel_deferred_exec(consolidation.token);
+        consolidation.token = INVALID_DEFERRED_TOKEN;
+    }
+    consolidation.phase         = CONSOLIDATION_IDLE;
+    consolidation.pending_count = 0;
+}
+
+/**
+ * Records a logical address range modified while a pass is in flight, for replay into the fresh write log.
+ * Over-covering is safe as the replay pulls current values from the cache.
+ */
+static void wear_leveling_consolidation_record_pending(uint32_t address, size_t length) {
+    if (consolidation.pending_count == (WEAR_LEVELING_CONSOLIDATION_PENDING_RANGES)) {
+        // No free slots -- widen the last range to cover the new one as well
+        uint32_t start = consolidation.pending[consolidation.pending_count - 1].address;
+        uint32_t end   = start + consolidation.pending[consolidation.pending_count - 1].length;
+        if (address < start) {
+            start = address;
+        }
+        if (address + length > end) {
+            end = address + (uint32_t)length;
+        }
+        consolidation.pending[consolidation.pending_count - 1].address = start;
+        consolidation.pending[consolidation.pending_count - 1].length  = end - start;
+        return;
+    }
+
+    consolidation.pending[consolidation.pending_count].address = address;
+    consolidation.pending[consolidation.pending_count].length  = (uint32_t)length;
+    consolidation.pending_count++;
+}
+
+/**
+ * Deferred executor callback: performs one bounded slice of the consolidation pass per invocation.
+ */
+static uint32_t wear_leveling_consolidation_callback(uint32_t trigger_time, void *cb_arg) {
+    if (consolidation.phase == CONSOLIDATION_IDLE) {
+        if (wear_leveling.write_address < (WEAR_LEVELING_CONSOLIDATION_HIGH_WATER_ADDRESS)) {
+            // The synchronous backstop already consolidated in the meantime -- nothing to do
+            consolidation.token = INVALID_DEFERRED_TOKEN;
+            return 0;
+        }
+        consolidation.phase = CONSOLIDATION_ERASE;
+    }
+
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    bool                        failed      = lock_status == STATUS_FAILURE;
+
+    if (!failed) {
+        switch (consolidation.phase) {
+            case CONSOLIDATION_ERASE: {
+                wl_dprintf("Background consolidation: erase\n");
+                if (!backing_store_erase()) {
+                    failed = true;
+                    break;
+                }
+                consolidation.hash         = FNV1A_64_INIT;
+                consolidation.write_offset = 0;
+                consolidation.phase        = CONSOLIDATION_WRITE_DATA;
+            } break;
+
+            case CONSOLIDATION_WRITE_DATA: {
+                const size_t total = sizeof(wear_leveling.cache) / sizeof(backing_store_int_t);
+                size_t       count = total - consolidation.write_offset;
+                if (count > (WEAR_LEVELING_CONSOLIDATION_SLICE_BYTES) / (BACKING_STORE_WRITE_SIZE)) {
+                    count = (WEAR_LEVELING_CONSOLIDATION_SLICE_BYTES) / (BACKING_STORE_WRITE_SIZE);
+                }
+
+                uint8_t *p = &wear_leveling.cache[consolidation.write_offset * (BACKING_STORE_WRITE_SIZE)];
+                wl_dprintf("Background consolidation: write slice\n");
+                if (!backing_store_write_bulk(consolidation.write_offset * (BACKING_STORE_WRITE_SIZE), (backing_store_int_t *)p, count)) {
+                    failed = true;
+                    break;
+                }
+
+                // Hash what was actually written -- the cache may change for not-yet-written slices
+                consolidation.hash = fnv_64a_buf(p, count * (BACKING_STORE_WRITE_SIZE), consolidation.hash);
+                consolidation.write_offset += count;
+                if (consolidation.write_offset == total) {
+                    consolidation.phase = CONSOLIDATION_FINALIZE;
+                }
+            } break;
+
+            case CONSOLIDATION_FINALIZE: {
+                wl_dprintf("Background consolidation: finalize\n");
+                write_log_entry_t entry;
+                entry.raw64 = consolidation.hash;
+#    if BACKING_STORE_WRITE_SIZE == 2
+                failed = !backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4);
+#    elif BACKING_STORE_WRITE_SIZE == 4
+                failed = !backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2);
+#    elif BACKING_STORE_WRITE_SIZE == 8
+                failed = !backing_store_write((WEAR_LEVELING_LOGICAL_SIZE), entry.raw64);
+#    endif
+                if (failed) {
+                    break;
+                }
+
+                // Log writes restart after the consolidated area
+                wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8;
+                consolidation.phase         = CONSOLIDATION_IDLE;
+
+                // Replay writes that arrived during the pass into the fresh log, using current cache values
+                for (uint8_t i = 0; i < consolidation.pending_count && !failed; ++i) {
+                    const uint32_t a = consolidation.pending[i].address;
+                    failed           = wear_leveling_write_raw(a, &wear_leveling.cache[a], consolidation.pending[i].length) == WEAR_LEVELING_FAILED;
+                }
+                consolidation.pending_count = 0;
+            } break;
+
+            default:
+                failed = true;
+                break;
+        }
+    }
+
+    if (lock_status == STATUS_SUCCESS) {
+        wear_leveling_lock();
+    }
+
+    if (failed) {
+        // Fall back to the synchronous path with the data we already have
+        wl_dprintf("Background consolidation failed, forcing synchronous consolidation\n");
+        wear_leveling_consolidate_force();
+        consolidation.token = INVALID_DEFERRED_TOKEN;
+        return 0;
+    }
+
+    if (consolidation.phase == CONSOLIDATION_IDLE) {
+        consolidation.token = INVALID_DEFERRED_TOKEN;
+        return 0;
+    }
+
+    return WEAR_LEVELING_CONSOLIDATION_INTERVAL_MS;
+}
+
+/**
+ * Schedules a background consolidation pass once the write log crosses the high-water mark.
+ */
+static void wear_leveling_consolidation_schedule(void) {
+    if (consolidation.phase != CONSOLIDATION_IDLE || consolidation.token != INVALID_DEFERRED_TOKEN) {
+        return;
+    }
+    if (wear_leveling.write_address < (WEAR_LEVELING_CONSOLIDATION_HIGH_WATER_ADDRESS)) {
+        return;
+    }
+    consolidation.token = defer_exec((WEAR_LEVELING_CONSOLIDATION_DELAY_MS), wear_leveling_consolidation_callback, NULL);
+}
+
+#endif // WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+
 /**
  * Reads the consolidated data from the backing store into the cache.
  * Does not consider the write log.
@@ -302,6 +539,11 @@ static wear_leveling_status_t wear_leveling_write_consolidated(void) {
 static wear_leveling_status_t wear_leveling_consolidate_force(void) {
     wl_dprintf("Erasing backing store\n");
 
+#ifdef WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+    // A synchronous consolidation makes any in-flight background pass meaningless
+    wear_leveling_consolidation_reset();
+#endif
+
     // Erase the backing store. Expectation is that any un-written values that are read back after this call come back as zero.
     bool ok = backing_store_erase();
     if (!ok) {
@@ -617,6 +859,10 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 wear_leveling_status_t wear_leveling_init(void) {
     wl_dprintf("Init\n");
 
+#ifdef WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+    wear_leveling_consolidation_reset();
+#endif
+
     // Reset the cache
     wear_leveling_clear_cache();
 
@@ -652,6 +898,10 @@ wear_leveling_status_t wear_leveling_init(void) {
 wear_leveling_status_t wear_leveling_erase(void) {
     wl_dprintf("Erase\n");
 
+#ifdef WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+    wear_leveling_consolidation_reset();
+#endif
+
     // Unlock the backing store
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
     if (lock_status == STATUS_FAILURE) {
@@ -691,6 +941,15 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
     memcpy(&wear_leveling.cache[address], value, length);
 
+#ifdef WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+    // While a background consolidation pass is rebuilding the backing store the write log doesn't exist yet --
+    // keep the data in the cache and replay it into the fresh log once the pass completes.
+    if (consolidation.phase != CONSOLIDATION_IDLE) {
+        wear_leveling_consolidation_record_pending(address, length);
+        return WEAR_LEVELING_SUCCESS;
+    }
+#endif
+
     // Unlock the backing store
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
     if (lock_status == STATUS_FAILURE) {
@@ -723,6 +982,13 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
         }
     }
 
+#ifdef WEAR_LEVELING_BACKGROUND_CONSOLIDATION
+    if (status == WEAR_LEVELING_SUCCESS) {
+        // Kick off a background pass before the log can fill mid-burst
+        wear_leveling_consolidation_schedule();
+    }
+#endif
+
     return status;
 }
 
@@ -743,6 +1009,13 @@ wear_leveling_status_t wear_leveling_read(const uint32_t address, void *value, s
     return WEAR_LEVELING_SUCCESS;
 }
 
+/**
+ * Retrieves a read-only pointer to the RAM mirror of the logical data.
+ */
+const uint8_t *wear_leveling_cache(void) {
+    return wear_leveling.cache;
+}
+
 /**
  * Weak implementation of bulk read, drivers can implement more optimised implementations.
  */
@@ -52,3 +52,14 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+/**
+ * Retrieves a read-only pointer to the RAM mirror of the logical data.
+ *
+ * The mirror is always consistent -- writes update it before touching the backing store -- so reads may be served as
+ * plain memory loads from the returned pointer. The pointer is valid for the lifetime of the firmware and covers
+ * `WEAR_LEVELING_LOGICAL_SIZE` bytes. All modifications must still go through wear_leveling_write().
+ *
+ * @return pointer to the start of the logical data mirror
+ */
+const uint8_t* wear_leveling_cache(void);
@@ -18,6 +18,7 @@
 #include "wpm.h"
 #include "timer.h"
 #include "keycode.h"
+#include "keycode_class.h"
 #include "quantum_keycodes.h"
 #include "action_util.h"
 #include <math.h>
@@ -26,6 +27,7 @@
 static uint8_t  current_wpm = 0;
 static uint32_t wpm_timer   = 0;
 
+#ifndef WPM_EXPONENTIAL_DECAY
 /* The WPM calculation works by specifying a certain number of 'periods' inside
  * a ring buffer, and we count the number of keypresses which occur in each of
  * those periods.  Then to calculate WPM, we add up all of the keypresses in
@@ -35,14 +37,14 @@ static uint32_t wpm_timer   = 0;
  * value `WPM_SAMPLE_PERIODS`.
  *
  */
-#define MAX_PERIODS (WPM_SAMPLE_PERIODS)
-#define PERIOD_DURATION (1000 * WPM_SAMPLE_SECONDS / MAX_PERIODS)
+#    define MAX_PERIODS (WPM_SAMPLE_PERIODS)
+#    define PERIOD_DURATION (1000 * WPM_SAMPLE_SECONDS / MAX_PERIODS)
 
 static int16_t period_presses[MAX_PERIODS] = {0};
 static uint8_t current_period              = 0;
 static uint8_t periods                     = 1;
 
-#if !defined(WPM_UNFILTERED)
+#    if !defined(WPM_UNFILTERED)
 /* LATENCY is used as part of filtering, and controls how quickly the reported
  * WPM trails behind our actual instantaneous measured WPM value, and is
  * defined in milliseconds.  So for LATENCY == 100, the displayed WPM is
@@ -52,14 +54,56 @@ static uint8_t periods                     = 1;
  *
  * LATENCY is not used if WPM_UNFILTERED is defined.
  */
-#    define LATENCY (100)
+#        define LATENCY (100)
 static uint32_t smoothing_timer = 0;
 static uint8_t  prev_wpm        = 0;
 static uint8_t  next_wpm        = 0;
-#endif
+#    endif
+#else // WPM_EXPONENTIAL_DECAY
+/* The exponential estimator keeps a single exponentially-weighted moving
+ * average of the typing rate in 8.8 fixed point, updated in O(1) on each
+ * counted keystroke from the time elapsed since the previous one.  There is
+ * no sample ring buffer and nothing to recompute on a timer; the only
+ * periodic work is halving the estimate once per `WPM_DECAY_HALFLIFE_MS`
+ * after typing has stopped so that the value falls back towards zero.
+ *
+ * `WPM_SMOOTHING_SHIFT` controls how strongly each keystroke pulls the
+ * average towards the instantaneous rate: the weight is 1/2^shift, so
+ * smaller values react faster but jitter more.
+ */
+#    ifndef WPM_SMOOTHING_SHIFT
+#        define WPM_SMOOTHING_SHIFT 3
+#    endif
+#    ifndef WPM_DECAY_HALFLIFE_MS
+#        define WPM_DECAY_HALFLIFE_MS 1000
+#    endif
+static uint16_t wpm_fixed   = 0; // current WPM in 8.8 fixed point
+static uint32_t decay_timer = 0;
+#endif // WPM_EXPONENTIAL_DECAY
+
+__attribute__((weak)) void wpm_changed_user(uint8_t new_wpm) {}
+
+__attribute__((weak)) void wpm_changed_kb(uint8_t new_wpm) {
+    wpm_changed_user(new_wpm);
+}
+
+/* Fire the changed callbacks whenever the reported integer value moves, so
+ * consumers like OLED widgets don't have to poll and diff it themselves.
+ */
+static void wpm_notify(void) {
+    static uint8_t last_reported_wpm = 0;
+    if (current_wpm != last_reported_wpm) {
+        last_reported_wpm = current_wpm;
+        wpm_changed_kb(current_wpm);
+    }
+}
 
 void set_current_wpm(uint8_t new_wpm) {
     current_wpm = new_wpm;
+#ifdef WPM_EXPONENTIAL_DECAY
+    wpm_fixed = (uint16_t)new_wpm << 8;
+#endif
+    wpm_notify();
 }
 uint8_t get_current_wpm(void) {
     return current_wpm;
@@ -79,11 +123,7 @@ __attribute__((weak)) bool wpm_keycode_user(uint16_t keycode) {
     } else if (keycode > 0xFF) {
         keycode = 0;
     }
-    if ((keycode >= KC_A && keycode <= KC_0) || (keycode >= KC_TAB && keycode <= KC_SLASH)) {
-        return true;
-    }
-
-    return false;
+    return (keycode_class(keycode) & KC_CLASS_WPM) != 0;
 }
 
 #if defined(WPM_ALLOW_COUNT_REGRESSION)
@@ -107,18 +147,66 @@ __attribute__((weak)) uint8_t wpm_regress_count(uint16_t keycode) {
 }
 #endif
 
+#ifdef WPM_EXPONENTIAL_DECAY
+
+void update_wpm(uint16_t keycode) {
+    if (wpm_keycode(keycode)) {
+        uint32_t elapsed = timer_elapsed32(wpm_timer);
+        wpm_timer        = timer_read32();
+        decay_timer      = wpm_timer;
+        if (elapsed == 0) {
+            elapsed = 1;
+        }
+        // Each counted keystroke is 1/WPM_ESTIMATED_WORD_SIZE of a word, so
+        // the instantaneous rate follows from the gap to the previous one.
+        uint32_t instantaneous = (60000UL << 8) / (elapsed * WPM_ESTIMATED_WORD_SIZE);
+        if (instantaneous > (240UL << 8)) { // same reasonable limit as the sampled engine
+            instantaneous = 240UL << 8;
+        }
+        wpm_fixed += ((int32_t)instantaneous - (int32_t)wpm_fixed) / (1 << WPM_SMOOTHING_SHIFT);
+        current_wpm = wpm_fixed >> 8;
+        wpm_notify();
+    }
+#    if defined(WPM_ALLOW_COUNT_REGRESSION)
+    uint8_t regress = wpm_regress_count(keycode);
+    while (regress--) {
+        // Pull the estimate towards zero by one smoothing step per
+        // regressed keystroke.
+        wpm_fixed -= wpm_fixed / (1 << WPM_SMOOTHING_SHIFT);
+        current_wpm = wpm_fixed >> 8;
+        wpm_notify();
+    }
+#    endif
+}
+
+void decay_wpm(void) {
+    // O(1) and free while idle: once the estimate reaches zero there is
+    // nothing left to decay and the timer isn't even read.
+    if (wpm_fixed != 0 && timer_elapsed32(decay_timer) > WPM_DECAY_HALFLIFE_MS) {
+        decay_timer = timer_read32();
+        wpm_fixed >>= 1;
+        if (wpm_fixed < (1 << 8)) {
+            wpm_fixed = 0;
+        }
+        current_wpm = wpm_fixed >> 8;
+    }
+    wpm_notify();
+}
+
+#else // WPM_EXPONENTIAL_DECAY
+
 // Outside 'raw' mode we smooth results over time.
 
 void update_wpm(uint16_t keycode) {
     if (wpm_keycode(keycode) && period_presses[current_period] < INT16_MAX) {
         period_presses[current_period]++;
     }
-#if defined(WPM_ALLOW_COUNT_REGRESSION)
+#    if defined(WPM_ALLOW_COUNT_REGRESSION)
     uint8_t regress = wpm_regress_count(keycode);
     if (regress && period_presses[current_period] > INT16_MIN) {
         period_presses[current_period]--;
     }
-#endif
+#    endif
 }
 
 void decay_wpm(void) {
@@ -147,7 +235,7 @@ void decay_wpm(void) {
     if (presses < 2) // don't guess high WPM based on a single keypress.
         wpm_now = 0;
 
-#if defined(WPM_LAUNCH_CONTROL)
+#    if defined(WPM_LAUNCH_CONTROL)
     /*
      * If the `WPM_LAUNCH_CONTROL` option is enabled, then whenever our WPM
      * drops to absolute zero due to no typing occurring within our sample
@@ -161,11 +249,11 @@ void decay_wpm(void) {
         wpm_now           = 0;
         period_presses[0] = 0;
     }
-#endif // WPM_LAUNCH_CONTROL
+#    endif // WPM_LAUNCH_CONTROL
 
-#if defined(WPM_UNFILTERED)
+#    if defined(WPM_UNFILTERED)
     current_wpm = wpm_now;
-#else
+#    else
     int32_t latency = timer_elapsed32(smoothing_timer);
     if (latency > LATENCY) {
         smoothing_timer = timer_read32();
@@ -174,5 +262,8 @@ void decay_wpm(void) {
     }
 
     current_wpm = prev_wpm + (latency * ((int)next_wpm - (int)prev_wpm) / LATENCY);
-#endif
+#    endif
+    wpm_notify();
 }
+
+#endif // WPM_EXPONENTIAL_DECAY
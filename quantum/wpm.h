@@ -34,6 +34,9 @@ bool wpm_keycode(uint16_t keycode);
 bool wpm_keycode_kb(uint16_t keycode);
 bool wpm_keycode_user(uint16_t keycode);
 
+void wpm_changed_kb(uint8_t new_wpm);
+void wpm_changed_user(uint8_t new_wpm);
+
 #ifdef WPM_ALLOW_COUNT_REGRESSION
 uint8_t wpm_regress_count(uint16_t keycode);
 #endif
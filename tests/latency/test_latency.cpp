@@ -0,0 +1,120 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "timer.h"
+
+using testing::_;
+using testing::InSequence;
+
+// Scan-to-report latency budgets on the simulated clock: each scan loop
+// advances the virtual timer by one millisecond, and TestDriver records
+// the simulated time of every keyboard report. These tests pin down *when*
+// reports go out, so queueing regressions in the processing pipeline fail
+// here instead of reaching users as added latency.
+class Latency : public TestFixture {};
+
+TEST_F(Latency, PlainKeypressIsReportedWithinOneScan) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    const uint32_t pressed_at = timer_read32();
+    key.press();
+    EXPECT_REPORT(driver, (KC_A));
+    run_one_scan_loop();
+    ASSERT_EQ(TestDriver::report_times().size(), 1u);
+    EXPECT_LE(TestDriver::last_report_time() - pressed_at, 1u);
+
+    const uint32_t released_at = timer_read32();
+    key.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    EXPECT_LE(TestDriver::last_report_time() - released_at, 1u);
+}
+
+TEST_F(Latency, RolloverBurstIsReportedScanByScan) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_s = KeymapKey(0, 1, 0, KC_S);
+    auto       key_d = KeymapKey(0, 2, 0, KC_D);
+
+    set_keymap({key_a, key_s, key_d});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_S));
+    EXPECT_REPORT(driver, (KC_A, KC_S, KC_D));
+
+    uint32_t press_times[3];
+    int      i = 0;
+    for (KeymapKey key : {key_a, key_s, key_d}) {
+        press_times[i++] = timer_read32();
+        key.press();
+        run_one_scan_loop();
+    }
+
+    ASSERT_EQ(TestDriver::report_times().size(), 3u);
+    for (i = 0; i < 3; i++) {
+        EXPECT_LE(TestDriver::report_times()[i] - press_times[i], 1u) << "report " << i << " missed its scan";
+    }
+
+    EXPECT_ANY_REPORT(driver).Times(3);
+    for (KeymapKey key : {key_a, key_s, key_d}) {
+        key.release();
+        run_one_scan_loop();
+    }
+}
+
+TEST_F(Latency, ModTapTapIsReportedOnRelease) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 7, 0, SFT_T(KC_P));
+
+    set_keymap({mod_tap_key});
+
+    // Within the tapping term nothing may be reported yet...
+    mod_tap_key.press();
+    EXPECT_NO_REPORT(driver);
+    idle_for(TAPPING_TERM / 2);
+    VERIFY_AND_CLEAR(driver);
+
+    // ...and the tap must go out on the release's own scan, not later.
+    const uint32_t released_at = timer_read32();
+    mod_tap_key.release();
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+
+    ASSERT_EQ(TestDriver::report_times().size(), 2u);
+    EXPECT_LE(TestDriver::report_times()[0] - released_at, 1u);
+    EXPECT_LE(TestDriver::report_times()[1] - released_at, 1u);
+}
+
+TEST_F(Latency, ModTapHoldResolvesAtTappingTerm) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 7, 0, SFT_T(KC_P));
+
+    set_keymap({mod_tap_key});
+
+    const uint32_t pressed_at = timer_read32();
+    mod_tap_key.press();
+    EXPECT_REPORT(driver, (KC_LSFT));
+    idle_for(TAPPING_TERM + 1);
+
+    // The hold may not resolve early, nor hang past the tapping term.
+    ASSERT_EQ(TestDriver::report_times().size(), 1u);
+    const uint32_t resolve_latency = TestDriver::last_report_time() - pressed_at;
+    EXPECT_GE(resolve_latency, (uint32_t)TAPPING_TERM - 1);
+    EXPECT_LE(resolve_latency, (uint32_t)TAPPING_TERM + 1);
+
+    const uint32_t released_at = timer_read32();
+    mod_tap_key.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    EXPECT_LE(TestDriver::last_report_time() - released_at, 1u);
+}
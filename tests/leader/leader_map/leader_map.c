@@ -0,0 +1,23 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+static void seq_a(void) {
+    tap_code(KC_1);
+}
+
+static void seq_a_b(void) {
+    tap_code(KC_2);
+}
+
+static void seq_b_c_d(void) {
+    tap_code(KC_3);
+}
+
+const leader_map_entry_t leader_map[] = {
+    LEADER_SEQUENCE(seq_a, KC_A),
+    LEADER_SEQUENCE(seq_a_b, KC_A, KC_B),
+    LEADER_SEQUENCE(seq_b_c_d, KC_B, KC_C, KC_D),
+    LEADER_MAP_END,
+};
@@ -0,0 +1,103 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+
+class LeaderMap : public TestFixture {};
+
+TEST_F(LeaderMap, unique_full_match_fires_immediately) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_b      = KeymapKey(0, 1, 0, KC_B);
+    auto key_c      = KeymapKey(0, 2, 0, KC_C);
+    auto key_d      = KeymapKey(0, 3, 0, KC_D);
+
+    set_keymap({key_leader, key_b, key_c, key_d});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+
+    EXPECT_EQ(leader_sequence_active(), true);
+
+    EXPECT_REPORT(driver, (KC_3));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_b);
+    tap_key(key_c);
+    tap_key(key_d);
+
+    // No other entry starts with this sequence, so it fires without waiting for the timeout
+    EXPECT_EQ(leader_sequence_active(), false);
+}
+
+TEST_F(LeaderMap, prefix_of_longer_entry_fires_on_timeout) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({key_leader, key_a});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+
+    // KC_A also prefixes the two-key entry, so the sequence stays open until timeout
+    EXPECT_EQ(leader_sequence_active(), true);
+
+    idle_for(300);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+}
+
+TEST_F(LeaderMap, longer_entry_fires_immediately_over_prefix) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+    auto key_b      = KeymapKey(0, 2, 0, KC_B);
+
+    set_keymap({key_leader, key_a, key_b});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+
+    EXPECT_REPORT(driver, (KC_2));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    tap_key(key_b);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+}
+
+TEST_F(LeaderMap, dead_prefix_abandons_sequence) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+    auto key_e      = KeymapKey(0, 2, 0, KC_E);
+
+    set_keymap({key_leader, key_a, key_e});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+
+    // KC_E starts no entry: the sequence ends right away without firing anything
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_e);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+
+    // Typing continues normally afterwards
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+}
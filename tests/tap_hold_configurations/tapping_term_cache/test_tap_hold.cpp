@@ -0,0 +1,103 @@
+// Copyright 2023 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+class TappingTermCache : public TestFixture {};
+
+// The long key gets a tapping term well above the global one and the short key
+// one well below it; the tests then check that the cached term tracks the key
+// being resolved rather than the global default or a previous decision's term.
+extern "C" uint16_t get_tapping_term(uint16_t keycode, keyrecord_t* record) {
+    switch (keycode) {
+        case SFT_T(KC_P):
+            return TAPPING_TERM + 100;
+        case RSFT_T(KC_A):
+            return TAPPING_TERM - 100;
+        default:
+            return TAPPING_TERM;
+    }
+}
+
+TEST_F(TappingTermCache, long_per_key_term_still_taps_past_global_term) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_hold_key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+
+    set_keymap({mod_tap_hold_key});
+
+    /* Press mod-tap-hold key and idle past the global tapping term, but not
+     * past this key's tapping term. */
+    EXPECT_NO_REPORT(driver);
+    mod_tap_hold_key.press();
+    idle_for(TAPPING_TERM + 50);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release mod-tap-hold key. */
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_hold_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TappingTermCache, short_per_key_term_holds_before_global_term) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_hold_key = KeymapKey(0, 1, 0, RSFT_T(KC_A));
+
+    set_keymap({mod_tap_hold_key});
+
+    /* Press mod-tap-hold key and idle past this key's tapping term, but not
+     * past the global tapping term. */
+    EXPECT_REPORT(driver, (KC_RIGHT_SHIFT));
+    mod_tap_hold_key.press();
+    idle_for(TAPPING_TERM - 100 + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release mod-tap-hold key. */
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_hold_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TappingTermCache, cached_term_is_refreshed_between_decisions) {
+    TestDriver driver;
+    InSequence s;
+    auto       long_term_key  = KeymapKey(0, 1, 0, SFT_T(KC_P));
+    auto       short_term_key = KeymapKey(0, 2, 0, RSFT_T(KC_A));
+
+    set_keymap({long_term_key, short_term_key});
+
+    /* Tap the long-term key. */
+    EXPECT_NO_REPORT(driver);
+    long_term_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    long_term_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Hold the short-term key: its own term must apply, not a stale copy of
+     * the previous key's term. */
+    EXPECT_REPORT(driver, (KC_RIGHT_SHIFT));
+    short_term_key.press();
+    idle_for(TAPPING_TERM - 100 + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    short_term_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
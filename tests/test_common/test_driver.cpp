@@ -15,8 +15,10 @@
  */
 
 #include "test_driver.hpp"
+#include "timer.h"
 
-TestDriver* TestDriver::m_this = nullptr;
+TestDriver*           TestDriver::m_this = nullptr;
+std::vector<uint32_t> TestDriver::m_report_times;
 
 namespace {
 // Given a hex digit between 0 and 15, returns the corresponding keycode.
@@ -46,9 +48,22 @@ uint8_t TestDriver::keyboard_leds(void) {
 
 void TestDriver::send_keyboard(report_keyboard_t* report) {
     test_logger.trace() << *report;
+    m_report_times.push_back(timer_read32());
     m_this->send_keyboard_mock(*report);
 }
 
+const std::vector<uint32_t>& TestDriver::report_times() {
+    return m_report_times;
+}
+
+uint32_t TestDriver::last_report_time() {
+    return m_report_times.empty() ? 0 : m_report_times.back();
+}
+
+void TestDriver::clear_report_times() {
+    m_report_times.clear();
+}
+
 void TestDriver::send_mouse(report_mouse_t* report) {
     m_this->send_mouse_mock(*report);
 }
@@ -18,6 +18,7 @@
 
 #include "gmock/gmock.h"
 #include <stdint.h>
+#include <vector>
 #include "host.h"
 #include "keyboard_report_util.hpp"
 #include "test_logger.hpp"
@@ -34,6 +35,21 @@ class TestDriver {
     MOCK_METHOD1(send_mouse_mock, void(report_mouse_t&));
     MOCK_METHOD1(send_extra_mock, void(report_extra_t&));
 
+    /**
+     * @brief Simulated timestamps (`timer_read32()`) of every keyboard
+     * report sent since the start of the test, in order. Together with the
+     * virtual timer this allows asserting scan-to-report latency budgets.
+     */
+    static const std::vector<uint32_t>& report_times();
+
+    /**
+     * @brief Timestamp of the most recent keyboard report, or 0 if none
+     * has been sent yet.
+     */
+    static uint32_t last_report_time();
+
+    static void clear_report_times();
+
    private:
     static uint8_t     keyboard_leds(void);
     static void        send_keyboard(report_keyboard_t* report);
@@ -42,6 +58,8 @@ class TestDriver {
     host_driver_t      m_driver;
     uint8_t            m_leds = 0;
     static TestDriver* m_this;
+
+    static std::vector<uint32_t> m_report_times;
 };
 
 /**
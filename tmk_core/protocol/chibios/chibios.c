@@ -173,13 +173,45 @@ void protocol_pre_init(void) {
     print("USB configured.\n");
 }
 
+#ifdef MATRIX_SCAN_THREAD_ENABLE
+#    ifndef MATRIX_SCAN_THREAD_PRIO
+#        define MATRIX_SCAN_THREAD_PRIO (NORMALPRIO + 2)
+#    endif
+#    ifndef MATRIX_SCAN_THREAD_WA_SIZE
+#        define MATRIX_SCAN_THREAD_WA_SIZE 1024
+#    endif
+
+static THD_WORKING_AREA(waMatrixScanThread, MATRIX_SCAN_THREAD_WA_SIZE);
+static THD_FUNCTION(MatrixScanThread, arg) {
+    (void)arg;
+    chRegSetThreadName("matrix_scan");
+    while (true) {
+        keyboard_scan_thread_iteration();
+        /* One scan per tick. Sleeping (rather than yielding) is what lets
+         * the normal-priority main loop run at all; debounce is
+         * time-based, so scanning faster than 1kHz buys nothing. */
+        chThdSleepMilliseconds(1);
+    }
+}
+#endif
+
 void protocol_post_init(void) {
     host_set_driver(driver);
+#ifdef MATRIX_SCAN_THREAD_ENABLE
+    /* Started only after keyboard_init() has brought up the matrix. */
+    chThdCreateStatic(waMatrixScanThread, sizeof(waMatrixScanThread), MATRIX_SCAN_THREAD_PRIO, MatrixScanThread, NULL);
+#endif
 }
 
 void protocol_pre_task(void) {
     usb_event_queue_task();
 
+#ifdef USB_SOF_ALIGNED_SCAN
+    /* Pace each pass of the main loop off the host's frame schedule, so
+     * matrix scanning completes at a fixed phase relative to the IN poll. */
+    usb_sof_align();
+#endif
+
 #if !defined(NO_USB_STARTUP_CHECK)
     if (USB_DRIVER.state == USB_SUSPENDED) {
         print("[s]");
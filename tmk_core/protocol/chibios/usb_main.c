@@ -32,6 +32,7 @@
 #include "usb_main.h"
 
 #include "host.h"
+#include "led.h"
 #include "chibios_config.h"
 #include "debug.h"
 #include "suspend.h"
@@ -39,6 +40,9 @@
 #    include "sleep_led.h"
 #    include "led.h"
 #endif
+#ifdef VIRTSER_ENABLE
+#    include "virtser.h"
+#endif
 #include "wait.h"
 #include "usb_device_state.h"
 #include "usb_descriptor.h"
@@ -139,6 +143,54 @@ static void dummy_usb_cb(USBDriver *usbp, usbep_t ep) {
     (void)ep;
 }
 
+#ifdef USB_REPORT_MAILBOX
+/* One staging slot per IN endpoint. send_report() copies the report into the
+ * slot and arms the endpoint if it is idle; if a transfer is still running,
+ * the slot is marked pending and the IN notification callback arms it on
+ * completion. Writers never block with the system locked, and the LLD always
+ * reads from a buffer that outlives the transfer. A newer report overwrites
+ * an unsent one - intermediate states the host never polled for carry no
+ * information.
+ *
+ * The slot array can be placed in USB-dedicated/USB-adjacent RAM by defining
+ * USB_REPORT_MAILBOX_SECTION (e.g. ".usbram") together with a matching
+ * linker section; data then only crosses the bus matrix once.
+ */
+#    ifndef USB_REPORT_MAILBOX_SLOT_SIZE
+#        define USB_REPORT_MAILBOX_SLOT_SIZE 32
+#    endif
+
+#    ifdef USB_REPORT_MAILBOX_SECTION
+#        define USB_REPORT_MAILBOX_ATTR __attribute__((section(USB_REPORT_MAILBOX_SECTION)))
+#    else
+#        define USB_REPORT_MAILBOX_ATTR
+#    endif
+
+typedef struct {
+    volatile bool pending;
+    uint16_t      size;
+    uint8_t       data[USB_REPORT_MAILBOX_SLOT_SIZE];
+} usb_report_slot_t;
+
+/* Indexed by endpoint number; slot 0 (control endpoint) is unused. */
+static usb_report_slot_t usb_report_slots[MAX_ENDPOINTS + 1] USB_REPORT_MAILBOX_ATTR;
+
+/* IN notification callback: arm the endpoint with the newest staged report. */
+static void usb_report_in_cb(USBDriver *usbp, usbep_t ep) {
+    usb_report_slot_t *slot = &usb_report_slots[ep];
+    osalSysLockFromISR();
+    if (slot->pending) {
+        slot->pending = false;
+        usbStartTransmitI(usbp, ep, slot->data, slot->size);
+    }
+    osalSysUnlockFromISR();
+}
+
+#    define report_in_cb usb_report_in_cb
+#else
+#    define report_in_cb dummy_usb_cb
+#endif
+
 #ifndef KEYBOARD_SHARED_EP
 /* keyboard endpoint state structure */
 static USBInEndpointState kbd_ep_state;
@@ -146,7 +198,7 @@ static USBInEndpointState kbd_ep_state;
 static const USBEndpointConfig kbd_ep_config = {
     USB_EP_MODE_TYPE_INTR,  /* Interrupt EP */
     NULL,                   /* SETUP packet notification callback */
-    dummy_usb_cb,           /* IN notification callback */
+    report_in_cb,           /* IN notification callback */
     NULL,                   /* OUT notification callback */
     KEYBOARD_EPSIZE,        /* IN maximum packet size */
     0,                      /* OUT maximum packet size */
@@ -164,7 +216,7 @@ static USBInEndpointState mouse_ep_state;
 static const USBEndpointConfig mouse_ep_config = {
     USB_EP_MODE_TYPE_INTR,  /* Interrupt EP */
     NULL,                   /* SETUP packet notification callback */
-    dummy_usb_cb,           /* IN notification callback */
+    report_in_cb,           /* IN notification callback */
     NULL,                   /* OUT notification callback */
     MOUSE_EPSIZE,           /* IN maximum packet size */
     0,                      /* OUT maximum packet size */
@@ -182,7 +234,7 @@ static USBInEndpointState shared_ep_state;
 static const USBEndpointConfig shared_ep_config = {
     USB_EP_MODE_TYPE_INTR,  /* Interrupt EP */
     NULL,                   /* SETUP packet notification callback */
-    dummy_usb_cb,           /* IN notification callback */
+    report_in_cb,           /* IN notification callback */
     NULL,                   /* OUT notification callback */
     SHARED_EPSIZE,          /* IN maximum packet size */
     0,                      /* OUT maximum packet size */
@@ -200,7 +252,7 @@ static USBInEndpointState joystick_ep_state;
 static const USBEndpointConfig joystick_ep_config = {
     USB_EP_MODE_TYPE_INTR,  /* Interrupt EP */
     NULL,                   /* SETUP packet notification callback */
-    dummy_usb_cb,           /* IN notification callback */
+    report_in_cb,           /* IN notification callback */
     NULL,                   /* OUT notification callback */
     JOYSTICK_EPSIZE,        /* IN maximum packet size */
     0,                      /* OUT maximum packet size */
@@ -218,7 +270,7 @@ static USBInEndpointState digitizer_ep_state;
 static const USBEndpointConfig digitizer_ep_config = {
     USB_EP_MODE_TYPE_INTR,  /* Interrupt EP */
     NULL,                   /* SETUP packet notification callback */
-    dummy_usb_cb,           /* IN notification callback */
+    report_in_cb,           /* IN notification callback */
     NULL,                   /* OUT notification callback */
     DIGITIZER_EPSIZE,       /* IN maximum packet size */
     0,                      /* OUT maximum packet size */
@@ -506,6 +558,12 @@ static void usb_event_cb(USBDriver *usbp, usbevent_t event) {
 
         case USB_EVENT_CONFIGURED:
             osalSysLockFromISR();
+#ifdef USB_REPORT_MAILBOX
+            /* Drop reports staged before the (re-)enumeration. */
+            for (int ep = 0; ep <= MAX_ENDPOINTS; ep++) {
+                usb_report_slots[ep].pending = false;
+            }
+#endif
             /* Enable the endpoints specified into the configuration. */
 #ifndef KEYBOARD_SHARED_EP
             usbInitEndpointI(usbp, KEYBOARD_IN_EPNUM, &kbd_ep_config);
@@ -600,9 +658,11 @@ static void set_led_transfer_cb(USBDriver *usbp) {
         uint8_t report_id = set_report_buf[0];
         if ((report_id == REPORT_ID_KEYBOARD) || (report_id == REPORT_ID_NKRO)) {
             keyboard_led_state = set_report_buf[1];
+            led_update_dirty();
         }
     } else {
         keyboard_led_state = set_report_buf[0];
+        led_update_dirty();
     }
 }
 
@@ -745,12 +805,36 @@ static bool usb_request_hook_cb(USBDriver *usbp) {
     return FALSE;
 }
 
+#ifdef USB_SOF_ALIGNED_SCAN
+/* Thread parked in usb_sof_align() waiting for the next frame. */
+static thread_reference_t sof_aligned_thread = NULL;
+
+void usb_sof_align(void) {
+    if (USB_DRIVER.state != USB_ACTIVE) return;
+
+    /* Park until the SOF callback releases us; time out after two frames so
+     * a bus error or suspend transition cannot wedge the scan loop. */
+    osalSysLock();
+    osalThreadSuspendTimeoutS(&sof_aligned_thread, TIME_MS2I(2));
+    osalSysUnlock();
+
+#    if USB_SOF_SCAN_PHASE_US > 0
+    /* Push the scan later into the frame so the report lands on the IN
+     * endpoint shortly before the next poll picks it up. */
+    wait_us(USB_SOF_SCAN_PHASE_US);
+#    endif
+}
+#endif
+
 /* Start-of-frame callback */
 static void usb_sof_cb(USBDriver *usbp) {
     osalSysLockFromISR();
     for (int i = 0; i < NUM_USB_DRIVERS; i++) {
         qmkusbSOFHookI(&drivers.array[i].driver);
     }
+#ifdef USB_SOF_ALIGNED_SCAN
+    osalThreadResumeI(&sof_aligned_thread, MSG_OK);
+#endif
     osalSysUnlockFromISR();
 }
 
@@ -860,6 +944,34 @@ uint8_t keyboard_leds(void) {
 }
 
 void send_report(uint8_t endpoint, void *report, size_t size) {
+#ifdef USB_REPORT_MAILBOX
+    usb_report_slot_t *slot = &usb_report_slots[endpoint];
+
+    if (size > sizeof(slot->data)) {
+        /* Raise USB_REPORT_MAILBOX_SLOT_SIZE to cover the largest report. */
+        return;
+    }
+
+    osalSysLock();
+    if (usbGetDriverStateI(&USB_DRIVER) != USB_ACTIVE) {
+        slot->pending = false;
+        osalSysUnlock();
+        return;
+    }
+
+    memcpy(slot->data, report, size);
+    slot->size = size;
+    if (usbGetTransmitStatusI(&USB_DRIVER, endpoint)) {
+        /* Endpoint busy: leave the newest report staged; the IN notification
+         * callback arms it when the running transfer completes. No thread is
+         * suspended while a NAKing host sits on the endpoint. */
+        slot->pending = true;
+    } else {
+        slot->pending = false;
+        usbStartTransmitI(&USB_DRIVER, endpoint, slot->data, size);
+    }
+    osalSysUnlock();
+#else
     osalSysLock();
     if (usbGetDriverStateI(&USB_DRIVER) != USB_ACTIVE) {
         osalSysUnlock();
@@ -878,6 +990,7 @@ void send_report(uint8_t endpoint, void *report, size_t size) {
     }
     usbStartTransmitI(&USB_DRIVER, endpoint, report, size);
     osalSysUnlock();
+#endif
 }
 
 /* prepare and start sending a report IN
@@ -1034,6 +1147,12 @@ void send_midi_packet(MIDI_EventPacket_t *event) {
     chnWrite(&drivers.midi_driver.driver, (uint8_t *)event, sizeof(MIDI_EventPacket_t));
 }
 
+void send_midi_packets(MIDI_EventPacket_t *events, uint8_t count) {
+    // single write; the endpoint packs as many 4-byte events per transaction
+    // as the endpoint size allows
+    chnWrite(&drivers.midi_driver.driver, (uint8_t *)events, count * sizeof(MIDI_EventPacket_t));
+}
+
 bool recv_midi_packet(MIDI_EventPacket_t *const event) {
     size_t size = chnReadTimeout(&drivers.midi_driver.driver, (uint8_t *)event, sizeof(MIDI_EventPacket_t), TIME_IMMEDIATE);
     return size == sizeof(MIDI_EventPacket_t);
@@ -1059,6 +1178,10 @@ void virtser_send(const uint8_t byte) {
     chnWrite(&drivers.serial_driver.driver, &byte, 1);
 }
 
+void virtser_send_buffer(const uint8_t *data, uint8_t length) {
+    chnWrite(&drivers.serial_driver.driver, data, length);
+}
+
 __attribute__((weak)) void virtser_recv(uint8_t c) {
     // Ignore by default
 }
@@ -1072,6 +1195,8 @@ void virtser_task(void) {
             virtser_recv(buffer[i]);
         }
     } while (numBytesReceived > 0);
+
+    virtser_flush();
 }
 
 #endif
@@ -47,6 +47,26 @@ void usb_event_queue_init(void);
 /* Task to dequeue and execute any handlers for the USB events on the main thread */
 void usb_event_queue_task(void);
 
+/* -------------------------
+ * SOF-aligned scan pacing
+ * -------------------------
+ */
+
+#ifdef USB_SOF_ALIGNED_SCAN
+
+/* How far into the 1ms frame (in microseconds) the scan loop is released.
+ * Raise this until the scan plus event processing finishes just before the
+ * next start-of-frame, minimizing how stale a report is when it is polled. */
+#    ifndef USB_SOF_SCAN_PHASE_US
+#        define USB_SOF_SCAN_PHASE_US 0
+#    endif
+
+/* Block until the next USB start-of-frame (plus the configured phase
+ * offset); returns immediately while the bus is not active. */
+void usb_sof_align(void);
+
+#endif
+
 /* --------------
  * Console header
  * --------------
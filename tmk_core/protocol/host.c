@@ -19,6 +19,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "keyboard.h"
 #include "keycode.h"
 #include "host.h"
+#include "led.h"
 #include "util.h"
 #include "debug.h"
 
@@ -35,17 +36,93 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "outputselect.h"
 #endif
 
+#ifdef RADIO_ENABLE
+#    include "radio.h"
+#    include "outputselect.h"
+#endif
+
 #ifdef NKRO_ENABLE
 #    include "keycode_config.h"
 extern keymap_config_t keymap_config;
 #endif
 
+#ifdef LATENCY_HISTOGRAM_ENABLE
+#    include "latency_histogram.h"
+#endif
+
+#ifdef EVENT_TRACE_ENABLE
+#    include "event_trace.h"
+#endif
+
+#ifdef EXTRAKEY_REPEAT
+#    ifndef DEFERRED_EXEC_ENABLE
+#        error EXTRAKEY_REPEAT requires deferred execution; add DEFERRED_EXEC_ENABLE = yes to your rules.mk.
+#    endif
+#    include "deferred_exec.h"
+// How long an extra key must be held before firmware repeat kicks in, and the period between repeats.
+#    ifndef EXTRAKEY_REPEAT_DELAY
+#        define EXTRAKEY_REPEAT_DELAY 500
+#    endif
+#    ifndef EXTRAKEY_REPEAT_INTERVAL
+#        define EXTRAKEY_REPEAT_INTERVAL 100
+#    endif
+#endif
+
 static host_driver_t *driver;
 static uint16_t       last_system_usage   = 0;
 static uint16_t       last_consumer_usage = 0;
 
+static void host_system_report_send(uint16_t usage);
+static void host_consumer_report_send(uint16_t usage);
+
+#ifdef EXTRAKEY_REPEAT
+/* Firmware-side auto-repeat for consumer/system usages. Hosts repeat ordinary
+ * keys themselves but most leave held media keys alone, so macro code ends up
+ * simulating repeats with ad-hoc timed re-sends. Instead, once a usage has
+ * been held for EXTRAKEY_REPEAT_DELAY, a deferred callback pulses it
+ * (release + re-press) every EXTRAKEY_REPEAT_INTERVAL until it is released.
+ * Only the most recently pressed extra key repeats, like typewriter repeat. */
+static deferred_token extrakey_repeat_token       = INVALID_DEFERRED_TOKEN;
+static uint16_t       extrakey_repeat_usage       = 0;
+static bool           extrakey_repeat_is_consumer = false;
+
+static uint32_t extrakey_repeat_callback(uint32_t trigger_time, void *cb_arg) {
+    // Pulse below the deduplication layer so the host registers a fresh press;
+    // the held usage is restored, keeping the dedup state consistent.
+    if (extrakey_repeat_is_consumer) {
+        host_consumer_report_send(0);
+        host_consumer_report_send(extrakey_repeat_usage);
+    } else {
+        host_system_report_send(0);
+        host_system_report_send(extrakey_repeat_usage);
+    }
+    return EXTRAKEY_REPEAT_INTERVAL;
+}
+
+static void extrakey_repeat_note(bool is_consumer, uint16_t usage) {
+    if (usage == 0) {
+        // Only a release of the repeating key stops the repeat
+        if (extrakey_repeat_token != INVALID_DEFERRED_TOKEN && is_consumer == extrakey_repeat_is_consumer) {
+            cancel_deferred_exec(extrakey_repeat_token);
+            extrakey_repeat_token = INVALID_DEFERRED_TOKEN;
+            extrakey_repeat_usage = 0;
+        }
+        return;
+    }
+
+    if (extrakey_repeat_token != INVALID_DEFERRED_TOKEN) {
+        cancel_deferred_exec(extrakey_repeat_token);
+    }
+    extrakey_repeat_usage       = usage;
+    extrakey_repeat_is_consumer = is_consumer;
+    extrakey_repeat_token       = defer_exec(EXTRAKEY_REPEAT_DELAY, extrakey_repeat_callback, NULL);
+}
+#endif
+
 void host_set_driver(host_driver_t *d) {
     driver = d;
+    // A new driver may report a different LED state than the previous one.
+    led_update_dirty();
 }
 
 host_driver_t *host_get_driver(void) {
@@ -56,6 +133,7 @@ host_driver_t *host_get_driver(void) {
 uint8_t split_led_state = 0;
 void    set_split_host_keyboard_leds(uint8_t led_state) {
     split_led_state = led_state;
+    led_update_dirty();
 }
 #endif
 
@@ -73,12 +151,25 @@ led_t host_keyboard_led_state(void) {
 
 /* send report */
 void host_keyboard_send(report_keyboard_t *report) {
+    if (!report_cache_should_send_keyboard(report)) return;
+#ifdef LATENCY_HISTOGRAM_ENABLE
+    latency_histogram_note_report();
+#endif
+#ifdef EVENT_TRACE_ENABLE
+    event_trace_note_report();
+#endif
 #ifdef BLUETOOTH_ENABLE
     if (where_to_send() == OUTPUT_BLUETOOTH) {
         bluetooth_send_keyboard(report);
         return;
     }
 #endif
+#ifdef RADIO_ENABLE
+    if (where_to_send() == OUTPUT_RF) {
+        radio_send_keyboard(report);
+        return;
+    }
+#endif
 
     if (!driver) return;
 #if defined(NKRO_ENABLE) && defined(NKRO_SHARED_EP)
@@ -107,12 +198,19 @@ void host_keyboard_send(report_keyboard_t *report) {
 }
 
 void host_mouse_send(report_mouse_t *report) {
+    if (!report_cache_should_send_mouse(report)) return;
 #ifdef BLUETOOTH_ENABLE
     if (where_to_send() == OUTPUT_BLUETOOTH) {
         bluetooth_send_mouse(report);
         return;
     }
 #endif
+#ifdef RADIO_ENABLE
+    if (where_to_send() == OUTPUT_RF) {
+        radio_send_mouse(report);
+        return;
+    }
+#endif
 
     if (!driver) return;
 #ifdef MOUSE_SHARED_EP
@@ -127,9 +225,30 @@ void host_mouse_send(report_mouse_t *report) {
 }
 
 void host_system_send(uint16_t usage) {
-    if (usage == last_system_usage) return;
+    if (usage == last_system_usage) {
+        report_cache_note_suppressed(REPORT_CACHE_SYSTEM);
+        return;
+    }
     last_system_usage = usage;
 
+#ifdef EXTRAKEY_REPEAT
+    extrakey_repeat_note(false, usage);
+#endif
+    host_system_report_send(usage);
+}
+
+static void host_system_report_send(uint16_t usage) {
+#ifdef RADIO_ENABLE
+    if (where_to_send() == OUTPUT_RF) {
+        report_extra_t rf_report = {
+            .report_id = REPORT_ID_SYSTEM,
+            .usage     = usage,
+        };
+        radio_send_extra(&rf_report);
+        return;
+    }
+#endif
+
     if (!driver) return;
 
     report_extra_t report = {
@@ -140,15 +259,35 @@ void host_system_send(uint16_t usage) {
 }
 
 void host_consumer_send(uint16_t usage) {
-    if (usage == last_consumer_usage) return;
+    if (usage == last_consumer_usage) {
+        report_cache_note_suppressed(REPORT_CACHE_CONSUMER);
+        return;
+    }
     last_consumer_usage = usage;
 
+#ifdef EXTRAKEY_REPEAT
+    extrakey_repeat_note(true, usage);
+#endif
+    host_consumer_report_send(usage);
+}
+
+static void host_consumer_report_send(uint16_t usage) {
 #ifdef BLUETOOTH_ENABLE
     if (where_to_send() == OUTPUT_BLUETOOTH) {
         bluetooth_send_consumer(usage);
         return;
     }
 #endif
+#ifdef RADIO_ENABLE
+    if (where_to_send() == OUTPUT_RF) {
+        report_extra_t rf_report = {
+            .report_id = REPORT_ID_CONSUMER,
+            .usage     = usage,
+        };
+        radio_send_extra(&rf_report);
+        return;
+    }
+#endif
 
     if (!driver) return;
 
@@ -87,6 +87,71 @@ static void    send_mouse(report_mouse_t *report);
 static void    send_extra(report_extra_t *report);
 host_driver_t  lufa_driver = {keyboard_leds, send_keyboard, send_mouse, send_extra};
 
+#ifdef USB_REPORT_MAILBOX
+/* Mailbox holding the newest keyboard report the host has not accepted yet.
+ * send_keyboard() stores here instead of busy-waiting on the IN endpoint;
+ * the 1ms start-of-frame interrupt retries until the bank frees. A newer
+ * report overwrites an unsent one - intermediate states the host never
+ * polled for carry no information. */
+static uint8_t       report_mailbox_data[sizeof(report_keyboard_t)];
+static uint8_t       report_mailbox_endpoint;
+static uint8_t       report_mailbox_size;
+static volatile bool report_mailbox_full = false;
+
+/* Hand the stored report to the endpoint if its bank is free. Runs from
+ * both the main loop and the SOF interrupt; main loop callers must wrap it
+ * in ATOMIC_BLOCK. The selected endpoint is restored so an interrupted
+ * endpoint stream elsewhere resumes where it left off. */
+static void report_mailbox_flush(void) {
+    if (!report_mailbox_full) return;
+
+    if (USB_DeviceState != DEVICE_STATE_Configured) {
+        report_mailbox_full = false;
+        return;
+    }
+
+    uint8_t prev_endpoint = Endpoint_GetCurrentEndpoint();
+    Endpoint_SelectEndpoint(report_mailbox_endpoint);
+    if (Endpoint_IsReadWriteAllowed()) {
+        Endpoint_Write_Stream_LE(report_mailbox_data, report_mailbox_size, NULL);
+        Endpoint_ClearIN();
+        report_mailbox_full = false;
+    }
+    Endpoint_SelectEndpoint(prev_endpoint);
+}
+#endif
+
+#ifdef USB_SOF_ALIGNED_SCAN
+#    ifndef USB_SOF_SCAN_PHASE_US
+#        define USB_SOF_SCAN_PHASE_US 0
+#    endif
+/* Set by the 1ms start-of-frame interrupt, consumed by usb_sof_align(). */
+static volatile bool usb_sof_seen = false;
+
+/* Block until the next USB start-of-frame (plus the configured phase offset)
+ * so each pass of the main loop scans at a fixed phase relative to the host's
+ * polling schedule. There is no thread to yield to on AVR, so the dead time is
+ * spent on USB housekeeping; a two-frame timeout keeps a suspend transition or
+ * bus error from wedging the scan loop. */
+static void usb_sof_align(void) {
+    if (USB_DeviceState != DEVICE_STATE_Configured) return;
+
+    usb_sof_seen   = false;
+    uint16_t start = timer_read();
+    while (!usb_sof_seen) {
+        if (timer_elapsed(start) > 2) return;
+#    if !defined(INTERRUPT_CONTROL_ENDPOINT)
+        USB_USBTask();
+#    endif
+    }
+#    if USB_SOF_SCAN_PHASE_US > 0
+    /* Push the scan later into the frame so the report lands on the IN
+     * endpoint shortly before the next poll picks it up. */
+    wait_us(USB_SOF_SCAN_PHASE_US);
+#    endif
+}
+#endif
+
 void send_report(uint8_t endpoint, void *report, size_t size) {
     uint8_t timeout = 255;
 
@@ -334,13 +399,24 @@ static bool console_flush = false;
                 console_flush = b;              \
             }                                   \
         } while (0)
+#endif
 
+#if defined(CONSOLE_ENABLE) || defined(USB_REPORT_MAILBOX) || defined(USB_SOF_ALIGNED_SCAN)
 /** \brief Event USB Device Start Of Frame
  *
  * FIXME: Needs doc
  * called every 1ms
  */
 void EVENT_USB_Device_StartOfFrame(void) {
+#    ifdef USB_SOF_ALIGNED_SCAN
+    usb_sof_seen = true;
+#    endif
+
+#    ifdef USB_REPORT_MAILBOX
+    report_mailbox_flush();
+#    endif
+
+#    ifdef CONSOLE_ENABLE
     static uint8_t count;
     if (++count % 50) return;
     count = 0;
@@ -348,6 +424,7 @@ void EVENT_USB_Device_StartOfFrame(void) {
     if (!console_flush) return;
     Console_Task();
     console_flush = false;
+#    endif
 }
 
 #endif
@@ -478,9 +555,11 @@ void EVENT_USB_Device_ControlRequest(void) {
 
                             if (report_id == REPORT_ID_KEYBOARD || report_id == REPORT_ID_NKRO) {
                                 keyboard_led_state = Endpoint_Read_8();
+                                led_update_dirty();
                             }
                         } else {
                             keyboard_led_state = Endpoint_Read_8();
+                            led_update_dirty();
                         }
 
                         Endpoint_ClearOUT();
@@ -563,19 +642,43 @@ static void send_keyboard(report_keyboard_t *report) {
     uint8_t ep   = KEYBOARD_IN_EPNUM;
     uint8_t size = KEYBOARD_REPORT_SIZE;
 
+#ifdef USB_REPORT_MAILBOX
+    uint8_t *data = (uint8_t *)report;
+
+    /* If we're in Boot Protocol, don't send any report ID or other funky fields */
+    if (!keyboard_protocol) {
+        data = &report->mods;
+        size = 8;
+    }
+#    ifdef NKRO_ENABLE
+    else if (keymap_config.nkro) {
+        ep   = SHARED_IN_EPNUM;
+        size = sizeof(struct nkro_report);
+    }
+#    endif
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        memcpy(report_mailbox_data, data, size);
+        report_mailbox_endpoint = ep;
+        report_mailbox_size     = size;
+        report_mailbox_full     = true;
+        report_mailbox_flush();
+    }
+#else
     /* If we're in Boot Protocol, don't send any report ID or other funky fields */
     if (!keyboard_protocol) {
         send_report(ep, &report->mods, 8);
     } else {
-#ifdef NKRO_ENABLE
+#    ifdef NKRO_ENABLE
         if (keymap_config.nkro) {
             ep   = SHARED_IN_EPNUM;
             size = sizeof(struct nkro_report);
         }
-#endif
+#    endif
 
         send_report(ep, report, size);
     }
+#endif
 
     keyboard_report_sent = *report;
 }
@@ -714,6 +817,16 @@ void send_midi_packet(MIDI_EventPacket_t *event) {
     MIDI_Device_SendEventPacket(&USB_MIDI_Interface, event);
 }
 
+void send_midi_packets(MIDI_EventPacket_t *events, uint8_t count) {
+    // SendEventPacket only queues into the endpoint bank; flushing once after
+    // the batch sends the whole bundle in as few transactions as the endpoint
+    // size allows
+    for (uint8_t i = 0; i < count; i++) {
+        MIDI_Device_SendEventPacket(&USB_MIDI_Interface, &events[i]);
+    }
+    MIDI_Device_Flush(&USB_MIDI_Interface);
+}
+
 bool recv_midi_packet(MIDI_EventPacket_t *const event) {
     return MIDI_Device_ReceiveEventPacket(&USB_MIDI_Interface, event);
 }
@@ -754,14 +867,24 @@ void virtser_task(void) {
         ch = CDC_Device_ReceiveByte(&cdc_device);
         virtser_recv(ch);
     }
+
+    virtser_flush();
 }
 /** \brief Virtual Serial Send
  *
  * FIXME: Needs doc
  */
 void virtser_send(const uint8_t byte) {
-    uint8_t timeout = 255;
-    uint8_t ep      = Endpoint_GetCurrentEndpoint();
+    virtser_send_buffer(&byte, 1);
+}
+
+/** \brief Virtual Serial Send Buffer
+ *
+ * Sends the whole buffer in one go, selecting the endpoint and flushing only
+ * once instead of per byte.
+ */
+void virtser_send_buffer(const uint8_t *data, uint8_t length) {
+    uint8_t ep = Endpoint_GetCurrentEndpoint();
 
     if (cdc_device.State.ControlLineStates.HostToDevice & CDC_CONTROL_LINE_OUT_DTR) {
         /* IN packet */
@@ -772,10 +895,14 @@ void virtser_send(const uint8_t byte) {
             return;
         }
 
-        while (timeout-- && !Endpoint_IsReadWriteAllowed())
-            _delay_us(40);
+        while (length--) {
+            uint8_t timeout = 255;
+
+            while (timeout-- && !Endpoint_IsReadWriteAllowed())
+                _delay_us(40);
 
-        Endpoint_Write_8(byte);
+            Endpoint_Write_8(*data++);
+        }
         CDC_Device_Flush(&cdc_device);
 
         if (Endpoint_IsINReady()) {
@@ -856,6 +983,12 @@ void protocol_post_init(void) {
 }
 
 void protocol_pre_task(void) {
+#ifdef USB_SOF_ALIGNED_SCAN
+    /* Pace each pass of the main loop off the host's frame schedule, so
+     * matrix scanning completes at a fixed phase relative to the IN poll. */
+    usb_sof_align();
+#endif
+
 #if !defined(NO_USB_STARTUP_CHECK)
     if (USB_DeviceState == DEVICE_STATE_Suspended) {
         print("[s]");
@@ -31,20 +31,39 @@ static int8_t cb_tail  = 0;
 static int8_t cb_count = 0;
 #endif
 
+#ifdef NKRO_ENABLE
+/* The NKRO bitmap is scanned on every key event, so it is walked in 32-bit
+ * chunks with bit intrinsics instead of byte-by-byte. It lives inside a
+ * packed union with no alignment guarantee, so the words go through memcpy;
+ * on targets that allow unaligned access this compiles to a plain load. */
+#    define NKRO_BITS_WORDS (KEYBOARD_REPORT_BITS / 4)
+
+static inline uint32_t nkro_bits_word(report_keyboard_t* keyboard_report, uint8_t word) {
+    uint32_t bits;
+    memcpy(&bits, &keyboard_report->nkro.bits[word * 4], sizeof(bits));
+    return bits;
+}
+#endif
+
 /** \brief has_anykey
  *
- * FIXME: Needs doc
+ * Returns the number of keys (not modifiers) held in the report.
  */
 uint8_t has_anykey(report_keyboard_t* keyboard_report) {
-    uint8_t  cnt = 0;
-    uint8_t* p   = keyboard_report->keys;
-    uint8_t  lp  = sizeof(keyboard_report->keys);
+    uint8_t cnt = 0;
 #ifdef NKRO_ENABLE
     if (keyboard_protocol && keymap_config.nkro) {
-        p  = keyboard_report->nkro.bits;
-        lp = sizeof(keyboard_report->nkro.bits);
+        for (uint8_t w = 0; w < NKRO_BITS_WORDS; w++) {
+            cnt += __builtin_popcount(nkro_bits_word(keyboard_report, w));
+        }
+        for (uint8_t i = NKRO_BITS_WORDS * 4; i < KEYBOARD_REPORT_BITS; i++) {
+            cnt += __builtin_popcount(keyboard_report->nkro.bits[i]);
+        }
+        return cnt;
     }
 #endif
+    uint8_t* p  = keyboard_report->keys;
+    uint8_t  lp = sizeof(keyboard_report->keys);
     while (lp--) {
         if (*p++) cnt++;
     }
@@ -53,15 +72,23 @@ uint8_t has_anykey(report_keyboard_t* keyboard_report) {
 
 /** \brief get_first_key
  *
- * FIXME: Needs doc
+ * Returns the keycode of the first key held in the report, 0 if none.
  */
 uint8_t get_first_key(report_keyboard_t* keyboard_report) {
 #ifdef NKRO_ENABLE
     if (keyboard_protocol && keymap_config.nkro) {
-        uint8_t i = 0;
-        for (; i < KEYBOARD_REPORT_BITS && !keyboard_report->nkro.bits[i]; i++)
-            ;
-        return i << 3 | biton(keyboard_report->nkro.bits[i]);
+        for (uint8_t w = 0; w < NKRO_BITS_WORDS; w++) {
+            uint32_t bits = nkro_bits_word(keyboard_report, w);
+            if (bits) {
+                return w * 32 + __builtin_ctz(bits);
+            }
+        }
+        for (uint8_t i = NKRO_BITS_WORDS * 4; i < KEYBOARD_REPORT_BITS; i++) {
+            if (keyboard_report->nkro.bits[i]) {
+                return i << 3 | biton(keyboard_report->nkro.bits[i]);
+            }
+        }
+        return 0;
     }
 #endif
 #ifdef RING_BUFFERED_6KRO_REPORT_ENABLE
@@ -291,3 +318,72 @@ __attribute__((weak)) bool has_mouse_report_changed(report_mouse_t* new_report,
     return memcmp(new_report, old_report, sizeof(report_mouse_t));
 }
 #endif
+
+static uint32_t report_cache_suppressed[REPORT_CACHE_TYPE_COUNT];
+
+static report_keyboard_t keyboard_cache;
+static bool              keyboard_cache_valid = false;
+
+/**
+ * @brief Returns whether `report` differs from the last keyboard report
+ * handed to the driver, caching it if so; counts the suppressed send
+ * otherwise.
+ */
+bool report_cache_should_send_keyboard(report_keyboard_t* report) {
+    if (keyboard_cache_valid && memcmp(report, &keyboard_cache, sizeof(report_keyboard_t)) == 0) {
+        report_cache_suppressed[REPORT_CACHE_KEYBOARD]++;
+        return false;
+    }
+    memcpy(&keyboard_cache, report, sizeof(report_keyboard_t));
+    keyboard_cache_valid = true;
+    return true;
+}
+
+static report_mouse_t mouse_cache;
+static bool           mouse_cache_valid = false;
+
+/**
+ * @brief Like report_cache_should_send_keyboard() for mouse reports, but
+ * any report carrying motion is always sent: relative axes repeat their
+ * bytes during continuous movement without being redundant.
+ */
+bool report_cache_should_send_mouse(report_mouse_t* report) {
+    if (report->x || report->y || report->v || report->h) {
+        memcpy(&mouse_cache, report, sizeof(report_mouse_t));
+        mouse_cache_valid = true;
+        return true;
+    }
+    if (mouse_cache_valid && memcmp(report, &mouse_cache, sizeof(report_mouse_t)) == 0) {
+        report_cache_suppressed[REPORT_CACHE_MOUSE]++;
+        return false;
+    }
+    memcpy(&mouse_cache, report, sizeof(report_mouse_t));
+    mouse_cache_valid = true;
+    return true;
+}
+
+void report_cache_note_suppressed(uint8_t type) {
+    if (type < REPORT_CACHE_TYPE_COUNT) {
+        report_cache_suppressed[type]++;
+    }
+}
+
+uint32_t report_cache_suppressed_count(uint8_t type) {
+    return type < REPORT_CACHE_TYPE_COUNT ? report_cache_suppressed[type] : 0;
+}
+
+void report_cache_clear(void) {
+    keyboard_cache_valid = false;
+    mouse_cache_valid    = false;
+}
+
+void report_cache_read_buffer(uint16_t offset, uint16_t size, uint8_t* data) {
+    for (uint16_t i = 0; i < size; i++) {
+        uint16_t pos = offset + i;
+        if (pos / 4 >= REPORT_CACHE_TYPE_COUNT) {
+            data[i] = 0x00;
+            continue;
+        }
+        data[i] = (report_cache_suppressed[pos / 4] >> (8 * (pos % 4))) & 0xFF;
+    }
+}
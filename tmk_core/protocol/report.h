@@ -348,6 +348,31 @@ void clear_keys_from_report(report_keyboard_t* keyboard_report);
 bool has_mouse_report_changed(report_mouse_t* new_report, report_mouse_t* old_report);
 #endif
 
+/* Report cache: host.c consults these immediately before handing a report
+ * to the driver (or Bluetooth), so byte-identical state is never re-sent
+ * regardless of which path assembled the report. Mouse reports carrying
+ * motion (x/y/v/h) are always sent, since relative axes are meaningful
+ * even when the bytes repeat. Suppressed sends are counted per type. */
+enum report_cache_type {
+    REPORT_CACHE_KEYBOARD,
+    REPORT_CACHE_MOUSE,
+    REPORT_CACHE_SYSTEM,
+    REPORT_CACHE_CONSUMER,
+    REPORT_CACHE_TYPE_COUNT,
+};
+
+bool     report_cache_should_send_keyboard(report_keyboard_t* report);
+bool     report_cache_should_send_mouse(report_mouse_t* report);
+void     report_cache_note_suppressed(uint8_t type);
+uint32_t report_cache_suppressed_count(uint8_t type);
+
+/* Invalidates the caches (e.g. after a host wake) so the next report of
+ * each type is always sent; the counters are kept. */
+void report_cache_clear(void);
+
+/* Flattened little-endian counters for the raw HID stream channel. */
+void report_cache_read_buffer(uint16_t offset, uint16_t size, uint8_t* data);
+
 #ifdef __cplusplus
 }
 #endif
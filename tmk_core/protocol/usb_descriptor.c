@@ -473,6 +473,14 @@ const USB_Descriptor_Device_t PROGMEM DeviceDescriptor = {
 #    define USB_POLLING_INTERVAL_MS 1
 #endif
 
+// The dedicated mouse endpoint may be scheduled faster than the rest of the device -- pointing device users
+// typically want the lowest possible report latency while the keyboard interface stays at its usual rate.
+// Note that full-speed USB caps interrupt endpoints at one transfer per 1ms frame; on high-speed links the
+// value is interpreted in 125us microframes by the host.
+#ifndef MOUSE_POLLING_INTERVAL_MS
+#    define MOUSE_POLLING_INTERVAL_MS USB_POLLING_INTERVAL_MS
+#endif
+
 /*
  * Configuration descriptors
  */
@@ -615,7 +623,7 @@ const USB_Descriptor_Configuration_t PROGMEM ConfigurationDescriptor = {
         .EndpointAddress        = (ENDPOINT_DIR_IN | MOUSE_IN_EPNUM),
         .Attributes             = (EP_TYPE_INTERRUPT | ENDPOINT_ATTR_NO_SYNC | ENDPOINT_USAGE_DATA),
         .EndpointSize           = MOUSE_EPSIZE,
-        .PollingIntervalMS      = USB_POLLING_INTERVAL_MS
+        .PollingIntervalMS      = MOUSE_POLLING_INTERVAL_MS
     },
 #endif
 
@@ -1089,6 +1097,57 @@ const USB_Descriptor_String_t PROGMEM SerialNumberString = {
 
 // clang-format on
 
+/*
+ * Descriptor dispatch tables
+ *
+ * String descriptor indices and HID interface numbers are both dense
+ * compile-time ranges, so dispatch is a direct index into a flash-resident
+ * table rather than a switch. The descriptors themselves already live in
+ * flash and are streamed to the control endpoint without RAM staging (LUFA
+ * via flash streaming, ChibiOS by handing the pointer straight to the USB
+ * driver); only the table pointers are read out here.
+ */
+static const USB_Descriptor_String_t* const PROGMEM string_descriptor_table[] = {
+    &LanguageString,     // 0x00
+    &ManufacturerString, // 0x01
+    &ProductString,      // 0x02
+#if defined(SERIAL_NUMBER)
+    &SerialNumberString, // 0x03
+#endif
+};
+
+typedef struct {
+    const void* hid_descriptor;
+    const void* report_descriptor;
+    uint16_t    report_size;
+} usb_hid_dispatch_entry_t;
+
+// Interfaces without a HID class descriptor (MIDI, CDC) leave zero-filled
+// entries, which dispatch as NO_DESCRIPTOR.
+static const usb_hid_dispatch_entry_t PROGMEM hid_dispatch_table[TOTAL_INTERFACES] = {
+#ifndef KEYBOARD_SHARED_EP
+    [KEYBOARD_INTERFACE] = {&ConfigurationDescriptor.Keyboard_HID, &KeyboardReport, sizeof(KeyboardReport)},
+#endif
+#if defined(MOUSE_ENABLE) && !defined(MOUSE_SHARED_EP)
+    [MOUSE_INTERFACE] = {&ConfigurationDescriptor.Mouse_HID, &MouseReport, sizeof(MouseReport)},
+#endif
+#ifdef SHARED_EP_ENABLE
+    [SHARED_INTERFACE] = {&ConfigurationDescriptor.Shared_HID, &SharedReport, sizeof(SharedReport)},
+#endif
+#ifdef RAW_ENABLE
+    [RAW_INTERFACE] = {&ConfigurationDescriptor.Raw_HID, &RawReport, sizeof(RawReport)},
+#endif
+#ifdef CONSOLE_ENABLE
+    [CONSOLE_INTERFACE] = {&ConfigurationDescriptor.Console_HID, &ConsoleReport, sizeof(ConsoleReport)},
+#endif
+#if defined(JOYSTICK_ENABLE) && !defined(JOYSTICK_SHARED_EP)
+    [JOYSTICK_INTERFACE] = {&ConfigurationDescriptor.Joystick_HID, &JoystickReport, sizeof(JoystickReport)},
+#endif
+#if defined(DIGITIZER_ENABLE) && !defined(DIGITIZER_SHARED_EP)
+    [DIGITIZER_INTERFACE] = {&ConfigurationDescriptor.Digitizer_HID, &DigitizerReport, sizeof(DigitizerReport)},
+#endif
+};
+
 /**
  * This function is called by the library when in device mode, and must be overridden (see library "USB Descriptors"
  * documentation) by the application code so that the address and size of a requested descriptor can be given
@@ -1114,29 +1173,9 @@ uint16_t get_usb_descriptor(const uint16_t wValue, const uint16_t wIndex, const
 
             break;
         case DTYPE_String:
-            switch (DescriptorIndex) {
-                case 0x00:
-                    Address = &LanguageString;
-                    Size    = pgm_read_byte(&LanguageString.Header.Size);
-
-                    break;
-                case 0x01:
-                    Address = &ManufacturerString;
-                    Size    = pgm_read_byte(&ManufacturerString.Header.Size);
-
-                    break;
-                case 0x02:
-                    Address = &ProductString;
-                    Size    = pgm_read_byte(&ProductString.Header.Size);
-
-                    break;
-#if defined(SERIAL_NUMBER)
-                case 0x03:
-                    Address = &SerialNumberString;
-                    Size    = pgm_read_byte(&SerialNumberString.Header.Size);
-
-                    break;
-#endif
+            if (DescriptorIndex < ARRAY_SIZE(string_descriptor_table)) {
+                Address = pgm_read_ptr(&string_descriptor_table[DescriptorIndex]);
+                Size    = pgm_read_byte(&((const USB_Descriptor_String_t*)Address)->Header.Size);
             }
 #ifdef OS_DETECTION_ENABLE
             process_wlength(wLength);
@@ -1144,114 +1183,20 @@ uint16_t get_usb_descriptor(const uint16_t wValue, const uint16_t wIndex, const
 
             break;
         case HID_DTYPE_HID:
-            switch (wIndex) {
-#ifndef KEYBOARD_SHARED_EP
-                case KEYBOARD_INTERFACE:
-                    Address = &ConfigurationDescriptor.Keyboard_HID;
-                    Size    = sizeof(USB_HID_Descriptor_HID_t);
-                    break;
-#endif
-
-#if defined(MOUSE_ENABLE) && !defined(MOUSE_SHARED_EP)
-                case MOUSE_INTERFACE:
-                    Address = &ConfigurationDescriptor.Mouse_HID;
-                    Size    = sizeof(USB_HID_Descriptor_HID_t);
-
-                    break;
-#endif
-
-#ifdef SHARED_EP_ENABLE
-                case SHARED_INTERFACE:
-                    Address = &ConfigurationDescriptor.Shared_HID;
-                    Size    = sizeof(USB_HID_Descriptor_HID_t);
-
-                    break;
-#endif
-
-#ifdef RAW_ENABLE
-                case RAW_INTERFACE:
-                    Address = &ConfigurationDescriptor.Raw_HID;
-                    Size    = sizeof(USB_HID_Descriptor_HID_t);
-
-                    break;
-#endif
-
-#ifdef CONSOLE_ENABLE
-                case CONSOLE_INTERFACE:
-                    Address = &ConfigurationDescriptor.Console_HID;
-                    Size    = sizeof(USB_HID_Descriptor_HID_t);
-
-                    break;
-#endif
-#if defined(JOYSTICK_ENABLE) && !defined(JOYSTICK_SHARED_EP)
-                case JOYSTICK_INTERFACE:
-                    Address = &ConfigurationDescriptor.Joystick_HID;
-                    Size    = sizeof(USB_HID_Descriptor_HID_t);
-                    break;
-#endif
-#if defined(DIGITIZER_ENABLE) && !defined(DIGITIZER_SHARED_EP)
-                case DIGITIZER_INTERFACE:
-                    Address = &ConfigurationDescriptor.Digitizer_HID;
-                    Size    = sizeof(USB_HID_Descriptor_HID_t);
-
-                    break;
-#endif
+            if (wIndex < TOTAL_INTERFACES) {
+                Address = pgm_read_ptr(&hid_dispatch_table[wIndex].hid_descriptor);
+                if (Address != NULL) {
+                    Size = sizeof(USB_HID_Descriptor_HID_t);
+                }
             }
 
             break;
         case HID_DTYPE_Report:
-            switch (wIndex) {
-#ifndef KEYBOARD_SHARED_EP
-                case KEYBOARD_INTERFACE:
-                    Address = &KeyboardReport;
-                    Size    = sizeof(KeyboardReport);
-
-                    break;
-#endif
-
-#if defined(MOUSE_ENABLE) && !defined(MOUSE_SHARED_EP)
-                case MOUSE_INTERFACE:
-                    Address = &MouseReport;
-                    Size    = sizeof(MouseReport);
-
-                    break;
-#endif
-
-#ifdef SHARED_EP_ENABLE
-                case SHARED_INTERFACE:
-                    Address = &SharedReport;
-                    Size    = sizeof(SharedReport);
-
-                    break;
-#endif
-
-#ifdef RAW_ENABLE
-                case RAW_INTERFACE:
-                    Address = &RawReport;
-                    Size    = sizeof(RawReport);
-
-                    break;
-#endif
-
-#ifdef CONSOLE_ENABLE
-                case CONSOLE_INTERFACE:
-                    Address = &ConsoleReport;
-                    Size    = sizeof(ConsoleReport);
-
-                    break;
-#endif
-#if defined(JOYSTICK_ENABLE) && !defined(JOYSTICK_SHARED_EP)
-                case JOYSTICK_INTERFACE:
-                    Address = &JoystickReport;
-                    Size    = sizeof(JoystickReport);
-                    break;
-#endif
-#if defined(DIGITIZER_ENABLE) && !defined(DIGITIZER_SHARED_EP)
-                case DIGITIZER_INTERFACE:
-                    Address = &DigitizerReport;
-                    Size    = sizeof(DigitizerReport);
-                    break;
-#endif
+            if (wIndex < TOTAL_INTERFACES) {
+                Address = pgm_read_ptr(&hid_dispatch_table[wIndex].report_descriptor);
+                if (Address != NULL) {
+                    Size = pgm_read_word(&hid_dispatch_table[wIndex].report_size);
+                }
             }
 
             break;
@@ -153,7 +153,11 @@ void protocol_task(void) {
         if (usbConfiguration && usbInterruptIsReady()) {
             keyboard_task();
         }
+        // Pre-stage the next reports while the endpoints are free so the
+        // next IN tokens are answered immediately.
+        usbPoll();
         vusb_transfer_keyboard();
+        vusb_transfer_shared();
 
 #ifdef RAW_ENABLE
         usbPoll();
@@ -16,6 +16,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include <stdint.h>
+#include <string.h>
 
 #include <avr/wdt.h>
 
@@ -100,32 +101,33 @@ static uint8_t           kbuf_tail = 0;
 
 static report_keyboard_t keyboard_report_sent;
 
-#define VUSB_TRANSFER_KEYBOARD_MAX_TRIES 10
-
-/* transfer keyboard report from buffer */
+/* transfer keyboard report from buffer
+ *
+ * Non-blocking: stages the next buffered report into the interrupt endpoint
+ * when it is free, so the IN transaction is already answered by the time the
+ * next token arrives. When the endpoint is busy the report simply stays
+ * queued; this is called every protocol_task() pass, so it is staged again
+ * within a scan loop iteration instead of stalling the scan with a retry
+ * loop here. */
 void vusb_transfer_keyboard(void) {
-    for (int i = 0; i < VUSB_TRANSFER_KEYBOARD_MAX_TRIES; i++) {
-        if (usbInterruptIsReady()) {
-            if (kbuf_head != kbuf_tail) {
+    if (!usbInterruptIsReady()) {
+        return;
+    }
+    if (kbuf_head != kbuf_tail) {
 #ifndef KEYBOARD_SHARED_EP
-                usbSetInterrupt((void *)&kbuf[kbuf_tail], sizeof(report_keyboard_t));
+        usbSetInterrupt((void *)&kbuf[kbuf_tail], sizeof(report_keyboard_t));
 #else
-                // Ugly hack! :(
-                usbSetInterrupt((void *)&kbuf[kbuf_tail], sizeof(report_keyboard_t) - 1);
-                while (!usbInterruptIsReady()) {
-                    usbPoll();
-                }
-                usbSetInterrupt((void *)(&(kbuf[kbuf_tail].keys[5])), 1);
+        // Ugly hack! :(
+        usbSetInterrupt((void *)&kbuf[kbuf_tail], sizeof(report_keyboard_t) - 1);
+        while (!usbInterruptIsReady()) {
+            usbPoll();
+        }
+        usbSetInterrupt((void *)(&(kbuf[kbuf_tail].keys[5])), 1);
 #endif
-                kbuf_tail = (kbuf_tail + 1) % KBUF_SIZE;
-                if (debug_keyboard) {
-                    dprintf("V-USB: kbuf[%d->%d](%02X)\n", kbuf_tail, kbuf_head, (kbuf_head < kbuf_tail) ? (KBUF_SIZE - kbuf_tail + kbuf_head) : (kbuf_head - kbuf_tail));
-                }
-            }
-            break;
+        kbuf_tail = (kbuf_tail + 1) % KBUF_SIZE;
+        if (debug_keyboard) {
+            dprintf("V-USB: kbuf[%d->%d](%02X)\n", kbuf_tail, kbuf_head, (kbuf_head < kbuf_tail) ? (KBUF_SIZE - kbuf_tail + kbuf_head) : (kbuf_head - kbuf_tail));
         }
-        usbPoll();
-        wait_ms(1);
     }
 }
 
@@ -267,35 +269,71 @@ static void send_keyboard(report_keyboard_t *report) {
 #    define usbSetInterruptShared usbSetInterrupt
 #endif
 
-static void send_mouse(report_mouse_t *report) {
-#ifdef MOUSE_ENABLE
+#if defined(MOUSE_ENABLE) || defined(EXTRAKEY_ENABLE) || defined(JOYSTICK_ENABLE) || defined(DIGITIZER_ENABLE)
+#    define SHARED_REPORT_STASH
+/* One-slot stash for shared-endpoint reports: when the endpoint is busy the
+ * freshest report is parked here instead of being dropped, and staged from
+ * protocol_task() as soon as the endpoint frees -- so the next IN token
+ * finds data ready. A newer report of any type overwrites the stash; the
+ * endpoint serializes them anyway and the latest state is what matters. */
+static union {
+#    ifdef MOUSE_ENABLE
+    report_mouse_t mouse;
+#    endif
+#    ifdef EXTRAKEY_ENABLE
+    report_extra_t extra;
+#    endif
+#    ifdef JOYSTICK_ENABLE
+    report_joystick_t joystick;
+#    endif
+#    ifdef DIGITIZER_ENABLE
+    report_digitizer_t digitizer;
+#    endif
+} pending_shared_report;
+static uint8_t pending_shared_length = 0;
+
+static void send_shared_report(void *report, uint8_t length) {
     if (usbInterruptIsReadyShared()) {
-        usbSetInterruptShared((void *)report, sizeof(report_mouse_t));
+        pending_shared_length = 0;
+        usbSetInterruptShared(report, length);
+    } else {
+        memcpy(&pending_shared_report, report, length);
+        pending_shared_length = length;
+    }
+}
+#endif
+
+/* stage a parked shared-endpoint report once the endpoint is free */
+void vusb_transfer_shared(void) {
+#ifdef SHARED_REPORT_STASH
+    if (pending_shared_length && usbInterruptIsReadyShared()) {
+        usbSetInterruptShared((void *)&pending_shared_report, pending_shared_length);
+        pending_shared_length = 0;
     }
 #endif
 }
 
+static void send_mouse(report_mouse_t *report) {
+#ifdef MOUSE_ENABLE
+    send_shared_report(report, sizeof(report_mouse_t));
+#endif
+}
+
 static void send_extra(report_extra_t *report) {
 #ifdef EXTRAKEY_ENABLE
-    if (usbInterruptIsReadyShared()) {
-        usbSetInterruptShared((void *)report, sizeof(report_extra_t));
-    }
+    send_shared_report(report, sizeof(report_extra_t));
 #endif
 }
 
 void send_joystick(report_joystick_t *report) {
 #ifdef JOYSTICK_ENABLE
-    if (usbInterruptIsReadyShared()) {
-        usbSetInterruptShared((void *)report, sizeof(report_joystick_t));
-    }
+    send_shared_report(report, sizeof(report_joystick_t));
 #endif
 }
 
 void send_digitizer(report_digitizer_t *report) {
 #ifdef DIGITIZER_ENABLE
-    if (usbInterruptIsReadyShared()) {
-        usbSetInterruptShared((void *)report, sizeof(report_digitizer_t));
-    }
+    send_shared_report(report, sizeof(report_digitizer_t));
 #endif
 }
 
@@ -122,3 +122,4 @@ extern bool vusb_suspended;
 
 host_driver_t *vusb_driver(void);
 void           vusb_transfer_keyboard(void);
+void           vusb_transfer_shared(void);
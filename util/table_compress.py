@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""Compresses a monotonic uint8 lookup table for quantum/table_compression.c.
+
+Reads whitespace/comma-separated values and emits the three C arrays backing
+a `compressed_table_t`: per-block delta-nibble streams, the block offset
+index, and the descriptor itself. Values must be non-decreasing; deltas of
+15 or more are encoded with continuation nibbles.
+
+Usage:
+    ./util/table_compress.py --name CIE1931_CURVE < values.txt
+"""
+import argparse
+import re
+import sys
+
+BLOCK_SIZE = 64
+
+
+def encode_block(values):
+    stream = [values[0]]
+    nibbles = []
+    for prev, curr in zip(values, values[1:]):
+        delta = curr - prev
+        if delta < 0:
+            sys.exit('error: input values must be non-decreasing')
+        while delta >= 15:
+            nibbles.append(15)
+            delta -= 15
+        nibbles.append(delta)
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    for lo, hi in zip(nibbles[0::2], nibbles[1::2]):
+        stream.append(lo | (hi << 4))
+    return stream
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--name', required=True, help='C identifier for the table')
+    parser.add_argument('infile', nargs='?', type=argparse.FileType('r'), default=sys.stdin)
+    args = parser.parse_args()
+
+    values = [int(tok, 0) for tok in re.split(r'[\s,]+', args.infile.read()) if tok]
+    if not values or any(not 0 <= v <= 255 for v in values):
+        sys.exit('error: expected one or more values in 0..255')
+
+    offsets = []
+    data = []
+    for start in range(0, len(values), BLOCK_SIZE):
+        offsets.append(len(data))
+        data.extend(encode_block(values[start:start + BLOCK_SIZE]))
+
+    print(f'// {len(values)} entries compressed to {len(data)} + {2 * len(offsets)} bytes')
+    print(f'static const uint8_t {args.name.lower()}_data[{len(data)}] PROGMEM = {{')
+    for i in range(0, len(data), 16):
+        print('    ' + ', '.join(f'0x{b:02X}' for b in data[i:i + 16]) + ',')
+    print('};')
+    print(f'static const uint16_t {args.name.lower()}_offsets[{len(offsets)}] PROGMEM = {{{", ".join(str(o) for o in offsets)}}};')
+    print(f'const compressed_table_t {args.name}_TABLE = {{{args.name.lower()}_data, {args.name.lower()}_offsets, {len(values)}}};')
+
+
+if __name__ == '__main__':
+    main()